@@ -81,14 +81,43 @@ bool RenderManager::IsRunning()
   return m_Thread && m_Thread->isRunning() && m_Running;
 }
 
-void RenderManager::AsyncInvoke(RenderManager::InvokeMethod m)
+void RenderManager::AsyncInvoke(RenderManager::InvokeMethod m, InvokePriority priority)
 {
   InvokeHandle *cmd = new InvokeHandle(m);
   cmd->selfdelete = true;
+  cmd->priority = priority;
 
   PushInvoke(cmd);
 }
 
+void RenderManager::AsyncInvoke(const QString &tag, RenderManager::InvokeMethod m,
+                                InvokePriority priority)
+{
+  InvokeHandle *cmd = new InvokeHandle(m);
+  cmd->selfdelete = true;
+  cmd->priority = priority;
+  cmd->tag = tag;
+
+  PushInvoke(cmd);
+}
+
+void RenderManager::CancelInvoke(const QString &tag)
+{
+  QMutexLocker lock(&m_RenderLock);
+
+  RemoveQueuedInvokes(tag);
+
+  if(m_CurrentInvoke && m_CurrentInvoke->tag == tag)
+    m_CurrentInvoke->cancelled = true;
+}
+
+bool RenderManager::IsInvokeCancelled()
+{
+  QMutexLocker lock(&m_RenderLock);
+
+  return m_CurrentInvoke && m_CurrentInvoke->cancelled;
+}
+
 void RenderManager::BlockInvoke(RenderManager::InvokeMethod m)
 {
   InvokeHandle *cmd = new InvokeHandle(m);
@@ -155,19 +184,53 @@ void RenderManager::PushInvoke(RenderManager::InvokeHandle *cmd)
 {
   if(m_Thread == NULL || !m_Thread->isRunning() || !m_Running)
   {
-    if(cmd->selfdelete)
-      delete cmd;
-    else
-      cmd->processed.release();
+    FinishInvoke(cmd);
     return;
   }
 
   m_RenderLock.lock();
-  m_RenderQueue.push_back(cmd);
+  // anything queued with the same tag has been superseded by this command
+  if(!cmd->tag.isEmpty())
+    RemoveQueuedInvokes(cmd->tag);
+  m_RenderQueue[(int)cmd->priority].push_back(cmd);
   m_RenderCondition.wakeAll();
   m_RenderLock.unlock();
 }
 
+RenderManager::InvokeHandle *RenderManager::PopInvoke()
+{
+  for(QQueue<InvokeHandle *> &queue : m_RenderQueue)
+  {
+    if(!queue.isEmpty())
+      return queue.dequeue();
+  }
+
+  return NULL;
+}
+
+void RenderManager::RemoveQueuedInvokes(const QString &tag)
+{
+  for(QQueue<InvokeHandle *> &queue : m_RenderQueue)
+  {
+    for(int i = 0; i < queue.count();)
+    {
+      if(queue[i]->tag == tag)
+        FinishInvoke(queue.takeAt(i));
+      else
+        i++;
+    }
+  }
+}
+
+void RenderManager::FinishInvoke(RenderManager::InvokeHandle *cmd)
+{
+  // if it's a throwaway command, delete it
+  if(cmd->selfdelete)
+    delete cmd;
+  else
+    cmd->processed.release();
+}
+
 void RenderManager::run()
 {
   IReplayRenderer *renderer = NULL;
@@ -184,52 +247,42 @@ void RenderManager::run()
   // main render command loop
   while(m_Running)
   {
-    QQueue<InvokeHandle *> queue;
+    InvokeHandle *cmd = NULL;
 
-    // wait for the condition to be woken, grab current queue,
-    // unlock again.
+    // take commands one at a time rather than the whole queue, so that anything queued while a
+    // command runs can still supersede older work or jump ahead of it by priority. Only wait for
+    // the condition when there's nothing to do.
     {
       m_RenderLock.lock();
-      m_RenderCondition.wait(&m_RenderLock, 10);
-      m_RenderQueue.swap(queue);
+      cmd = PopInvoke();
+      if(cmd == NULL)
+      {
+        m_RenderCondition.wait(&m_RenderLock, 10);
+        cmd = PopInvoke();
+      }
+      m_CurrentInvoke = cmd;
       m_RenderLock.unlock();
     }
 
-    // process all the commands
-    for(InvokeHandle *cmd : queue)
-    {
-      if(cmd == NULL)
-        continue;
+    if(cmd == NULL)
+      continue;
 
-      if(cmd->method != NULL)
-        cmd->method(renderer);
+    if(cmd->method != NULL)
+      cmd->method(renderer);
 
-      // if it's a throwaway command, delete it
-      if(cmd->selfdelete)
-        delete cmd;
-      else
-        cmd->processed.release();
-    }
+    m_RenderLock.lock();
+    m_CurrentInvoke = NULL;
+    m_RenderLock.unlock();
+
+    FinishInvoke(cmd);
   }
 
   // clean up anything left in the queue
   {
-    QQueue<InvokeHandle *> queue;
-
     m_RenderLock.lock();
-    m_RenderQueue.swap(queue);
+    for(InvokeHandle *cmd = PopInvoke(); cmd; cmd = PopInvoke())
+      FinishInvoke(cmd);
     m_RenderLock.unlock();
-
-    for(InvokeHandle *cmd : queue)
-    {
-      if(cmd == NULL)
-        continue;
-
-      if(cmd->selfdelete)
-        delete cmd;
-      else
-        cmd->processed.release();
-    }
   }
 
   // close the core renderer
@@ -38,9 +38,17 @@
 struct IReplayRenderer;
 class LambdaThread;
 
-// simple helper for the common case of 'we just need to run this on the render thread
-#define INVOKE_MEMFN(function) \
-  m_Ctx->Renderer()->AsyncInvoke([this](IReplayRenderer *r) { function(r); });
+// simple helper for the common case of 'we just need to run this on the render thread. These
+// functions always work from the current state, so a call that's still queued is replaced by a
+// newer one from the same object.
+#define INVOKE_MEMFN(function)                                                                    \
+  m_Ctx->Renderer()->AsyncInvoke(RenderManager::MakeInvokeTag(this, #function),                  \
+                                 [this](IReplayRenderer *r) { function(r); });
+
+#define INVOKE_MEMFN_PRIORITY(function, priority)                                                 \
+  m_Ctx->Renderer()->AsyncInvoke(RenderManager::MakeInvokeTag(this, #function),                  \
+                                 [this](IReplayRenderer *r) { function(r); },                     \
+                                 RenderManager::InvokePriority::priority);
 
 struct EnvironmentModification
 {
@@ -120,6 +128,23 @@ class RenderManager
 public:
   typedef std::function<void(IReplayRenderer *)> InvokeMethod;
 
+  // invokes run in order of priority, and in the order they were queued within each priority.
+  enum class InvokePriority
+  {
+    // direct responses to user input like picking, that should jump ahead of anything else queued
+    Interactive,
+    Normal,
+    // bulk fetches and periodic polling that can wait until everything else is done
+    Background,
+
+    Count,
+  };
+
+  static QString MakeInvokeTag(const void *owner, const char *name)
+  {
+    return QString("%1:%2").arg((quintptr)owner, 0, 16).arg(QString::fromLatin1(name));
+  }
+
   RenderManager();
   ~RenderManager();
 
@@ -128,9 +153,21 @@ public:
 
   bool IsRunning();
   ReplayCreateStatus GetCreateStatus() { return m_CreateStatus; }
-  void AsyncInvoke(InvokeMethod m);
+  void AsyncInvoke(InvokeMethod m, InvokePriority priority = InvokePriority::Normal);
   void BlockInvoke(InvokeMethod m);
 
+  // a tagged invoke replaces any invoke with the same tag that hasn't started running yet, since
+  // its result would be out of date by the time it ran.
+  void AsyncInvoke(const QString &tag, InvokeMethod m,
+                   InvokePriority priority = InvokePriority::Normal);
+
+  // drops any queued invokes with this tag. If one is currently running, it's flagged so that it
+  // can stop early by checking IsInvokeCancelled() between steps.
+  void CancelInvoke(const QString &tag);
+
+  // only valid on the render thread, inside an invoke
+  bool IsInvokeCancelled();
+
   void CloseThread();
 
   uint32_t ExecuteAndInject(const QString &exe, const QString &workingDir, const QString &cmdLine,
@@ -144,20 +181,31 @@ private:
     {
       method = m;
       selfdelete = false;
+      cancelled = false;
+      priority = InvokePriority::Normal;
     }
 
     InvokeMethod method;
     QSemaphore processed;
     bool selfdelete;
+    bool cancelled;
+    QString tag;
+    InvokePriority priority;
   };
 
   void run();
 
   QMutex m_RenderLock;
-  QQueue<InvokeHandle *> m_RenderQueue;
+  QQueue<InvokeHandle *> m_RenderQueue[(int)InvokePriority::Count];
   QWaitCondition m_RenderCondition;
 
+  // the invoke being executed on the render thread, if any. Protected by m_RenderLock
+  InvokeHandle *m_CurrentInvoke = NULL;
+
   void PushInvoke(InvokeHandle *cmd);
+  InvokeHandle *PopInvoke();
+  void RemoveQueuedInvokes(const QString &tag);
+  void FinishInvoke(InvokeHandle *cmd);
 
   int m_ProxyRenderer;
   QString m_ReplayHost;
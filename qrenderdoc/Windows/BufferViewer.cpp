@@ -26,7 +26,9 @@
 #include <QDoubleSpinBox>
 #include <QFontDatabase>
 #include <QMouseEvent>
+#include <QPointer>
 #include <QScrollBar>
+#include <QSet>
 #include <QTimer>
 #include "ui_BufferViewer.h"
 
@@ -300,34 +302,157 @@ private:
   FloatVector m_Position, m_Rotation;
 };
 
+// Large buffers aren't fetched in one go, the contents are read from the replay a page of elements
+// at a time as rows become visible. Only the most recently used pages are kept around. Pages and
+// the amount kept are sized in bytes, so a buffer with a large stride doesn't fetch or hold any
+// more memory than one with a small stride.
+class BufferPager
+{
+public:
+  // pages hold as many whole elements as fit in this, but always at least one
+  static const uint64_t PageBytes = 64 * 1024;
+  // older pages are dropped once the resident pages add up to more than this
+  static const uint64_t MaxResidentBytes = 16 * 1024 * 1024;
+
+  // size must be the real size of the range, pages past it are never fetched
+  BufferPager(ResourceId id, uint64_t offset, uint64_t size, size_t stride)
+      : m_ID(id), m_Offset(offset), m_Size(size), m_Stride(stride)
+  {
+    m_ElementsPerPage = (uint32_t)qMax<uint64_t>(1, PageBytes / stride);
+    m_ResidentBytes = 0;
+  }
+
+  ResourceId id() const { return m_ID; }
+  uint32_t pageForElement(uint32_t element) const { return element / m_ElementsPerPage; }
+  uint64_t pageOffset(uint32_t page) const { return m_Offset + pageByteSize() * page; }
+  uint64_t pageLength(uint32_t page) const
+  {
+    uint64_t start = pageByteSize() * page;
+
+    if(start >= m_Size)
+      return 0;
+
+    return qMin(pageByteSize(), m_Size - start);
+  }
+
+  // returns the element's data and the end of the page it's in, or false if the page needs to be
+  // fetched first.
+  bool getElement(uint32_t element, const byte *&data, const byte *&end)
+  {
+    uint32_t page = pageForElement(element);
+
+    auto it = m_Pages.find(page);
+    if(it == m_Pages.end())
+      return false;
+
+    // move to the back as most recently used
+    if(m_LRU.back() != page)
+    {
+      m_LRU.removeOne(page);
+      m_LRU.push_back(page);
+    }
+
+    const QByteArray &bytes = it.value();
+
+    data = (const byte *)bytes.data() + (element % m_ElementsPerPage) * m_Stride;
+    end = (const byte *)bytes.data() + bytes.size();
+    return true;
+  }
+
+  bool needsFetch(uint32_t page) const
+  {
+    return pageLength(page) > 0 && !m_Pages.contains(page) && !m_Pending.contains(page);
+  }
+  void markPending(uint32_t page) { m_Pending.insert(page); }
+  void insertPage(uint32_t page, const QByteArray &bytes)
+  {
+    m_Pending.remove(page);
+
+    if(m_Pages.contains(page))
+      return;
+
+    while(!m_LRU.isEmpty() && m_ResidentBytes + bytes.size() > MaxResidentBytes)
+    {
+      uint32_t evict = m_LRU.takeFirst();
+      m_ResidentBytes -= m_Pages[evict].size();
+      m_Pages.remove(evict);
+    }
+
+    m_Pages[page] = bytes;
+    m_LRU.push_back(page);
+    m_ResidentBytes += bytes.size();
+  }
+
+private:
+  uint64_t pageByteSize() const { return uint64_t(m_Stride) * m_ElementsPerPage; }
+  ResourceId m_ID;
+  uint64_t m_Offset;
+  uint64_t m_Size;
+  size_t m_Stride;
+  uint32_t m_ElementsPerPage;
+  uint64_t m_ResidentBytes;
+
+  QHash<uint32_t, QByteArray> m_Pages;
+  QList<uint32_t> m_LRU;
+  QSet<uint32_t> m_Pending;
+};
+
 struct BufferData
 {
   BufferData()
   {
     data = end = NULL;
     stride = 0;
+    pager = NULL;
   }
 
   byte *data;
   byte *end;
   size_t stride;
+
+  // if set, data is NULL and the contents are fetched on demand
+  BufferPager *pager;
 };
 
 class BufferItemModel : public QAbstractItemModel
 {
 public:
-  BufferItemModel(RDTableView *v, QObject *parent) : QAbstractItemModel(parent)
+  BufferItemModel(CaptureContext *ctx, RDTableView *v, QObject *parent)
+      : QAbstractItemModel(parent), m_Ctx(ctx)
   {
     view = v;
     view->setModel(this);
   }
-  void beginReset() { emit beginResetModel(); }
+  void beginReset()
+  {
+    // any pages still in flight are for the old data
+    m_PageGeneration++;
+    m_Resetting = true;
+    emit beginResetModel();
+  }
   void endReset()
   {
     cacheColumns();
     m_ColumnCount = columnLookup.count() + reservedColumnCount();
+    m_FormattedPages.clear();
+    m_FormattedLRU.clear();
+    m_IncompletePages.clear();
+    m_Resetting = false;
     emit endResetModel();
   }
+  void clearBuffers()
+  {
+    delete[] indices.data;
+    indices = BufferData();
+
+    for(auto vb : buffers)
+    {
+      delete[] vb.data;
+      delete vb.pager;
+    }
+
+    buffers.clear();
+  }
   QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override
   {
     if(row < 0 || row >= rowCount())
@@ -410,103 +535,83 @@ public:
 
           uint32_t idx = row;
 
-          if(indices.data)
+          if(!rowIndex(row, idx))
+            return QVariant();
+
+          if(col == 1 && meshView)
+            return idx;
+
+          const QVector<QString> *page = formattedPage(row / RowsPerFormattedPage);
+
+          if(page)
           {
-            byte *idxData = indices.data + row * sizeof(uint32_t);
-            if(idxData + 1 > indices.end)
-              return QVariant();
+            int dataCols = m_ColumnCount - reservedColumnCount();
+            int pageRow = row % RowsPerFormattedPage;
 
-            idx = *(uint32_t *)idxData;
+            return page->at(pageRow * dataCols + col - reservedColumnCount());
           }
+        }
+      }
+    }
 
-          if(col == 1 && meshView)
-            return idx;
+    return QVariant();
+  }
 
-          const FormatElement &el = columnForIndex(col);
+  // fetches any pages for the visible rows along with a margin either side, so that scrolling a
+  // short distance doesn't wait on the replay.
+  void prefetchVisible()
+  {
+    // the buffers are filled in on the render thread during a reset
+    if(m_Resetting || numRows == 0 || buffers.isEmpty())
+      return;
 
-          uint32_t instIdx = 0;
-          if(el.instancerate > 0)
-            instIdx = curInstance / el.instancerate;
+    int first = view->rowAt(0);
+    int last = view->rowAt(view->viewport()->height());
 
-          if(el.buffer < buffers.size())
-          {
-            const byte *data = buffers[el.buffer].data;
-            const byte *end = buffers[el.buffer].end;
+    if(first < 0)
+      first = 0;
+    if(last < 0)
+      last = numRows - 1;
 
-            if(!el.perinstance)
-              data += buffers[el.buffer].stride * idx;
-            else
-              data += buffers[el.buffer].stride * instIdx;
+    int margin = qMax(last - first, (int)RowsPerFormattedPage);
 
-            data += el.offset;
+    first = qMax(0, first - margin);
+    last = qMin((int)numRows - 1, last + margin);
 
-            // only slightly wasteful, we need to fetch all variants together
-            // since some formats are packed and can't be read individually
-            QVariantList list = el.GetVariants(data, end);
+    for(int b = 0; b < buffers.count(); b++)
+    {
+      BufferPager *pager = buffers[b].pager;
 
-            int comp = componentForIndex(col);
+      if(!pager)
+        continue;
 
-            if(comp < list.count())
-            {
-              QVariant &v = list[comp];
-
-              QString ret;
-
-              QMetaType::Type vt = (QMetaType::Type)v.type();
-
-              if(vt == QMetaType::Double)
-              {
-                double d = v.toDouble();
-                // pad with space on left if sign is missing, to better align
-                if(d < 0.0)
-                  ret = Formatter::Format(d);
-                else if(d > 0.0)
-                  ret = " " + Formatter::Format(d);
-                else if(qIsNaN(d))
-                  ret = " NaN";
-                else
-                  // force negative and positive 0 together
-                  ret = " " + Formatter::Format(0.0);
-              }
-              else if(vt == QMetaType::Float)
-              {
-                float f = v.toFloat();
-                // pad with space on left if sign is missing, to better align
-                if(f < 0.0)
-                  ret = Formatter::Format(f);
-                else if(f > 0.0)
-                  ret = " " + Formatter::Format(f);
-                else if(qIsNaN(f))
-                  ret = " NaN";
-                else
-                  // force negative and positive 0 together
-                  ret = " " + Formatter::Format(0.0);
-              }
-              else if(vt == QMetaType::UInt || vt == QMetaType::UShort || vt == QMetaType::UChar)
-              {
-                ret = Formatter::Format(v.toUInt(), el.hex);
-              }
-              else if(vt == QMetaType::Int || vt == QMetaType::Short || vt == QMetaType::SChar)
-              {
-                int i = v.toInt();
-                if(i > 0)
-                  ret = " " + Formatter::Format(i);
-                else
-                  ret = Formatter::Format(i);
-              }
-              else
-                ret = v.toString();
-
-              return ret;
-            }
-          }
-        }
+      bool pervertex = false;
+
+      for(const FormatElement &el : columns)
+      {
+        if(el.buffer != b)
+          continue;
+
+        // instanced data is only ever read for the current instance
+        if(el.perinstance)
+          requestPage(pager, pager->pageForElement(instanceElement(el)));
+        else
+          pervertex = true;
       }
-    }
 
-    return QVariant();
+      if(!pervertex)
+        continue;
+
+      for(int row = first; row <= last; row++)
+      {
+        uint32_t idx = row;
+        if(rowIndex(row, idx))
+          requestPage(pager, pager->pageForElement(idx));
+      }
+    }
   }
 
+  RDTableView *view = NULL;
   RDTableView *view = NULL;
 
   uint32_t curInstance = 0;
@@ -517,6 +622,265 @@ public:
   QList<BufferData> buffers;
 
 private:
+  static const uint32_t RowsPerFormattedPage = 256;
+  static const int MaxFormattedPages = 32;
+
+  CaptureContext *m_Ctx;
+
+  // incremented on every reset, so that pages fetched for the old data can be dropped
+  int m_PageGeneration = 0;
+  bool m_Resetting = false;
+
+  // the text for every data cell, formatted a page of rows at a time. Pages that were formatted
+  // while some of their data was still being fetched are discarded when it arrives.
+  mutable QHash<uint32_t, QVector<QString>> m_FormattedPages;
+  mutable QList<uint32_t> m_FormattedLRU;
+  mutable QSet<uint32_t> m_IncompletePages;
+
+  bool rowIndex(uint32_t row, uint32_t &idx) const
+  {
+    idx = row;
+
+    if(indices.data)
+    {
+      byte *idxData = indices.data + row * sizeof(uint32_t);
+      if(idxData + 1 > indices.end)
+        return false;
+
+      idx = *(uint32_t *)idxData;
+    }
+
+    return true;
+  }
+
+  uint32_t instanceElement(const FormatElement &el) const
+  {
+    if(el.instancerate > 0)
+      return curInstance / el.instancerate;
+
+    return 0;
+  }
+
+  // returns false if there's no data for the element. If that's because it hasn't been fetched
+  // yet, pending is set and the fetch is started.
+  bool elementData(const FormatElement &el, uint32_t idx, const byte *&data, const byte *&end,
+                   bool &pending) const
+  {
+    if(el.buffer < 0 || el.buffer >= buffers.size())
+      return false;
+
+    const BufferData &buf = buffers[el.buffer];
+
+    uint32_t element = el.perinstance ? instanceElement(el) : idx;
+
+    if(buf.pager)
+    {
+      if(!buf.pager->getElement(element, data, end))
+      {
+        requestPage(buf.pager, buf.pager->pageForElement(element));
+        pending = true;
+        return false;
+      }
+
+      data += el.offset;
+      return true;
+    }
+
+    data = buf.data + buf.stride * element + el.offset;
+    end = buf.end;
+    return true;
+  }
+
+  void requestPage(BufferPager *pager, uint32_t page) const
+  {
+    if(!pager->needsFetch(page))
+      return;
+
+    pager->markPending(page);
+
+    ResourceId id = pager->id();
+    uint64_t offset = pager->pageOffset(page);
+    uint64_t length = pager->pageLength(page);
+    int generation = m_PageGeneration;
+
+    // the fetch doesn't change what the model contains, only how soon it can be displayed
+    QPointer<BufferItemModel> me(const_cast<BufferItemModel *>(this));
+
+    m_Ctx->Renderer()->AsyncInvoke(
+        [me, pager, page, generation, id, offset, length](IReplayRenderer *r) {
+          rdctype::array<byte> data;
+          r->GetBufferData(id, offset, length, &data);
+
+          QByteArray bytes((const char *)data.elems, data.count);
+
+          GUIInvoke::call([me, pager, page, generation, bytes]() {
+            if(me)
+              me->pageFetched(pager, page, generation, bytes);
+          });
+        },
+        RenderManager::InvokePriority::Background);
+  }
+
+  void pageFetched(BufferPager *pager, uint32_t page, int generation, const QByteArray &bytes)
+  {
+    if(generation != m_PageGeneration)
+      return;
+
+    pager->insertPage(page, bytes);
+
+    // only rows that were formatted while data was missing can be showing blanks for this page,
+    // whether they map to its elements directly, by index or by instance. They're taken first as
+    // re-formatting on dataChanged can mark pages incomplete again.
+    QSet<uint32_t> incomplete;
+    incomplete.swap(m_IncompletePages);
+
+    for(uint32_t p : incomplete)
+    {
+      m_FormattedPages.remove(p);
+      m_FormattedLRU.removeOne(p);
+    }
+
+    if(m_ColumnCount == 0)
+      return;
+
+    for(uint32_t p : incomplete)
+    {
+      uint32_t firstRow = p * RowsPerFormattedPage;
+      uint32_t lastRow = qMin(numRows, firstRow + RowsPerFormattedPage);
+
+      if(firstRow < lastRow)
+        emit dataChanged(index(firstRow, 0), index(lastRow - 1, m_ColumnCount - 1));
+    }
+  }
+
+  const QVector<QString> *formattedPage(uint32_t page) const
+  {
+    auto it = m_FormattedPages.find(page);
+    if(it != m_FormattedPages.end())
+    {
+      if(m_FormattedLRU.back() != page)
+      {
+        m_FormattedLRU.removeOne(page);
+        m_FormattedLRU.push_back(page);
+      }
+
+      return &it.value();
+    }
+
+    int dataCols = m_ColumnCount - reservedColumnCount();
+    uint32_t firstRow = page * RowsPerFormattedPage;
+    uint32_t lastRow = qMin(numRows, firstRow + RowsPerFormattedPage);
+
+    QVector<QString> text(RowsPerFormattedPage * dataCols);
+
+    bool pending = false;
+
+    for(uint32_t row = firstRow; row < lastRow; row++)
+    {
+      uint32_t idx = row;
+
+      if(!rowIndex(row, idx))
+        continue;
+
+      QString *rowText = text.data() + (row - firstRow) * dataCols;
+
+      int c = 0;
+      while(c < dataCols)
+      {
+        const FormatElement &el = columns[columnLookup[c]];
+
+        int numComps = 1;
+        while(c + numComps < dataCols && columnLookup[c + numComps] == columnLookup[c])
+          numComps++;
+
+        const byte *data = NULL;
+        const byte *end = NULL;
+
+        // all components are decoded together, since some formats are packed and can't be read
+        // individually
+        if(elementData(el, idx, data, end, pending))
+        {
+          QVariantList list = el.GetVariants(data, end);
+
+          for(int i = 0; i < numComps; i++)
+          {
+            int comp = componentLookup[c + i];
+
+            if(comp < list.count())
+              rowText[i + c] = formatVariant(list[comp], el.hex);
+          }
+        }
+
+        c += numComps;
+      }
+    }
+
+    // the blanks are filled in once the missing data arrives
+    if(pending)
+      m_IncompletePages.insert(page);
+
+    while(m_FormattedLRU.count() >= MaxFormattedPages)
+    {
+      m_IncompletePages.remove(m_FormattedLRU.front());
+      m_FormattedPages.remove(m_FormattedLRU.takeFirst());
+    }
+
+    m_FormattedLRU.push_back(page);
+    return &(m_FormattedPages[page] = text);
+  }
+
+  static QString formatVariant(const QVariant &v, bool hex)
+  {
+    QString ret;
+
+    QMetaType::Type vt = (QMetaType::Type)v.type();
+
+    if(vt == QMetaType::Double)
+    {
+      double d = v.toDouble();
+      // pad with space on left if sign is missing, to better align
+      if(d < 0.0)
+        ret = Formatter::Format(d);
+      else if(d > 0.0)
+        ret = " " + Formatter::Format(d);
+      else if(qIsNaN(d))
+        ret = " NaN";
+      else
+        // force negative and positive 0 together
+        ret = " " + Formatter::Format(0.0);
+    }
+    else if(vt == QMetaType::Float)
+    {
+      float f = v.toFloat();
+      // pad with space on left if sign is missing, to better align
+      if(f < 0.0)
+        ret = Formatter::Format(f);
+      else if(f > 0.0)
+        ret = " " + Formatter::Format(f);
+      else if(qIsNaN(f))
+        ret = " NaN";
+      else
+        // force negative and positive 0 together
+        ret = " " + Formatter::Format(0.0);
+    }
+    else if(vt == QMetaType::UInt || vt == QMetaType::UShort || vt == QMetaType::UChar)
+    {
+      ret = Formatter::Format(v.toUInt(), hex);
+    }
+    else if(vt == QMetaType::Int || vt == QMetaType::Short || vt == QMetaType::SChar)
+    {
+      int i = v.toInt();
+      if(i > 0)
+        ret = " " + Formatter::Format(i);
+      else
+        ret = Formatter::Format(i);
+    }
+    else
+      ret = v.toString();
+
+    return ret;
+  }
+
   // maps from column number (0-based from data, so excluding VTX/IDX columns)
   // to the column element in the columns list, and lists its component.
   //
@@ -582,14 +946,39 @@ private:
   }
 };
 
+// buffers are paged in by element as they're displayed. Without a stride there's no way to split
+// them up, and without a size there's no way to know where the pages end, so in either case the
+// whole range is read immediately instead.
+static BufferData MakeBufferData(IReplayRenderer *r, ResourceId id, uint64_t offset, uint64_t size,
+                                 size_t stride)
+{
+  BufferData ret;
+  ret.stride = stride;
+
+  if(stride > 0 && size > 0)
+  {
+    ret.pager = new BufferPager(id, offset, size, stride);
+    return ret;
+  }
+
+  rdctype::array<byte> data;
+  r->GetBufferData(id, offset, size, &data);
+
+  ret.data = new byte[data.count];
+  memcpy(ret.data, data.elems, data.count);
+  ret.end = ret.data + data.count;
+
+  return ret;
+}
+
 BufferViewer::BufferViewer(CaptureContext *ctx, bool meshview, QWidget *parent)
     : QFrame(parent), ui(new Ui::BufferViewer), m_Ctx(ctx)
 {
   ui->setupUi(this);
 
-  m_ModelVSIn = new BufferItemModel(ui->vsinData, this);
-  m_ModelVSOut = new BufferItemModel(ui->vsoutData, this);
-  m_ModelGSOut = new BufferItemModel(ui->gsoutData, this);
+  m_ModelVSIn = new BufferItemModel(m_Ctx, ui->vsinData, this);
+  m_ModelVSOut = new BufferItemModel(m_Ctx, ui->vsoutData, this);
+  m_ModelGSOut = new BufferItemModel(m_Ctx, ui->gsoutData, this);
 
   m_Flycam = new FlycamWrapper();
   m_Arcball = new ArcballWrapper();
@@ -752,15 +1141,9 @@ void BufferViewer::SetupMeshView()
 
 BufferViewer::~BufferViewer()
 {
-  delete[] m_ModelVSIn->indices.data;
-
-  for(auto vb : m_ModelVSIn->buffers)
-    delete[] vb.data;
-
-  delete[] m_ModelVSOut->indices.data;
-
-  for(auto vb : m_ModelVSOut->buffers)
-    delete[] vb.data;
+  m_ModelVSIn->clearBuffers();
+  m_ModelVSOut->clearBuffers();
+  m_ModelGSOut->clearBuffers();
 
   delete m_Arcball;
   delete m_Flycam;
@@ -840,7 +1223,18 @@ void BufferViewer::OnEventChanged(uint32_t eventID)
   if(m_MeshView)
     ConfigureMeshColumns();
 
-  m_Ctx->Renderer()->AsyncInvoke([this, vsinHoriz, vsoutHoriz, gsoutHoriz](IReplayRenderer *r) {
+  // work out how much of the buffer is being viewed, so rows can be fetched as they're needed
+  // rather than reading the whole thing up front.
+  uint64_t byteSize = m_ByteSize;
+  if(!m_MeshView && m_IsBuffer)
+  {
+    FetchBuffer *buf = m_Ctx->GetBuffer(m_BufferID);
+    if(buf)
+      byteSize = qMin(byteSize, buf->length > m_ByteOffset ? buf->length - m_ByteOffset : 0);
+  }
+
+  m_Ctx->Renderer()->AsyncInvoke([this, byteSize, vsinHoriz, vsoutHoriz,
+                                  gsoutHoriz](IReplayRenderer *r) {
 
     if(m_MeshView)
     {
@@ -848,33 +1242,37 @@ void BufferViewer::OnEventChanged(uint32_t eventID)
     }
     else
     {
+      m_ModelVSIn->clearBuffers();
+
+      // calculate tight stride
+      size_t stride = 0;
+      for(const FormatElement &el : m_ModelVSIn->columns)
+        stride += el.byteSize();
+
+      stride = qMax((size_t)1, stride);
+
       BufferData buf = {};
-      rdctype::array<byte> data;
-      if(m_IsBuffer)
+      if(m_IsBuffer && byteSize != UINT64_MAX)
       {
-        uint64_t len = m_ByteSize;
-        if(len == UINT64_MAX)
-          len = 0;
+        buf = MakeBufferData(r, m_BufferID, m_ByteOffset, byteSize, stride);
 
-        r->GetBufferData(m_BufferID, m_ByteOffset, len, &data);
+        m_ModelVSIn->numRows = uint32_t((byteSize + stride - 1) / stride);
       }
       else
       {
-        r->GetTextureData(m_BufferID, m_TexArrayIdx, m_TexMip, &data);
-      }
-
-      buf.data = new byte[data.count];
-      memcpy(buf.data, data.elems, data.count);
-      buf.end = buf.data + data.count;
-
-      // calculate tight stride
-      buf.stride = 0;
-      for(const FormatElement &el : m_ModelVSIn->columns)
-        buf.stride += el.byteSize();
+        rdctype::array<byte> data;
+        if(m_IsBuffer)
+          r->GetBufferData(m_BufferID, m_ByteOffset, 0, &data);
+        else
+          r->GetTextureData(m_BufferID, m_TexArrayIdx, m_TexMip, &data);
 
-      buf.stride = qMax((size_t)1, buf.stride);
+        buf.data = new byte[data.count];
+        memcpy(buf.data, data.elems, data.count);
+        buf.end = buf.data + data.count;
+        buf.stride = stride;
 
-      m_ModelVSIn->numRows = uint32_t((data.count + buf.stride - 1) / buf.stride);
+        m_ModelVSIn->numRows = uint32_t((data.count + buf.stride - 1) / buf.stride);
+      }
 
       m_ModelVSIn->buffers.push_back(buf);
     }
@@ -900,6 +1298,10 @@ void BufferViewer::OnEventChanged(uint32_t eventID)
       ScrollToRow(m_ModelVSOut, ui->rowOffset->value());
       ScrollToRow(m_ModelGSOut, ui->rowOffset->value());
 
+      m_ModelVSIn->prefetchVisible();
+      m_ModelVSOut->prefetchVisible();
+      m_ModelGSOut->prefetchVisible();
+
       ui->vsinData->horizontalScrollBar()->setValue(vsinHoriz);
       ui->vsoutData->horizontalScrollBar()->setValue(vsoutHoriz);
       ui->gsoutData->horizontalScrollBar()->setValue(gsoutHoriz);
@@ -1012,16 +1414,8 @@ void BufferViewer::RT_FetchMeshData(IReplayRenderer *r)
 
     BufferData buf = {};
     if(used)
-    {
-      rdctype::array<byte> bufdata;
-      r->GetBufferData(vb.Buffer, vb.ByteOffset + offset * vb.ByteStride,
-                       (maxIdx + 1) * vb.ByteStride, &bufdata);
-
-      buf.data = new byte[bufdata.count];
-      memcpy(buf.data, bufdata.elems, bufdata.count);
-      buf.end = buf.data + bufdata.count;
-      buf.stride = vb.ByteStride;
-    }
+      buf = MakeBufferData(r, vb.Buffer, vb.ByteOffset + offset * vb.ByteStride,
+                           uint64_t(maxIdx + 1) * vb.ByteStride, vb.ByteStride);
     m_ModelVSIn->buffers.push_back(buf);
   }
 
@@ -1037,7 +1431,7 @@ void BufferViewer::RT_FetchMeshData(IReplayRenderer *r)
   m_ModelVSOut->indices = BufferData();
   if(draw && draw->indexByteWidth != 0 && idata.count != 0)
   {
-    indices = new uint32_t[draw->numIndices];
+    indices = new uint32_t[draw->numIndices]();
     m_ModelVSOut->indices.data = (byte *)indices;
     m_ModelVSOut->indices.end = (byte *)(indices + draw->numIndices);
   }
@@ -1064,15 +1458,19 @@ void BufferViewer::RT_FetchMeshData(IReplayRenderer *r)
 
   if(m_PostVS.buf != ResourceId())
   {
-    BufferData postvs = {};
-    rdctype::array<byte> bufdata;
-    r->GetBufferData(m_PostVS.buf, m_PostVS.offset, 0, &bufdata);
+    // the output holds every vertex the rows can reference, which is either one per row or up to
+    // the highest index.
+    uint32_t numElements = m_PostVS.numVerts;
+    if(indices)
+    {
+      numElements = 0;
+      for(uint32_t i = 0; i < draw->numIndices; i++)
+        numElements = qMax(numElements, indices[i] + 1);
+    }
 
-    postvs.data = new byte[bufdata.count];
-    memcpy(postvs.data, bufdata.elems, bufdata.count);
-    postvs.end = postvs.data + bufdata.count;
-    postvs.stride = m_PostVS.stride;
-    m_ModelVSOut->buffers.push_back(postvs);
+    m_ModelVSOut->buffers.push_back(MakeBufferData(r, m_PostVS.buf, m_PostVS.offset,
+                                                   uint64_t(numElements) * m_PostVS.stride,
+                                                   m_PostVS.stride));
   }
 }
 
@@ -1464,14 +1862,7 @@ void BufferViewer::ClearModels()
 
     m->beginReset();
 
-    delete[] m->indices.data;
-
-    m->indices = BufferData();
-
-    for(auto vb : m->buffers)
-      delete[] vb.data;
-
-    m->buffers.clear();
+    m->clearBuffers();
     m->columns.clear();
     m->numRows = 0;
 
@@ -1578,6 +1969,10 @@ void BufferViewer::data_selected(const QItemSelection &selected, const QItemSele
 void BufferViewer::data_scrolled(int scrollvalue)
 {
   SyncViews(qobject_cast<RDTableView *>(QObject::sender()), false, true);
+
+  m_ModelVSIn->prefetchVisible();
+  m_ModelVSOut->prefetchVisible();
+  m_ModelGSOut->prefetchVisible();
 }
 
 void BufferViewer::camGuess_changed(double value)
@@ -72,6 +72,7 @@ QVariantMap CaptureSettings::toJSON() const
   opts["SaveAllInitials"] = Options.SaveAllInitials;
   opts["CaptureAllCmdLists"] = Options.CaptureAllCmdLists;
   opts["DebugOutputMute"] = Options.DebugOutputMute;
+  opts["CallstackUnwinder"] = Options.CallstackUnwinder;
   ret["Options"] = opts;
 
   return ret;
@@ -107,6 +108,7 @@ void CaptureSettings::fromJSON(const QVariantMap &data)
   Options.SaveAllInitials = opts["SaveAllInitials"].toBool();
   Options.CaptureAllCmdLists = opts["CaptureAllCmdLists"].toBool();
   Options.DebugOutputMute = opts["DebugOutputMute"].toBool();
+  Options.CallstackUnwinder = opts["CallstackUnwinder"].toUInt();
 }
 
 CaptureDialog::CaptureDialog(CaptureContext *ctx, OnCaptureMethod captureCallback,
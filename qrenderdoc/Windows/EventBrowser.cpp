@@ -23,6 +23,10 @@
  ******************************************************************************/
 
 #include "EventBrowser.h"
+#include <QAbstractItemModel>
+#include <QBitArray>
+#include <QHash>
+#include <QPointer>
 #include <QTimer>
 #include "Code/CaptureContext.h"
 #include "Code/QRDUtils.h"
@@ -34,10 +38,393 @@ enum
   COL_EID = 1,
   COL_DURATION = 2,
 
-  COL_CURRENT,
-  COL_FIND,
-  COL_BOOKMARK,
-  COL_LAST_EID,
+  COL_COUNT,
+};
+
+static const int EIDRole = Qt::UserRole + 1;
+static const int LastEIDRole = Qt::UserRole + 2;
+
+// a flat snapshot of every node's display name, in the same order as the model's node IDs. It is
+// immutable once built so it can be searched on a background thread while the UI carries on.
+struct EventSearchIndex
+{
+  QVector<QString> names;
+
+  // returns the IDs of matching nodes in tree order. The search is abandoned (returning nothing) as
+  // soon as generation no longer matches expected.
+  QVector<int> Search(const QString &filter, const QAtomicInt &generation, int expected) const
+  {
+    QVector<int> ret;
+
+    // node 0 is the frame itself, which is never a find result
+    for(int i = 1; i < names.count(); i++)
+    {
+      if((i % 1024) == 0 && generation.load() != expected)
+        return QVector<int>();
+
+      if(names[i].contains(filter, Qt::CaseInsensitive))
+        ret.push_back(i);
+    }
+
+    return ret;
+  }
+};
+
+// The drawcall tree is flattened into a node table when a log is loaded, instead of creating an
+// item per drawcall up front. Text is only generated for the rows the view actually asks about.
+//
+// Node 0 is the frame, node 1 the implicit 'Frame Start' event, and the drawcalls follow in
+// preorder - so every node's descendants have larger IDs than it does. Each node's children are
+// stored as a contiguous block of m_Children, giving constant time index() and parent().
+class EventItemModel : public QAbstractItemModel
+{
+public:
+  EventItemModel(QObject *parent) : QAbstractItemModel(parent)
+  {
+    m_CurrentIcon.addFile(QStringLiteral(":/Resources/flag_green.png"), QSize(), QIcon::Normal,
+                          QIcon::Off);
+    m_FindIcon.addFile(QStringLiteral(":/Resources/find.png"), QSize(), QIcon::Normal, QIcon::Off);
+  }
+
+  void SetDrawcalls(uint32_t frameNumber, const rdctype::array<FetchDrawcall> &draws)
+  {
+    emit beginResetModel();
+
+    m_Nodes.clear();
+    m_Children.clear();
+    m_EIDNodes.clear();
+    m_FindMatches.clear();
+    m_Current = -1;
+    m_Timed = false;
+
+    m_FrameName = QString("Frame #%1").arg(frameNumber);
+
+    Node frame = {};
+    frame.parent = -1;
+    frame.numChildren = draws.count + 1;
+    m_Nodes.push_back(frame);
+    m_Children.resize(frame.numChildren);
+
+    Node framestart = {};
+    framestart.parent = 0;
+    framestart.firstChild = m_Children.count();
+    m_Nodes.push_back(framestart);
+    m_Children[0] = 1;
+
+    m_Nodes[0].lastEID = AddDrawcalls(0, 1, draws);
+
+    m_FindMatches.resize(m_Nodes.count());
+
+    BuildEIDIndex();
+
+    emit endResetModel();
+  }
+
+  void Clear()
+  {
+    emit beginResetModel();
+
+    m_Nodes.clear();
+    m_Children.clear();
+    m_EIDNodes.clear();
+    m_FindMatches.clear();
+    m_Current = -1;
+    m_Timed = false;
+
+    emit endResetModel();
+  }
+
+  EventSearchIndex *BuildSearchIndex() const
+  {
+    EventSearchIndex *ret = new EventSearchIndex;
+
+    ret->names.reserve(m_Nodes.count());
+    for(int i = 0; i < m_Nodes.count(); i++)
+      ret->names.push_back(NodeName(i));
+
+    return ret;
+  }
+
+  QModelIndex GetIndexForNode(int node, int column = COL_NAME) const
+  {
+    if(node < 0 || node >= m_Nodes.count())
+      return QModelIndex();
+
+    return createIndex(m_Nodes[node].row, column, (quintptr)node);
+  }
+
+  // finds the node to select for an EID: the one with the nearest lastEID at or after it
+  QModelIndex GetIndexForEID(uint32_t eventID) const
+  {
+    if(eventID >= (uint32_t)m_EIDNodes.count())
+      return QModelIndex();
+
+    return GetIndexForNode(m_EIDNodes[eventID]);
+  }
+
+  uint32_t GetLastEID(int node) const { return m_Nodes[node].lastEID; }
+  void SetCurrent(const QModelIndex &idx)
+  {
+    int prev = m_Current;
+
+    m_Current = idx.isValid() ? (int)idx.internalId() : -1;
+
+    if(prev >= 0 && prev < m_Nodes.count())
+    {
+      QModelIndex p = GetIndexForNode(prev);
+      emit dataChanged(p, p, {Qt::DecorationRole});
+    }
+
+    if(m_Current >= 0)
+    {
+      QModelIndex c = GetIndexForNode(m_Current);
+      emit dataChanged(c, c, {Qt::DecorationRole});
+    }
+  }
+
+  // these touch arbitrarily many rows, so rather than emitting dataChanged for every one the
+  // caller is expected to repaint the view afterwards.
+  void SetFindMatches(const QVector<int> &nodes)
+  {
+    m_FindMatches.fill(false);
+
+    for(int n : nodes)
+      m_FindMatches.setBit(n);
+  }
+
+  void SetTimes(const rdctype::array<CounterResult> &results)
+  {
+    QHash<uint32_t, double> times;
+    times.reserve(results.count);
+
+    for(const CounterResult &r : results)
+      times[r.eventID] = r.value.d;
+
+    // leaf nodes are looked up directly, parents take the sum of their children
+    for(int i = 1; i < m_Nodes.count(); i++)
+    {
+      Node &n = m_Nodes[i];
+
+      if(n.numChildren == 0)
+        n.duration = times.value(n.eventID, -1.0);
+      else
+        n.duration = 0.0;
+    }
+
+    m_Nodes[0].duration = 0.0;
+
+    // children always come after their parents, so walking backwards accumulates each node's total
+    // before it's added to its own parent.
+    for(int i = m_Nodes.count() - 1; i > 0; i--)
+    {
+      if(m_Nodes[i].duration > 0.0)
+        m_Nodes[m_Nodes[i].parent].duration += m_Nodes[i].duration;
+    }
+
+    m_Timed = true;
+  }
+
+  QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override
+  {
+    if(row < 0 || column < 0 || column >= COL_COUNT || row >= rowCount(parent))
+      return QModelIndex();
+
+    if(!parent.isValid())
+      return createIndex(row, column, (quintptr)0);
+
+    const Node &p = m_Nodes[(int)parent.internalId()];
+
+    return createIndex(row, column, (quintptr)m_Children[p.firstChild + row]);
+  }
+
+  QModelIndex parent(const QModelIndex &index) const override
+  {
+    if(!index.isValid())
+      return QModelIndex();
+
+    return GetIndexForNode(m_Nodes[(int)index.internalId()].parent);
+  }
+
+  int rowCount(const QModelIndex &parent = QModelIndex()) const override
+  {
+    if(!parent.isValid())
+      return m_Nodes.isEmpty() ? 0 : 1;
+
+    if(parent.column() != COL_NAME)
+      return 0;
+
+    return m_Nodes[(int)parent.internalId()].numChildren;
+  }
+
+  int columnCount(const QModelIndex &parent = QModelIndex()) const override { return COL_COUNT; }
+  Qt::ItemFlags flags(const QModelIndex &index) const override
+  {
+    if(!index.isValid())
+      return 0;
+
+    return QAbstractItemModel::flags(index);
+  }
+
+  QVariant headerData(int section, Qt::Orientation orientation, int role) const override
+  {
+    if(orientation == Qt::Horizontal && role == Qt::DisplayRole)
+    {
+      switch(section)
+      {
+        case COL_NAME: return "Name";
+        case COL_EID: return "EID";
+        case COL_DURATION: return "Duration (µs)";
+        default: break;
+      }
+    }
+
+    return QVariant();
+  }
+
+  QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override
+  {
+    if(!index.isValid())
+      return QVariant();
+
+    int id = (int)index.internalId();
+    const Node &n = m_Nodes[id];
+
+    if(role == Qt::DisplayRole)
+    {
+      switch(index.column())
+      {
+        case COL_NAME: return NodeName(id);
+        case COL_EID: return id == 0 ? QString() : QString::number(n.eventID);
+        case COL_DURATION:
+          if(!m_Timed)
+            return n.draw ? QStringLiteral("0.0") : QString();
+          return n.duration < 0.0 ? QString() : QString::number(n.duration * 1000000.0);
+        default: break;
+      }
+    }
+
+    if(role == Qt::DecorationRole && index.column() == COL_NAME)
+    {
+      if(id == m_Current)
+        return m_CurrentIcon;
+      if(m_FindMatches.testBit(id))
+        return m_FindIcon;
+    }
+
+    if(role == EIDRole)
+      return n.eventID;
+
+    if(role == LastEIDRole)
+      return n.lastEID;
+
+    return QVariant();
+  }
+
+private:
+  struct Node
+  {
+    const FetchDrawcall *draw;
+    int parent;
+    int row;
+    int firstChild;
+    int numChildren;
+    uint32_t eventID;
+    uint32_t lastEID;
+    double duration;
+  };
+
+  QString NodeName(int id) const
+  {
+    if(id == 0)
+      return m_FrameName;
+
+    const Node &n = m_Nodes[id];
+    return n.draw ? QString(n.draw->name) : QStringLiteral("Frame Start");
+  }
+
+  uint32_t AddDrawcalls(int parent, int firstRow, const rdctype::array<FetchDrawcall> &draws)
+  {
+    uint32_t lastEID = 0;
+
+    for(int32_t i = 0; i < draws.count; i++)
+    {
+      int id = m_Nodes.count();
+
+      Node child = {};
+      child.draw = &draws[i];
+      child.parent = parent;
+      child.row = firstRow + i;
+      child.eventID = draws[i].eventID;
+      child.numChildren = draws[i].children.count;
+
+      // reserve this node's block of children before recursing, so that it stays contiguous
+      child.firstChild = m_Children.count();
+      m_Children.resize(child.firstChild + child.numChildren);
+
+      m_Nodes.push_back(child);
+      m_Children[m_Nodes[parent].firstChild + child.row] = id;
+
+      lastEID = AddDrawcalls(id, 0, draws[i].children);
+
+      if(lastEID == 0)
+      {
+        lastEID = draws[i].eventID;
+
+        if((draws[i].flags & eDraw_SetMarker) && i + 1 < draws.count)
+          lastEID = draws[i + 1].eventID;
+      }
+
+      m_Nodes[id].lastEID = lastEID;
+    }
+
+    return lastEID;
+  }
+
+  void BuildEIDIndex()
+  {
+    uint32_t maxEID = 0;
+    for(const Node &n : m_Nodes)
+      maxEID = qMax(maxEID, n.lastEID);
+
+    // first pick one node for each lastEID. Where a parent and its children share a lastEID the
+    // later (deeper) node wins, but a leaf that's found is kept.
+    QVector<int> byLastEID(maxEID + 1, -1);
+
+    for(int i = 1; i < m_Nodes.count(); i++)
+    {
+      int &best = byLastEID[m_Nodes[i].lastEID];
+
+      if(best < 0 || m_Nodes[best].numChildren > 0)
+        best = i;
+    }
+
+    // then any EID without a node of its own maps to the next one after it
+    m_EIDNodes.resize(maxEID + 1);
+
+    int next = -1;
+    for(int eid = (int)maxEID; eid >= 0; eid--)
+    {
+      if(byLastEID[eid] >= 0)
+        next = byLastEID[eid];
+
+      m_EIDNodes[eid] = next;
+    }
+  }
+
+  QVector<Node> m_Nodes;
+  QVector<int> m_Children;
+
+  // node to select for each EID, for constant time lookups when the event changes
+  QVector<int> m_EIDNodes;
+
+  QBitArray m_FindMatches;
+  int m_Current = -1;
+  bool m_Timed = false;
+
+  QString m_FrameName;
+
+  QIcon m_CurrentIcon;
+  QIcon m_FindIcon;
 };
 
 EventBrowser::EventBrowser(CaptureContext *ctx, QWidget *parent)
@@ -47,6 +434,14 @@ EventBrowser::EventBrowser(CaptureContext *ctx, QWidget *parent)
 
   m_Ctx->AddLogViewer(this);
 
+  m_Model = new EventItemModel(this);
+  ui->events->setModel(m_Model);
+
+  QObject::connect(ui->events->selectionModel(), &QItemSelectionModel::currentChanged, this,
+                   &EventBrowser::events_currentChanged);
+
+  m_FindGeneration = QSharedPointer<QAtomicInt>(new QAtomicInt(0));
+
   ui->events->header()->resizeSection(COL_EID, 45);
 
   ui->events->header()->setSectionResizeMode(COL_NAME, QHeaderView::Stretch);
@@ -76,16 +471,13 @@ EventBrowser::EventBrowser(CaptureContext *ctx, QWidget *parent)
   ui->jumpStrip->hide();
   ui->findStrip->hide();
   ui->bookmarkStrip->hide();
-
-  m_CurrentIcon.addFile(QStringLiteral(":/Resources/flag_green.png"), QSize(), QIcon::Normal,
-                        QIcon::Off);
-  m_FindIcon.addFile(QStringLiteral(":/Resources/find.png"), QSize(), QIcon::Normal, QIcon::Off);
-  m_BookmarkIcon.addFile(QStringLiteral(":/Resources/asterisk_orange.png"), QSize(), QIcon::Normal,
-                         QIcon::Off);
 }
 
 EventBrowser::~EventBrowser()
 {
+  // let any search still running in the background bail out early
+  CancelFind();
+
   m_Ctx->windowClosed(this);
   m_Ctx->RemoveLogViewer(this);
   delete ui;
@@ -94,107 +486,38 @@ EventBrowser::~EventBrowser()
 
 void EventBrowser::OnLogfileLoaded()
 {
-  QTreeWidgetItem *frame = new QTreeWidgetItem(
-      (QTreeWidget *)NULL,
-      QStringList{QString("Frame #%1").arg(m_Ctx->FrameInfo().frameNumber), "", ""});
+  CancelFind();
+  m_SearchIndex.clear();
+  m_FindFilter.clear();
+  m_FindResults.clear();
 
-  QTreeWidgetItem *framestart = new QTreeWidgetItem(frame, QStringList{"Frame Start", "0", ""});
-  framestart->setData(COL_EID, Qt::UserRole, QVariant(0));
-  framestart->setData(COL_CURRENT, Qt::UserRole, QVariant(false));
-  framestart->setData(COL_FIND, Qt::UserRole, QVariant(false));
-  framestart->setData(COL_BOOKMARK, Qt::UserRole, QVariant(false));
-  framestart->setData(COL_LAST_EID, Qt::UserRole, QVariant(0));
+  m_Model->SetDrawcalls(m_Ctx->FrameInfo().frameNumber, m_Ctx->CurDrawcalls());
 
-  uint lastEID = AddDrawcalls(frame, m_Ctx->CurDrawcalls());
-  frame->setData(COL_EID, Qt::UserRole, QVariant(0));
-  frame->setData(COL_LAST_EID, Qt::UserRole, QVariant(lastEID));
+  QModelIndex frame = m_Model->index(0, COL_NAME);
 
-  ui->events->insertTopLevelItem(0, frame);
+  ui->events->expand(frame);
 
-  ui->events->expandItem(frame);
+  uint lastEID = frame.data(LastEIDRole).toUInt();
 
   m_Ctx->SetEventID({this}, lastEID, lastEID);
 }
 
 void EventBrowser::OnLogfileClosed()
 {
-  ui->events->clear();
-}
+  // the timings would be for the old log
+  m_Ctx->Renderer()->CancelInvoke(RenderManager::MakeInvokeTag(this, "timeDraws"));
 
-void EventBrowser::OnEventChanged(uint32_t eventID)
-{
-  SelectEvent(eventID);
-}
-
-uint EventBrowser::AddDrawcalls(QTreeWidgetItem *parent, const rdctype::array<FetchDrawcall> &draws)
-{
-  uint lastEID = 0;
-
-  for(int32_t i = 0; i < draws.count; i++)
-  {
-    QTreeWidgetItem *child = new QTreeWidgetItem(
-        parent, QStringList{QString(draws[i].name), QString("%1").arg(draws[i].eventID), "0.0"});
-
-    lastEID = AddDrawcalls(child, draws[i].children);
-
-    if(lastEID == 0)
-    {
-      lastEID = draws[i].eventID;
+  CancelFind();
+  m_SearchIndex.clear();
+  m_FindFilter.clear();
+  m_FindResults.clear();
 
-      if((draws[i].flags & eDraw_SetMarker) && i + 1 < draws.count)
-        lastEID = draws[i + 1].eventID;
-    }
-
-    child->setData(COL_EID, Qt::UserRole, QVariant(draws[i].eventID));
-    child->setData(COL_CURRENT, Qt::UserRole, QVariant(false));
-    child->setData(COL_FIND, Qt::UserRole, QVariant(false));
-    child->setData(COL_BOOKMARK, Qt::UserRole, QVariant(false));
-    child->setData(COL_LAST_EID, Qt::UserRole, QVariant(lastEID));
-  }
-
-  return lastEID;
+  m_Model->Clear();
 }
 
-void EventBrowser::SetDrawcallTimes(QTreeWidgetItem *node,
-                                    const rdctype::array<CounterResult> &results)
+void EventBrowser::OnEventChanged(uint32_t eventID)
 {
-  if(node == NULL)
-    return;
-
-  // parent nodes take the value of the sum of their children
-  double duration = 0.0;
-
-  // look up leaf nodes in the dictionary
-  if(node->childCount() == 0)
-  {
-    uint eid = node->data(COL_EID, Qt::UserRole).toUInt();
-
-    duration = -1.0;
-
-    for(const CounterResult &r : results)
-    {
-      if(r.eventID == eid)
-        duration = r.value.d;
-    }
-
-    node->setText(COL_DURATION, duration < 0.0f ? "" : QString::number(duration * 1000000.0));
-    node->setData(COL_DURATION, Qt::UserRole, QVariant(duration));
-
-    return;
-  }
-
-  for(int i = 0; i < node->childCount(); i++)
-  {
-    SetDrawcallTimes(node->child(i), results);
-
-    double nd = node->child(i)->data(COL_DURATION, Qt::UserRole).toDouble();
-
-    if(nd > 0.0)
-      duration += nd;
-  }
-
-  node->setText(COL_DURATION, duration < 0.0f ? "" : QString::number(duration * 1000000.0));
-  node->setData(COL_DURATION, Qt::UserRole, QVariant(duration));
+  SelectEvent(eventID);
 }
 
 void EventBrowser::on_find_clicked()
@@ -222,34 +545,33 @@ void EventBrowser::on_toolButton_clicked()
 
 void EventBrowser::on_timeDraws_clicked()
 {
-  m_Ctx->Renderer()->AsyncInvoke([this](IReplayRenderer *r) {
+  RenderManager::InvokeMethod fetch = [this](IReplayRenderer *r) {
 
     uint32_t counters[] = {eCounter_EventGPUDuration};
 
     rdctype::array<CounterResult> results;
     r->FetchCounters(counters, 1, &results);
 
-    GUIInvoke::blockcall(
-        [this, results]() { SetDrawcallTimes(ui->events->topLevelItem(0), results); });
-  });
+    GUIInvoke::blockcall([this, results]() {
+      m_Model->SetTimes(results);
+      ui->events->viewport()->update();
+    });
+  };
+
+  // timing every drawcall is slow, so don't hold up anything more interactive
+  m_Ctx->Renderer()->AsyncInvoke(RenderManager::MakeInvokeTag(this, "timeDraws"), fetch,
+                                 RenderManager::InvokePriority::Background);
 }
 
-void EventBrowser::on_events_currentItemChanged(QTreeWidgetItem *current, QTreeWidgetItem *previous)
+void EventBrowser::events_currentChanged(const QModelIndex &current, const QModelIndex &previous)
 {
-  if(previous)
-  {
-    previous->setData(COL_CURRENT, Qt::UserRole, QVariant(false));
-    RefreshIcon(previous);
-  }
+  m_Model->SetCurrent(current);
 
-  if(!current)
+  if(!current.isValid())
     return;
 
-  current->setData(COL_CURRENT, Qt::UserRole, QVariant(true));
-  RefreshIcon(current);
-
-  uint EID = current->data(COL_EID, Qt::UserRole).toUInt();
-  uint lastEID = current->data(COL_LAST_EID, Qt::UserRole).toUInt();
+  uint EID = current.data(EIDRole).toUInt();
+  uint lastEID = current.data(LastEIDRole).toUInt();
 
   m_Ctx->SetEventID({this}, EID, lastEID);
 }
@@ -278,18 +600,19 @@ void EventBrowser::on_jumpToEID_returnPressed()
 
 void EventBrowser::findHighlight_timeout()
 {
-  ClearFindIcons();
+  QString filter = ui->findEvent->text();
 
-  int results = SetFindIcons(ui->findEvent->text());
+  if(filter.isEmpty() || !m_Ctx->LogLoaded())
+    return;
 
-  if(results > 0)
-    ui->findEvent->setStyleSheet("");
-  else
-    ui->findEvent->setStyleSheet("QLineEdit{background-color:#ff0000;}");
+  StartFind(filter);
 }
 
 void EventBrowser::on_findEvent_textEdited(const QString &arg1)
 {
+  // any search in flight is for the old text, so discard it
+  CancelFind();
+
   if(arg1.isEmpty())
   {
     m_FindHighlight->stop();
@@ -305,12 +628,9 @@ void EventBrowser::on_findEvent_textEdited(const QString &arg1)
 
 void EventBrowser::on_findEvent_returnPressed()
 {
-  if(m_FindHighlight->isActive())
-  {
-    // manually fire it instantly
-    m_FindHighlight->stop();
-    findHighlight_timeout();
-  }
+  // no need to wait for the highlight, Find() searches immediately if the results are stale and
+  // highlights the matches at the same time.
+  m_FindHighlight->stop();
 
   if(!ui->findEvent->text().isEmpty())
   {
@@ -328,55 +648,17 @@ void EventBrowser::on_findPrev_clicked()
   Find(false);
 }
 
-void EventBrowser::RefreshIcon(QTreeWidgetItem *item)
-{
-  if(item->data(COL_CURRENT, Qt::UserRole).toBool())
-    item->setIcon(COL_NAME, m_CurrentIcon);
-  else if(item->data(COL_FIND, Qt::UserRole).toBool())
-    item->setIcon(COL_NAME, m_FindIcon);
-  else if(item->data(COL_BOOKMARK, Qt::UserRole).toBool())
-    item->setIcon(COL_NAME, m_BookmarkIcon);
-  else
-    item->setIcon(COL_NAME, QIcon());
-}
-
-bool EventBrowser::FindEventNode(QTreeWidgetItem *&found, QTreeWidgetItem *parent, uint32_t eventID)
+void EventBrowser::ExpandNode(const QModelIndex &idx)
 {
-  for(int i = 0; i < parent->childCount(); i++)
+  QModelIndex i = idx;
+  while(i.isValid())
   {
-    QTreeWidgetItem *n = parent->child(i);
-
-    uint nEID = n->data(COL_LAST_EID, Qt::UserRole).toUInt();
-    uint fEID = found ? found->data(COL_LAST_EID, Qt::UserRole).toUInt() : 0;
-
-    if(nEID >= eventID && (found == NULL || nEID <= fEID))
-      found = n;
-
-    if(nEID == eventID && n->childCount() == 0)
-      return true;
-
-    if(n->childCount() > 0)
-    {
-      bool exact = FindEventNode(found, n, eventID);
-      if(exact)
-        return true;
-    }
-  }
-
-  return false;
-}
-
-void EventBrowser::ExpandNode(QTreeWidgetItem *node)
-{
-  QTreeWidgetItem *n = node;
-  while(node != NULL)
-  {
-    node->setExpanded(true);
-    node = node->parent();
+    ui->events->expand(i);
+    i = i.parent();
   }
 
-  if(n)
-    ui->events->scrollToItem(n);
+  if(idx.isValid())
+    ui->events->scrollTo(idx);
 }
 
 bool EventBrowser::SelectEvent(uint32_t eventID)
@@ -384,163 +666,147 @@ bool EventBrowser::SelectEvent(uint32_t eventID)
   if(!m_Ctx->LogLoaded())
     return false;
 
-  QTreeWidgetItem *found = NULL;
-  FindEventNode(found, ui->events->topLevelItem(0), eventID);
-  if(found != NULL)
+  QModelIndex found = m_Model->GetIndexForEID(eventID);
+  if(found.isValid())
   {
-    ui->events->clearSelection();
-    ui->events->setItemSelected(found, true);
-    ui->events->setCurrentItem(found);
-
-    ExpandNode(found);
+    SelectIndex(found);
     return true;
   }
 
   return false;
 }
 
-void EventBrowser::ClearFindIcons(QTreeWidgetItem *parent)
+void EventBrowser::SelectIndex(const QModelIndex &idx)
 {
-  for(int i = 0; i < parent->childCount(); i++)
-  {
-    QTreeWidgetItem *n = parent->child(i);
-
-    n->setData(COL_FIND, Qt::UserRole, QVariant(false));
-    RefreshIcon(n);
+  ui->events->clearSelection();
+  ui->events->setCurrentIndex(idx);
 
-    if(n->childCount() > 0)
-      ClearFindIcons(n);
-  }
+  ExpandNode(idx);
 }
 
 void EventBrowser::ClearFindIcons()
 {
-  if(m_Ctx->LogLoaded())
-    ClearFindIcons(ui->events->topLevelItem(0));
-}
-
-int EventBrowser::SetFindIcons(QTreeWidgetItem *parent, QString filter)
-{
-  int results = 0;
+  CancelFind();
+  m_FindFilter.clear();
+  m_FindResults.clear();
 
-  for(int i = 0; i < parent->childCount(); i++)
+  if(m_Ctx->LogLoaded())
   {
-    QTreeWidgetItem *n = parent->child(i);
-
-    if(n->text(COL_NAME).contains(filter, Qt::CaseInsensitive))
-    {
-      n->setData(COL_FIND, Qt::UserRole, QVariant(true));
-      RefreshIcon(n);
-      results++;
-    }
-
-    if(n->childCount() > 0)
-    {
-      results += SetFindIcons(n, filter);
-    }
+    m_Model->SetFindMatches(QVector<int>());
+    ui->events->viewport()->update();
   }
-
-  return results;
 }
 
-int EventBrowser::SetFindIcons(QString filter)
+QSharedPointer<const EventSearchIndex> EventBrowser::GetSearchIndex()
 {
-  if(filter.isEmpty())
-    return 0;
+  if(!m_SearchIndex)
+    m_SearchIndex = QSharedPointer<const EventSearchIndex>(m_Model->BuildSearchIndex());
 
-  return SetFindIcons(ui->events->topLevelItem(0), filter);
+  return m_SearchIndex;
 }
 
-QTreeWidgetItem *EventBrowser::FindNode(QTreeWidgetItem *parent, QString filter, uint32_t after)
+int EventBrowser::CancelFind()
 {
-  for(int i = 0; i < parent->childCount(); i++)
-  {
-    QTreeWidgetItem *n = parent->child(i);
+  return m_FindGeneration->fetchAndAddOrdered(1) + 1;
+}
 
-    uint eid = n->data(COL_LAST_EID, Qt::UserRole).toUInt();
+void EventBrowser::StartFind(const QString &filter)
+{
+  int generation = CancelFind();
 
-    if(eid > after && n->text(COL_NAME).contains(filter, Qt::CaseInsensitive))
-      return n;
+  QSharedPointer<const EventSearchIndex> index = GetSearchIndex();
+  QSharedPointer<QAtomicInt> current = m_FindGeneration;
+  QPointer<EventBrowser> me(this);
 
-    if(n->childCount() > 0)
-    {
-      QTreeWidgetItem *found = FindNode(n, filter, after);
+  LambdaThread *thread = new LambdaThread([index, current, generation, filter, me]() {
+    QVector<int> results = index->Search(filter, *current, generation);
 
-      if(found != NULL)
-        return found;
-    }
-  }
+    if(current->load() != generation)
+      return;
 
-  return NULL;
+    GUIInvoke::call([me, filter, generation, results]() {
+      if(me)
+        me->SetFindResults(filter, generation, results);
+    });
+  });
+  thread->selfDelete(true);
+  thread->start();
 }
 
-int EventBrowser::FindEvent(QTreeWidgetItem *parent, QString filter, uint32_t after, bool forward)
+void EventBrowser::SetFindResults(const QString &filter, int generation,
+                                  const QVector<int> &results)
 {
-  if(parent == NULL)
-    return -1;
-
-  for(int i = forward ? 0 : parent->childCount() - 1; i >= 0 && i < parent->childCount();
-      i += forward ? 1 : -1)
-  {
-    auto n = parent->child(i);
-
-    uint eid = n->data(COL_LAST_EID, Qt::UserRole).toUInt();
-
-    bool matchesAfter = (forward && eid > after) || (!forward && eid < after);
+  // the find text changed or was cleared while this was searching
+  if(m_FindGeneration->load() != generation)
+    return;
 
-    if(matchesAfter)
-    {
-      QString name = n->text(COL_NAME);
-      if(name.contains(filter, Qt::CaseInsensitive))
-        return (int)eid;
-    }
+  m_FindFilter = filter;
+  m_FindResults = results;
 
-    if(n->childCount() > 0)
-    {
-      int found = FindEvent(n, filter, after, forward);
+  m_Model->SetFindMatches(results);
+  ui->events->viewport()->update();
 
-      if(found > 0)
-        return found;
-    }
-  }
-
-  return -1;
+  if(results.isEmpty())
+    ui->findEvent->setStyleSheet("QLineEdit{background-color:#ff0000;}");
+  else
+    ui->findEvent->setStyleSheet("");
 }
 
-int EventBrowser::FindEvent(QString filter, uint32_t after, bool forward)
+void EventBrowser::Find(bool forward)
 {
-  if(!m_Ctx->LogLoaded())
-    return 0;
+  QString filter = ui->findEvent->text();
 
-  return FindEvent(ui->events->topLevelItem(0), filter, after, forward);
-}
+  if(filter.isEmpty() || !m_Ctx->LogLoaded())
+    return;
 
-void EventBrowser::Find(bool forward)
-{
-  if(ui->findEvent->text().isEmpty())
+  // if the background search hasn't finished for this text yet, search synchronously so the jump
+  // isn't lost.
+  if(filter != m_FindFilter)
+  {
+    int generation = CancelFind();
+    QVector<int> results = GetSearchIndex()->Search(filter, *m_FindGeneration, generation);
+    SetFindResults(filter, generation, results);
+  }
+
+  if(m_FindResults.isEmpty())
     return;
 
   uint32_t curEID = m_Ctx->CurEvent();
-  if(!ui->events->selectedItems().isEmpty())
-    curEID = ui->events->selectedItems()[0]->data(COL_LAST_EID, Qt::UserRole).toUInt();
+  QModelIndex cur = ui->events->currentIndex();
+  if(cur.isValid())
+    curEID = cur.data(LastEIDRole).toUInt();
 
-  int eid = FindEvent(ui->findEvent->text(), curEID, forward);
-  if(eid >= 0)
-  {
-    SelectEvent((uint32_t)eid);
-    ui->findEvent->setStyleSheet("");
-  }
-  else    // if(WrapSearch)
+  int found = -1;
+
+  if(forward)
   {
-    eid = FindEvent(ui->findEvent->text(), forward ? 0 : ~0U, forward);
-    if(eid >= 0)
+    for(int i = 0; i < m_FindResults.count(); i++)
     {
-      SelectEvent((uint32_t)eid);
-      ui->findEvent->setStyleSheet("");
+      if(m_Model->GetLastEID(m_FindResults[i]) > curEID)
+      {
+        found = m_FindResults[i];
+        break;
+      }
     }
-    else
+
+    // wrap around
+    if(found < 0)
+      found = m_FindResults.front();
+  }
+  else
+  {
+    for(int i = m_FindResults.count() - 1; i >= 0; i--)
     {
-      ui->findEvent->setStyleSheet("QLineEdit{background-color:#ff0000;}");
+      if(m_Model->GetLastEID(m_FindResults[i]) < curEID)
+      {
+        found = m_FindResults[i];
+        break;
+      }
     }
+
+    if(found < 0)
+      found = m_FindResults.back();
   }
+
+  SelectIndex(m_Model->GetIndexForNode(found));
 }
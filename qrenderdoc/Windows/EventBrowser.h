@@ -24,8 +24,10 @@
 
 #pragma once
 
+#include <QAtomicInt>
 #include <QFrame>
-#include <QIcon>
+#include <QSharedPointer>
+#include <QVector>
 #include "Code/CaptureContext.h"
 
 namespace Ui
@@ -33,9 +35,11 @@ namespace Ui
 class EventBrowser;
 }
 
-class QTreeWidgetItem;
+class QModelIndex;
 class QTimer;
 class SizeDelegate;
+class EventItemModel;
+struct EventSearchIndex;
 
 class EventBrowser : public QFrame, public ILogViewerForm
 {
@@ -61,41 +65,42 @@ private slots:
   void on_jumpToEID_returnPressed();
   void on_findEvent_returnPressed();
   void on_findEvent_textEdited(const QString &arg1);
-  void on_events_currentItemChanged(QTreeWidgetItem *current, QTreeWidgetItem *previous);
   void on_findNext_clicked();
   void on_findPrev_clicked();
 
   // manual slots
   void findHighlight_timeout();
+  void events_currentChanged(const QModelIndex &current, const QModelIndex &previous);
 
 private:
-  uint AddDrawcalls(QTreeWidgetItem *parent, const rdctype::array<FetchDrawcall> &draws);
-  void SetDrawcallTimes(QTreeWidgetItem *node, const rdctype::array<CounterResult> &results);
+  void ExpandNode(const QModelIndex &idx);
 
-  void ExpandNode(QTreeWidgetItem *node);
-
-  bool FindEventNode(QTreeWidgetItem *&found, QTreeWidgetItem *parent, uint32_t eventID);
   bool SelectEvent(uint32_t eventID);
+  void SelectIndex(const QModelIndex &idx);
 
-  void ClearFindIcons(QTreeWidgetItem *parent);
   void ClearFindIcons();
 
-  int SetFindIcons(QTreeWidgetItem *parent, QString filter);
-  int SetFindIcons(QString filter);
-
-  QTreeWidgetItem *FindNode(QTreeWidgetItem *parent, QString filter, uint32_t after);
-  int FindEvent(QTreeWidgetItem *parent, QString filter, uint32_t after, bool forward);
-  int FindEvent(QString filter, uint32_t after, bool forward);
+  QSharedPointer<const EventSearchIndex> GetSearchIndex();
+  int CancelFind();
+  void StartFind(const QString &filter);
+  void SetFindResults(const QString &filter, int generation, const QVector<int> &results);
   void Find(bool forward);
 
-  QIcon m_CurrentIcon;
-  QIcon m_FindIcon;
-  QIcon m_BookmarkIcon;
-
   SizeDelegate *m_SizeDelegate;
   QTimer *m_FindHighlight;
 
-  void RefreshIcon(QTreeWidgetItem *item);
+  EventItemModel *m_Model;
+
+  // built the first time a find is run, and shared with the background search thread
+  QSharedPointer<const EventSearchIndex> m_SearchIndex;
+
+  // incremented whenever the find text changes, so that any search still running in the
+  // background for an old filter stops early and its results are discarded
+  QSharedPointer<QAtomicInt> m_FindGeneration;
+
+  // the filter that m_FindResults were found with, and the matching nodes in tree order
+  QString m_FindFilter;
+  QVector<int> m_FindResults;
 
   Ui::EventBrowser *ui;
   CaptureContext *m_Ctx;
@@ -839,7 +839,7 @@ void MainWindow::messageCheck()
 {
   if(m_Ctx->LogLoaded())
   {
-    m_Ctx->Renderer()->AsyncInvoke([this](IReplayRenderer *r) {
+    RenderManager::InvokeMethod check = [this](IReplayRenderer *r) {
       rdctype::array<DebugMessage> msgs;
       r->GetDebugMessages(&msgs);
 
@@ -886,7 +886,11 @@ void MainWindow::messageCheck()
 
         setLogHasErrors(!m_Ctx->DebugMessages.empty());
       });
-    });
+    };
+
+    // this polls regularly, so if the previous check hasn't run yet there's no need for another
+    m_Ctx->Renderer()->AsyncInvoke(RenderManager::MakeInvokeTag(this, "messageCheck"), check,
+                                   RenderManager::InvokePriority::Background);
   }
 }
 
@@ -2177,11 +2177,11 @@ void TextureViewer::render_mouseMove(QMouseEvent *e)
         m_PickedPoint.setX(qBound(0, m_PickedPoint.x(), (int)texptr->width - 1));
         m_PickedPoint.setY(qBound(0, m_PickedPoint.y(), (int)texptr->height - 1));
 
-        INVOKE_MEMFN(RT_PickPixelsAndUpdate);
+        INVOKE_MEMFN_PRIORITY(RT_PickPixelsAndUpdate, Interactive);
       }
       else if(e->buttons() == Qt::NoButton)
       {
-        INVOKE_MEMFN(RT_PickHoverAndUpdate);
+        INVOKE_MEMFN_PRIORITY(RT_PickHoverAndUpdate, Interactive);
       }
     }
   }
@@ -2284,10 +2284,8 @@ void TextureViewer::render_keyPress(QKeyEvent *e)
                            qBound(0, m_PickedPoint.y(), (int)texptr->height - 1));
     e->accept();
 
-    m_Ctx->Renderer()->AsyncInvoke([this](IReplayRenderer *r) {
-      RT_PickPixelsAndUpdate(r);
-      RT_UpdateAndDisplay(r);
-    });
+    INVOKE_MEMFN_PRIORITY(RT_PickPixelsAndUpdate, Interactive);
+    INVOKE_MEMFN(RT_UpdateAndDisplay);
 
     UI_UpdateStatusText();
   }
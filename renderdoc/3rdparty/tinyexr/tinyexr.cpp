@@ -1,2 +1,63 @@
 #define TINYEXR_IMPLEMENTATION
 #include "tinyexr.h"
+
+#include "tinyexr_miniz.h"
+
+namespace TinyEXRMiniz
+{
+uint32_t Adler32(uint32_t adler, const void *data, size_t len)
+{
+  return (uint32_t)miniz::mz_adler32(adler, (const unsigned char *)data, len);
+}
+
+uint32_t CRC32(uint32_t crc, const void *data, size_t len)
+{
+  return (uint32_t)miniz::mz_crc32(crc, (const unsigned char *)data, len);
+}
+
+static miniz::mz_bool PutBuf(const void *buf, int len, void *user)
+{
+  std::vector<uint8_t> &out = *(std::vector<uint8_t> *)user;
+  out.insert(out.end(), (const uint8_t *)buf, (const uint8_t *)buf + len);
+  return MZ_TRUE;
+}
+
+bool DeflateRaw(const void *data, size_t len, int level, bool finish, std::vector<uint8_t> &out)
+{
+  miniz::tdefl_compressor *comp =
+      (miniz::tdefl_compressor *)malloc(sizeof(miniz::tdefl_compressor));
+
+  if(comp == NULL)
+    return false;
+
+  // negative window bits selects a raw stream with the default 32kb window
+  miniz::tdefl_status status = miniz::tdefl_init(
+      comp, &PutBuf, &out, (int)miniz::tdefl_create_comp_flags_from_zip_params(
+                               level, -MZ_DEFAULT_WINDOW_BITS, miniz::MZ_DEFAULT_STRATEGY));
+
+  if(status == miniz::TDEFL_STATUS_OKAY)
+    status = miniz::tdefl_compress_buffer(comp, data, len,
+                                          finish ? miniz::TDEFL_FINISH : miniz::TDEFL_SYNC_FLUSH);
+
+  free(comp);
+
+  return finish ? status == miniz::TDEFL_STATUS_DONE : status == miniz::TDEFL_STATUS_OKAY;
+}
+
+size_t CompressBound(size_t len)
+{
+  return (size_t)miniz::mz_compressBound((miniz::mz_ulong)len);
+}
+
+bool Compress(void *dst, size_t &dstLen, const void *src, size_t srcLen, int level)
+{
+  miniz::mz_ulong size = (miniz::mz_ulong)dstLen;
+
+  int ret = miniz::mz_compress2((unsigned char *)dst, &size, (const unsigned char *)src,
+                                (miniz::mz_ulong)srcLen, level);
+
+  dstLen = (size_t)size;
+
+  return ret == miniz::MZ_OK;
+}
+};
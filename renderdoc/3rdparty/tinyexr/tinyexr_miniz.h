@@ -0,0 +1,50 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// RenderDoc only builds one copy of miniz, the one embedded in tinyexr. It's private to
+// tinyexr.cpp, so these wrap the parts the PNG and EXR writers need and are implemented there.
+namespace TinyEXRMiniz
+{
+static const uint32_t Adler32Init = 1;
+static const uint32_t CRC32Init = 0;
+
+uint32_t Adler32(uint32_t adler, const void *data, size_t len);
+uint32_t CRC32(uint32_t crc, const void *data, size_t len);
+
+// appends a raw deflate stream (no zlib header or adler-32) of data to out. Unless finish is set
+// it ends with a sync flush instead, so another stream can follow on a byte boundary.
+bool DeflateRaw(const void *data, size_t len, int level, bool finish, std::vector<uint8_t> &out);
+
+// a complete zlib stream, as mz_compress2. dstLen is the capacity of dst, and the compressed size
+// on return.
+size_t CompressBound(size_t len);
+bool Compress(void *dst, size_t &dstLen, const void *src, size_t srcLen, int level);
+};
@@ -191,6 +191,20 @@ typedef enum {
   // 0 - API debugging is displayed as normal
   eRENDERDOC_Option_DebugOutputMute = 11,
 
+  // Selects how CPU callstacks are collected when CaptureCallstacks is enabled.
+  // Currently only used on Linux, other platforms always use their system
+  // stack walker.
+  //
+  // Default - 0
+  //
+  // 0 - The system unwinder. Slowest, but handles any code
+  // 1 - Follow frame pointers. Very cheap, but callstacks stop at the first
+  //     function that was compiled without frame pointers
+  // 2 - Use each module's .eh_frame unwind tables, caching the rule for every
+  //     return address. Handles code without frame pointers at a fraction of
+  //     the cost of the system unwinder
+  eRENDERDOC_Option_CallstackUnwinder = 12,
+
 } RENDERDOC_CaptureOption;
 
 // Sets an option that controls how RenderDoc behaves on capture.
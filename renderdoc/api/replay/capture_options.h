@@ -49,4 +49,5 @@ struct CaptureOptions
   bool32 SaveAllInitials;
   bool32 CaptureAllCmdLists;
   bool32 DebugOutputMute;
+  uint32_t CallstackUnwinder;
 };
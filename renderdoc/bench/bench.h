@@ -0,0 +1,118 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "common/common.h"
+#include "common/timing.h"
+
+// A minimal self-timing microbenchmark harness for renderdoc-bench.
+//
+// Each registered benchmark function can start any number of named measurements. A measurement
+// loops over its body until a minimum amount of time has elapsed, growing the number of iterations
+// between clock reads so that even very cheap bodies aren't dominated by timer overhead:
+//
+//   RDOC_BENCHMARK(Example)
+//   {
+//     if(bench.Start("Example/foo"))
+//     {
+//       bench.SetBytesPerIteration(size);
+//       while(bench.KeepRunning())
+//         foo();
+//     }
+//   }
+
+struct BenchmarkResult
+{
+  std::string name;
+  uint64_t iterations;
+  double totalMS;
+  uint64_t bytesPerIteration;
+  uint64_t itemsPerIteration;
+  // extra named values reported alongside the timings, e.g. the size of what was measured
+  std::vector<std::pair<std::string, double> > counters;
+};
+
+class Benchmark
+{
+public:
+  Benchmark(const std::vector<std::string> &filters, const std::vector<std::string> &inputs,
+            double minTimeMS);
+
+  // begins a new measurement, finishing any previous one. Returns false if the name doesn't match
+  // the command line filters, in which case the measurement should be skipped.
+  bool Start(const char *name);
+
+  // returns true while the current measurement needs more iterations.
+  bool KeepRunning();
+
+  // exclude setup or teardown from the measured time, either per-iteration or between Start() and
+  // the first KeepRunning().
+  void PauseTiming();
+  void ResumeTiming();
+
+  // optional units processed by one iteration, used to report throughput.
+  void SetBytesPerIteration(uint64_t bytes) { m_Current.bytesPerIteration = bytes; }
+  void SetItemsPerIteration(uint64_t items) { m_Current.itemsPerIteration = items; }
+  // records a named value with the current measurement's results.
+  void SetCounter(const char *name, double value)
+  {
+    m_Current.counters.push_back(std::make_pair(std::string(name), value));
+  }
+  // files and directories passed on the command line, for benchmarks that take real-world data.
+  const std::vector<std::string> &GetInputs() const { return m_Inputs; }
+  const std::vector<BenchmarkResult> &GetResults() const { return m_Results; }
+  void Finish();
+
+private:
+  std::vector<std::string> m_Filters;
+  std::vector<std::string> m_Inputs;
+  double m_MinTimeMS;
+
+  bool m_Running;
+  bool m_Paused;
+  uint64_t m_NextCheck;
+  double m_PausedMS;
+  PerformanceTimer m_Timer;
+  PerformanceTimer m_PauseTimer;
+
+  BenchmarkResult m_Current;
+  std::vector<BenchmarkResult> m_Results;
+};
+
+typedef void (*BenchmarkFunction)(Benchmark &bench);
+
+struct BenchmarkRegistration
+{
+  BenchmarkRegistration(const char *name, BenchmarkFunction func);
+};
+
+#define RDOC_BENCHMARK(name)                                                                  \
+  static void CONCAT(Benchmark_, name)(Benchmark & bench);                                    \
+  static BenchmarkRegistration CONCAT(BenchmarkReg_, name)(#name, &CONCAT(Benchmark_, name)); \
+  static void CONCAT(Benchmark_, name)(Benchmark & bench)
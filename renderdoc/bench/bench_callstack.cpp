@@ -0,0 +1,89 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "os/os_specific.h"
+#include "bench.h"
+
+struct UnwinderCase
+{
+  const char *name;
+  Callstack::Unwinder unwinder;
+};
+
+static const UnwinderCase unwinderCases[] = {
+    {"Callstack/Collect/System", Callstack::eUnwinder_System},
+    {"Callstack/Collect/FramePointers", Callstack::eUnwinder_FramePointers},
+    {"Callstack/Collect/EHFrame", Callstack::eUnwinder_EHFrame},
+};
+
+// roughly how deep an application's API calls are below main(), before entering RenderDoc
+static const int stackDepth = 24;
+
+static void RunCollect(Benchmark &bench, const UnwinderCase &c)
+{
+  if(!bench.Start(c.name))
+    return;
+
+  Callstack::SetUnwinder(c.unwinder);
+
+  // how deep the walk gets matters as much as how fast it is, a walk that stops early is cheap
+  Callstack::Stackwalk *call = Callstack::Collect();
+  bench.SetCounter("frames", (double)call->NumLevels());
+  delete call;
+
+  bench.SetItemsPerIteration(1);
+
+  while(bench.KeepRunning())
+  {
+    call = Callstack::Collect();
+    delete call;
+  }
+}
+
+// every level reads a volatile after the call so it can't become a tail call or a loop, and each
+// level stays on the stack
+static __attribute__((noinline)) int Recurse(Benchmark &bench, int depth, const UnwinderCase &c)
+{
+  volatile int level = depth;
+
+  if(depth == 0)
+  {
+    RunCollect(bench, c);
+    return 0;
+  }
+
+  int ret = Recurse(bench, depth - 1, c);
+  return ret + level;
+}
+
+RDOC_BENCHMARK(Callstack)
+{
+  Callstack::Init();
+
+  for(size_t i = 0; i < ARRAY_COUNT(unwinderCases); i++)
+    Recurse(bench, stackDepth, unwinderCases[i]);
+
+  Callstack::SetUnwinder(Callstack::eUnwinder_System);
+}
@@ -0,0 +1,127 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "serialise/serialiser.h"
+#include "bench.h"
+
+// FindDiffRange runs on every map/unmap of a persistently tracked buffer, comparing the shadow
+// copy against the application's memory, so it's measured from a typical buffer up to the largest
+// allocations applications make.
+static const size_t diffSizes[] = {
+    1024 * 1024, 16 * 1024 * 1024, 256 * 1024 * 1024, 1024 * 1024 * 1024,
+};
+
+enum DiffCase
+{
+  eDiff_Identical,
+  eDiff_Middle,
+  eDiff_Ends,
+  eDiff_Count,
+};
+
+static const char *diffCaseNames[] = {"Identical", "DiffMiddle", "DiffEnds"};
+
+struct DiffBuffers
+{
+  DiffBuffers(size_t s) : size(s), a(NULL), b(NULL) {}
+  ~DiffBuffers()
+  {
+    Serialiser::FreeAlignedBuffer(a);
+    Serialiser::FreeAlignedBuffer(b);
+  }
+
+  // only allocate once a measurement needs them, the largest size is 2GB in total
+  void Prepare()
+  {
+    if(a)
+      return;
+
+    a = Serialiser::AllocAlignedBuffer(size);
+    b = Serialiser::AllocAlignedBuffer(size);
+
+    uint32_t seed = 0x2545f491;
+    for(size_t i = 0; i < size; i += sizeof(uint32_t))
+    {
+      seed = seed * 1664525 + 1013904223;
+      memcpy(a + i, &seed, sizeof(uint32_t));
+    }
+    memcpy(b, a, size);
+  }
+
+  // modify b in place for the given case. Each call undoes the previous one
+  void SetCase(DiffCase c)
+  {
+    memcpy(b, a, 16);
+    memcpy(b + size / 2, a + size / 2, 16);
+    memcpy(b + size - 16, a + size - 16, 16);
+
+    if(c == eDiff_Middle)
+    {
+      b[size / 2] ^= 0xff;
+    }
+    else if(c == eDiff_Ends)
+    {
+      b[0] ^= 0xff;
+      b[size - 1] ^= 0xff;
+    }
+  }
+
+  size_t size;
+  byte *a, *b;
+};
+
+RDOC_BENCHMARK(FindDiffRange)
+{
+  for(size_t s = 0; s < ARRAY_COUNT(diffSizes); s++)
+  {
+    DiffBuffers buffers(diffSizes[s]);
+
+    for(int c = 0; c < eDiff_Count; c++)
+    {
+      std::string name =
+          StringFormat::Fmt("FindDiffRange/%lluMB/%s",
+                            (unsigned long long)(diffSizes[s] / (1024 * 1024)), diffCaseNames[c]);
+
+      if(!bench.Start(name.c_str()))
+        continue;
+
+      bench.PauseTiming();
+      buffers.Prepare();
+      buffers.SetCase(DiffCase(c));
+      bench.ResumeTiming();
+
+      bench.SetBytesPerIteration(diffSizes[s]);
+
+      size_t diffStart = 0, diffEnd = 0;
+
+      while(bench.KeepRunning())
+        FindDiffRange(buffers.a, buffers.b, buffers.size, diffStart, diffEnd);
+
+      bool found = FindDiffRange(buffers.a, buffers.b, buffers.size, diffStart, diffEnd);
+      if(found != (c != eDiff_Identical))
+        RDCERR("Unexpected FindDiffRange result for %s", name.c_str());
+    }
+  }
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "api/replay/renderdoc_replay.h"
+#include "maths/formatpacking.h"
+#include "bench.h"
+
+struct FormatCase
+{
+  const char *name;
+  uint32_t compCount;
+  uint32_t compByteWidth;
+  FormatComponentType compType;
+  bool srgb;
+  SpecialFormat special;
+};
+
+static const FormatCase formatCases[] = {
+    {"RGBA8_UNORM", 4, 1, eCompType_UNorm, false, eSpecial_Unknown},
+    {"RGBA8_SRGB", 4, 1, eCompType_UNorm, true, eSpecial_Unknown},
+    {"RG8_SNORM", 2, 1, eCompType_SNorm, false, eSpecial_Unknown},
+    {"RGBA16_FLOAT", 4, 2, eCompType_Float, false, eSpecial_Unknown},
+    {"RGBA16_UNORM", 4, 2, eCompType_UNorm, false, eSpecial_Unknown},
+    {"RGB32_FLOAT", 3, 4, eCompType_Float, false, eSpecial_Unknown},
+    {"RGBA32_UINT", 4, 4, eCompType_UInt, false, eSpecial_Unknown},
+    {"RGB10A2_UNORM", 4, 1, eCompType_UNorm, false, eSpecial_R10G10B10A2},
+};
+
+// one million elements, about the size of a 1024x1024 texture or a large mesh
+static const size_t numElements = 1024 * 1024;
+
+RDOC_BENCHMARK(FormatDecode)
+{
+  std::vector<FloatVector> out(numElements);
+
+  for(size_t f = 0; f < ARRAY_COUNT(formatCases); f++)
+  {
+    const FormatCase &c = formatCases[f];
+
+    ResourceFormat fmt;
+    fmt.special = (c.special != eSpecial_Unknown);
+    fmt.specialFormat = c.special;
+    fmt.compCount = c.compCount;
+    fmt.compByteWidth = c.compByteWidth;
+    fmt.compType = c.compType;
+    fmt.srgbCorrected = c.srgb;
+
+    size_t stride = fmt.special ? sizeof(uint32_t) : c.compCount * c.compByteWidth;
+
+    // the contents don't matter much, but avoid all-zero so nothing is suspiciously cheap
+    std::vector<byte> data(stride * numElements);
+    uint32_t seed = 0x12345678;
+    for(size_t i = 0; i < data.size(); i++)
+    {
+      seed = seed * 1664525 + 1013904223;
+      data[i] = byte(seed >> 24);
+    }
+
+    // halves with an all-ones exponent are inf/nan, keep them finite like real data
+    if(c.compType == eCompType_Float && c.compByteWidth == 2)
+      for(size_t i = 1; i < data.size(); i += 2)
+        data[i] &= 0xbb;
+
+    const byte *begin = &data[0];
+    const byte *end = begin + data.size();
+
+    std::string name = std::string("FormatDecode/") + c.name;
+
+    if(bench.Start((name + "/Batch").c_str()))
+    {
+      bench.SetBytesPerIteration(data.size());
+      bench.SetItemsPerIteration(numElements);
+
+      while(bench.KeepRunning())
+        DecodeFormattedComponents(fmt, begin, end, stride, numElements, &out[0]);
+    }
+
+    // the previous one-component-at-a-time path, for comparison
+    if(!fmt.special && bench.Start((name + "/ConvertComponent").c_str()))
+    {
+      bench.SetBytesPerIteration(data.size());
+      bench.SetItemsPerIteration(numElements);
+
+      while(bench.KeepRunning())
+      {
+        byte *src = &data[0];
+        for(size_t i = 0; i < numElements; i++)
+        {
+          float *o = &out[i].x;
+          for(uint32_t comp = 0; comp < c.compCount; comp++)
+            o[comp] = ConvertComponent(fmt, src + comp * c.compByteWidth);
+          src += stride;
+        }
+      }
+    }
+  }
+}
+
+RDOC_BENCHMARK(HalfConvert)
+{
+  // cover the whole half range - normals, subnormals, zeroes, infs and nans
+  std::vector<uint16_t> halves(numElements);
+  for(size_t i = 0; i < numElements; i++)
+    halves[i] = uint16_t(i * 40503);
+
+  std::vector<float> floats(numElements);
+  for(size_t i = 0; i < numElements; i++)
+    floats[i] = ConvertFromHalf(halves[i]);
+
+  if(bench.Start("HalfConvert/ConvertFromHalf"))
+  {
+    bench.SetBytesPerIteration(numElements * sizeof(uint16_t));
+    bench.SetItemsPerIteration(numElements);
+
+    while(bench.KeepRunning())
+      for(size_t i = 0; i < numElements; i++)
+        floats[i] = ConvertFromHalf(halves[i]);
+  }
+
+  if(bench.Start("HalfConvert/ConvertToHalf"))
+  {
+    bench.SetBytesPerIteration(numElements * sizeof(float));
+    bench.SetItemsPerIteration(numElements);
+
+    while(bench.KeepRunning())
+      for(size_t i = 0; i < numElements; i++)
+        halves[i] = ConvertToHalf(floats[i]);
+  }
+}
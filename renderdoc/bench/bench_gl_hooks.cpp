@@ -0,0 +1,134 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include <string.h>
+#include <strings.h>
+#include <string>
+#include <vector>
+#include "common/common.h"
+#include "driver/gl/gl_hookset_defs.h"
+#include "bench.h"
+
+// defined in gl_hooks_linux.cpp
+struct GLHookEntry;
+const GLHookEntry *FindGLHookEntry(const char *name);
+
+// every GL 4.5 core and extension entry point that hookset.pl knows about - hooked functions,
+// their aliases and the unsupported dummies - which is what a loader resolves at startup.
+#define HookTableEntry(function) STRINGIZE(function),
+#define HookTableAlias(function, alias) STRINGIZE(alias),
+#define UnsupportedTableEntry(function) STRINGIZE(function),
+
+static const char *const glNames[] = {GLHookTable() GLUnsupportedTable()};
+
+// the if() chain that glXGetProcAddress used before the sorted tables, without the side effects
+#define HookInit(function)               \
+  if(!strcmp(func, STRINGIZE(function))) \
+    return true;
+#define HookExtension(funcPtrType, function) \
+  if(!strcmp(func, STRINGIZE(function)))     \
+    return true;
+#define HookExtensionAlias(funcPtrType, function, alias) \
+  if(!strcmp(func, STRINGIZE(alias)))                    \
+    return true;
+#define HandleUnsupported(funcPtrType, function) \
+  if(lowername == STRINGIZE(function))           \
+    return true;
+
+static bool StrcmpChainLookup(const char *func)
+{
+  DLLExportHooks();
+  HookCheckGLExtensions();
+
+  std::string lowername = func;
+  for(size_t i = 0; i < lowername.size(); i++)
+    lowername[i] = (char)tolower(lowername[i]);
+
+  CheckUnsupported();
+
+  return false;
+}
+
+RDOC_BENCHMARK(GLHookLookup)
+{
+  const size_t numNames = ARRAY_COUNT(glNames);
+
+  // names a loader might ask for that we don't hook - window system functions and entry points
+  // newer than our headers
+  std::vector<std::string> unknownNames;
+  for(size_t i = 0; i < numNames; i++)
+    unknownNames.push_back(std::string(glNames[i]) + "NEWVENDOR");
+  unknownNames.push_back("glXCreateContextAttribsARB");
+  unknownNames.push_back("eglGetDisplay");
+  unknownNames.push_back("vkGetInstanceProcAddr");
+
+  if(bench.Start("GLHookLookup/Table"))
+  {
+    bench.SetItemsPerIteration(numNames);
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < numNames; i++)
+        if(FindGLHookEntry(glNames[i]) == NULL)
+          RDCERR("%s wasn't found", glNames[i]);
+    }
+  }
+
+  if(bench.Start("GLHookLookup/StrcmpChain"))
+  {
+    bench.SetItemsPerIteration(numNames);
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < numNames; i++)
+        if(!StrcmpChainLookup(glNames[i]))
+          RDCERR("%s wasn't found", glNames[i]);
+    }
+  }
+
+  if(bench.Start("GLHookLookup/TableMiss"))
+  {
+    bench.SetItemsPerIteration(unknownNames.size());
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < unknownNames.size(); i++)
+        if(FindGLHookEntry(unknownNames[i].c_str()) != NULL)
+          RDCERR("%s was unexpectedly found", unknownNames[i].c_str());
+    }
+  }
+
+  if(bench.Start("GLHookLookup/StrcmpChainMiss"))
+  {
+    bench.SetItemsPerIteration(unknownNames.size());
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < unknownNames.size(); i++)
+        if(StrcmpChainLookup(unknownNames[i].c_str()))
+          RDCERR("%s was unexpectedly found", unknownNames[i].c_str());
+    }
+  }
+}
@@ -0,0 +1,313 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "api/replay/version.h"
+#include "bench.h"
+
+struct RegisteredBenchmark
+{
+  const char *name;
+  BenchmarkFunction func;
+};
+
+static std::vector<RegisteredBenchmark> &GetRegisteredBenchmarks()
+{
+  // function-local so registration order between translation units doesn't matter
+  static std::vector<RegisteredBenchmark> benchmarks;
+  return benchmarks;
+}
+
+BenchmarkRegistration::BenchmarkRegistration(const char *name, BenchmarkFunction func)
+{
+  RegisteredBenchmark b = {name, func};
+  GetRegisteredBenchmarks().push_back(b);
+}
+
+Benchmark::Benchmark(const std::vector<std::string> &filters,
+                     const std::vector<std::string> &inputs, double minTimeMS)
+    : m_Filters(filters), m_Inputs(inputs), m_MinTimeMS(minTimeMS)
+{
+  m_Running = m_Paused = false;
+  m_NextCheck = 1;
+  m_PausedMS = 0.0;
+}
+
+bool Benchmark::Start(const char *name)
+{
+  Finish();
+
+  bool match = m_Filters.empty();
+  for(size_t i = 0; i < m_Filters.size(); i++)
+    if(strstr(name, m_Filters[i].c_str()))
+      match = true;
+
+  if(!match)
+    return false;
+
+  m_Current = BenchmarkResult();
+  m_Current.name = name;
+  m_Current.iterations = 0;
+  m_Current.totalMS = 0.0;
+  m_Current.bytesPerIteration = 0;
+  m_Current.itemsPerIteration = 0;
+
+  m_Running = true;
+  m_Paused = false;
+  m_NextCheck = 1;
+  m_PausedMS = 0.0;
+
+  fprintf(stderr, "Running %s...\n", name);
+
+  m_Timer.Restart();
+
+  return true;
+}
+
+bool Benchmark::KeepRunning()
+{
+  if(!m_Running)
+    return false;
+
+  // the first call starts the loop, every subsequent call is the end of one iteration
+  if(m_Current.iterations++ < m_NextCheck)
+    return true;
+
+  double elapsed = m_Timer.GetMilliseconds() - m_PausedMS;
+
+  if(elapsed < m_MinTimeMS)
+  {
+    m_NextCheck *= 2;
+    return true;
+  }
+
+  // don't count the call that started the loop
+  m_Current.iterations--;
+  m_Current.totalMS = elapsed;
+  m_Results.push_back(m_Current);
+  m_Running = false;
+
+  return false;
+}
+
+void Benchmark::PauseTiming()
+{
+  RDCASSERT(!m_Paused);
+  m_Paused = true;
+  m_PauseTimer.Restart();
+}
+
+void Benchmark::ResumeTiming()
+{
+  RDCASSERT(m_Paused);
+  m_Paused = false;
+  m_PausedMS += m_PauseTimer.GetMilliseconds();
+}
+
+void Benchmark::Finish()
+{
+  if(m_Running)
+    RDCERR("Benchmark %s didn't finish its loop", m_Current.name.c_str());
+
+  m_Running = false;
+}
+
+static void PrintResults(const std::vector<BenchmarkResult> &results)
+{
+  printf("%-48s %12s %14s %14s\n", "Benchmark", "Iterations", "Time/iter", "Throughput");
+
+  for(size_t i = 0; i < results.size(); i++)
+  {
+    const BenchmarkResult &r = results[i];
+
+    double nsPerIter = r.iterations ? (r.totalMS * 1000000.0) / double(r.iterations) : 0.0;
+    double seconds = r.totalMS / 1000.0;
+
+    std::string time;
+    if(nsPerIter >= 1000000.0)
+      time = StringFormat::Fmt("%.3f ms", nsPerIter / 1000000.0);
+    else if(nsPerIter >= 1000.0)
+      time = StringFormat::Fmt("%.3f us", nsPerIter / 1000.0);
+    else
+      time = StringFormat::Fmt("%.1f ns", nsPerIter);
+
+    std::string throughput;
+    if(r.bytesPerIteration && seconds > 0.0)
+      throughput = StringFormat::Fmt(
+          "%.1f MB/s", double(r.bytesPerIteration * r.iterations) / (1024.0 * 1024.0) / seconds);
+    else if(r.itemsPerIteration && seconds > 0.0)
+      throughput =
+          StringFormat::Fmt("%.1f M/s", double(r.itemsPerIteration * r.iterations) / 1e6 / seconds);
+
+    std::string counters;
+    for(size_t c = 0; c < r.counters.size(); c++)
+      counters += StringFormat::Fmt(" %s=%g", r.counters[c].first.c_str(), r.counters[c].second);
+
+    printf("%-48s %12llu %14s %14s%s\n", r.name.c_str(), (unsigned long long)r.iterations,
+           time.c_str(), throughput.c_str(), counters.c_str());
+  }
+}
+
+static std::string EscapeJSON(const std::string &str)
+{
+  std::string ret;
+  for(size_t i = 0; i < str.size(); i++)
+  {
+    char c = str[i];
+    if(c == '"' || c == '\\')
+      ret += '\\';
+    if((unsigned char)c < 0x20)
+      ret += StringFormat::Fmt("\\u%04x", (uint32_t)c);
+    else
+      ret += c;
+  }
+  return ret;
+}
+
+// writes the results in a machine-readable form so runs can be compared and tracked over time
+static bool WriteJSON(const char *filename, const std::vector<BenchmarkResult> &results,
+                      double minTimeMS)
+{
+  FILE *f = fopen(filename, "w");
+  if(!f)
+  {
+    fprintf(stderr, "Couldn't open '%s' for writing\n", filename);
+    return false;
+  }
+
+  fprintf(f, "{\n");
+  fprintf(f, "  \"context\": {\n");
+  fprintf(f, "    \"version\": \"%s\",\n", RENDERDOC_VERSION_STRING);
+  fprintf(f, "    \"git_commit\": \"%s\",\n", GIT_COMMIT_HASH);
+  fprintf(f, "    \"arch\": \"%s\",\n", sizeof(uintptr_t) == sizeof(uint64_t) ? "x64" : "x86");
+  fprintf(f, "    \"min_time_ms\": %.3f\n", minTimeMS);
+  fprintf(f, "  },\n");
+  fprintf(f, "  \"benchmarks\": [");
+
+  for(size_t i = 0; i < results.size(); i++)
+  {
+    const BenchmarkResult &r = results[i];
+
+    double nsPerIter = r.iterations ? (r.totalMS * 1000000.0) / double(r.iterations) : 0.0;
+    double seconds = r.totalMS / 1000.0;
+    double bytesPerSec =
+        seconds > 0.0 ? double(r.bytesPerIteration) * double(r.iterations) / seconds : 0.0;
+    double itemsPerSec =
+        seconds > 0.0 ? double(r.itemsPerIteration) * double(r.iterations) / seconds : 0.0;
+
+    fprintf(f, "%s\n    {\n", i > 0 ? "," : "");
+    fprintf(f, "      \"name\": \"%s\",\n", EscapeJSON(r.name).c_str());
+    fprintf(f, "      \"iterations\": %llu,\n", (unsigned long long)r.iterations);
+    fprintf(f, "      \"real_time_ns\": %.3f,\n", nsPerIter);
+    fprintf(f, "      \"bytes_per_second\": %.1f,\n", bytesPerSec);
+    fprintf(f, "      \"items_per_second\": %.1f", itemsPerSec);
+    for(size_t c = 0; c < r.counters.size(); c++)
+      fprintf(f, ",\n      \"%s\": %g", EscapeJSON(r.counters[c].first).c_str(),
+              r.counters[c].second);
+    fprintf(f, "\n");
+    fprintf(f, "    }");
+  }
+
+  fprintf(f, "\n  ]\n}\n");
+  fclose(f);
+
+  return true;
+}
+
+static void PrintUsage(const char *exe)
+{
+  fprintf(stderr, "Usage: %s [options] [inputs...]\n", exe);
+  fprintf(stderr, "  --filter <substr>   Only run measurements whose name contains substr.\n");
+  fprintf(stderr, "                      Can be given multiple times.\n");
+  fprintf(stderr, "  --min-time <ms>     Minimum time to run each measurement for (default 500).\n");
+  fprintf(stderr, "  --list              List the registered benchmarks and exit.\n");
+  fprintf(stderr, "  --json <file>       Also write the results as JSON to file.\n");
+  fprintf(stderr, "  inputs              Files or directories with real-world data for the\n");
+  fprintf(stderr, "                      benchmarks that use it, e.g. SPIR-V modules.\n");
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<std::string> filters;
+  std::vector<std::string> inputs;
+  double minTimeMS = 500.0;
+  const char *jsonFile = NULL;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(!strcmp(argv[i], "--filter") && i + 1 < argc)
+    {
+      filters.push_back(argv[++i]);
+    }
+    else if(!strcmp(argv[i], "--min-time") && i + 1 < argc)
+    {
+      minTimeMS = atof(argv[++i]);
+    }
+    else if(!strcmp(argv[i], "--json") && i + 1 < argc)
+    {
+      jsonFile = argv[++i];
+    }
+    else if(!strcmp(argv[i], "--list"))
+    {
+      std::vector<RegisteredBenchmark> &benchmarks = GetRegisteredBenchmarks();
+      for(size_t b = 0; b < benchmarks.size(); b++)
+        printf("%s\n", benchmarks[b].name);
+      return 0;
+    }
+    else if(!strcmp(argv[i], "--help") || !strcmp(argv[i], "-h"))
+    {
+      PrintUsage(argv[0]);
+      return 0;
+    }
+    else if(argv[i][0] == '-')
+    {
+      fprintf(stderr, "Unknown option '%s'\n", argv[i]);
+      PrintUsage(argv[0]);
+      return 1;
+    }
+    else
+    {
+      inputs.push_back(argv[i]);
+    }
+  }
+
+  Benchmark bench(filters, inputs, minTimeMS);
+
+  std::vector<RegisteredBenchmark> &benchmarks = GetRegisteredBenchmarks();
+  for(size_t b = 0; b < benchmarks.size(); b++)
+  {
+    benchmarks[b].func(bench);
+    bench.Finish();
+  }
+
+  PrintResults(bench.GetResults());
+
+  if(jsonFile && !WriteJSON(jsonFile, bench.GetResults(), minTimeMS))
+    return 1;
+
+  return 0;
+}
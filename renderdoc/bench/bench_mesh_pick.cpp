@@ -0,0 +1,137 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "api/replay/renderdoc_replay.h"
+#include "replay/mesh_picker.h"
+#include "bench.h"
+
+// a bumpy 1024x1024 quad grid, two million triangles - about the size of a dense scanned mesh
+static const uint32_t gridSize = 1024;
+static const uint32_t numRays = 1000;
+
+static void MakeGrid(std::vector<FloatVector> &positions, std::vector<uint32_t> &indices)
+{
+  const uint32_t gridVerts = gridSize + 1;
+
+  positions.resize(gridVerts * gridVerts);
+
+  uint32_t seed = 0x12345678;
+  for(uint32_t y = 0; y < gridVerts; y++)
+  {
+    for(uint32_t x = 0; x < gridVerts; x++)
+    {
+      seed = seed * 1664525 + 1013904223;
+      float height = float(seed >> 8) / float(1 << 24);
+      positions[y * gridVerts + x] = FloatVector(float(x), height, float(y), 1.0f);
+    }
+  }
+
+  indices.reserve(gridSize * gridSize * 6);
+  for(uint32_t y = 0; y < gridSize; y++)
+  {
+    for(uint32_t x = 0; x < gridSize; x++)
+    {
+      uint32_t i = y * gridVerts + x;
+
+      indices.push_back(i);
+      indices.push_back(i + gridVerts);
+      indices.push_back(i + 1);
+
+      indices.push_back(i + 1);
+      indices.push_back(i + gridVerts);
+      indices.push_back(i + gridVerts + 1);
+    }
+  }
+}
+
+RDOC_BENCHMARK(MeshPick)
+{
+  std::vector<FloatVector> positions;
+  std::vector<uint32_t> indices;
+  MakeGrid(positions, indices);
+
+  MeshFormat fmt = {};
+  fmt.topo = eTopology_TriangleList;
+  fmt.numVerts = (uint32_t)indices.size();
+
+  // rays looking down at the grid from a camera off to one side, so each one crosses a lot of
+  // the grid's bounds before it hits
+  std::vector<Vec3f> rayPos(numRays), rayDir(numRays);
+  uint32_t seed = 0x87654321;
+  for(uint32_t i = 0; i < numRays; i++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    float tx = float(seed >> 8) / float(1 << 24) * float(gridSize);
+    seed = seed * 1664525 + 1013904223;
+    float tz = float(seed >> 8) / float(1 << 24) * float(gridSize);
+
+    rayPos[i] = Vec3f(-100.0f, 200.0f, -100.0f);
+    rayDir[i] = Vec3f(tx, 0.5f, tz) - rayPos[i];
+    rayDir[i].Normalise();
+  }
+
+  if(bench.Start("MeshPick/Build"))
+  {
+    bench.SetItemsPerIteration(indices.size() / 3);
+
+    while(bench.KeepRunning())
+    {
+      MeshPicker picker(0, 0, fmt);
+      picker.Build(&positions[0], (uint32_t)positions.size(), &indices[0], false);
+    }
+  }
+
+  MeshPicker picker(0, 0, fmt);
+  picker.Build(&positions[0], (uint32_t)positions.size(), &indices[0], false);
+
+  if(bench.Start("MeshPick/Ray"))
+  {
+    bench.SetItemsPerIteration(numRays);
+
+    while(bench.KeepRunning())
+    {
+      for(uint32_t i = 0; i < numRays; i++)
+        picker.Pick(rayPos[i], rayDir[i], Matrix4f::Identity(), 0, 0, 1.0f, 1.0f);
+    }
+  }
+
+  // a points mesh over the same vertices, picked in screen space by testing every vertex
+  fmt.topo = eTopology_PointList;
+  fmt.numVerts = (uint32_t)positions.size();
+
+  MeshPicker points(0, 0, fmt);
+  points.Build(&positions[0], (uint32_t)positions.size(), NULL, false);
+
+  Matrix4f mvp = Matrix4f::Perspective(90.0f, 0.1f, 100000.0f, 1.0f)
+                     .Mul(Matrix4f::Translation(Vec3f(-512.0f, -100.0f, -600.0f)));
+
+  if(bench.Start("MeshPick/Point"))
+  {
+    bench.SetItemsPerIteration(positions.size());
+
+    while(bench.KeepRunning())
+      points.Pick(Vec3f(), Vec3f(), mvp, 512, 512, 1024.0f, 1024.0f);
+  }
+}
@@ -0,0 +1,192 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "core/resource_manager.h"
+#include "bench.h"
+
+// stand-ins for API handles. The manager only stores and compares them
+typedef uint64_t BenchWrapped;
+typedef uint64_t BenchReal;
+
+struct BenchResourceRecord : public ResourceRecord
+{
+  enum
+  {
+    NullResource = 0
+  };
+
+  BenchResourceRecord(ResourceId id) : ResourceRecord(id, true) {}
+};
+
+class BenchResourceManager
+    : public ResourceManager<BenchWrapped, BenchReal, BenchResourceRecord>
+{
+public:
+  BenchResourceManager() : ResourceManager(WRITING_IDLE, NULL) {}
+
+private:
+  bool SerialisableResource(ResourceId id, BenchResourceRecord *record) { return true; }
+  ResourceId GetID(BenchWrapped res) { return ResourceId(); }
+  bool ResourceTypeRelease(BenchWrapped res) { return true; }
+  bool Force_InitialState(BenchWrapped res, bool prepare) { return false; }
+  bool Need_InitialStateChunk(BenchWrapped res) { return false; }
+  bool Prepare_InitialState(BenchWrapped res) { return false; }
+  bool Serialise_InitialState(ResourceId resid, BenchWrapped res) { return false; }
+  void Create_InitialState(ResourceId id, BenchWrapped live, bool hasData) {}
+  void Apply_InitialState(BenchWrapped live, InitialContentData data) {}
+};
+
+// large applications can have this many live resources - buffers, textures, views, descriptor sets
+static const size_t numResources = 100000;
+
+// a frame references fewer resources than exist, but many of them repeatedly
+static const size_t numFrameRefs = 200000;
+
+struct BenchResource
+{
+  ResourceId id;
+  BenchWrapped wrapped;
+  BenchReal real;
+};
+
+static void AddResources(BenchResourceManager &mgr, const std::vector<BenchResource> &resources)
+{
+  for(size_t i = 0; i < resources.size(); i++)
+  {
+    const BenchResource &res = resources[i];
+    mgr.AddResourceRecord(res.id);
+    mgr.AddCurrentResource(res.id, res.wrapped);
+    mgr.AddWrapper(res.wrapped, res.real);
+  }
+}
+
+static void RemoveResources(BenchResourceManager &mgr, const std::vector<BenchResource> &resources)
+{
+  for(size_t i = 0; i < resources.size(); i++)
+  {
+    const BenchResource &res = resources[i];
+    mgr.GetResourceRecord(res.id)->Delete(&mgr);
+    mgr.ReleaseCurrentResource(res.id);
+    mgr.RemoveWrapper(res.real);
+  }
+}
+
+RDOC_BENCHMARK(ResourceManager)
+{
+  std::vector<BenchResource> resources(numResources);
+  for(size_t i = 0; i < numResources; i++)
+  {
+    resources[i].id = ResourceIDGen::GetNewUniqueID();
+    resources[i].wrapped = 0x10000000ULL + i * 64;
+    resources[i].real = 0x7f0000000000ULL + i * 256;
+  }
+
+  // lookups come in an order unrelated to creation
+  std::vector<size_t> order(numFrameRefs);
+  uint32_t seed = 0xdeadbeef;
+  for(size_t i = 0; i < numFrameRefs; i++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    // bias towards a hot subset, as most draws reference the same few resources
+    size_t range = (seed & 0x3) ? numResources / 20 : numResources;
+    order[i] = (seed >> 8) % range;
+  }
+
+  BenchResourceManager mgr;
+
+  if(bench.Start("ResourceManager/Insert"))
+  {
+    bench.SetItemsPerIteration(numResources);
+
+    while(bench.KeepRunning())
+    {
+      AddResources(mgr, resources);
+
+      bench.PauseTiming();
+      RemoveResources(mgr, resources);
+      bench.ResumeTiming();
+    }
+  }
+
+  AddResources(mgr, resources);
+
+  if(bench.Start("ResourceManager/GetResourceRecord"))
+  {
+    bench.SetItemsPerIteration(numFrameRefs);
+
+    uint32_t total = 0;
+    while(bench.KeepRunning())
+      for(size_t i = 0; i < numFrameRefs; i++)
+        total += mgr.GetResourceRecord(resources[order[i]].id)->GetRefCount();
+
+    if(total == 0)
+      RDCERR("Unexpected missing records");
+  }
+
+  if(bench.Start("ResourceManager/GetCurrentResource"))
+  {
+    bench.SetItemsPerIteration(numFrameRefs);
+
+    uint64_t total = 0;
+    while(bench.KeepRunning())
+      for(size_t i = 0; i < numFrameRefs; i++)
+        total += mgr.GetCurrentResource(resources[order[i]].id);
+
+    if(total == 0)
+      RDCERR("Unexpected missing resources");
+  }
+
+  if(bench.Start("ResourceManager/GetWrapper"))
+  {
+    bench.SetItemsPerIteration(numFrameRefs);
+
+    uint64_t total = 0;
+    while(bench.KeepRunning())
+      for(size_t i = 0; i < numFrameRefs; i++)
+        total += mgr.GetWrapper(resources[order[i]].real);
+
+    if(total == 0)
+      RDCERR("Unexpected missing wrappers");
+  }
+
+  if(bench.Start("ResourceManager/MarkResourceFrameReferenced"))
+  {
+    bench.SetItemsPerIteration(numFrameRefs);
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < numFrameRefs; i++)
+        mgr.MarkResourceFrameReferenced(resources[order[i]].id,
+                                        (i & 1) ? eFrameRef_Read : eFrameRef_Write);
+
+      bench.PauseTiming();
+      mgr.ClearReferencedResources();
+      bench.ResumeTiming();
+    }
+  }
+
+  RemoveResources(mgr, resources);
+  mgr.Shutdown();
+}
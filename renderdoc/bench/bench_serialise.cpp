@@ -0,0 +1,357 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "api/replay/renderdoc_replay.h"
+#include "serialise/compressed_file_io.h"
+#include "serialise/serialiser.h"
+#include "bench.h"
+
+// arbitrary chunk indices, the serialiser doesn't interpret them
+enum BenchChunkType
+{
+  BENCH_DRAW_CHUNK = 100,
+  BENCH_BUFFER_CHUNK,
+};
+
+// roughly the parameters of an indexed instanced draw, the most common chunk in a frame
+struct DrawParams
+{
+  uint32_t mode;
+  uint32_t count;
+  uint32_t type;
+  uint64_t offset;
+  int32_t instances;
+  int32_t baseVertex;
+  ResourceId id;
+};
+
+static void SerialiseDraw(Serialiser *ser, DrawParams &draw)
+{
+  ser->Serialise("mode", draw.mode);
+  ser->Serialise("count", draw.count);
+  ser->Serialise("type", draw.type);
+  ser->Serialise("offset", draw.offset);
+  ser->Serialise("instances", draw.instances);
+  ser->Serialise("baseVertex", draw.baseVertex);
+  ser->Serialise("id", draw.id);
+}
+
+static DrawParams MakeDraw(uint32_t i)
+{
+  DrawParams draw;
+  draw.mode = 4;
+  draw.count = 3 * (i + 1);
+  draw.type = 0x1405;
+  draw.offset = uint64_t(i) * 12;
+  draw.instances = 1;
+  draw.baseVertex = int32_t(i);
+  draw.id = ResourceId();
+  return draw;
+}
+
+// e.g. a buffer or texture subresource update
+static const size_t bufferChunkSize = 64 * 1024;
+
+// enough draws that the stream is well outside of L1/L2
+static const uint32_t numDrawChunks = 20000;
+
+RDOC_BENCHMARK(Serialiser)
+{
+  std::vector<byte> payload(bufferChunkSize);
+  for(size_t i = 0; i < payload.size(); i++)
+    payload[i] = byte(i * 7 + (i >> 8));
+
+  if(bench.Start("Serialiser/WriteChunk/Draw"))
+  {
+    Serialiser ser(NULL, Serialiser::WRITING, false);
+    DrawParams draw = MakeDraw(0);
+
+    bench.SetItemsPerIteration(1);
+
+    while(bench.KeepRunning())
+    {
+      ScopedContext scope(&ser, "Draw", BENCH_DRAW_CHUNK, false);
+      SerialiseDraw(&ser, draw);
+      Chunk *chunk = scope.Get();
+      delete chunk;
+    }
+  }
+
+  // the same chunk appended to a stream, as command buffers record their commands
+  if(bench.Start("Serialiser/AppendChunk/Draw"))
+  {
+    Serialiser ser(NULL, Serialiser::WRITING, false);
+    ChunkStream stream;
+    DrawParams draw = MakeDraw(0);
+
+    bench.SetItemsPerIteration(1);
+
+    uint32_t count = 0;
+
+    while(bench.KeepRunning())
+    {
+      // reset periodically like a re-recorded command buffer, rather than growing forever
+      if(++count == numDrawChunks)
+      {
+        stream.Reset();
+        count = 0;
+      }
+
+      ScopedContext scope(&ser, "Draw", BENCH_DRAW_CHUNK, false);
+      SerialiseDraw(&ser, draw);
+      scope.Append(&stream);
+    }
+  }
+
+  if(bench.Start("Serialiser/WriteChunk/Buffer64KB"))
+  {
+    Serialiser ser(NULL, Serialiser::WRITING, false);
+
+    bench.SetBytesPerIteration(bufferChunkSize);
+
+    while(bench.KeepRunning())
+    {
+      ScopedContext scope(&ser, "BufferData", BENCH_BUFFER_CHUNK, false);
+      byte *buf = &payload[0];
+      size_t len = payload.size();
+      ser.SerialiseBuffer("data", buf, len);
+      Chunk *chunk = scope.Get();
+      delete chunk;
+    }
+  }
+
+  if(bench.Start("Serialiser/ReadChunks/Draw"))
+  {
+    bench.PauseTiming();
+
+    // write out a stream of chunks as they'd appear back to back in a capture
+    std::vector<byte> stream;
+    {
+      Serialiser ser(NULL, Serialiser::WRITING, false);
+      for(uint32_t i = 0; i < numDrawChunks; i++)
+      {
+        ScopedContext scope(&ser, "Draw", BENCH_DRAW_CHUNK, false);
+        DrawParams draw = MakeDraw(i);
+        SerialiseDraw(&ser, draw);
+        Chunk *chunk = scope.Get();
+        stream.insert(stream.end(), chunk->GetData(), chunk->GetData() + chunk->GetLength());
+        delete chunk;
+      }
+    }
+
+    Serialiser ser(stream.size(), &stream[0], false);
+
+    bench.ResumeTiming();
+
+    bench.SetBytesPerIteration(stream.size());
+    bench.SetItemsPerIteration(numDrawChunks);
+
+    uint32_t total = 0;
+
+    while(bench.KeepRunning())
+    {
+      ser.Rewind();
+
+      for(uint32_t i = 0; i < numDrawChunks; i++)
+      {
+        uint32_t chunkType = ser.PushContext(NULL, NULL, 1, false);
+        DrawParams draw;
+        SerialiseDraw(&ser, draw);
+        total += draw.count;
+        ser.PopContext(chunkType);
+      }
+    }
+
+    // make sure the reads aren't optimised away
+    if(total == 0)
+      RDCERR("Unexpected empty draws");
+  }
+
+  if(bench.Start("Serialiser/ReadChunks/Buffer64KB"))
+  {
+    bench.PauseTiming();
+
+    std::vector<byte> stream;
+    {
+      Serialiser ser(NULL, Serialiser::WRITING, false);
+      ScopedContext scope(&ser, "BufferData", BENCH_BUFFER_CHUNK, false);
+      byte *buf = &payload[0];
+      size_t len = payload.size();
+      ser.SerialiseBuffer("data", buf, len);
+      Chunk *chunk = scope.Get();
+      stream.insert(stream.end(), chunk->GetData(), chunk->GetData() + chunk->GetLength());
+      delete chunk;
+    }
+
+    Serialiser ser(stream.size(), &stream[0], false);
+
+    std::vector<byte> dest(bufferChunkSize);
+
+    bench.ResumeTiming();
+
+    bench.SetBytesPerIteration(bufferChunkSize);
+
+    while(bench.KeepRunning())
+    {
+      ser.Rewind();
+
+      uint32_t chunkType = ser.PushContext(NULL, NULL, 1, false);
+      byte *buf = &dest[0];
+      size_t len = 0;
+      ser.SerialiseBuffer("data", buf, len);
+      ser.PopContext(chunkType);
+    }
+  }
+}
+
+// about the size of a modest capture's frame data
+static const size_t compressedDataSize = 64 * 1024 * 1024;
+static const size_t compressedWriteSize = 1024 * 1024;
+
+static void GenerateCompressibleData(std::vector<byte> &data)
+{
+  // mix runs of repeated bytes with noise, so the data compresses about as well as typical chunk
+  // data rather than trivially well or not at all
+  data.resize(compressedDataSize);
+  uint32_t seed = 0x9e3779b9;
+  for(size_t i = 0; i < data.size();)
+  {
+    seed = seed * 1664525 + 1013904223;
+    size_t run = RDCMIN(size_t(seed >> 28) + 1, data.size() - i);
+    if(seed & 0x100)
+    {
+      memset(&data[i], int(seed >> 16) & 0xff, run);
+      i += run;
+    }
+    else
+    {
+      data[i++] = byte(seed >> 20);
+    }
+  }
+}
+
+static uint32_t WriteCompressed(FILE *f, const std::vector<byte> &data)
+{
+  FileIO::fseek64(f, 0, SEEK_SET);
+
+  CompressedFileIO *writer = new CompressedFileIO(f);
+
+  for(size_t offs = 0; offs < data.size(); offs += compressedWriteSize)
+    writer->Write(&data[offs], compressedWriteSize);
+  writer->Flush();
+  fflush(f);
+
+  uint32_t ret = writer->GetCompressedSize();
+  delete writer;
+
+  return ret;
+}
+
+// the read measurements need a compressed file even when the write measurement is filtered out
+static void PrepareCompressed(std::vector<byte> &data, FILE *&f, uint32_t &compressedSize)
+{
+  if(data.empty())
+    GenerateCompressibleData(data);
+  if(!f)
+    f = tmpfile();
+  if(f && compressedSize == 0)
+    compressedSize = WriteCompressed(f, data);
+}
+
+RDOC_BENCHMARK(CompressedFileIO)
+{
+  std::vector<byte> data;
+  FILE *f = NULL;
+  uint32_t compressedSize = 0;
+
+  if(bench.Start("CompressedFileIO/Write"))
+  {
+    bench.PauseTiming();
+    GenerateCompressibleData(data);
+    f = tmpfile();
+    bench.ResumeTiming();
+
+    bench.SetBytesPerIteration(compressedDataSize);
+
+    while(f && bench.KeepRunning())
+      compressedSize = WriteCompressed(f, data);
+
+    fprintf(stderr, "CompressedFileIO: %u bytes compressed to %u\n", (uint32_t)compressedDataSize,
+            compressedSize);
+  }
+
+  std::vector<byte> dest(compressedWriteSize);
+
+  if(bench.Start("CompressedFileIO/Read"))
+  {
+    bench.PauseTiming();
+    PrepareCompressed(data, f, compressedSize);
+    bench.ResumeTiming();
+
+    bench.SetBytesPerIteration(compressedDataSize);
+
+    while(f && bench.KeepRunning())
+    {
+      bench.PauseTiming();
+      FileIO::fseek64(f, 0, SEEK_SET);
+      bench.ResumeTiming();
+
+      CompressedFileIO *reader = new CompressedFileIO(f);
+
+      for(size_t offs = 0; offs < data.size(); offs += compressedWriteSize)
+        reader->Read(&dest[0], compressedWriteSize);
+
+      delete reader;
+    }
+
+    if(f && memcmp(&dest[0], &data[data.size() - compressedWriteSize], compressedWriteSize))
+      RDCERR("Decompressed data doesn't match");
+  }
+
+  if(bench.Start("CompressedFileIO/Decompress"))
+  {
+    bench.PauseTiming();
+
+    PrepareCompressed(data, f, compressedSize);
+
+    // the in-memory path, used when a capture is opened from a buffer
+    std::vector<byte> compressed(compressedSize);
+    if(f)
+    {
+      FileIO::fseek64(f, 0, SEEK_SET);
+      FileIO::fread(&compressed[0], 1, compressed.size(), f);
+    }
+
+    bench.ResumeTiming();
+
+    bench.SetBytesPerIteration(compressedDataSize);
+
+    while(f && bench.KeepRunning())
+      CompressedFileIO::Decompress(&data[0], &compressed[0], compressed.size());
+  }
+
+  if(f)
+    FileIO::fclose(f);
+}
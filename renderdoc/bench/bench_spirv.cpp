@@ -0,0 +1,166 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "api/replay/renderdoc_replay.h"
+#include "data/glsl_shaders.h"
+#include "driver/shaders/spirv/spirv_common.h"
+#include "bench.h"
+
+// the corpus is the debug shaders precompiled into this build, plus any .spv files or directories
+// of them passed on the command line
+static void LoadSPIRVCorpus(Benchmark &bench, std::vector<std::vector<uint32_t> > &corpus,
+                            uint64_t &totalBytes)
+{
+  size_t numPrecompiled = 0;
+  const PrecompiledSPIRV *precompiled = GetPrecompiledSPIRV(numPrecompiled);
+
+  for(size_t i = 0; i < numPrecompiled; i++)
+    corpus.push_back(std::vector<uint32_t>(precompiled[i].words,
+                                           precompiled[i].words + precompiled[i].numWords));
+
+  std::vector<std::string> files;
+
+  const std::vector<std::string> &inputs = bench.GetInputs();
+  for(size_t i = 0; i < inputs.size(); i++)
+  {
+    std::vector<FileIO::FoundFile> dir = FileIO::GetFilesInDirectory(inputs[i].c_str());
+
+    if(dir.size() == 1 && (dir[0].flags & FileIO::eFileProp_ErrorInvalidPath))
+    {
+      files.push_back(inputs[i]);
+      continue;
+    }
+
+    for(size_t f = 0; f < dir.size(); f++)
+    {
+      const std::string &fn = dir[f].filename;
+      if(!(dir[f].flags & FileIO::eFileProp_Directory) && fn.size() > 4 &&
+         fn.compare(fn.size() - 4, 4, ".spv") == 0)
+        files.push_back(inputs[i] + "/" + fn);
+    }
+  }
+
+  for(size_t i = 0; i < files.size(); i++)
+  {
+    std::vector<byte> contents;
+    FileIO::slurp(files[i].c_str(), contents);
+
+    if(contents.size() < 5 * sizeof(uint32_t) || (contents.size() % sizeof(uint32_t)) != 0 ||
+       *(uint32_t *)&contents[0] != (uint32_t)spv::MagicNumber)
+    {
+      fprintf(stderr, "Skipping '%s', not a SPIR-V module\n", files[i].c_str());
+      continue;
+    }
+
+    const uint32_t *words = (const uint32_t *)&contents[0];
+    corpus.push_back(std::vector<uint32_t>(words, words + contents.size() / sizeof(uint32_t)));
+  }
+
+  totalBytes = 0;
+  for(size_t i = 0; i < corpus.size(); i++)
+    totalBytes += corpus[i].size() * sizeof(uint32_t);
+}
+
+RDOC_BENCHMARK(SPIRV)
+{
+  std::vector<std::vector<uint32_t> > corpus;
+  uint64_t totalBytes = 0;
+
+  LoadSPIRVCorpus(bench, corpus, totalBytes);
+
+  if(corpus.empty())
+  {
+    fprintf(stderr, "No SPIR-V modules available, pass .spv files or directories to benchmark\n");
+    return;
+  }
+
+  fprintf(stderr, "SPIR-V corpus: %u modules, %llu bytes\n", (uint32_t)corpus.size(),
+          (unsigned long long)totalBytes);
+
+  if(bench.Start("SPIRV/ParseSPIRV"))
+  {
+    bench.SetBytesPerIteration(totalBytes);
+    bench.SetItemsPerIteration(corpus.size());
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < corpus.size(); i++)
+      {
+        SPVModule module;
+        ParseSPIRV(&corpus[i][0], corpus[i].size(), module);
+      }
+    }
+  }
+
+  // disassembly annotates the parsed module as it goes, so each iteration needs a fresh parse
+  std::vector<SPVModule *> modules(corpus.size(), (SPVModule *)NULL);
+
+  if(bench.Start("SPIRV/Disassemble"))
+  {
+    bench.SetBytesPerIteration(totalBytes);
+    bench.SetItemsPerIteration(corpus.size());
+
+    while(bench.KeepRunning())
+    {
+      bench.PauseTiming();
+      for(size_t i = 0; i < corpus.size(); i++)
+      {
+        SAFE_DELETE(modules[i]);
+        modules[i] = new SPVModule();
+        ParseSPIRV(&corpus[i][0], corpus[i].size(), *modules[i]);
+      }
+      bench.ResumeTiming();
+
+      for(size_t i = 0; i < modules.size(); i++)
+        modules[i]->Disassemble("main");
+    }
+  }
+
+  if(bench.Start("SPIRV/MakeReflection"))
+  {
+    bench.SetBytesPerIteration(totalBytes);
+    bench.SetItemsPerIteration(corpus.size());
+
+    for(size_t i = 0; i < corpus.size(); i++)
+    {
+      SAFE_DELETE(modules[i]);
+      modules[i] = new SPVModule();
+      ParseSPIRV(&corpus[i][0], corpus[i].size(), *modules[i]);
+    }
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < modules.size(); i++)
+      {
+        ShaderReflection refl;
+        ShaderBindpointMapping mapping;
+        modules[i]->MakeReflection("main", &refl, &mapping);
+      }
+    }
+  }
+
+  for(size_t i = 0; i < modules.size(); i++)
+    SAFE_DELETE(modules[i]);
+}
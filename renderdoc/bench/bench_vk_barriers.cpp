@@ -0,0 +1,174 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "api/replay/renderdoc_replay.h"
+#include "driver/vulkan/vk_manager.h"
+#include "bench.h"
+
+// a frame in an engine that regenerates mip chains and renders shadow cascades issues a barrier
+// per mip or per layer, so images with many subresources see many partial transitions.
+struct BenchImage
+{
+  WrappedVkImage *wrapped;
+  VkImage handle;
+  uint32_t levels;
+  uint32_t layers;
+  VkImageAspectFlags aspect;
+};
+
+static void AddImage(std::vector<BenchImage> &images, map<ResourceId, ImageLayouts> &layouts,
+                     uint32_t levels, uint32_t layers, VkImageAspectFlags aspect)
+{
+  BenchImage img;
+  img.wrapped =
+      new WrappedVkImage(VkImage(0x1000 + images.size()), ResourceIDGen::GetNewUniqueID());
+  img.handle = VkImage((uint64_t)img.wrapped);
+  img.levels = levels;
+  img.layers = layers;
+  img.aspect = aspect;
+  images.push_back(img);
+
+  ImageLayouts &layout = layouts[img.wrapped->id];
+  layout.levelCount = (int)levels;
+  layout.layerCount = (int)layers;
+
+  VkImageSubresourceRange range = {aspect, 0, levels, 0, layers};
+  layout.subresourceStates.push_back(
+      ImageRegionState(range, UNKNOWN_PREV_IMG_LAYOUT, VK_IMAGE_LAYOUT_UNDEFINED));
+}
+
+static void AddBarrier(std::vector<VkImageMemoryBarrier> &barriers, const BenchImage &img,
+                       VkImageLayout from, VkImageLayout to, uint32_t baseMip, uint32_t numMips,
+                       uint32_t baseLayer, uint32_t numLayers)
+{
+  VkImageMemoryBarrier b = {
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+      NULL,
+      0,
+      0,
+      from,
+      to,
+      VK_QUEUE_FAMILY_IGNORED,
+      VK_QUEUE_FAMILY_IGNORED,
+      img.handle,
+      {img.aspect, baseMip, numMips, baseLayer, numLayers},
+  };
+  barriers.push_back(b);
+}
+
+RDOC_BENCHMARK(VulkanBarriers)
+{
+  std::vector<BenchImage> images;
+  map<ResourceId, ImageLayouts> layouts;
+
+  // texture arrays and cubemaps with full mip chains, shadow cascades, plain render targets
+  for(int i = 0; i < 16; i++)
+    AddImage(images, layouts, 12, 16, VK_IMAGE_ASPECT_COLOR_BIT);
+  for(int i = 0; i < 16; i++)
+    AddImage(images, layouts, 10, 6, VK_IMAGE_ASPECT_COLOR_BIT);
+  for(int i = 0; i < 8; i++)
+    AddImage(images, layouts, 1, 4, VK_IMAGE_ASPECT_DEPTH_BIT);
+  for(int i = 0; i < 64; i++)
+    AddImage(images, layouts, 1, 1, VK_IMAGE_ASPECT_COLOR_BIT);
+
+  std::vector<VkImageMemoryBarrier> barriers;
+
+  for(size_t i = 0; i < images.size(); i++)
+  {
+    const BenchImage &img = images[i];
+
+    if(img.levels > 1)
+    {
+      // downsample each mip from the previous one, then make the whole chain readable
+      AddBarrier(barriers, img, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, img.levels, 0, img.layers);
+      for(uint32_t m = 1; m < img.levels; m++)
+        AddBarrier(barriers, img, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                   VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m - 1, 1, 0, img.layers);
+      AddBarrier(barriers, img, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                 VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, img.levels - 1, 0, img.layers);
+      AddBarrier(barriers, img, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                 VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, img.levels - 1, 1, 0, img.layers);
+    }
+    else if(img.layers > 1)
+    {
+      // render each cascade, sampling the previous ones
+      for(uint32_t l = 0; l < img.layers; l++)
+      {
+        AddBarrier(barriers, img, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                   VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, 0, 1, l, 1);
+        AddBarrier(barriers, img, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, 1, l, 1);
+      }
+    }
+    else
+    {
+      AddBarrier(barriers, img, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                 VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, 0, 1, 0, 1);
+      AddBarrier(barriers, img, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                 VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, 1, 0, 1);
+    }
+  }
+
+  VulkanResourceManager mgr(WRITING_IDLE, NULL, NULL);
+  Threading::CriticalSection lock;
+
+  if(bench.Start("Vulkan/RecordBarriers/Frame"))
+  {
+    bench.SetItemsPerIteration(barriers.size());
+
+    vector<pair<ResourceId, ImageRegionState> > states;
+    while(bench.KeepRunning())
+    {
+      states.clear();
+
+      // each barrier is a separate vkCmdPipelineBarrier in one command buffer
+      for(size_t i = 0; i < barriers.size(); i++)
+        mgr.RecordBarriers(states, layouts, lock, 1, &barriers[i]);
+    }
+  }
+
+  if(bench.Start("Vulkan/ApplyBarriers/Frame"))
+  {
+    bench.SetItemsPerIteration(barriers.size());
+
+    // submit each barrier separately, otherwise most transitions within the frame cancel out
+    // once accumulated and there's little left to apply
+    bench.PauseTiming();
+    vector<vector<pair<ResourceId, ImageRegionState> > > submits(barriers.size());
+    for(size_t i = 0; i < barriers.size(); i++)
+      mgr.RecordBarriers(submits[i], layouts, lock, 1, &barriers[i]);
+    bench.ResumeTiming();
+
+    while(bench.KeepRunning())
+      for(size_t i = 0; i < submits.size(); i++)
+        mgr.ApplyBarriers(submits[i], layouts, lock);
+  }
+
+  for(size_t i = 0; i < images.size(); i++)
+    delete images[i].wrapped;
+
+  mgr.Shutdown();
+}
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "api/replay/renderdoc_replay.h"
+#include "common/wrapped_pool.h"
+#include "bench.h"
+
+// about the size of a typical wrapped API object - a vtable, the real handle, the ID and a record
+struct BenchPooledObject
+{
+  ALLOCATE_WITH_WRAPPED_POOL(BenchPooledObject);
+
+  void *vtable;
+  void *real;
+  ResourceId id;
+  void *record;
+  uint64_t pad[4];
+};
+
+WRAPPED_POOL_INST(BenchPooledObject);
+
+static const size_t poolCount = BenchPooledObject::PoolType::AllocCount;
+
+RDOC_BENCHMARK(WrappingPool)
+{
+  std::vector<BenchPooledObject *> objs;
+  objs.reserve(poolCount * 2);
+
+  // the common case of a short-lived object, which keeps reusing the same slot
+  if(bench.Start("WrappingPool/NewDelete"))
+  {
+    bench.SetItemsPerIteration(1);
+
+    while(bench.KeepRunning())
+    {
+      BenchPooledObject *obj = new BenchPooledObject;
+      delete obj;
+    }
+  }
+
+  // fill the immediate pool completely, then free everything
+  if(bench.Start("WrappingPool/FillImmediate"))
+  {
+    bench.SetItemsPerIteration(poolCount);
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < poolCount; i++)
+        objs.push_back(new BenchPooledObject);
+      for(size_t i = 0; i < poolCount; i++)
+        delete objs[i];
+      objs.clear();
+    }
+  }
+
+  // allocate twice as many as fit in the immediate pool, so every allocation past the first half
+  // searches the full immediate pool before falling back to an additional pool
+  if(bench.Start("WrappingPool/Overflow"))
+  {
+    bench.SetItemsPerIteration(poolCount * 2);
+
+    while(bench.KeepRunning())
+    {
+      for(size_t i = 0; i < poolCount * 2; i++)
+        objs.push_back(new BenchPooledObject);
+      for(size_t i = 0; i < poolCount * 2; i++)
+        delete objs[i];
+      objs.clear();
+    }
+  }
+
+  // IsAlloc is used to validate every unwrap in development builds. Check pointers both in the
+  // immediate pool and in an additional pool, which needs the lock
+  if(bench.Start("WrappingPool/IsAlloc"))
+  {
+    bench.PauseTiming();
+    for(size_t i = 0; i < poolCount * 2; i++)
+      objs.push_back(new BenchPooledObject);
+    bench.ResumeTiming();
+
+    bench.SetItemsPerIteration(objs.size());
+
+    size_t count = 0;
+
+    while(bench.KeepRunning())
+      for(size_t i = 0; i < objs.size(); i++)
+        count += BenchPooledObject::IsAlloc(objs[i]) ? 1 : 0;
+
+    if(count == 0)
+      RDCERR("Unexpected unallocated objects");
+
+    for(size_t i = 0; i < objs.size(); i++)
+      delete objs[i];
+    objs.clear();
+  }
+}
@@ -255,6 +255,272 @@ uint64_t Log2Floor(uint64_t value)
 static string logfile;
 static void *logfileHandle = NULL;
 
+static bool log_output_enabled = false;
+
+// Log messages are formatted on the calling thread into a stack buffer, then pushed into a fixed
+// ring of slots which a logger thread drains to the actual outputs. Producers never take a lock,
+// they only claim a slot with a compare-exchange, so hooked threads that log heavily don't
+// serialise on file or console I/O.
+//
+// Anything that writes to the outputs (the logger thread, a flush, or a synchronous write) must
+// own logOutputOwner first, which keeps output ordered and lets the log file be swapped safely.
+// Messages that don't fit in a slot, or that can't be queued because the ring is still full after
+// flushing it, are written synchronously behind everything already queued - nothing is dropped.
+//
+// Ring positions are free-running counters. All arithmetic on them is done unsigned so they wrap
+// safely, the ring size divides 2^32 so a wrapped position still maps to the right slot and lap.
+
+static const int32_t logRingSize = 256;
+static const size_t logSlotSize = 512;
+
+struct LogSlot
+{
+  // the slot is free for position pos when seq == (pos & ~mask), and holds a message ready to be
+  // written when seq == (pos & ~mask) + 1. This is offset from the usual bounded queue scheme so
+  // that the zero-initialised ring is already valid before any thread starts logging.
+  volatile int32_t seq;
+  LogType type;
+  uint32_t msgOffset;
+  char text[logSlotSize];
+};
+
+static LogSlot logRing[logRingSize];
+static volatile int32_t logEnqueuePos = 0;
+static volatile int32_t logDequeuePos = 0;
+
+static volatile int32_t logOutputOwner = 0;
+
+// the PID of the process that started the logger thread, so a forked child starts its own
+static volatile int32_t logThreadPID = 0;
+static volatile int32_t logSynchronous = 0;
+static Threading::ThreadHandle logThread = 0;
+
+static int32_t rdclog_load(volatile int32_t *val)
+{
+  // compare-exchange used as a full barrier load, the value is only written if it's unchanged
+  return Atomic::CmpExch32(val, 0, 0);
+}
+
+static uint32_t rdclog_loadpos(volatile int32_t *val)
+{
+  return (uint32_t)rdclog_load(val);
+}
+
+static void rdclog_write(LogType type, const char *fullMsg, const char *msg)
+{
+#if ENABLED(OUTPUT_LOG_TO_DEBUG_OUT)
+  OSUtility::WriteOutput(OSUtility::Output_DebugMon, fullMsg);
+#endif
+#if ENABLED(OUTPUT_LOG_TO_STDOUT)
+  // don't output debug messages to stdout/stderr
+  if(type != RDCLog_Debug && log_output_enabled)
+    OSUtility::WriteOutput(OSUtility::Output_StdOut, msg);
+#endif
+#if ENABLED(OUTPUT_LOG_TO_STDERR)
+  // don't output debug messages to stdout/stderr
+  if(type != RDCLog_Debug && log_output_enabled)
+    OSUtility::WriteOutput(OSUtility::Output_StdErr, msg);
+#endif
+#if ENABLED(OUTPUT_LOG_TO_DISK)
+  if(logfileHandle)
+  {
+    // strlen used as byte length - str is UTF-8 so this is NOT number of characters
+    FileIO::logfile_append(logfileHandle, fullMsg, strlen(fullMsg));
+  }
+#endif
+}
+
+static bool rdclog_tryacquireoutput()
+{
+  return Atomic::CmpExch32(&logOutputOwner, 0, 1) == 0;
+}
+
+// waits until this thread owns the output. If a timeout is given and the output is still held
+// when it expires, returns false and the caller must not write anything.
+static bool rdclog_acquireoutput(uint32_t timeoutMS = ~0U)
+{
+  for(uint32_t i = 0;; i++)
+  {
+    if(rdclog_tryacquireoutput())
+      return true;
+
+    // output is normally only held for as long as it takes to write out the ring, so spin briefly
+    // before sleeping
+    if(timeoutMS != ~0U && i >= 100 && i - 100 >= timeoutMS)
+      return false;
+
+    Threading::Sleep(i < 100 ? 0 : 1);
+  }
+}
+
+static void rdclog_releaseoutput()
+{
+  Atomic::CmpExch32(&logOutputOwner, 1, 0);
+}
+
+// must own the output. Returns the number of messages written
+static uint32_t rdclog_drain()
+{
+  uint32_t count = 0;
+
+  for(;;)
+  {
+    uint32_t pos = (uint32_t)logDequeuePos;
+    uint32_t lap = pos & ~uint32_t(logRingSize - 1);
+    LogSlot &slot = logRing[pos & (logRingSize - 1)];
+
+    // stop at the first message that isn't ready, even if later ones are, to keep them in order
+    if(rdclog_loadpos(&slot.seq) != lap + 1)
+      break;
+
+    rdclog_write(slot.type, slot.text, slot.text + slot.msgOffset);
+    count++;
+
+    logDequeuePos = int32_t(pos + 1);
+
+    // release the slot for the next time around the ring
+    Atomic::CmpExch32(&slot.seq, int32_t(lap + 1), int32_t(lap + logRingSize));
+  }
+
+  return count;
+}
+
+// must own the output. Writes out everything queued before this call, waiting for any messages
+// that have been claimed but not yet published rather than stopping at them
+static void rdclog_drainall()
+{
+  uint32_t end = rdclog_loadpos(&logEnqueuePos);
+
+  // the wait is bounded in case the publishing thread has crashed
+  for(uint32_t i = 0; i < 1000; i++)
+  {
+    rdclog_drain();
+
+    if(int32_t(end - (uint32_t)logDequeuePos) <= 0)
+      return;
+
+    Threading::Sleep(0);
+  }
+}
+
+static bool rdclog_push(LogType type, const char *fullMsg, size_t length, size_t msgOffset)
+{
+  uint32_t pos = rdclog_loadpos(&logEnqueuePos);
+
+  for(;;)
+  {
+    uint32_t lap = pos & ~uint32_t(logRingSize - 1);
+    LogSlot &slot = logRing[pos & (logRingSize - 1)];
+
+    int32_t diff = int32_t(rdclog_loadpos(&slot.seq) - lap);
+
+    if(diff == 0)
+    {
+      // slot is free for this position, try to claim it
+      uint32_t prev = (uint32_t)Atomic::CmpExch32(&logEnqueuePos, int32_t(pos), int32_t(pos + 1));
+      if(prev == pos)
+      {
+        memcpy(slot.text, fullMsg, length);
+        slot.text[length] = 0;
+        slot.type = type;
+        slot.msgOffset = (uint32_t)msgOffset;
+
+        // publish the message
+        Atomic::CmpExch32(&slot.seq, int32_t(lap), int32_t(lap + 1));
+        return true;
+      }
+
+      pos = prev;
+    }
+    else if(diff < 0)
+    {
+      // the slot still holds a message from the last time around - the ring is full
+      return false;
+    }
+    else
+    {
+      // another thread claimed this position already
+      pos = rdclog_loadpos(&logEnqueuePos);
+    }
+  }
+}
+
+static void rdclog_thread(void *)
+{
+  uint32_t idleWait = 1;
+
+  while(rdclog_load(&logSynchronous) == 0)
+  {
+    uint32_t count = 0;
+
+    if(rdclog_tryacquireoutput())
+    {
+      count = rdclog_drain();
+      rdclog_releaseoutput();
+    }
+
+    // back off while the log is quiet, but stay responsive while it's busy
+    if(count > 0)
+      idleWait = 1;
+    else if(idleWait < 16)
+      idleWait *= 2;
+
+    Threading::Sleep(idleWait);
+  }
+}
+
+static void rdclog_startthread(uint32_t pid)
+{
+  int32_t running = rdclog_load(&logThreadPID);
+
+  if(running == (int32_t)pid)
+    return;
+
+  // only one thread gets to start the logger
+  if(Atomic::CmpExch32(&logThreadPID, running, (int32_t)pid) != running)
+    return;
+
+  // in a forked child only the forking thread exists, so if the output was held at the time of the
+  // fork nothing will ever release it.
+  if(running != 0)
+    Atomic::CmpExch32(&logOutputOwner, 1, 0);
+
+  logThread = Threading::CreateThread(&rdclog_thread, NULL);
+
+  // if we can't start a thread, fall back to writing everything synchronously
+  if(logThread == 0)
+    Atomic::CmpExch32(&logSynchronous, 0, 1);
+}
+
+static void rdclog_enqueue(LogType type, const char *fullMsg, size_t length, size_t msgOffset,
+                           uint32_t pid)
+{
+  if(rdclog_load(&logSynchronous) == 0 && length < logSlotSize)
+  {
+    rdclog_startthread(pid);
+
+    if(rdclog_push(type, fullMsg, length, msgOffset))
+    {
+      // if the log was closed while we were pushing, the logger thread may be gone and the final
+      // drain may have missed this message, so write it out now.
+      if(rdclog_load(&logSynchronous) != 0)
+        rdclog_flush();
+      return;
+    }
+
+    // the ring is full, so this thread writes it out rather than dropping the message
+    rdclog_flush();
+
+    if(rdclog_push(type, fullMsg, length, msgOffset))
+      return;
+  }
+
+  rdclog_acquireoutput();
+  rdclog_drainall();
+  rdclog_write(type, fullMsg, fullMsg + msgOffset);
+  rdclog_releaseoutput();
+}
+
 const char *rdclog_getfilename()
 {
   return logfile.c_str();
@@ -262,6 +528,10 @@ const char *rdclog_getfilename()
 
 void rdclog_filename(const char *filename)
 {
+  // write out anything queued to the current log and keep the logger thread off the handle
+  rdclog_acquireoutput();
+  rdclog_drainall();
+
   string previous = logfile;
 
   logfile = "";
@@ -269,6 +539,7 @@ void rdclog_filename(const char *filename)
     logfile = filename;
 
   FileIO::logfile_close(logfileHandle);
+  logfileHandle = NULL;
 
   if(!logfile.empty())
   {
@@ -286,9 +557,9 @@ void rdclog_filename(const char *filename)
       FileIO::Delete(previous.c_str());
     }
   }
-}
 
-static bool log_output_enabled = false;
+  rdclog_releaseoutput();
+}
 
 void rdclog_enableoutput()
 {
@@ -297,45 +568,62 @@ void rdclog_enableoutput()
 
 void rdclog_closelog()
 {
+  // stop the logger thread and wait for it to exit, then write out whatever is left in the ring
+  // ourselves. Anything logged after this point is written synchronously.
+  Atomic::CmpExch32(&logSynchronous, 0, 1);
+
+  if(logThread && rdclog_load(&logThreadPID) == (int32_t)Process::GetCurrentPID())
+  {
+    Threading::JoinThread(logThread);
+    Threading::CloseThread(logThread);
+    logThread = 0;
+  }
+
+  rdclog_acquireoutput();
+
+  // keep going until the ring is empty, picking up any message pushed by a thread that checked
+  // logSynchronous just before it was set
+  while(rdclog_loadpos(&logEnqueuePos) != (uint32_t)logDequeuePos)
+  {
+    uint32_t dequeued = (uint32_t)logDequeuePos;
+
+    rdclog_drainall();
+
+    // a slot was claimed but never published, the thread that claimed it must have died
+    if((uint32_t)logDequeuePos == dequeued)
+      break;
+  }
+
   log_output_enabled = false;
   if(logfileHandle)
     FileIO::logfile_close(logfileHandle);
+  logfileHandle = NULL;
+
+  rdclog_releaseoutput();
 }
 
 void rdclog_flush()
 {
+  // called from RenderDoc's crash handler before the dump is written, so it never waits forever on
+  // the output. If that can't be acquired in time (e.g. the crashing thread owns it) nothing is
+  // written, and anything queued stays in the ring for the owner to write out.
+  if(rdclog_acquireoutput(1000))
+  {
+    rdclog_drainall();
+    rdclog_releaseoutput();
+  }
 }
 
 void rdclogprint_int(LogType type, const char *fullMsg, const char *msg)
 {
-  static Threading::CriticalSection lock;
-
-  SCOPED_LOCK(lock);
-
-#if ENABLED(OUTPUT_LOG_TO_DEBUG_OUT)
-  OSUtility::WriteOutput(OSUtility::Output_DebugMon, fullMsg);
-#endif
-#if ENABLED(OUTPUT_LOG_TO_STDOUT)
-  // don't output debug messages to stdout/stderr
-  if(type != RDCLog_Debug && log_output_enabled)
-    OSUtility::WriteOutput(OSUtility::Output_StdOut, msg);
-#endif
-#if ENABLED(OUTPUT_LOG_TO_STDERR)
-  // don't output debug messages to stdout/stderr
-  if(type != RDCLog_Debug && log_output_enabled)
-    OSUtility::WriteOutput(OSUtility::Output_StdErr, msg);
-#endif
-#if ENABLED(OUTPUT_LOG_TO_DISK)
-  if(logfileHandle)
-  {
-    // strlen used as byte length - str is UTF-8 so this is NOT number of characters
-    FileIO::logfile_append(logfileHandle, fullMsg, strlen(fullMsg));
-  }
-#endif
+  // used for fatal messages, so write synchronously behind anything already queued
+  rdclog_acquireoutput();
+  rdclog_drainall();
+  rdclog_write(type, fullMsg, msg);
+  rdclog_releaseoutput();
 }
 
 const size_t rdclog_outBufSize = 4 * 1024;
-static char rdclog_outputBuffer[rdclog_outBufSize + 1];
 
 void rdclog_int(LogType type, const char *project, const char *file, unsigned int line,
                 const char *fmt, ...)
@@ -365,18 +653,18 @@ void rdclog_int(LogType type, const char *project, const char *file, unsigned in
       "Debug  ", "Log    ", "Warning", "Error  ", "Fatal  ",
   };
 
-  static Threading::CriticalSection lock;
-
-  SCOPED_LOCK(lock);
+  // each thread formats into its own buffer, only the queue is shared
+  char outputBuffer[rdclog_outBufSize + 1];
 
-  rdclog_outputBuffer[rdclog_outBufSize] = rdclog_outputBuffer[0] = 0;
+  outputBuffer[rdclog_outBufSize] = outputBuffer[0] = 0;
 
-  char *output = rdclog_outputBuffer;
+  char *output = outputBuffer;
   size_t available = rdclog_outBufSize;
 
-  int numWritten =
-      StringFormat::snprintf(output, available, "% 4s %06u: %s%s%s - ", project,
-                             Process::GetCurrentPID(), timestamp, location, typestr[type]);
+  uint32_t pid = Process::GetCurrentPID();
+
+  int numWritten = StringFormat::snprintf(output, available, "% 4s %06u: %s%s%s - ", project, pid,
+                                          timestamp, location, typestr[type]);
 
   if(numWritten < 0)
   {
@@ -406,5 +694,9 @@ void rdclog_int(LogType type, const char *project, const char *file, unsigned in
   *output = '\n';
   *(output + 1) = 0;
 
-  rdclogprint_int(type, rdclog_outputBuffer, noPrefixOutput);
+  rdclog_enqueue(type, outputBuffer, output + 1 - outputBuffer, noPrefixOutput - outputBuffer, pid);
+
+  // make sure errors are on disk before we carry on, in case they're followed by a crash
+  if(type >= RDCLog_Error)
+    rdclog_flush();
 }
@@ -615,7 +615,7 @@ DXGI_FORMAT ResourceFormat2DXGIFormat(ResourceFormat format)
   return DXGI_FORMAT_UNKNOWN;
 }
 
-bool write_dds_to_file(FILE *f, const dds_data &data)
+bool write_dds_header(FILE *f, const dds_data &data)
 {
   if(!f)
     return false;
@@ -794,49 +794,78 @@ bool write_dds_to_file(FILE *f, const dds_data &data)
     header.ddspf.dwFourCC = MAKE_FOURCC('D', 'X', '1', '0');
   }
 
+  FileIO::fwrite(&magic, sizeof(magic), 1, f);
+  FileIO::fwrite(&header, sizeof(header), 1, f);
+  if(dx10Header)
+    FileIO::fwrite(&headerDXT10, sizeof(headerDXT10), 1, f);
+
+  return true;
+}
+
+void write_dds_subresource(FILE *f, const dds_data &data, int mip, const byte *bytedata)
+{
+  bool blockFormat = false;
+  uint32_t bytesPerPixel = 1;
+
+  switch(data.format.specialFormat)
   {
-    FileIO::fwrite(&magic, sizeof(magic), 1, f);
-    FileIO::fwrite(&header, sizeof(header), 1, f);
-    if(dx10Header)
-      FileIO::fwrite(&headerDXT10, sizeof(headerDXT10), 1, f);
+    case eSpecial_BC1:
+    case eSpecial_BC2:
+    case eSpecial_BC3:
+    case eSpecial_BC4:
+    case eSpecial_BC5:
+    case eSpecial_BC6:
+    case eSpecial_BC7: blockFormat = data.format.special; break;
+    case eSpecial_S8: bytesPerPixel = 1; break;
+    case eSpecial_R10G10B10A2:
+    case eSpecial_R9G9B9E5:
+    case eSpecial_R11G11B10:
+    case eSpecial_D24S8: bytesPerPixel = 4; break;
+    case eSpecial_R5G6B5:
+    case eSpecial_R5G5B5A1:
+    case eSpecial_R4G4B4A4: bytesPerPixel = 2; break;
+    case eSpecial_D32S8: bytesPerPixel = 8; break;
+    default: bytesPerPixel = data.format.compCount * data.format.compByteWidth;
+  }
 
-    int i = 0;
-    for(int slice = 0; slice < RDCMAX(1, data.slices); slice++)
-    {
-      for(int mip = 0; mip < RDCMAX(1, data.mips); mip++)
-      {
-        int numdepths = RDCMAX(1, data.depth >> mip);
-        for(int d = 0; d < numdepths; d++)
-        {
-          byte *bytedata = data.subdata[i];
+  int rowlen = RDCMAX(1, data.width >> mip);
+  int numRows = RDCMAX(1, data.height >> mip);
+  int pitch = RDCMAX(1U, rowlen * bytesPerPixel);
 
-          int rowlen = RDCMAX(1, data.width >> mip);
-          int numRows = RDCMAX(1, data.height >> mip);
-          int pitch = RDCMAX(1U, rowlen * bytesPerPixel);
+  // pitch/rows are in blocks, not pixels, for block formats.
+  if(blockFormat)
+  {
+    numRows = RDCMAX(1, numRows / 4);
 
-          // pitch/rows are in blocks, not pixels, for block formats.
-          if(blockFormat)
-          {
-            numRows = RDCMAX(1, numRows / 4);
+    int blockSize =
+        (data.format.specialFormat == eSpecial_BC1 || data.format.specialFormat == eSpecial_BC4)
+            ? 8
+            : 16;
 
-            int blockSize = (data.format.specialFormat == eSpecial_BC1 ||
-                             data.format.specialFormat == eSpecial_BC4)
-                                ? 8
-                                : 16;
+    pitch = RDCMAX(blockSize, (((rowlen + 3) / 4)) * blockSize);
+  }
 
-            pitch = RDCMAX(blockSize, (((rowlen + 3) / 4)) * blockSize);
-          }
+  for(int row = 0; row < numRows; row++)
+  {
+    FileIO::fwrite(bytedata, 1, pitch, f);
 
-          for(int row = 0; row < numRows; row++)
-          {
-            FileIO::fwrite(bytedata, 1, pitch, f);
+    bytedata += pitch;
+  }
+}
 
-            bytedata += pitch;
-          }
+bool write_dds_to_file(FILE *f, const dds_data &data)
+{
+  if(!write_dds_header(f, data))
+    return false;
 
-          i++;
-        }
-      }
+  int i = 0;
+  for(int slice = 0; slice < RDCMAX(1, data.slices); slice++)
+  {
+    for(int mip = 0; mip < RDCMAX(1, data.mips); mip++)
+    {
+      int numdepths = RDCMAX(1, data.depth >> mip);
+      for(int d = 0; d < numdepths; d++)
+        write_dds_subresource(f, data, mip, data.subdata[i++]);
     }
   }
 
@@ -46,3 +46,9 @@ struct dds_data
 extern bool is_dds_file(FILE *f);
 extern dds_data load_dds_from_file(FILE *f);
 extern bool write_dds_to_file(FILE *f, const dds_data &data);
+
+// for streaming out subresources as they become available, without holding them all in memory.
+// After the header, each subresource must be written in the same order write_dds_to_file uses:
+// for each slice, for each mip, for each depth slice. data.subdata is not used.
+extern bool write_dds_header(FILE *f, const dds_data &data);
+extern void write_dds_subresource(FILE *f, const dds_data &data, int mip, const byte *bytes);
@@ -0,0 +1,254 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+
+#include "exr_write.h"
+#include <string.h>
+#include "3rdparty/tinyexr/tinyexr_miniz.h"
+#include "common/worker_pool.h"
+#include "maths/half_convert.h"
+#include "os/os_specific.h"
+
+// ZIP compression in EXR always covers 16 scanlines per block
+static const uint32_t EXRLinesPerBlock = 16;
+
+// blocks are grouped into bands of roughly this many uncompressed bytes for each pool job
+static const size_t EXRBandSize = 1024 * 1024;
+
+static const int EXRCompressionLevel = 6;
+
+static const uint32_t EXRNumChannels = 4;
+
+struct EXRBandJob : public Threading::WorkerJob
+{
+  EXRFetchRow fetchRow;
+  const void *userdata;
+  uint32_t width;
+  uint32_t height;
+  uint32_t firstBlock;
+  uint32_t numBlocks;
+
+  // outputs. Each block is stored ready to write - y, compressed size, then the data.
+  std::vector<byte> blocks;
+  std::vector<uint32_t> blockSizes;
+  bool success;
+
+  void Run()
+  {
+    const size_t lineBytes = size_t(width) * EXRNumChannels * sizeof(uint16_t);
+    const size_t maxBlockBytes = lineBytes * EXRLinesPerBlock;
+
+    float *row = new float[width * 4];
+    byte *raw = new byte[maxBlockBytes];
+    byte *reordered = new byte[maxBlockBytes];
+
+    size_t bound = TinyEXRMiniz::CompressBound(maxBlockBytes);
+    byte *compressed = new byte[bound];
+
+    success = true;
+
+    for(uint32_t b = 0; b < numBlocks && success; b++)
+    {
+      uint32_t startY = (firstBlock + b) * EXRLinesPerBlock;
+      uint32_t numLines = RDCMIN(EXRLinesPerBlock, height - startY);
+
+      // channels are stored in alphabetical order, one after another for each scanline
+      for(uint32_t l = 0; l < numLines; l++)
+      {
+        fetchRow(startY + l, row, userdata);
+
+        uint16_t *dst = (uint16_t *)(raw + lineBytes * l);
+
+        const uint32_t srcComp[EXRNumChannels] = {3, 2, 1, 0};
+
+        for(uint32_t c = 0; c < EXRNumChannels; c++)
+        {
+          for(uint32_t x = 0; x < width; x++)
+          {
+            uint16_t h = ConvertToHalf(row[x * 4 + srcComp[c]]);
+            memcpy(&dst[c * width + x], &h, sizeof(h));
+          }
+        }
+      }
+
+      size_t rawSize = lineBytes * numLines;
+
+      // split the bytes into even and odd halves, then delta encode, as OpenEXR's ZIP compressor
+      // does before deflating.
+      size_t half = (rawSize + 1) / 2;
+      for(size_t i = 0; i < rawSize; i++)
+        reordered[(i & 1) ? half + i / 2 : i / 2] = raw[i];
+
+      byte prev = reordered[0];
+      for(size_t i = 1; i < rawSize; i++)
+      {
+        byte cur = reordered[i];
+        reordered[i] = byte(int(cur) - int(prev) + 128 + 256);
+        prev = cur;
+      }
+
+      size_t compSize = bound;
+      if(!TinyEXRMiniz::Compress(compressed, compSize, reordered, rawSize, EXRCompressionLevel))
+      {
+        success = false;
+        break;
+      }
+
+      int32_t header[2] = {(int32_t)startY, (int32_t)compSize};
+      blocks.insert(blocks.end(), (const byte *)header, (const byte *)(header + 2));
+      blocks.insert(blocks.end(), compressed, compressed + compSize);
+      blockSizes.push_back(uint32_t(sizeof(header) + compSize));
+    }
+
+    delete[] compressed;
+    delete[] reordered;
+    delete[] raw;
+    delete[] row;
+  }
+};
+
+static void WriteAttribute(std::vector<byte> &header, const char *name, const char *type,
+                           const void *data, uint32_t size)
+{
+  header.insert(header.end(), name, name + strlen(name) + 1);
+  header.insert(header.end(), type, type + strlen(type) + 1);
+  header.insert(header.end(), (const byte *)&size, (const byte *)&size + sizeof(size));
+  header.insert(header.end(), (const byte *)data, (const byte *)data + size);
+}
+
+bool write_exr_to_file(FILE *f, uint32_t width, uint32_t height, EXRFetchRow fetchRow,
+                       const void *userdata, Threading::WorkerPool &pool)
+{
+  if(!f || !fetchRow || width == 0 || height == 0)
+    return false;
+
+  const size_t rawBlockSize = size_t(width) * EXRNumChannels * sizeof(uint16_t) * EXRLinesPerBlock;
+
+  uint32_t numBlocks = (height + EXRLinesPerBlock - 1) / EXRLinesPerBlock;
+  uint32_t blocksPerBand = RDCMAX(1U, uint32_t(EXRBandSize / rawBlockSize));
+  uint32_t numBands = (numBlocks + blocksPerBand - 1) / blocksPerBand;
+
+  std::vector<EXRBandJob> bands(numBands);
+
+  for(uint32_t b = 0; b < numBands; b++)
+  {
+    bands[b].fetchRow = fetchRow;
+    bands[b].userdata = userdata;
+    bands[b].width = width;
+    bands[b].height = height;
+    bands[b].firstBlock = b * blocksPerBand;
+    bands[b].numBlocks = RDCMIN(blocksPerBand, numBlocks - b * blocksPerBand);
+    bands[b].success = false;
+  }
+
+  for(uint32_t b = 0; b < numBands; b++)
+    pool.Submit(&bands[b]);
+
+  std::vector<byte> header;
+
+  // magic number, then version 2 with no flags (single part scanline file)
+  const byte magic[8] = {0x76, 0x2f, 0x31, 0x01, 2, 0, 0, 0};
+  header.insert(header.end(), magic, magic + sizeof(magic));
+
+  // must be in this order as many viewers don't pay attention to channels and just assume
+  // they are in this order
+  {
+    std::vector<byte> chlist;
+    const char *names[EXRNumChannels] = {"A", "B", "G", "R"};
+    for(uint32_t c = 0; c < EXRNumChannels; c++)
+    {
+      // pixel type HALF, pLinear and reserved bytes, then x and y sampling
+      const int32_t channel[4] = {1, 0, 1, 1};
+      chlist.insert(chlist.end(), names[c], names[c] + 2);
+      chlist.insert(chlist.end(), (const byte *)channel, (const byte *)(channel + 4));
+    }
+    chlist.push_back(0);
+
+    WriteAttribute(header, "channels", "chlist", &chlist[0], (uint32_t)chlist.size());
+  }
+
+  const byte zipCompression = 3;
+  WriteAttribute(header, "compression", "compression", &zipCompression, 1);
+
+  const int32_t window[4] = {0, 0, int32_t(width) - 1, int32_t(height) - 1};
+  WriteAttribute(header, "dataWindow", "box2i", window, sizeof(window));
+  WriteAttribute(header, "displayWindow", "box2i", window, sizeof(window));
+
+  const byte increasingY = 0;
+  WriteAttribute(header, "lineOrder", "lineOrder", &increasingY, 1);
+
+  const float one = 1.0f;
+  const float centre[2] = {0.0f, 0.0f};
+  WriteAttribute(header, "pixelAspectRatio", "float", &one, sizeof(one));
+  WriteAttribute(header, "screenWindowCenter", "v2f", centre, sizeof(centre));
+  WriteAttribute(header, "screenWindowWidth", "float", &one, sizeof(one));
+
+  header.push_back(0);
+
+  // the offset table is filled in as blocks are written, so the compressed data for the whole
+  // image is never held in memory at once.
+  std::vector<uint64_t> offsets(numBlocks);
+
+  uint64_t base = FileIO::ftell64(f);
+
+  bool success = true;
+
+  success &= FileIO::fwrite(&header[0], 1, header.size(), f) == header.size();
+  success &= FileIO::fwrite(&offsets[0], sizeof(uint64_t), numBlocks, f) == numBlocks;
+
+  uint64_t offset = base + header.size() + sizeof(uint64_t) * numBlocks;
+  uint32_t block = 0;
+
+  for(uint32_t b = 0; b < numBands; b++)
+  {
+    EXRBandJob &band = bands[b];
+
+    pool.Wait(&band);
+
+    success &= band.success;
+
+    if(!success)
+      continue;
+
+    for(size_t i = 0; i < band.blockSizes.size(); i++)
+    {
+      offsets[block++] = offset;
+      offset += band.blockSizes[i];
+    }
+
+    success &= FileIO::fwrite(&band.blocks[0], 1, band.blocks.size(), f) == band.blocks.size();
+
+    std::vector<byte>().swap(band.blocks);
+  }
+
+  if(success)
+  {
+    FileIO::fseek64(f, base + header.size(), SEEK_SET);
+    success &= FileIO::fwrite(&offsets[0], sizeof(uint64_t), numBlocks, f) == numBlocks;
+    FileIO::fseek64(f, 0, SEEK_END);
+  }
+
+  return success;
+}
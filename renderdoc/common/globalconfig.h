@@ -135,6 +135,10 @@ enum
 // force debugbreaks regardless of debug/release mode
 #define FORCE_DEBUGBREAK OPTION_OFF
 
+// remove all trace instrumentation (RDCTRACE_SCOPE etc). When compiled in, tracing is still off
+// at runtime unless enabled - see common/tracing.h
+#define STRIP_TRACING OPTION_OFF
+
 /////////////////////////////////////////////////
 // Logging configuration
 
@@ -0,0 +1,300 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "png_write.h"
+#include <stdlib.h>
+#include <string.h>
+#include "3rdparty/tinyexr/tinyexr_miniz.h"
+#include "common/worker_pool.h"
+#include "os/os_specific.h"
+
+// Each band is compressed on its own, so matches can't reach back across band boundaries. A band
+// size well above the 32kb deflate window keeps the cost of that negligible while still giving
+// enough bands to spread over the pool.
+static const size_t PNGBandSize = 1024 * 1024;
+
+static const int PNGCompressionLevel = 6;
+
+static byte Paeth(int a, int b, int c)
+{
+  int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+  if(pa <= pb && pa <= pc)
+    return byte(a);
+  if(pb <= pc)
+    return byte(b);
+  return byte(c);
+}
+
+// applies one of the five PNG filter types to a row, given the previous row (all zeroes for the
+// first row of the image). Returns the sum of absolute filtered values, the usual heuristic for
+// picking the filter that will compress best.
+static uint32_t FilterRow(int type, const byte *cur, const byte *prev, uint32_t rowBytes,
+                          uint32_t bpp, byte *out)
+{
+  uint32_t est = 0;
+
+  for(uint32_t i = 0; i < rowBytes; i++)
+  {
+    int a = i >= bpp ? cur[i - bpp] : 0;
+    int b = prev[i];
+    int c = i >= bpp ? prev[i - bpp] : 0;
+
+    byte val = cur[i];
+
+    switch(type)
+    {
+      case 0: break;
+      case 1: val = byte(val - a); break;
+      case 2: val = byte(val - b); break;
+      case 3: val = byte(val - ((a + b) >> 1)); break;
+      case 4: val = byte(val - Paeth(a, b, c)); break;
+    }
+
+    out[i] = val;
+    est += abs((signed char)val);
+  }
+
+  return est;
+}
+
+static uint32_t CombineAdler32(uint32_t adler1, uint32_t adler2, size_t len2)
+{
+  const uint32_t BASE = 65521;
+
+  uint32_t rem = uint32_t(len2 % BASE);
+  uint32_t sum1 = adler1 & 0xffff;
+  uint32_t sum2 = uint32_t((uint64_t(rem) * sum1) % BASE);
+
+  sum1 += (adler2 & 0xffff) + BASE - 1;
+  sum2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) + BASE - rem;
+
+  if(sum1 >= BASE)
+    sum1 -= BASE;
+  if(sum1 >= BASE)
+    sum1 -= BASE;
+  if(sum2 >= (BASE << 1))
+    sum2 -= (BASE << 1);
+  if(sum2 >= BASE)
+    sum2 -= BASE;
+
+  return sum1 | (sum2 << 16);
+}
+
+struct PNGBandJob : public Threading::WorkerJob
+{
+  const byte *pixels;
+  const byte *zeroRow;
+  uint32_t rowBytes;
+  uint32_t bpp;
+  uint32_t stride;
+  uint32_t firstRow;
+  uint32_t numRows;
+  bool lastBand;
+
+  // outputs. Each band becomes one IDAT chunk, the crc covers the tag and all of deflated (which
+  // begins with the zlib header for the first band) but not the trailing adler-32 on the last.
+  std::vector<byte> deflated;
+  size_t filteredSize;
+  uint32_t adler;
+  uint32_t crc;
+  bool success;
+
+  void Run()
+  {
+    filteredSize = size_t(rowBytes + 1) * numRows;
+
+    byte *filtered = new byte[filteredSize];
+    byte *candidate = new byte[rowBytes];
+
+    for(uint32_t r = 0; r < numRows; r++)
+    {
+      uint32_t y = firstRow + r;
+      const byte *cur = pixels + size_t(y) * stride;
+      const byte *prev = y > 0 ? cur - stride : zeroRow;
+
+      byte *dst = filtered + size_t(rowBytes + 1) * r;
+
+      // try every filter type, then re-run the best one into the output
+      int best = 0;
+      uint32_t bestEst = ~0U;
+      for(int type = 0; type < 5; type++)
+      {
+        uint32_t est = FilterRow(type, cur, prev, rowBytes, bpp, candidate);
+        if(est < bestEst)
+        {
+          bestEst = est;
+          best = type;
+        }
+      }
+
+      dst[0] = byte(best);
+      FilterRow(best, cur, prev, rowBytes, bpp, dst + 1);
+    }
+
+    delete[] candidate;
+
+    adler = TinyEXRMiniz::Adler32(TinyEXRMiniz::Adler32Init, filtered, filteredSize);
+
+    // raw deflate - the zlib header and adler-32 are added around the concatenated bands. Every
+    // band but the last ends with a sync flush so the next band starts on a byte boundary.
+    deflated.reserve(filteredSize / 2);
+
+    // deflate, 32kb window, default compression level
+    if(firstRow == 0)
+    {
+      deflated.push_back(0x78);
+      deflated.push_back(0x9c);
+    }
+
+    success =
+        TinyEXRMiniz::DeflateRaw(filtered, filteredSize, PNGCompressionLevel, lastBand, deflated);
+
+    delete[] filtered;
+
+    crc = TinyEXRMiniz::CRC32(TinyEXRMiniz::CRC32Init, "IDAT", 4);
+    if(!deflated.empty())
+      crc = TinyEXRMiniz::CRC32(crc, &deflated[0], deflated.size());
+  }
+};
+
+static void WriteBE32(byte *dst, uint32_t val)
+{
+  dst[0] = byte(val >> 24);
+  dst[1] = byte(val >> 16);
+  dst[2] = byte(val >> 8);
+  dst[3] = byte(val);
+}
+
+static void WriteChunk(FILE *f, const char *tag, const byte *data, uint32_t dataLen)
+{
+  byte header[8];
+  WriteBE32(header, dataLen);
+  memcpy(header + 4, tag, 4);
+
+  // the crc resets on a NULL pointer, so skip empty data
+  uint32_t crc = TinyEXRMiniz::CRC32(TinyEXRMiniz::CRC32Init, header + 4, 4);
+  if(dataLen > 0)
+    crc = TinyEXRMiniz::CRC32(crc, data, dataLen);
+
+  byte footer[4];
+  WriteBE32(footer, (uint32_t)crc);
+
+  FileIO::fwrite(header, 1, sizeof(header), f);
+  if(dataLen > 0)
+    FileIO::fwrite(data, 1, dataLen, f);
+  FileIO::fwrite(footer, 1, sizeof(footer), f);
+}
+
+bool write_png_to_file(FILE *f, const byte *pixels, uint32_t width, uint32_t height,
+                       uint32_t comps, uint32_t stride, Threading::WorkerPool &pool)
+{
+  if(!f || comps < 1 || comps > 4 || width == 0 || height == 0)
+    return false;
+
+  const byte colourTypes[5] = {0, 0, 4, 2, 6};
+
+  uint32_t rowBytes = width * comps;
+
+  if(stride == 0)
+    stride = rowBytes;
+
+  uint32_t rowsPerBand = RDCMAX(1U, uint32_t(PNGBandSize / rowBytes));
+  uint32_t numBands = (height + rowsPerBand - 1) / rowsPerBand;
+
+  byte *zeroRow = new byte[rowBytes];
+  memset(zeroRow, 0, rowBytes);
+
+  std::vector<PNGBandJob> bands(numBands);
+
+  for(uint32_t b = 0; b < numBands; b++)
+  {
+    bands[b].pixels = pixels;
+    bands[b].zeroRow = zeroRow;
+    bands[b].rowBytes = rowBytes;
+    bands[b].bpp = comps;
+    bands[b].stride = stride;
+    bands[b].firstRow = b * rowsPerBand;
+    bands[b].numRows = RDCMIN(rowsPerBand, height - b * rowsPerBand);
+    bands[b].lastBand = (b + 1 == numBands);
+  }
+
+  for(uint32_t b = 0; b < numBands; b++)
+    pool.Submit(&bands[b]);
+
+  const byte signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+  FileIO::fwrite(signature, 1, sizeof(signature), f);
+
+  byte ihdr[13] = {};
+  WriteBE32(ihdr + 0, width);
+  WriteBE32(ihdr + 4, height);
+  ihdr[8] = 8;    // bit depth
+  ihdr[9] = colourTypes[comps];
+  WriteChunk(f, "IHDR", ihdr, sizeof(ihdr));
+
+  bool success = true;
+  uint32_t adler = TinyEXRMiniz::Adler32Init;
+
+  // write each band as its own IDAT chunk as soon as it's ready, in order, so the compressed data
+  // for the whole image is never held in memory at once.
+  for(uint32_t b = 0; b < numBands; b++)
+  {
+    PNGBandJob &band = bands[b];
+
+    pool.Wait(&band);
+
+    success &= band.success;
+    adler = CombineAdler32(adler, band.adler, band.filteredSize);
+
+    byte adlerBE[4];
+    WriteBE32(adlerBE, adler);
+
+    size_t suffixLen = band.lastBand ? sizeof(adlerBE) : 0;
+    uint32_t crc = band.crc;
+    if(suffixLen > 0)
+      crc = TinyEXRMiniz::CRC32(crc, adlerBE, suffixLen);
+
+    byte header[8];
+    WriteBE32(header, uint32_t(band.deflated.size() + suffixLen));
+    memcpy(header + 4, "IDAT", 4);
+
+    byte footer[4];
+    WriteBE32(footer, (uint32_t)crc);
+
+    FileIO::fwrite(header, 1, sizeof(header), f);
+    if(!band.deflated.empty())
+      FileIO::fwrite(&band.deflated[0], 1, band.deflated.size(), f);
+    if(suffixLen > 0)
+      FileIO::fwrite(adlerBE, 1, suffixLen, f);
+    FileIO::fwrite(footer, 1, sizeof(footer), f);
+
+    std::vector<byte>().swap(band.deflated);
+  }
+
+  WriteChunk(f, "IEND", NULL, 0);
+
+  delete[] zeroRow;
+
+  return success;
+}
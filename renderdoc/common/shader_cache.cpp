@@ -0,0 +1,526 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "shader_cache.h"
+#include <string.h>
+#include <algorithm>
+#include "serialise/string_utils.h"
+
+ShaderBlobCache::ShaderBlobCache()
+{
+  m_Magic = m_Version = 0;
+  m_MaxSize = DefaultMaxSize;
+
+  m_Mapped = NULL;
+  m_MappedSize = 0;
+  m_MapHandle = NULL;
+
+  RDCEraseEl(m_Header);
+  m_Generation = 1;
+
+  m_Dirty = m_Touched = m_NeedsRewrite = false;
+}
+
+ShaderBlobCache::~ShaderBlobCache()
+{
+  Close();
+}
+
+bool ShaderBlobCache::Open(const char *filename, uint32_t magic, uint32_t version, uint64_t maxSize)
+{
+  Close();
+
+  m_Filename = FileIO::GetAppFolderFilename(filename);
+  m_Magic = magic;
+  m_Version = version;
+  m_MaxSize = maxSize;
+
+  m_Mapped = (const byte *)FileIO::MapFile(m_Filename.c_str(), m_MappedSize, m_MapHandle);
+
+  if(m_Mapped == NULL)
+  {
+    // no file, nothing to do until we have something to save
+    RDCEraseEl(m_Header);
+    m_Generation = 1;
+    m_NeedsRewrite = true;
+    return false;
+  }
+
+  ReadIndex();
+
+  if(m_Header.fourcc == FileFourCC)
+    CompactStaleData();
+
+  RDCDEBUG("Opened shader cache %s with %u entries", m_Filename.c_str(),
+           (uint32_t)m_Entries.size());
+
+  return m_Header.fourcc == FileFourCC;
+}
+
+void ShaderBlobCache::CompactStaleData()
+{
+  uint64_t live = LiveBytes();
+  uint64_t dead = m_MappedSize > live ? m_MappedSize - live : 0;
+
+  // every append leaves the previous index behind. Allow one stale index's worth of slack so that
+  // alternate sessions append, rather than rewriting the whole file every time.
+  if(dead <= uint64_t(m_Entries.size()) * sizeof(IndexEntry))
+    return;
+
+  RDCDEBUG("Compacting %llu stale bytes from shader cache %s", dead, m_Filename.c_str());
+
+  EvictToBudget();
+
+  if(!Rewrite())
+    RDCERR("Error compacting shader cache %s", m_Filename.c_str());
+
+  // the rewrite releases the mapping, so pick up whichever file is now in place
+  if(m_Mapped == NULL)
+  {
+    m_Entries.clear();
+
+    m_Mapped = (const byte *)FileIO::MapFile(m_Filename.c_str(), m_MappedSize, m_MapHandle);
+
+    if(m_Mapped)
+    {
+      ReadIndex();
+    }
+    else
+    {
+      RDCEraseEl(m_Header);
+      m_Generation = 1;
+      m_NeedsRewrite = true;
+    }
+  }
+}
+
+void ShaderBlobCache::ReadIndex()
+{
+  RDCEraseEl(m_Header);
+  m_Generation = 1;
+
+  if(m_MappedSize < sizeof(FileHeader))
+  {
+    RDCERR("Invalid shader cache - truncated header");
+    m_NeedsRewrite = true;
+    return;
+  }
+
+  FileHeader header;
+  memcpy(&header, m_Mapped, sizeof(header));
+
+  if(header.fourcc != FileFourCC || header.formatVersion != FileFormatVersion ||
+     header.clientMagic != m_Magic || header.clientVersion != m_Version)
+  {
+    RDCDEBUG("Out of date or invalid shader cache magic: %x version: %u", header.clientMagic,
+             header.clientVersion);
+    m_NeedsRewrite = true;
+    return;
+  }
+
+  uint64_t indexSize = uint64_t(header.numEntries) * sizeof(IndexEntry);
+
+  if(header.indexOffset < sizeof(FileHeader) || header.indexOffset > m_MappedSize ||
+     indexSize > m_MappedSize - header.indexOffset)
+  {
+    RDCERR("Invalid shader cache - index out of bounds");
+    m_NeedsRewrite = true;
+    return;
+  }
+
+  const byte *indexData = m_Mapped + header.indexOffset;
+
+  if(hash64(indexData, (size_t)indexSize) != header.indexChecksum)
+  {
+    RDCERR("Invalid shader cache - index checksum mismatch");
+    m_NeedsRewrite = true;
+    return;
+  }
+
+  m_Header = header;
+  m_Generation = header.generation + 1;
+
+  for(uint32_t i = 0; i < header.numEntries; i++)
+  {
+    CacheEntry entry;
+    memcpy(&entry.disk, indexData + i * sizeof(IndexEntry), sizeof(IndexEntry));
+    entry.heapData = NULL;
+    entry.verified = false;
+
+    // blobs must lie between the header and the index
+    if(entry.disk.offset < sizeof(FileHeader) || entry.disk.offset > header.indexOffset ||
+       entry.disk.size > header.indexOffset - entry.disk.offset)
+    {
+      RDCERR("Invalid shader cache - entry %u out of bounds", i);
+      m_NeedsRewrite = true;
+      continue;
+    }
+
+    m_Entries[entry.disk.key] = entry;
+  }
+}
+
+void ShaderBlobCache::Close()
+{
+  if(m_Filename.empty())
+    return;
+
+  if(m_Dirty || m_Touched || (m_NeedsRewrite && !m_Entries.empty()))
+  {
+    uint64_t live = LiveBytes();
+    uint64_t dead = m_MappedSize > live ? m_MappedSize - live : 0;
+
+    // compact when over budget, or when more than a third of the file is stale data
+    bool compact = m_NeedsRewrite || live > m_MaxSize || dead > live / 2;
+
+    bool success = false;
+
+    if(!compact)
+      success = Append();
+
+    if(!success)
+    {
+      EvictToBudget();
+      success = Rewrite();
+    }
+
+    if(success)
+      RDCDEBUG("Successfully wrote %u shaders to shader cache", (uint32_t)m_Entries.size());
+    else
+      RDCERR("Error writing shader cache %s", m_Filename.c_str());
+  }
+
+  Unmap();
+
+  for(auto it = m_Entries.begin(); it != m_Entries.end(); ++it)
+    delete[] it->second.heapData;
+
+  m_Entries.clear();
+  m_Filename = "";
+  RDCEraseEl(m_Header);
+  m_Dirty = m_Touched = m_NeedsRewrite = false;
+}
+
+bool ShaderBlobCache::Find(uint64_t key, const byte *&data, uint32_t &size)
+{
+  auto it = m_Entries.find(key);
+
+  if(it == m_Entries.end())
+    return false;
+
+  CacheEntry &entry = it->second;
+
+  if(entry.heapData)
+  {
+    data = entry.heapData;
+    size = entry.disk.size;
+    return true;
+  }
+
+  const byte *blob = m_Mapped + entry.disk.offset;
+
+  if(!entry.verified)
+  {
+    if(hash64(blob, entry.disk.size) != entry.disk.checksum)
+    {
+      RDCERR("Shader cache entry %llx is corrupt, discarding", key);
+      m_Entries.erase(it);
+      m_NeedsRewrite = true;
+      return false;
+    }
+
+    entry.verified = true;
+  }
+
+  if(entry.disk.lastUsed != m_Generation)
+  {
+    entry.disk.lastUsed = m_Generation;
+    m_Touched = true;
+  }
+
+  data = blob;
+  size = entry.disk.size;
+  return true;
+}
+
+void ShaderBlobCache::Insert(uint64_t key, const void *data, uint32_t size)
+{
+  CacheEntry &entry = m_Entries[key];
+
+  delete[] entry.heapData;
+
+  // allocate at least one byte so that empty blobs are still recognised as pending
+  entry.heapData = new byte[size > 0 ? size : 1];
+  memcpy(entry.heapData, data, size);
+
+  entry.disk.key = key;
+  entry.disk.offset = 0;
+  entry.disk.size = size;
+  entry.disk.lastUsed = m_Generation;
+  entry.disk.checksum = hash64(data, size);
+  entry.verified = true;
+
+  m_Dirty = true;
+}
+
+uint64_t ShaderBlobCache::LiveBytes() const
+{
+  uint64_t ret = AlignUp(uint64_t(sizeof(FileHeader)), BlobAlignment);
+
+  for(auto it = m_Entries.begin(); it != m_Entries.end(); ++it)
+    ret += AlignUp(uint64_t(it->second.disk.size), BlobAlignment) + sizeof(IndexEntry);
+
+  return ret;
+}
+
+struct LRUSort
+{
+  bool operator()(const std::pair<uint32_t, uint64_t> &a, const std::pair<uint32_t, uint64_t> &b)
+  {
+    return a.first > b.first;
+  }
+};
+
+void ShaderBlobCache::EvictToBudget()
+{
+  if(LiveBytes() <= m_MaxSize)
+    return;
+
+  // sort by last use, most recent first, and keep entries until we run out of budget
+  std::vector<std::pair<uint32_t, uint64_t> > lru;
+  lru.reserve(m_Entries.size());
+
+  for(auto it = m_Entries.begin(); it != m_Entries.end(); ++it)
+    lru.push_back(std::make_pair(it->second.disk.lastUsed, it->first));
+
+  std::stable_sort(lru.begin(), lru.end(), LRUSort());
+
+  uint64_t budget = AlignUp(uint64_t(sizeof(FileHeader)), BlobAlignment);
+
+  size_t evicted = 0;
+
+  for(size_t i = 0; i < lru.size(); i++)
+  {
+    auto it = m_Entries.find(lru[i].second);
+
+    budget += AlignUp(uint64_t(it->second.disk.size), BlobAlignment) + sizeof(IndexEntry);
+
+    if(budget > m_MaxSize)
+    {
+      delete[] it->second.heapData;
+      m_Entries.erase(it);
+      evicted++;
+    }
+  }
+
+  RDCDEBUG("Evicted %u least recently used entries from shader cache", (uint32_t)evicted);
+}
+
+static bool WritePadding(FILE *f, uint64_t &offset, uint64_t alignment)
+{
+  static const byte zeros[16] = {};
+
+  uint64_t aligned = AlignUp(offset, alignment);
+
+  while(offset < aligned)
+  {
+    size_t chunk = (size_t)RDCMIN(aligned - offset, uint64_t(sizeof(zeros)));
+    if(FileIO::fwrite(zeros, 1, chunk, f) != chunk)
+      return false;
+    offset += chunk;
+  }
+
+  return true;
+}
+
+bool ShaderBlobCache::Append()
+{
+  FILE *f = FileIO::fopen(m_Filename.c_str(), "r+b");
+
+  if(!f)
+    return false;
+
+  // if another process has written the file since we mapped it, our index is stale. Fall back to
+  // a full rewrite rather than clobbering their entries with a mismatched index.
+  FileHeader current;
+  if(FileIO::fread(&current, 1, sizeof(current), f) != sizeof(current) ||
+     memcmp(&current, &m_Header, sizeof(current)) != 0)
+  {
+    FileIO::fclose(f);
+    return false;
+  }
+
+  FileIO::fseek64(f, 0, SEEK_END);
+  uint64_t offset = FileIO::ftell64(f);
+
+  // append new blobs after everything currently in the file, including the old index, so that it
+  // stays valid until the header is updated. New entries keep their heap copy, so if anything
+  // fails before then the offsets recorded here are never used and the file is left as it was.
+  bool success = true;
+
+  std::vector<IndexEntry> index;
+  index.reserve(m_Entries.size());
+
+  for(auto it = m_Entries.begin(); success && it != m_Entries.end(); ++it)
+  {
+    CacheEntry &entry = it->second;
+
+    IndexEntry disk = entry.disk;
+
+    if(entry.heapData)
+    {
+      success = WritePadding(f, offset, BlobAlignment) &&
+                FileIO::fwrite(entry.heapData, 1, disk.size, f) == disk.size;
+
+      disk.offset = offset;
+      offset += disk.size;
+    }
+
+    index.push_back(disk);
+  }
+
+  success = success && WritePadding(f, offset, BlobAlignment);
+
+  FileHeader header = m_Header;
+  header.generation = m_Generation;
+  header.numEntries = (uint32_t)index.size();
+  header.indexOffset = offset;
+  header.indexChecksum = hash64(index.data(), index.size() * sizeof(IndexEntry));
+
+  if(success && !index.empty())
+    success = FileIO::fwrite(index.data(), sizeof(IndexEntry), index.size(), f) == index.size();
+
+  // everything the new header points to must be on disk before it's written
+  success = success && fflush(f) == 0;
+
+  if(success)
+  {
+    FileIO::fseek64(f, 0, SEEK_SET);
+    success = FileIO::fwrite(&header, 1, sizeof(header), f) == sizeof(header) && fflush(f) == 0;
+  }
+
+  success = (FileIO::fclose(f) == 0) && success;
+
+  if(!success)
+  {
+    RDCWARN("Failed to append to shader cache %s", m_Filename.c_str());
+    return false;
+  }
+
+  // only now the index is committed, record where the new blobs went
+  for(size_t i = 0; i < index.size(); i++)
+    m_Entries[index[i].key].disk.offset = index[i].offset;
+
+  return true;
+}
+
+bool ShaderBlobCache::Rewrite()
+{
+  string tmpFilename = m_Filename + ".tmp";
+
+  FILE *f = FileIO::fopen(tmpFilename.c_str(), "wb");
+
+  if(!f)
+    return false;
+
+  FileHeader header = {};
+  header.fourcc = FileFourCC;
+  header.formatVersion = FileFormatVersion;
+  header.clientMagic = m_Magic;
+  header.clientVersion = m_Version;
+  header.generation = m_Generation;
+
+  // placeholder until the index is written
+  bool success = FileIO::fwrite(&header, 1, sizeof(header), f) == sizeof(header);
+  uint64_t offset = sizeof(header);
+
+  std::vector<IndexEntry> index;
+  index.reserve(m_Entries.size());
+
+  for(auto it = m_Entries.begin(); success && it != m_Entries.end(); ++it)
+  {
+    CacheEntry &entry = it->second;
+
+    const byte *data = entry.heapData ? entry.heapData : m_Mapped + entry.disk.offset;
+
+    // don't carry corrupt data forward
+    if(!entry.verified && hash64(data, entry.disk.size) != entry.disk.checksum)
+      continue;
+
+    success = WritePadding(f, offset, BlobAlignment);
+
+    IndexEntry disk = entry.disk;
+    disk.offset = offset;
+    index.push_back(disk);
+
+    success = success && FileIO::fwrite(data, 1, entry.disk.size, f) == entry.disk.size;
+    offset += entry.disk.size;
+  }
+
+  success = success && WritePadding(f, offset, BlobAlignment);
+
+  header.numEntries = (uint32_t)index.size();
+  header.indexOffset = offset;
+  header.indexChecksum = hash64(index.data(), index.size() * sizeof(IndexEntry));
+
+  if(success && !index.empty())
+    success = FileIO::fwrite(index.data(), sizeof(IndexEntry), index.size(), f) == index.size();
+
+  if(success)
+  {
+    FileIO::fseek64(f, 0, SEEK_SET);
+    success = FileIO::fwrite(&header, 1, sizeof(header), f) == sizeof(header) && fflush(f) == 0;
+  }
+
+  success = (FileIO::fclose(f) == 0) && success;
+
+  // never replace the existing cache with a partially written one
+  if(!success)
+  {
+    FileIO::Delete(tmpFilename.c_str());
+    return false;
+  }
+
+  // the mapping must be released before the file can be replaced on some platforms
+  Unmap();
+
+  if(!FileIO::Move(tmpFilename.c_str(), m_Filename.c_str()))
+  {
+    FileIO::Delete(tmpFilename.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+void ShaderBlobCache::Unmap()
+{
+  if(m_Mapped)
+    FileIO::UnmapFile(m_Mapped, m_MappedSize, m_MapHandle);
+
+  m_Mapped = NULL;
+  m_MappedSize = 0;
+  m_MapHandle = NULL;
+}
@@ -22,153 +22,109 @@
  * THE SOFTWARE.
  ******************************************************************************/
 
+
 #pragma once
 
+#include <map>
+#include "common/common.h"
 #include "os/os_specific.h"
 
-template <typename ResultType, typename ShaderCallbacks>
-bool LoadShaderCache(const char *filename, const uint32_t magicNumber, const uint32_t versionNumber,
-                     std::map<uint32_t, ResultType> &resultCache, const ShaderCallbacks &callbacks)
+// A persistent cache of compiled shader blobs, shared by the replay debug managers.
+//
+// The file is memory-mapped on open and only the index is parsed - blob contents are checksummed
+// and handed out lazily the first time they're looked up. New blobs are appended after the
+// existing data followed by a fresh index, and the header is rewritten last so a crash mid-save
+// leaves the previous index intact. When the file is over its size budget, or has accumulated too
+// much dead space, it is compacted into a temporary file and atomically renamed over the original,
+// evicting the least recently used entries first. Stale indices left behind by earlier appends are
+// compacted away when the file is opened. A failed write never replaces the committed index.
+class ShaderBlobCache
 {
-  string shadercache = FileIO::GetAppFolderFilename(filename);
-
-  FILE *f = FileIO::fopen(shadercache.c_str(), "rb");
+public:
+  static const uint64_t DefaultMaxSize = 32 * 1024 * 1024;
 
-  if(!f)
-    return false;
+  ShaderBlobCache();
+  ~ShaderBlobCache();
 
-  FileIO::fseek64(f, 0, SEEK_END);
-  uint64_t cachelen = FileIO::ftell64(f);
-  FileIO::fseek64(f, 0, SEEK_SET);
+  // opens filename in the app folder. magic and version identify the client, any existing file
+  // with different values is discarded. Returns false if no usable existing cache was found, in
+  // which case the cache starts empty and is written on Close().
+  bool Open(const char *filename, uint32_t magic, uint32_t version,
+            uint64_t maxSize = DefaultMaxSize);
 
-  bool ret = true;
+  // writes any new entries and updated usage out to disk, then releases the mapping. Any pointers
+  // returned from Find() are invalid after this point.
+  void Close();
 
-  // header: magic number, file version, number of entries
-  if(cachelen < sizeof(uint32_t) * 3)
-  {
-    RDCERR("Invalid shader cache");
-    ret = false;
-  }
-  else
-  {
-    byte *cache = new byte[(size_t)cachelen];
-    FileIO::fread(cache, 1, (size_t)cachelen, f);
-
-    uint32_t *header = (uint32_t *)cache;
-
-    uint32_t fileMagic = header[0];
-    uint32_t fileVer = header[1];
-
-    if(fileMagic != magicNumber || fileVer != versionNumber)
-    {
-      RDCDEBUG("Out of date or invalid shader cache magic: %d version: %d", fileMagic, fileVer);
-      ret = false;
-    }
-    else
-    {
-      uint32_t numentries = header[2];
-
-      byte *ptr = cache + sizeof(uint32_t) * 3;
-
-      int64_t bufsize = (int64_t)cachelen - sizeof(uint32_t) * 3;
-
-      for(uint32_t i = 0; i < numentries; i++)
-      {
-        if((size_t)bufsize < sizeof(uint32_t))
-        {
-          RDCERR("Invalid shader cache - truncated, not enough data for shader hash");
-          ret = false;
-          break;
-        }
-
-        uint32_t hash = *(uint32_t *)ptr;
-        ptr += sizeof(uint32_t);
-        bufsize -= sizeof(uint32_t);
-
-        if((size_t)bufsize < sizeof(uint32_t))
-        {
-          RDCERR("Invalid shader cache - truncated, not enough data for shader length");
-          ret = false;
-          break;
-        }
-
-        uint32_t len = *(uint32_t *)ptr;
-        ptr += sizeof(uint32_t);
-        bufsize -= sizeof(uint32_t);
-
-        if(bufsize < len)
-        {
-          RDCERR("Invalid shader cache - truncated, not enough data for shader buffer");
-          ret = false;
-          break;
-        }
-
-        byte *data = ptr;
-        ptr += len;
-        bufsize -= len;
-
-        ResultType result;
-        bool created = callbacks.Create(len, data, &result);
-
-        if(!created)
-        {
-          RDCERR("Couldn't create blob of size %u from shadercache", len);
-          ret = false;
-          break;
-        }
-
-        resultCache[hash] = result;
-      }
-
-      if(ret == true && bufsize != 0)
-      {
-        RDCERR("Invalid shader cache - trailing data");
-        ret = false;
-      }
-
-      RDCDEBUG("Successfully loaded %d shaders from shader cache", resultCache.size());
-    }
-
-    delete[] cache;
-  }
-
-  FileIO::fclose(f);
-
-  return ret;
-}
-
-template <typename ResultType, typename ShaderCallbacks>
-void SaveShaderCache(const char *filename, uint32_t magicNumber, uint32_t versionNumber,
-                     const std::map<uint32_t, ResultType> &cache, const ShaderCallbacks &callbacks)
-{
-  string shadercache = FileIO::GetAppFolderFilename(filename);
+  // looks up a blob. The returned data stays valid until Close() and is at least 4-byte aligned.
+  bool Find(uint64_t key, const byte *&data, uint32_t &size);
 
-  FILE *f = FileIO::fopen(shadercache.c_str(), "wb");
+  // adds a new blob, copying the data. If the key already exists it is replaced.
+  void Insert(uint64_t key, const void *data, uint32_t size);
 
-  if(!f)
+  size_t GetNumEntries() const { return m_Entries.size(); }
+private:
+  struct FileHeader
   {
-    RDCERR("Error opening shader cache for write");
-    return;
-  }
-
-  FileIO::fwrite(&magicNumber, 1, sizeof(magicNumber), f);
-  FileIO::fwrite(&versionNumber, 1, sizeof(versionNumber), f);
-  uint32_t numentries = (uint32_t)cache.size();
-  FileIO::fwrite(&numentries, 1, sizeof(numentries), f);
-
-  for(auto it = cache.begin(); it != cache.end(); ++it)
+    uint32_t fourcc;
+    uint32_t formatVersion;
+    uint32_t clientMagic;
+    uint32_t clientVersion;
+    uint32_t generation;
+    uint32_t numEntries;
+    uint64_t indexOffset;
+    uint64_t indexChecksum;
+  };
+
+  struct IndexEntry
   {
-    uint32_t hash = it->first;
-    uint32_t len = callbacks.GetSize(it->second);
-    byte *data = callbacks.GetData(it->second);
-    FileIO::fwrite(&hash, 1, sizeof(hash), f);
-    FileIO::fwrite(&len, 1, sizeof(len), f);
-    FileIO::fwrite(data, 1, len, f);
-
-    callbacks.Destroy(it->second);
-  }
-
-  FileIO::fclose(f);
-
-  RDCDEBUG("Successfully wrote %u shaders to shader cache", numentries);
-}
+    uint64_t key;
+    uint64_t offset;
+    uint32_t size;
+    uint32_t lastUsed;
+    uint64_t checksum;
+  };
+
+  struct CacheEntry
+  {
+    IndexEntry disk;
+    // non-NULL for entries added this session that aren't in the file yet
+    byte *heapData;
+    bool verified;
+  };
+
+  static const uint32_t FileFourCC = MAKE_FOURCC('R', 'D', 'S', 'C');
+  static const uint32_t FileFormatVersion = 1;
+  static const uint64_t BlobAlignment = 16;
+
+  void ReadIndex();
+  void CompactStaleData();
+  uint64_t LiveBytes() const;
+  void EvictToBudget();
+
+  bool Append();
+  bool Rewrite();
+  void Unmap();
+
+  string m_Filename;
+  uint32_t m_Magic;
+  uint32_t m_Version;
+  uint64_t m_MaxSize;
+
+  const byte *m_Mapped;
+  uint64_t m_MappedSize;
+  void *m_MapHandle;
+
+  // the header as it was on disk when we opened the file, all zero if there was no valid file
+  FileHeader m_Header;
+  uint32_t m_Generation;
+
+  std::map<uint64_t, CacheEntry> m_Entries;
+
+  // entries were added or replaced
+  bool m_Dirty;
+  // lookups updated LRU stamps of existing entries
+  bool m_Touched;
+  // the file had corrupt entries or a stale format and needs to be rewritten from scratch
+  bool m_NeedsRewrite;
+};
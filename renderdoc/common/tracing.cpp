@@ -0,0 +1,292 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "common/tracing.h"
+#include "common/threading.h"
+#include "serialise/string_utils.h"
+
+namespace Tracing
+{
+volatile bool Enabled = false;
+
+struct TraceEvent
+{
+  const char *name;
+  uint64_t start;
+  uint64_t end;
+  int64_t arg;
+  bool counter;
+  bool hasArg;
+};
+
+// Each thread appends events to its own list of fixed-size chunks, so recording never locks and
+// an event never moves once written. The owning thread is the only writer - it fills in an event
+// then bumps the chunk's count, and the exporter only reads up to that count.
+static const int32_t TraceChunkSize = 4096;
+
+// caps each thread at around 20MB of events, anything past that is counted and dropped
+static const uint32_t MaxChunksPerThread = 128;
+
+struct TraceChunk
+{
+  TraceChunk() : count(0), next(NULL) {}
+  TraceEvent events[TraceChunkSize];
+  volatile int32_t count;
+  TraceChunk *volatile next;
+};
+
+struct ThreadTrace
+{
+  uint64_t threadID;
+  TraceChunk *head;
+  TraceChunk *tail;
+  uint32_t numChunks;
+  uint32_t dropped;
+};
+
+static uint64_t traceTLSSlot = 0;
+static uint64_t traceBaseTick = 0;
+static string traceFilename;
+
+// only taken when a thread records its first event, and when exporting
+static Threading::CriticalSection traceThreadsLock;
+static vector<ThreadTrace *> traceThreads;
+
+void Init()
+{
+  if(traceTLSSlot == 0)
+    traceTLSSlot = Threading::AllocateTLSSlot();
+
+  traceFilename = Process::GetEnvVariable("RENDERDOC_TRACE");
+
+  if(!traceFilename.empty())
+  {
+    RDCLOG("Tracing enabled, trace will be written to %s", traceFilename.c_str());
+    SetEnabled(true);
+  }
+}
+
+void Shutdown()
+{
+  SetEnabled(false);
+
+  if(!traceFilename.empty())
+    Export(traceFilename.c_str());
+
+  // the per-thread buffers are deliberately not freed, as a thread could still be in the middle
+  // of recording an event that started before tracing was disabled.
+}
+
+void SetEnabled(bool enabled)
+{
+  if(enabled)
+  {
+    if(traceTLSSlot == 0)
+      traceTLSSlot = Threading::AllocateTLSSlot();
+
+    if(traceBaseTick == 0)
+      traceBaseTick = Timing::GetTick();
+  }
+
+  Enabled = enabled;
+}
+
+static ThreadTrace *GetThreadTrace()
+{
+  ThreadTrace *trace = (ThreadTrace *)Threading::GetTLSValue(traceTLSSlot);
+
+  if(trace)
+    return trace;
+
+  trace = new ThreadTrace();
+  trace->threadID = Threading::GetCurrentID();
+  trace->head = trace->tail = new TraceChunk();
+  trace->numChunks = 1;
+  trace->dropped = 0;
+
+  Threading::SetTLSValue(traceTLSSlot, trace);
+
+  {
+    SCOPED_LOCK(traceThreadsLock);
+    traceThreads.push_back(trace);
+  }
+
+  return trace;
+}
+
+// returns the next free event for this thread, which becomes visible once Publish() is called
+static TraceEvent *AllocateEvent(ThreadTrace *trace)
+{
+  TraceChunk *chunk = trace->tail;
+
+  if(chunk->count == TraceChunkSize)
+  {
+    if(trace->numChunks >= MaxChunksPerThread)
+    {
+      trace->dropped++;
+      return NULL;
+    }
+
+    TraceChunk *newChunk = new TraceChunk();
+
+    // make sure the new chunk is fully constructed before the exporter can reach it
+    Atomic::CmpExch32(&newChunk->count, 0, 0);
+
+    chunk->next = newChunk;
+    trace->tail = newChunk;
+    trace->numChunks++;
+
+    chunk = newChunk;
+  }
+
+  return &chunk->events[chunk->count];
+}
+
+static void Publish(ThreadTrace *trace)
+{
+  Atomic::Inc32(&trace->tail->count);
+}
+
+void RecordScope(const char *name, uint64_t startTick, uint64_t endTick, bool hasArg, int64_t arg)
+{
+  ThreadTrace *trace = GetThreadTrace();
+  TraceEvent *ev = AllocateEvent(trace);
+
+  if(ev == NULL)
+    return;
+
+  ev->name = name;
+  ev->start = startTick;
+  ev->end = endTick;
+  ev->arg = arg;
+  ev->counter = false;
+  ev->hasArg = hasArg;
+
+  Publish(trace);
+}
+
+void RecordCounter(const char *name, int64_t value)
+{
+  ThreadTrace *trace = GetThreadTrace();
+  TraceEvent *ev = AllocateEvent(trace);
+
+  if(ev == NULL)
+    return;
+
+  ev->name = name;
+  ev->start = ev->end = Timing::GetTick();
+  ev->arg = value;
+  ev->counter = true;
+  ev->hasArg = true;
+
+  Publish(trace);
+}
+
+bool Export(const char *filename)
+{
+  vector<ThreadTrace *> threads;
+
+  {
+    SCOPED_LOCK(traceThreadsLock);
+    threads = traceThreads;
+  }
+
+  FILE *f = FileIO::fopen(filename, "wb");
+
+  if(f == NULL)
+  {
+    RDCERR("Couldn't open '%s' to write trace", filename);
+    return false;
+  }
+
+  // trace_event timestamps are in microseconds
+  double usPerTick = 1000.0 / Timing::GetTickFrequency();
+  uint32_t pid = Process::GetCurrentPID();
+
+  string json = "{\"traceEvents\":[\n";
+  uint64_t numEvents = 0;
+  uint64_t numDropped = 0;
+
+  for(size_t t = 0; t < threads.size(); t++)
+  {
+    ThreadTrace *trace = threads[t];
+
+    numDropped += trace->dropped;
+
+    for(TraceChunk *chunk = trace->head; chunk; chunk = chunk->next)
+    {
+      int32_t count = Atomic::CmpExch32(&chunk->count, 0, 0);
+
+      for(int32_t i = 0; i < count; i++)
+      {
+        const TraceEvent &ev = chunk->events[i];
+
+        if(numEvents > 0)
+          json += ",\n";
+
+        double ts = double(ev.start - traceBaseTick) * usPerTick;
+
+        if(ev.counter)
+        {
+          json += StringFormat::Fmt(
+              "{\"name\":\"%s\",\"ph\":\"C\",\"pid\":%u,\"tid\":%llu,\"ts\":%.3f,"
+              "\"args\":{\"value\":%lld}}",
+              ev.name, pid, trace->threadID, ts, ev.arg);
+        }
+        else
+        {
+          json += StringFormat::Fmt(
+              "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%u,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f",
+              ev.name, pid, trace->threadID, ts, double(ev.end - ev.start) * usPerTick);
+
+          if(ev.hasArg)
+            json += StringFormat::Fmt(",\"args\":{\"arg\":%lld}", ev.arg);
+
+          json += "}";
+        }
+
+        numEvents++;
+      }
+
+      // write out as we go rather than building the whole trace in memory
+      FileIO::fwrite(json.c_str(), 1, json.size(), f);
+      json.clear();
+    }
+  }
+
+  json = "\n],\"displayTimeUnit\":\"ms\"}\n";
+  FileIO::fwrite(json.c_str(), 1, json.size(), f);
+
+  FileIO::fclose(f);
+
+  if(numDropped > 0)
+    RDCWARN("Trace buffers filled up, %llu events were dropped", numDropped);
+
+  RDCLOG("Wrote %llu trace events from %u threads to %s", numEvents, (uint32_t)threads.size(),
+         filename);
+
+  return true;
+}
+};
@@ -0,0 +1,115 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include "common/common.h"
+#include "os/os_specific.h"
+
+// Hierarchical tracing of RenderDoc's own hot paths, for profiling capture and replay. Scopes and
+// counters are recorded into per-thread buffers without locking and the trace can be exported as
+// Chrome trace_event JSON, to be opened in chrome://tracing or any compatible viewer.
+//
+// Tracing is off at runtime unless the RENDERDOC_TRACE environment variable is set to a filename,
+// in which case the trace is written there on shutdown. Defining STRIP_TRACING in globalconfig.h
+// compiles the instrumentation out entirely.
+namespace Tracing
+{
+// checks the environment and enables tracing if requested
+void Init();
+// writes out the trace if one was requested, and frees all recorded events
+void Shutdown();
+
+void SetEnabled(bool enabled);
+
+extern volatile bool Enabled;
+inline bool IsEnabled()
+{
+  return Enabled;
+}
+
+// names must be string literals, or at least live as long as the trace. Only the pointer is
+// recorded.
+void RecordScope(const char *name, uint64_t startTick, uint64_t endTick, bool hasArg, int64_t arg);
+void RecordCounter(const char *name, int64_t value);
+
+// write all events recorded so far, from every thread, to filename. Safe to call while other
+// threads are still recording - events recorded during the export may or may not be included.
+bool Export(const char *filename);
+};
+
+class ScopedTrace
+{
+public:
+  ScopedTrace(const char *name)
+      : m_Name(Tracing::IsEnabled() ? name : NULL), m_HasArg(false), m_Arg(0), m_Start(GetStart())
+  {
+  }
+
+  ScopedTrace(const char *name, int64_t arg)
+      : m_Name(Tracing::IsEnabled() ? name : NULL), m_HasArg(true), m_Arg(arg), m_Start(GetStart())
+  {
+  }
+
+  ~ScopedTrace()
+  {
+    if(m_Name)
+      Tracing::RecordScope(m_Name, m_Start, Timing::GetTick(), m_HasArg, m_Arg);
+  }
+
+private:
+  uint64_t GetStart() const { return m_Name ? Timing::GetTick() : 0; }
+
+  const char *m_Name;
+  bool m_HasArg;
+  int64_t m_Arg;
+  uint64_t m_Start;
+};
+
+#if ENABLED(STRIP_TRACING)
+
+#define RDCTRACE_SCOPE(...) \
+  do                        \
+  {                         \
+  } while((void)0, 0)
+#define RDCTRACE_COUNTER(name, value) \
+  do                                  \
+  {                                   \
+  } while((void)0, 0)
+
+#else
+
+// times the enclosing scope, with an optional integer argument shown alongside it
+#define RDCTRACE_SCOPE(...) ScopedTrace CONCAT(trace, __LINE__)(__VA_ARGS__);
+
+// records a new value on the named counter track
+#define RDCTRACE_COUNTER(name, value)                  \
+  do                                                   \
+  {                                                    \
+    if(Tracing::IsEnabled())                           \
+      Tracing::RecordCounter(name, (int64_t)(value)); \
+  } while((void)0, 0)
+
+#endif
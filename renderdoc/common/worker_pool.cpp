@@ -0,0 +1,203 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "worker_pool.h"
+#include "common/threading.h"
+
+namespace Threading
+{
+// upper bound on the default worker count, most jobs are memory bound well before this
+static const uint32_t MaxDefaultWorkers = 16;
+
+WorkerPool::WorkerPool(uint32_t numWorkers)
+{
+  m_Pending = 0;
+  m_Shutdown = false;
+
+  if(numWorkers == DefaultWorkerCount)
+    numWorkers = RDCMIN(NumberOfCores() - 1, MaxDefaultWorkers);
+
+  for(uint32_t i = 0; i < numWorkers; i++)
+  {
+    ThreadHandle thread = CreateThread(&WorkerPool::WorkerThread, this);
+    if(thread == 0)
+    {
+      RDCWARN("Couldn't create worker thread %u of %u", i, numWorkers);
+      break;
+    }
+    m_Threads.push_back(thread);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  WaitAll();
+
+  {
+    SCOPED_LOCK(m_Lock);
+    m_Shutdown = true;
+    m_JobQueued.WakeAll();
+  }
+
+  for(size_t i = 0; i < m_Threads.size(); i++)
+  {
+    JoinThread(m_Threads[i]);
+    CloseThread(m_Threads[i]);
+  }
+}
+
+void WorkerPool::WorkerThread(void *userData)
+{
+  WorkerPool *pool = (WorkerPool *)userData;
+
+  pool->m_Lock.Lock();
+
+  for(;;)
+  {
+    if(pool->RunQueuedJob())
+      continue;
+
+    if(pool->m_Shutdown)
+      break;
+
+    pool->m_JobQueued.Wait(pool->m_Lock);
+  }
+
+  pool->m_Lock.Unlock();
+}
+
+bool WorkerPool::RunQueuedJob()
+{
+  if(m_Queue.empty())
+    return false;
+
+  WorkerJob *job = m_Queue.front();
+  m_Queue.pop_front();
+
+  job->m_State = WorkerJob::eJob_Running;
+
+  m_Lock.Unlock();
+  job->Run();
+  m_Lock.Lock();
+
+  job->m_State = WorkerJob::eJob_Done;
+  m_Pending--;
+  m_JobDone.WakeAll();
+
+  return true;
+}
+
+void WorkerPool::Submit(WorkerJob *job)
+{
+  RDCASSERT(job->m_State != WorkerJob::eJob_Queued && job->m_State != WorkerJob::eJob_Running);
+
+  if(m_Threads.empty())
+  {
+    job->m_State = WorkerJob::eJob_Running;
+    job->Run();
+    job->m_State = WorkerJob::eJob_Done;
+    return;
+  }
+
+  SCOPED_LOCK(m_Lock);
+  job->m_State = WorkerJob::eJob_Queued;
+  m_Queue.push_back(job);
+  m_Pending++;
+  m_JobQueued.WakeOne();
+}
+
+void WorkerPool::Wait(WorkerJob *job)
+{
+  m_Lock.Lock();
+
+  while(job->m_State == WorkerJob::eJob_Queued || job->m_State == WorkerJob::eJob_Running)
+  {
+    // help out with anything that's queued (likely including this job) instead of idling
+    if(!RunQueuedJob())
+      m_JobDone.Wait(m_Lock);
+  }
+
+  m_Lock.Unlock();
+}
+
+void WorkerPool::WaitAll()
+{
+  m_Lock.Lock();
+
+  while(m_Pending > 0)
+  {
+    if(!RunQueuedJob())
+      m_JobDone.Wait(m_Lock);
+  }
+
+  m_Lock.Unlock();
+}
+
+struct ParallelRunner : public WorkerJob
+{
+  ParallelJob *body;
+  volatile int32_t *next;
+  uint32_t count;
+
+  void Run()
+  {
+    for(;;)
+    {
+      uint32_t idx = (uint32_t)(Atomic::Inc32(next) - 1);
+      if(idx >= count)
+        break;
+
+      body->Run(idx);
+    }
+  }
+};
+
+void WorkerPool::ParallelFor(uint32_t count, ParallelJob &job)
+{
+  if(count == 0)
+    return;
+
+  volatile int32_t next = 0;
+
+  // one runner per worker that could usefully take an index, plus one on this thread. Each runner
+  // pulls indices until the range is exhausted, so uneven iterations balance out.
+  std::vector<ParallelRunner> runners(RDCMIN(GetWorkerCount(), count - 1) + 1);
+
+  for(size_t i = 0; i < runners.size(); i++)
+  {
+    runners[i].body = &job;
+    runners[i].next = &next;
+    runners[i].count = count;
+  }
+
+  for(size_t i = 1; i < runners.size(); i++)
+    Submit(&runners[i]);
+
+  runners[0].Run();
+
+  for(size_t i = 1; i < runners.size(); i++)
+    Wait(&runners[i]);
+}
+};
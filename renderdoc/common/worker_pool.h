@@ -0,0 +1,107 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <deque>
+#include "common/common.h"
+#include "os/os_specific.h"
+
+namespace Threading
+{
+// a unit of work for a WorkerPool. The pool never takes ownership - a submitted job must stay alive
+// until it has been waited on, either directly or through WaitAll().
+class WorkerJob
+{
+public:
+  WorkerJob() : m_State(eJob_Idle) {}
+  virtual ~WorkerJob() {}
+  virtual void Run() = 0;
+
+private:
+  friend class WorkerPool;
+
+  enum JobState
+  {
+    eJob_Idle,
+    eJob_Queued,
+    eJob_Running,
+    eJob_Done,
+  };
+
+  JobState m_State;
+};
+
+// loop body for WorkerPool::ParallelFor, called exactly once for each index in the range, from any
+// thread and in no particular order.
+class ParallelJob
+{
+public:
+  virtual ~ParallelJob() {}
+  virtual void Run(uint32_t index) = 0;
+};
+
+// A fixed set of worker threads draining a FIFO queue of jobs. Threads waiting on the pool help run
+// queued jobs rather than sleeping, so waiting from inside a job can't deadlock. A pool with no
+// workers runs jobs on the submitting thread.
+class WorkerPool
+{
+public:
+  // by default, one worker per core in addition to the thread that owns the pool
+  static const uint32_t DefaultWorkerCount = ~0U;
+
+  explicit WorkerPool(uint32_t numWorkers = DefaultWorkerCount);
+  ~WorkerPool();
+
+  uint32_t GetWorkerCount() const { return (uint32_t)m_Threads.size(); }
+  void Submit(WorkerJob *job);
+  void Wait(WorkerJob *job);
+  void WaitAll();
+
+  // runs job.Run(i) for every i in [0, count) across the workers and the calling thread, and
+  // returns once all have completed.
+  void ParallelFor(uint32_t count, ParallelJob &job);
+
+private:
+  // no copying
+  WorkerPool &operator=(const WorkerPool &other);
+  WorkerPool(const WorkerPool &other);
+
+  static void WorkerThread(void *userData);
+
+  // pops the next queued job and runs it on the calling thread. Must be called with m_Lock held
+  // once, which is released while the job runs.
+  bool RunQueuedJob();
+
+  std::vector<ThreadHandle> m_Threads;
+
+  CriticalSection m_Lock;
+  ConditionVariable m_JobQueued;
+  ConditionVariable m_JobDone;
+  std::deque<WorkerJob *> m_Queue;
+  uint32_t m_Pending;
+  bool m_Shutdown;
+};
+};
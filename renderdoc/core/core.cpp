@@ -29,6 +29,7 @@
 #include "api/replay/version.h"
 #include "common/common.h"
 #include "common/dds_readwrite.h"
+#include "common/tracing.h"
 #include "hooks/hooks.h"
 #include "replay/replay_driver.h"
 #include "serialise/serialiser.h"
@@ -248,6 +249,8 @@ void RenderDoc::Initialise()
 
   Threading::Init();
 
+  Tracing::Init();
+
   m_RemoteIdent = 0;
   m_RemoteThread = 0;
 
@@ -376,6 +379,8 @@ RenderDoc::~RenderDoc()
 
   Network::Shutdown();
 
+  Tracing::Shutdown();
+
   Threading::Shutdown();
 
   FileIO::Delete(m_LoggingFilename.c_str());
@@ -468,11 +473,15 @@ IFrameCapturer *RenderDoc::MatchFrameCapturer(void *dev, void *wnd)
 
 void RenderDoc::StartFrameCapture(void *dev, void *wnd)
 {
+  RDCTRACE_SCOPE("StartFrameCapture");
+
   IFrameCapturer *frameCap = MatchFrameCapturer(dev, wnd);
   if(frameCap)
   {
     frameCap->StartFrameCapture(dev, wnd);
     m_CapturesActive++;
+
+    RDCTRACE_COUNTER("Captures active", m_CapturesActive);
   }
 }
 
@@ -492,10 +501,15 @@ void RenderDoc::SetActiveWindow(void *dev, void *wnd)
 
 bool RenderDoc::EndFrameCapture(void *dev, void *wnd)
 {
+  RDCTRACE_SCOPE("EndFrameCapture");
+
   IFrameCapturer *frameCap = MatchFrameCapturer(dev, wnd);
   if(frameCap)
   {
     m_CapturesActive--;
+
+    RDCTRACE_COUNTER("Captures active", m_CapturesActive);
+
     return frameCap->EndFrameCapture(dev, wnd);
   }
   return false;
@@ -974,6 +988,8 @@ void RenderDoc::SetCaptureOptions(const CaptureOptions &opts)
 {
   m_Options = opts;
 
+  Callstack::SetUnwinder(opts.CallstackUnwinder);
+
   LibraryHooks::GetInstance().OptionsUpdated();
 }
 
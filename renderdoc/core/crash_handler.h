@@ -120,8 +120,9 @@ public:
 
     _CrtSetReportMode(_CRT_ASSERT, 0);
     m_ExHandler = new google_breakpad::ExceptionHandler(
-        dumpFolder.c_str(), NULL, NULL, NULL, google_breakpad::ExceptionHandler::HANDLER_ALL,
-        dumpType, L"\\\\.\\pipe\\RenderDocBreakpadServer", &custom);
+        dumpFolder.c_str(), &FlushLogFilter, NULL, NULL,
+        google_breakpad::ExceptionHandler::HANDLER_ALL, dumpType,
+        L"\\\\.\\pipe\\RenderDocBreakpadServer", &custom);
 
     m_ExHandler->set_handle_debug_exceptions(true);
 
@@ -130,6 +131,16 @@ public:
   }
 
   virtual ~CrashHandler() { SAFE_DELETE(m_ExHandler); }
+
+  // called before the minidump is written. Write out anything still queued in the log so the
+  // last messages before the crash aren't lost.
+  static bool FlushLogFilter(void *context, EXCEPTION_POINTERS *exinfo,
+                             MDRawAssertionInfo *assertion)
+  {
+    rdclog_flush();
+    return true;
+  }
+
   void WriteMinidump() { m_ExHandler->WriteMinidump(); }
   void WriteMinidump(void *data)
   {
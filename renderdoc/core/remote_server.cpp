@@ -67,7 +67,7 @@ void Serialiser::Serialise(const char *name, Process::EnvironmentModification &e
   Serialise("value", el.value);
 }
 
-static const uint32_t RemoteServerProtocolVersion = 1;
+static const uint32_t RemoteServerProtocolVersion = 2;
 
 enum RemoteServerPacket
 {
@@ -24,6 +24,7 @@
  ******************************************************************************/
 
 #include "replay_proxy.h"
+#include "common/tracing.h"
 #include "lz4/lz4.h"
 
 // these functions do compile time asserts on the size of the structure, to
@@ -1954,6 +1955,8 @@ ReplayProxy::~ReplayProxy()
 
 bool ReplayProxy::SendReplayCommand(ReplayProxyPacket type)
 {
+  RDCTRACE_SCOPE("ReplayProxy::SendReplayCommand", type);
+
   if(!m_Socket->Connected())
     return false;
 
@@ -2111,6 +2114,8 @@ bool ReplayProxy::Tick(int type, Serialiser *incomingPacket)
   if(!m_RemoteServer)
     return true;
 
+  RDCTRACE_SCOPE("ReplayProxy::Tick", type);
+
   if(!m_Socket || !m_Socket->Connected())
     return false;
 
@@ -2355,29 +2360,48 @@ FetchBuffer ReplayProxy::GetBuffer(ResourceId id)
 
 void ReplayProxy::SavePipelineState()
 {
+  // only the state for the capture's API is filled out, so only that one is sent. Both sides know
+  // the API from GetAPIProperties(), which the client calls on creation.
+  GraphicsAPI api = m_APIProps.pipelineType;
+
   if(m_RemoteServer)
   {
     m_Remote->SavePipelineState();
-    m_D3D11PipelineState = m_Remote->GetD3D11PipelineState();
-    m_D3D12PipelineState = m_Remote->GetD3D12PipelineState();
-    m_GLPipelineState = m_Remote->GetGLPipelineState();
-    m_VulkanPipelineState = m_Remote->GetVulkanPipelineState();
+
+    api = m_Remote->GetAPIProperties().pipelineType;
+
+    if(api == eGraphicsAPI_D3D11)
+      m_D3D11PipelineState = m_Remote->GetD3D11PipelineState();
+    else if(api == eGraphicsAPI_D3D12)
+      m_D3D12PipelineState = m_Remote->GetD3D12PipelineState();
+    else if(api == eGraphicsAPI_OpenGL)
+      m_GLPipelineState = m_Remote->GetGLPipelineState();
+    else if(api == eGraphicsAPI_Vulkan)
+      m_VulkanPipelineState = m_Remote->GetVulkanPipelineState();
   }
   else
   {
     if(!SendReplayCommand(eReplayProxy_SavePipelineState))
       return;
 
-    m_D3D11PipelineState = D3D11PipelineState();
-    m_D3D12PipelineState = D3D12PipelineState();
-    m_GLPipelineState = GLPipelineState();
-    m_VulkanPipelineState = VulkanPipelineState();
-  }
-
-  m_FromReplaySerialiser->Serialise("", m_D3D11PipelineState);
-  m_FromReplaySerialiser->Serialise("", m_D3D12PipelineState);
-  m_FromReplaySerialiser->Serialise("", m_GLPipelineState);
-  m_FromReplaySerialiser->Serialise("", m_VulkanPipelineState);
+    if(api == eGraphicsAPI_D3D11)
+      m_D3D11PipelineState = D3D11PipelineState();
+    else if(api == eGraphicsAPI_D3D12)
+      m_D3D12PipelineState = D3D12PipelineState();
+    else if(api == eGraphicsAPI_OpenGL)
+      m_GLPipelineState = GLPipelineState();
+    else if(api == eGraphicsAPI_Vulkan)
+      m_VulkanPipelineState = VulkanPipelineState();
+  }
+
+  if(api == eGraphicsAPI_D3D11)
+    m_FromReplaySerialiser->Serialise("", m_D3D11PipelineState);
+  else if(api == eGraphicsAPI_D3D12)
+    m_FromReplaySerialiser->Serialise("", m_D3D12PipelineState);
+  else if(api == eGraphicsAPI_OpenGL)
+    m_FromReplaySerialiser->Serialise("", m_GLPipelineState);
+  else if(api == eGraphicsAPI_Vulkan)
+    m_FromReplaySerialiser->Serialise("", m_VulkanPipelineState);
 }
 
 void ReplayProxy::ReplayLog(uint32_t endEventID, ReplayLogType replayType)
@@ -405,6 +405,16 @@ public:
   ResourceId GetOriginalID(ResourceId id);
   ResourceId GetLiveID(ResourceId id);
 
+  // While tracking, the first event at which each original ID is looked up through GetLiveResource
+  // or GetLiveID is recorded. Replaying up to an event can't touch a resource that was first
+  // looked up after it, which lets a driver tell which initial contents a replay needs.
+  void BeginUseTracking();
+  void SetUseTrackingEvent(uint32_t eventID) { m_UseEvent = eventID; }
+  void EndUseTracking() { m_TrackUses = false; }
+  bool IsTrackingUses() { return m_TrackUses; }
+  // returns ~0U for resources that were never looked up
+  uint32_t GetFirstUse(ResourceId origid);
+
   // Serialise in which resources need initial contents and set them up.
   void CreateInitialContents();
 
@@ -412,7 +422,7 @@ public:
   void FreeInitialContents();
 
   // Apply the initial contents for the resources that need them, used at the start of a frame
-  void ApplyInitialContents();
+  virtual void ApplyInitialContents();
 
   // Resource wrapping, allows for querying and adding/removing of wrapper layers around resources
   bool AddWrapper(WrappedResourceType wrap, RealResourceType real);
@@ -487,6 +497,11 @@ protected:
 
   // used during replay - holds current resource replacements
   map<ResourceId, ResourceId> m_Replacements;
+
+  // used during replay - the first event each resource was looked up at, see BeginUseTracking
+  bool m_TrackUses;
+  uint32_t m_UseEvent;
+  map<ResourceId, uint32_t> m_FirstUse;
 };
 
 template <typename WrappedResourceType, typename RealResourceType, typename RecordType>
@@ -500,6 +515,9 @@ ResourceManager<WrappedResourceType, RealResourceType, RecordType>::ResourceMana
   m_pSerialiser = ser;
 
   m_InFrame = false;
+
+  m_TrackUses = false;
+  m_UseEvent = 0;
 }
 
 template <typename WrappedResourceType, typename RealResourceType, typename RecordType>
@@ -1327,6 +1345,10 @@ WrappedResourceType ResourceManager<WrappedResourceType, RealResourceType, Recor
 
   RDCASSERT(HasLiveResource(origid), origid);
 
+  // insert doesn't overwrite, so this keeps the earliest event
+  if(m_TrackUses)
+    m_FirstUse.insert(std::make_pair(origid, m_UseEvent));
+
   if(m_Replacements.find(origid) != m_Replacements.end())
     return GetLiveResource(m_Replacements[origid]);
 
@@ -1416,5 +1438,32 @@ ResourceId ResourceManager<WrappedResourceType, RealResourceType, RecordType>::G
     return id;
 
   RDCASSERT(m_LiveIDs.find(id) != m_LiveIDs.end(), id);
+
+  if(m_TrackUses)
+    m_FirstUse.insert(std::make_pair(id, m_UseEvent));
+
   return m_LiveIDs[id];
 }
+
+template <typename WrappedResourceType, typename RealResourceType, typename RecordType>
+void ResourceManager<WrappedResourceType, RealResourceType, RecordType>::BeginUseTracking()
+{
+  SCOPED_LOCK(m_Lock);
+
+  m_FirstUse.clear();
+  m_UseEvent = 0;
+  m_TrackUses = true;
+}
+
+template <typename WrappedResourceType, typename RealResourceType, typename RecordType>
+uint32_t ResourceManager<WrappedResourceType, RealResourceType, RecordType>::GetFirstUse(
+    ResourceId origid)
+{
+  SCOPED_LOCK(m_Lock);
+
+  auto it = m_FirstUse.find(origid);
+  if(it == m_FirstUse.end())
+    return ~0U;
+
+  return it->second;
+}
@@ -25,51 +25,59 @@
 #include "glsl_shaders.h"
 #include "os/os_specific.h"
 
+#if defined(RENDERDOC_PRECOMPILED_SPIRV)
+
+// generated at build time by spirv-precompile, sorted by hash
+extern const PrecompiledSPIRV precompiled_spirv[];
+extern const size_t precompiled_spirv_count;
+
+#else
+
+static const PrecompiledSPIRV *precompiled_spirv = NULL;
+static const size_t precompiled_spirv_count = 0;
+
+#endif
+
 void GenerateGLSLShader(std::vector<std::string> &sources, ShaderType type,
                         const std::string &defines, const std::string &shader, int version,
                         bool uniforms)
 {
-  sources.resize(4);
-  sources[0] = StringFormat::Fmt("#version %d core\n", version);
+  string texsample;
 
-  if(uniforms)
-    sources[1] = GetEmbeddedResource(glsl_debuguniforms_h);
+  if(type == eShaderVulkan)
+    texsample = GetEmbeddedResource(glsl_vk_texsample_h);
+  else if(type == eShaderGLSL)
+    texsample = GetEmbeddedResource(glsl_gl_texsample_h);
   else
-    sources[1] = "";
+    RDCERR("Unknown type! %d", type);
 
-  if(shader.find("#include \"texsample.h\"") != string::npos)
-  {
-    if(type == eShaderVulkan)
-      sources[2] = GetEmbeddedResource(glsl_vk_texsample_h);
-    else if(type == eShaderGLSL)
-      sources[2] = GetEmbeddedResource(glsl_gl_texsample_h);
-    else
-      RDCERR("Unknown type! %d", type);
-  }
-  else
-  {
-    sources[2] = "";
-  }
+  ComposeGLSLShader(sources, defines, shader, version,
+                    uniforms ? GetEmbeddedResource(glsl_debuguniforms_h) : "", texsample);
+}
 
-  sources[3] = shader;
+const PrecompiledSPIRV *FindPrecompiledSPIRV(uint64_t hash)
+{
+  // binary search, the table is sorted by hash
+  size_t lo = 0, hi = precompiled_spirv_count;
 
-  for(int i = 0; i < 4; i++)
+  while(lo < hi)
   {
-    // hoist up any #extension directives
-    size_t extsearch = 0;
-    do
-    {
-      extsearch = sources[i].find("#extension", extsearch);
+    size_t mid = lo + (hi - lo) / 2;
 
-      if(extsearch == string::npos)
-        break;
+    if(precompiled_spirv[mid].hash < hash)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
 
-      size_t begin = extsearch;
-      extsearch = sources[i].find('\n', extsearch);
+  if(lo < precompiled_spirv_count && precompiled_spirv[lo].hash == hash)
+    return &precompiled_spirv[lo];
 
-      sources[0] += sources[i].substr(begin, extsearch - begin + 1);
-    } while(extsearch != string::npos);
-  }
+  return NULL;
+}
 
-  sources[0] += "\n" + defines + "\n";
+const PrecompiledSPIRV *GetPrecompiledSPIRV(size_t &count)
+{
+  count = precompiled_spirv_count;
+  return precompiled_spirv;
 }
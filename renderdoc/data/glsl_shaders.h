@@ -22,15 +22,87 @@
  * THE SOFTWARE.
  ******************************************************************************/
 
+#pragma once
+
 enum ShaderType
 {
   eShaderGLSL,
   eShaderVulkan
 };
 
+#include <stdint.h>
+#include <stdio.h>
 #include <string>
 #include <vector>
+#include "serialise/string_utils.h"
 
 void GenerateGLSLShader(std::vector<std::string> &sources, ShaderType type,
                         const std::string &defines, const std::string &shader, int version,
                         bool uniforms = true);
+
+// the guts of GenerateGLSLShader, with the uniforms and texsample headers passed in rather than
+// fetched from the embedded resources. This is also used by the build-time SPIR-V precompiler
+// (driver/shaders/spirv/spirv_precompile.cpp) so it must only depend on the standard library.
+inline void ComposeGLSLShader(std::vector<std::string> &sources, const std::string &defines,
+                              const std::string &shader, int version, const std::string &uniforms,
+                              const std::string &texsample)
+{
+  char versionString[32];
+  snprintf(versionString, sizeof(versionString), "#version %d core\n", version);
+
+  sources.resize(4);
+  sources[0] = versionString;
+  sources[1] = uniforms;
+
+  if(shader.find("#include \"texsample.h\"") != std::string::npos)
+    sources[2] = texsample;
+  else
+    sources[2] = "";
+
+  sources[3] = shader;
+
+  for(int i = 0; i < 4; i++)
+  {
+    // hoist up any #extension directives
+    size_t extsearch = 0;
+    do
+    {
+      extsearch = sources[i].find("#extension", extsearch);
+
+      if(extsearch == std::string::npos)
+        break;
+
+      size_t begin = extsearch;
+      extsearch = sources[i].find('\n', extsearch);
+
+      sources[0] += sources[i].substr(begin, extsearch - begin + 1);
+    } while(extsearch != std::string::npos);
+  }
+
+  sources[0] += "\n" + defines + "\n";
+}
+
+// 64-bit hash identifying a set of shader sources compiled for a given SPIRVShaderStage
+inline uint64_t HashGLSLShader(uint32_t stage, const std::vector<std::string> &sources)
+{
+  uint64_t hash = hash64(&stage, sizeof(stage));
+  // include the NULL terminators so that moving text between strings changes the hash
+  for(size_t i = 0; i < sources.size(); i++)
+    hash = hash64(sources[i].c_str(), sources[i].size() + 1, hash);
+  return hash;
+}
+
+struct PrecompiledSPIRV
+{
+  uint64_t hash;
+  uint32_t stage;
+  uint32_t numWords;
+  const uint32_t *words;
+};
+
+// returns the SPIR-V compiled at build time for sources with the given HashGLSLShader, or NULL if
+// it wasn't precompiled (or the build has no precompile step) and must be compiled at runtime.
+const PrecompiledSPIRV *FindPrecompiledSPIRV(uint64_t hash);
+
+// returns the whole table of precompiled SPIR-V, e.g. for use as a corpus of real-world modules
+const PrecompiledSPIRV *GetPrecompiledSPIRV(size_t &count);
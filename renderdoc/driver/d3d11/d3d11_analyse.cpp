@@ -2528,27 +2528,26 @@ uint32_t D3D11DebugManager::PickVertex(uint32_t eventID, const MeshDisplay &cfg,
     byte *data = &oldData[0];
     byte *dataEnd = data + oldData.size();
 
-    bool valid;
-
+    // apply baseVertex but clamp to 0 (don't allow index to become negative). The first idxclamp
+    // vertices all read vertex 0, and the rest are one contiguous run we can decode in one go.
     uint32_t idxclamp = 0;
     if(cfg.position.baseVertex < 0)
-      idxclamp = uint32_t(-cfg.position.baseVertex);
-
-    for(uint32_t i = 0; i < cfg.position.numVerts; i++)
-    {
-      uint32_t idx = i;
+      idxclamp = RDCMIN(uint32_t(-cfg.position.baseVertex), cfg.position.numVerts);
 
-      // apply baseVertex but clamp to 0 (don't allow index to become negative)
-      if(idx < idxclamp)
-        idx = 0;
-      else if(cfg.position.baseVertex < 0)
-        idx -= idxclamp;
-      else if(cfg.position.baseVertex > 0)
-        idx += cfg.position.baseVertex;
+    byte *runStart = data;
+    if(cfg.position.baseVertex > 0)
+      runStart += cfg.position.baseVertex * cfg.position.stride;
 
-      vbData[i] = InterpretVertex(data, idx, cfg, dataEnd, false, valid);
+    if(idxclamp > 0)
+    {
+      DecodeFormattedComponents(cfg.position, data, dataEnd, 1, vbData);
+      for(uint32_t i = 1; i < idxclamp; i++)
+        vbData[i] = vbData[0];
     }
 
+    DecodeFormattedComponents(cfg.position, runStart, dataEnd, cfg.position.numVerts - idxclamp,
+                              vbData + idxclamp);
+
     m_pImmediateContext->UpdateSubresource(m_DebugRender.PickVBBuf, 0, NULL, vbData, sizeof(Vec4f),
                                            sizeof(Vec4f));
 
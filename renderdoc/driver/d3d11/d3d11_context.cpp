@@ -478,18 +478,7 @@ void WrappedID3D11DeviceContext::EndCaptureFrame()
   m_pSerialiser->Serialise("HasCallstack", HasCallstack);
 
   if(HasCallstack)
-  {
-    Callstack::Stackwalk *call = Callstack::Collect();
-
-    RDCASSERT(call->NumLevels() < 0xff);
-
-    size_t numLevels = call->NumLevels();
-    uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-    m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-    delete call;
-  }
+    m_pSerialiser->SerialiseCallstack("callstack");
 
   m_ContextRecord->AddChunk(scope.Get());
 }
@@ -777,16 +766,7 @@ void WrappedID3D11DeviceContext::ProcessChunk(uint64_t offset, D3D11ChunkType ch
       m_pSerialiser->Serialise("HasCallstack", HasCallstack);
 
       if(HasCallstack)
-      {
-        size_t numLevels = 0;
-        uint64_t *stack = NULL;
-
-        m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-        m_pSerialiser->SetCallstack(stack, numLevels);
-
-        SAFE_DELETE_ARRAY(stack);
-      }
+        m_pSerialiser->SerialiseCallstack("callstack");
 
       if(m_State == READING)
       {
@@ -3688,32 +3688,7 @@ void WrappedID3D11DeviceContext::Serialise_DebugMessages()
                     RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws != 0);
 
   if(HasCallstack)
-  {
-    if(m_State >= WRITING)
-    {
-      Callstack::Stackwalk *call = Callstack::Collect();
-
-      RDCASSERT(call->NumLevels() < 0xff);
-
-      size_t numLevels = call->NumLevels();
-      uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-      m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-      delete call;
-    }
-    else
-    {
-      size_t numLevels = 0;
-      uint64_t *stack = NULL;
-
-      m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-      m_pSerialiser->SetCallstack(stack, numLevels);
-
-      SAFE_DELETE_ARRAY(stack);
-    }
-  }
+    m_pSerialiser->SerialiseCallstack("callstack");
 
   SERIALISE_ELEMENT(uint32_t, NumMessages, (uint32_t)debugMessages.size());
 
@@ -24,7 +24,6 @@
  ******************************************************************************/
 
 #include "d3d11_debug.h"
-#include "common/shader_cache.h"
 #include "data/resource.h"
 #include "driver/d3d11/d3d11_resources.h"
 #include "driver/dx/official/d3dcompiler.h"
@@ -55,7 +54,7 @@ struct D3DBlobShaderCallbacks
       RDCFATAL("d3dcompiler.dll doesn't contain D3DCreateBlob");
   }
 
-  bool Create(uint32_t size, byte *data, ID3DBlob **ret) const
+  bool Create(uint32_t size, const byte *data, ID3DBlob **ret) const
   {
     RDCASSERT(ret);
 
@@ -74,8 +73,6 @@ struct D3DBlobShaderCallbacks
   }
 
   void Destroy(ID3DBlob *blob) const { blob->Release(); }
-  uint32_t GetSize(ID3DBlob *blob) const { return (uint32_t)blob->GetBufferSize(); }
-  byte *GetData(ID3DBlob *blob) const { return (byte *)blob->GetBufferPointer(); }
   pD3DCreateBlob m_BlobCreate;
 } ShaderCacheCallbacks;
 
@@ -138,11 +135,7 @@ D3D11DebugManager::D3D11DebugManager(WrappedID3D11Device *wrapper)
     }
   }
 
-  bool success = LoadShaderCache("d3dshaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion,
-                                 m_ShaderCache, ShaderCacheCallbacks);
-
-  // if we failed to load from the cache
-  m_ShaderCacheDirty = !success;
+  m_ShaderBlobCache.Open("d3dshaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion);
 
   m_CacheShaders = true;
 
@@ -161,16 +154,10 @@ D3D11DebugManager::~D3D11DebugManager()
 {
   PreDeviceShutdownCounters();
 
-  if(m_ShaderCacheDirty)
-  {
-    SaveShaderCache("d3dshaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion, m_ShaderCache,
-                    ShaderCacheCallbacks);
-  }
-  else
-  {
-    for(auto it = m_ShaderCache.begin(); it != m_ShaderCache.end(); ++it)
-      ShaderCacheCallbacks.Destroy(it->second);
-  }
+  m_ShaderBlobCache.Close();
+
+  for(auto it = m_ShaderCache.begin(); it != m_ShaderCache.end(); ++it)
+    ShaderCacheCallbacks.Destroy(it->second);
 
   ShutdownFontRendering();
   ShutdownStreamOut();
@@ -217,10 +204,10 @@ string D3D11DebugManager::GetShaderBlob(const char *source, const char *entry,
                                         const uint32_t compileFlags, const char *profile,
                                         ID3DBlob **srcblob)
 {
-  uint32_t hash = strhash(source);
-  hash = strhash(entry, hash);
-  hash = strhash(profile, hash);
-  hash ^= compileFlags;
+  uint64_t hash = hash64(source, strlen(source) + 1);
+  hash = hash64(entry, strlen(entry) + 1, hash);
+  hash = hash64(profile, strlen(profile) + 1, hash);
+  hash = hash64(&compileFlags, sizeof(compileFlags), hash);
 
   if(m_ShaderCache.find(hash) != m_ShaderCache.end())
   {
@@ -229,6 +216,23 @@ string D3D11DebugManager::GetShaderBlob(const char *source, const char *entry,
     return "";
   }
 
+  const byte *cached = NULL;
+  uint32_t cachedSize = 0;
+
+  if(m_ShaderBlobCache.Find(hash, cached, cachedSize))
+  {
+    ID3DBlob *blob = NULL;
+
+    if(ShaderCacheCallbacks.Create(cachedSize, cached, &blob))
+    {
+      m_ShaderCache[hash] = blob;
+
+      *srcblob = blob;
+      (*srcblob)->AddRef();
+      return "";
+    }
+  }
+
   HRESULT hr = S_OK;
 
   ID3DBlob *byteBlob = NULL;
@@ -278,7 +282,8 @@ string D3D11DebugManager::GetShaderBlob(const char *source, const char *entry,
   {
     m_ShaderCache[hash] = byteBlob;
     byteBlob->AddRef();
-    m_ShaderCacheDirty = true;
+    m_ShaderBlobCache.Insert(hash, byteBlob->GetBufferPointer(),
+                             (uint32_t)byteBlob->GetBufferSize());
   }
 
   SAFE_RELEASE(errBlob);
@@ -4465,66 +4470,8 @@ FloatVector D3D11DebugManager::InterpretVertex(byte *data, uint32_t vert, const
 
   data += vert * cfg.position.stride;
 
-  float *out = &ret.x;
-
-  ResourceFormat fmt;
-  fmt.compByteWidth = cfg.position.compByteWidth;
-  fmt.compCount = cfg.position.compCount;
-  fmt.compType = cfg.position.compType;
-
-  if(cfg.position.specialFormat == eSpecial_R10G10B10A2)
-  {
-    if(data + 4 >= end)
-    {
-      valid = false;
-      return ret;
-    }
-
-    Vec4f v = ConvertFromR10G10B10A2(*(uint32_t *)data);
-    ret.x = v.x;
-    ret.y = v.y;
-    ret.z = v.z;
-    ret.w = v.w;
-    return ret;
-  }
-  else if(cfg.position.specialFormat == eSpecial_R11G11B10)
-  {
-    if(data + 4 >= end)
-    {
-      valid = false;
-      return ret;
-    }
-
-    Vec3f v = ConvertFromR11G11B10(*(uint32_t *)data);
-    ret.x = v.x;
-    ret.y = v.y;
-    ret.z = v.z;
-    return ret;
-  }
-
-  if(data + cfg.position.compCount * cfg.position.compByteWidth > end)
-  {
+  if(DecodeFormattedComponents(cfg.position, data, end, 1, &ret) == 0)
     valid = false;
-    return ret;
-  }
-
-  for(uint32_t i = 0; i < cfg.position.compCount; i++)
-  {
-    *out = ConvertComponent(fmt, data);
-
-    data += cfg.position.compByteWidth;
-    out++;
-  }
-
-  if(cfg.position.bgraOrder)
-  {
-    FloatVector reversed;
-    reversed.x = ret.z;
-    reversed.y = ret.y;
-    reversed.z = ret.x;
-    reversed.w = ret.w;
-    return reversed;
-  }
 
   return ret;
 }
@@ -29,6 +29,7 @@
 #include <map>
 #include <utility>
 #include "api/replay/renderdoc_replay.h"
+#include "common/shader_cache.h"
 #include "driver/dx/official/d3d11_4.h"
 #include "driver/shaders/dxbc/dxbc_debug.h"
 #include "d3d11_renderstate.h"
@@ -327,10 +328,11 @@ private:
   } m_RealState;
 
   static const uint32_t m_ShaderCacheMagic = 0xf000baba;
-  static const uint32_t m_ShaderCacheVersion = 3;
+  static const uint32_t m_ShaderCacheVersion = 4;
 
-  bool m_ShaderCacheDirty, m_CacheShaders;
-  map<uint32_t, ID3DBlob *> m_ShaderCache;
+  bool m_CacheShaders;
+  ShaderBlobCache m_ShaderBlobCache;
+  map<uint64_t, ID3DBlob *> m_ShaderCache;
 
   static const int m_SOBufferSize = 32 * 1024 * 1024;
   ID3D11Buffer *m_SOBuffer;
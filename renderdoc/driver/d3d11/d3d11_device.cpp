@@ -24,6 +24,7 @@
  ******************************************************************************/
 
 #include "driver/d3d11/d3d11_device.h"
+#include "common/tracing.h"
 #include "core/core.h"
 #include "driver/d3d11/d3d11_context.h"
 #include "driver/d3d11/d3d11_renderstate.h"
@@ -1136,6 +1137,8 @@ void WrappedID3D11Device::Serialise_CaptureScope(uint64_t offset)
 
 void WrappedID3D11Device::ReadLogInitialisation()
 {
+  RDCTRACE_SCOPE("WrappedID3D11Device::ReadLogInitialisation");
+
   uint64_t frameOffset = 0;
 
   LazyInit();
@@ -1166,6 +1169,8 @@ void WrappedID3D11Device::ReadLogInitialisation()
 
     D3D11ChunkType context = (D3D11ChunkType)m_pSerialiser->PushContext(NULL, NULL, 1, false);
 
+    RDCTRACE_SCOPE("Initialisation chunk", context);
+
     if(context == CAPTURE_SCOPE)
     {
       // immediately read rest of log into memory
@@ -2437,6 +2442,8 @@ void WrappedID3D11Device::Apply_InitialState(ID3D11DeviceChild *live,
 void WrappedID3D11Device::ReplayLog(uint32_t startEventID, uint32_t endEventID,
                                     ReplayLogType replayType)
 {
+  RDCTRACE_SCOPE("WrappedID3D11Device::ReplayLog", endEventID);
+
   uint64_t offs = m_FrameRecord.frameInfo.fileOffset;
 
   m_pSerialiser->SetOffset(offs);
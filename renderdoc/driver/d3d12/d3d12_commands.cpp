@@ -399,16 +399,7 @@ void WrappedID3D12CommandQueue::ProcessChunk(uint64_t offset, D3D12ChunkType chu
       m_BackbufferID = bbid;
 
       if(HasCallstack)
-      {
-        size_t numLevels = 0;
-        uint64_t *stack = NULL;
-
-        m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-        m_pSerialiser->SetCallstack(stack, numLevels);
-
-        SAFE_DELETE_ARRAY(stack);
-      }
+        m_pSerialiser->SerialiseCallstack("callstack");
 
       if(m_State == READING)
       {
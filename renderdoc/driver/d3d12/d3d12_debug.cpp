@@ -23,7 +23,6 @@
  ******************************************************************************/
 
 #include "d3d12_debug.h"
-#include "common/shader_cache.h"
 #include "data/resource.h"
 #include "driver/dx/official/d3dcompiler.h"
 #include "driver/dxgi/dxgi_common.h"
@@ -55,7 +54,7 @@ struct D3D12BlobShaderCallbacks
       RDCFATAL("d3dcompiler.dll doesn't contain D3DCreateBlob");
   }
 
-  bool Create(uint32_t size, byte *data, ID3DBlob **ret) const
+  bool Create(uint32_t size, const byte *data, ID3DBlob **ret) const
   {
     RDCASSERT(ret);
 
@@ -74,8 +73,6 @@ struct D3D12BlobShaderCallbacks
   }
 
   void Destroy(ID3DBlob *blob) const { blob->Release(); }
-  uint32_t GetSize(ID3DBlob *blob) const { return (uint32_t)blob->GetBufferSize(); }
-  byte *GetData(ID3DBlob *blob) const { return (byte *)blob->GetBufferPointer(); }
   pD3DCreateBlob m_BlobCreate;
 } ShaderCache12Callbacks;
 
@@ -359,11 +356,7 @@ D3D12DebugManager::D3D12DebugManager(WrappedID3D12Device *wrapper)
 
   RenderDoc::Inst().SetProgress(DebugManagerInit, 0.4f);
 
-  bool success = LoadShaderCache("d3d12shaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion,
-                                 m_ShaderCache, ShaderCache12Callbacks);
-
-  // if we failed to load from the cache
-  m_ShaderCacheDirty = !success;
+  m_ShaderBlobCache.Open("d3d12shaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion);
 
   m_CacheShaders = true;
 
@@ -1304,16 +1297,10 @@ D3D12DebugManager::D3D12DebugManager(WrappedID3D12Device *wrapper)
 
 D3D12DebugManager::~D3D12DebugManager()
 {
-  if(m_ShaderCacheDirty)
-  {
-    SaveShaderCache("d3d12shaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion, m_ShaderCache,
-                    ShaderCache12Callbacks);
-  }
-  else
-  {
-    for(auto it = m_ShaderCache.begin(); it != m_ShaderCache.end(); ++it)
-      ShaderCache12Callbacks.Destroy(it->second);
-  }
+  m_ShaderBlobCache.Close();
+
+  for(auto it = m_ShaderCache.begin(); it != m_ShaderCache.end(); ++it)
+    ShaderCache12Callbacks.Destroy(it->second);
 
   for(auto it = m_CachedMeshPipelines.begin(); it != m_CachedMeshPipelines.end(); ++it)
     for(size_t p = 0; p < MeshDisplayPipelines::ePipe_Count; p++)
@@ -1404,10 +1391,10 @@ string D3D12DebugManager::GetShaderBlob(const char *source, const char *entry,
                                         const uint32_t compileFlags, const char *profile,
                                         ID3DBlob **srcblob)
 {
-  uint32_t hash = strhash(source);
-  hash = strhash(entry, hash);
-  hash = strhash(profile, hash);
-  hash ^= compileFlags;
+  uint64_t hash = hash64(source, strlen(source) + 1);
+  hash = hash64(entry, strlen(entry) + 1, hash);
+  hash = hash64(profile, strlen(profile) + 1, hash);
+  hash = hash64(&compileFlags, sizeof(compileFlags), hash);
 
   if(m_ShaderCache.find(hash) != m_ShaderCache.end())
   {
@@ -1416,6 +1403,23 @@ string D3D12DebugManager::GetShaderBlob(const char *source, const char *entry,
     return "";
   }
 
+  const byte *cached = NULL;
+  uint32_t cachedSize = 0;
+
+  if(m_ShaderBlobCache.Find(hash, cached, cachedSize))
+  {
+    ID3DBlob *blob = NULL;
+
+    if(ShaderCache12Callbacks.Create(cachedSize, cached, &blob))
+    {
+      m_ShaderCache[hash] = blob;
+
+      *srcblob = blob;
+      (*srcblob)->AddRef();
+      return "";
+    }
+  }
+
   HRESULT hr = S_OK;
 
   ID3DBlob *byteBlob = NULL;
@@ -1465,7 +1469,8 @@ string D3D12DebugManager::GetShaderBlob(const char *source, const char *entry,
   {
     m_ShaderCache[hash] = byteBlob;
     byteBlob->AddRef();
-    m_ShaderCacheDirty = true;
+    m_ShaderBlobCache.Insert(hash, byteBlob->GetBufferPointer(),
+                             (uint32_t)byteBlob->GetBufferSize());
   }
 
   SAFE_RELEASE(errBlob);
@@ -2622,27 +2627,26 @@ uint32_t D3D12DebugManager::PickVertex(uint32_t eventID, const MeshDisplay &cfg,
     byte *data = &oldData[0];
     byte *dataEnd = data + oldData.size();
 
-    bool valid = true;
-
+    // apply baseVertex but clamp to 0 (don't allow index to become negative). The first idxclamp
+    // vertices all read vertex 0, and the rest are one contiguous run we can decode in one go.
     uint32_t idxclamp = 0;
     if(cfg.position.baseVertex < 0)
-      idxclamp = uint32_t(-cfg.position.baseVertex);
+      idxclamp = RDCMIN(uint32_t(-cfg.position.baseVertex), cfg.position.numVerts);
 
-    for(uint32_t i = 0; i < cfg.position.numVerts; i++)
-    {
-      uint32_t idx = i;
-
-      // apply baseVertex but clamp to 0 (don't allow index to become negative)
-      if(idx < idxclamp)
-        idx = 0;
-      else if(cfg.position.baseVertex < 0)
-        idx -= idxclamp;
-      else if(cfg.position.baseVertex > 0)
-        idx += cfg.position.baseVertex;
+    byte *runStart = data;
+    if(cfg.position.baseVertex > 0)
+      runStart += cfg.position.baseVertex * cfg.position.stride;
 
-      vbData[i] = InterpretVertex(data, idx, cfg, dataEnd, false, valid);
+    if(idxclamp > 0)
+    {
+      DecodeFormattedComponents(cfg.position, data, dataEnd, 1, vbData);
+      for(uint32_t i = 1; i < idxclamp; i++)
+        vbData[i] = vbData[0];
     }
 
+    DecodeFormattedComponents(cfg.position, runStart, dataEnd, cfg.position.numVerts - idxclamp,
+                              vbData + idxclamp);
+
     FillBuffer(m_PickVB, 0, vbData, sizeof(Vec4f) * cfg.position.numVerts);
 
     delete[] vbData;
@@ -4939,66 +4943,8 @@ FloatVector D3D12DebugManager::InterpretVertex(byte *data, uint32_t vert, const
 
   data += vert * cfg.position.stride;
 
-  float *out = &ret.x;
-
-  ResourceFormat fmt;
-  fmt.compByteWidth = cfg.position.compByteWidth;
-  fmt.compCount = cfg.position.compCount;
-  fmt.compType = cfg.position.compType;
-
-  if(cfg.position.specialFormat == eSpecial_R10G10B10A2)
-  {
-    if(data + 4 >= end)
-    {
-      valid = false;
-      return ret;
-    }
-
-    Vec4f v = ConvertFromR10G10B10A2(*(uint32_t *)data);
-    ret.x = v.x;
-    ret.y = v.y;
-    ret.z = v.z;
-    ret.w = v.w;
-    return ret;
-  }
-  else if(cfg.position.specialFormat == eSpecial_R11G11B10)
-  {
-    if(data + 4 >= end)
-    {
-      valid = false;
-      return ret;
-    }
-
-    Vec3f v = ConvertFromR11G11B10(*(uint32_t *)data);
-    ret.x = v.x;
-    ret.y = v.y;
-    ret.z = v.z;
-    return ret;
-  }
-
-  if(data + cfg.position.compCount * cfg.position.compByteWidth > end)
-  {
+  if(DecodeFormattedComponents(cfg.position, data, end, 1, &ret) == 0)
     valid = false;
-    return ret;
-  }
-
-  for(uint32_t i = 0; i < cfg.position.compCount; i++)
-  {
-    *out = ConvertComponent(fmt, data);
-
-    data += cfg.position.compByteWidth;
-    out++;
-  }
-
-  if(cfg.position.bgraOrder)
-  {
-    FloatVector reversed;
-    reversed.x = ret.z;
-    reversed.y = ret.y;
-    reversed.z = ret.x;
-    reversed.w = ret.w;
-    return reversed;
-  }
 
   return ret;
 }
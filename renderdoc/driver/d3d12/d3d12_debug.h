@@ -25,6 +25,7 @@
 #pragma once
 
 #include "api/replay/renderdoc_replay.h"
+#include "common/shader_cache.h"
 #include "core/core.h"
 #include "driver/shaders/dxbc/dxbc_debug.h"
 #include "replay/replay_driver.h"
@@ -301,10 +302,11 @@ private:
   static const uint64_t m_ReadbackSize = 16 * 1024 * 1024;
 
   static const uint32_t m_ShaderCacheMagic = 0xbaafd1d1;
-  static const uint32_t m_ShaderCacheVersion = 1;
+  static const uint32_t m_ShaderCacheVersion = 2;
 
-  bool m_ShaderCacheDirty, m_CacheShaders;
-  map<uint32_t, ID3DBlob *> m_ShaderCache;
+  bool m_CacheShaders;
+  ShaderBlobCache m_ShaderBlobCache;
+  map<uint64_t, ID3DBlob *> m_ShaderCache;
 
   void FillCBufferVariables(const string &prefix, size_t &offset, bool flatten,
                             const vector<DXBC::CBufferVariable> &invars,
@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include "d3d12_device.h"
+#include "common/tracing.h"
 #include "core/core.h"
 #include "driver/dxgi/dxgi_common.h"
 #include "driver/dxgi/dxgi_wrapped.h"
@@ -1236,18 +1237,7 @@ void WrappedID3D12Device::EndCaptureFrame(ID3D12Resource *presentImage)
   localSerialiser->Serialise("HasCallstack", HasCallstack);
 
   if(HasCallstack)
-  {
-    Callstack::Stackwalk *call = Callstack::Collect();
-
-    RDCASSERT(call->NumLevels() < 0xff);
-
-    size_t numLevels = call->NumLevels();
-    uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-    localSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-    delete call;
-  }
+    localSerialiser->SerialiseCallstack("callstack");
 
   m_FrameCaptureRecord->AddChunk(scope.Get());
 }
@@ -2270,6 +2260,8 @@ void WrappedID3D12Device::ProcessChunk(uint64_t offset, D3D12ChunkType context)
 
 void WrappedID3D12Device::ReadLogInitialisation()
 {
+  RDCTRACE_SCOPE("WrappedID3D12Device::ReadLogInitialisation");
+
   uint64_t frameOffset = 0;
 
   m_pSerialiser->SetDebugText(true);
@@ -2298,6 +2290,8 @@ void WrappedID3D12Device::ReadLogInitialisation()
 
     D3D12ChunkType context = (D3D12ChunkType)m_pSerialiser->PushContext(NULL, NULL, 1, false);
 
+    RDCTRACE_SCOPE("Initialisation chunk", context);
+
     if(context == CAPTURE_SCOPE)
     {
       // immediately read rest of log into memory
@@ -2383,6 +2377,8 @@ void WrappedID3D12Device::ReadLogInitialisation()
 void WrappedID3D12Device::ReplayLog(uint32_t startEventID, uint32_t endEventID,
                                     ReplayLogType replayType)
 {
+  RDCTRACE_SCOPE("WrappedID3D12Device::ReplayLog", endEventID);
+
   uint64_t offs = m_FrameRecord.frameInfo.fileOffset;
 
   m_pSerialiser->SetOffset(offs);
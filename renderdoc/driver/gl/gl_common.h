@@ -191,6 +191,8 @@ extern bool GLIsCore;
 // 99 means the extension never became core, so you can easily
 // just do a check of CoreVersion >= NN and they will always fail.
 #define EXTENSION_CHECKS()                           \
+  EXT_TO_CHECK(21, ARB_pixel_buffer_object)          \
+  EXT_TO_CHECK(32, ARB_sync)                         \
   EXT_TO_CHECK(33, ARB_explicit_attrib_location)     \
   EXT_TO_CHECK(33, ARB_sampler_objects)              \
   EXT_TO_CHECK(33, ARB_texture_swizzle)              \
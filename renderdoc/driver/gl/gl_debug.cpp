@@ -777,6 +777,8 @@ bool GLReplay::GetMinMax(ResourceId texid, uint32_t sliceFace, uint32_t mip, uin
 
   auto &texDetails = m_pDriver->m_Textures[texid];
 
+  m_pDriver->GetResourceManager()->EnsureInitialState(texid);
+
   FetchTexture details = GetTexture(texid);
 
   const GLHookSet &gl = m_pDriver->GetHookset();
@@ -951,6 +953,8 @@ bool GLReplay::GetHistogram(ResourceId texid, uint32_t sliceFace, uint32_t mip,
 
   auto &texDetails = m_pDriver->m_Textures[texid];
 
+  m_pDriver->GetResourceManager()->EnsureInitialState(texid);
+
   FetchTexture details = GetTexture(texid);
 
   const GLHookSet &gl = m_pDriver->GetHookset();
@@ -1357,27 +1361,26 @@ uint32_t GLReplay::PickVertex(uint32_t eventID, const MeshDisplay &cfg, uint32_t
     byte *data = &oldData[0];
     byte *dataEnd = data + oldData.size();
 
-    bool valid;
-
+    // apply baseVertex but clamp to 0 (don't allow index to become negative). The first idxclamp
+    // vertices all read vertex 0, and the rest are one contiguous run we can decode in one go.
     uint32_t idxclamp = 0;
     if(cfg.position.baseVertex < 0)
-      idxclamp = uint32_t(-cfg.position.baseVertex);
-
-    for(uint32_t i = 0; i < cfg.position.numVerts; i++)
-    {
-      uint32_t idx = i;
+      idxclamp = RDCMIN(uint32_t(-cfg.position.baseVertex), cfg.position.numVerts);
 
-      // apply baseVertex but clamp to 0 (don't allow index to become negative)
-      if(idx < idxclamp)
-        idx = 0;
-      else if(cfg.position.baseVertex < 0)
-        idx -= idxclamp;
-      else if(cfg.position.baseVertex > 0)
-        idx += cfg.position.baseVertex;
+    byte *runStart = data;
+    if(cfg.position.baseVertex > 0)
+      runStart += cfg.position.baseVertex * cfg.position.stride;
 
-      vbData[i] = InterpretVertex(data, idx, cfg, dataEnd, false, valid);
+    if(idxclamp > 0)
+    {
+      DecodeFormattedComponents(cfg.position, data, dataEnd, 1, vbData);
+      for(uint32_t i = 1; i < idxclamp; i++)
+        vbData[i] = vbData[0];
     }
 
+    DecodeFormattedComponents(cfg.position, runStart, dataEnd, cfg.position.numVerts - idxclamp,
+                              vbData + idxclamp);
+
     gl.glBindBuffer(eGL_SHADER_STORAGE_BUFFER, DebugData.pickVBBuf);
     gl.glBufferSubData(eGL_SHADER_STORAGE_BUFFER, 0, cfg.position.numVerts * sizeof(Vec4f), vbData);
 
@@ -1666,6 +1669,8 @@ bool GLReplay::RenderTextureInternal(TextureDisplay cfg, int flags)
   if(texDetails.internalFormat == eGL_NONE)
     return false;
 
+  m_pDriver->GetResourceManager()->EnsureInitialState(cfg.texid);
+
   bool renderbuffer = false;
 
   int intIdx = 0;
@@ -4308,66 +4313,8 @@ FloatVector GLReplay::InterpretVertex(byte *data, uint32_t vert, const MeshDispl
 
   data += vert * cfg.position.stride;
 
-  float *out = &ret.x;
-
-  ResourceFormat fmt;
-  fmt.compByteWidth = cfg.position.compByteWidth;
-  fmt.compCount = cfg.position.compCount;
-  fmt.compType = cfg.position.compType;
-
-  if(cfg.position.specialFormat == eSpecial_R10G10B10A2)
-  {
-    if(data + 4 >= end)
-    {
-      valid = false;
-      return ret;
-    }
-
-    Vec4f v = ConvertFromR10G10B10A2(*(uint32_t *)data);
-    ret.x = v.x;
-    ret.y = v.y;
-    ret.z = v.z;
-    ret.w = v.w;
-    return ret;
-  }
-  else if(cfg.position.specialFormat == eSpecial_R11G11B10)
-  {
-    if(data + 4 >= end)
-    {
-      valid = false;
-      return ret;
-    }
-
-    Vec3f v = ConvertFromR11G11B10(*(uint32_t *)data);
-    ret.x = v.x;
-    ret.y = v.y;
-    ret.z = v.z;
-    return ret;
-  }
-
-  if(data + cfg.position.compCount * cfg.position.compByteWidth > end)
-  {
+  if(DecodeFormattedComponents(cfg.position, data, end, 1, &ret) == 0)
     valid = false;
-    return ret;
-  }
-
-  for(uint32_t i = 0; i < cfg.position.compCount; i++)
-  {
-    *out = ConvertComponent(fmt, data);
-
-    data += cfg.position.compByteWidth;
-    out++;
-  }
-
-  if(cfg.position.bgraOrder)
-  {
-    FloatVector reversed;
-    reversed.x = ret.z;
-    reversed.y = ret.y;
-    reversed.z = ret.x;
-    reversed.w = ret.w;
-    return reversed;
-  }
 
   return ret;
 }
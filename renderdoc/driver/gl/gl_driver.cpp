@@ -26,6 +26,7 @@
 #include "gl_driver.h"
 #include <algorithm>
 #include "common/common.h"
+#include "common/tracing.h"
 #include "data/glsl_shaders.h"
 #include "driver/shaders/spirv/spirv_common.h"
 #include "jpeg-compressor/jpge.h"
@@ -773,6 +774,24 @@ WrappedOpenGL::WrappedOpenGL(const char *logfile, const GLHookSet &funcs) : m_Re
     m_pSerialiser = new Serialiser(NULL, Serialiser::WRITING, false);
   }
 
+  // opt-in shadowing of indexed bindings, to avoid glGet queries on every draw. Setting this to
+  // 'validate' cross-checks the shadowed state against the driver each time it's used.
+  m_ShadowStateMode = eShadowState_Disabled;
+
+  if(m_State >= WRITING)
+  {
+    string shadow = Process::GetEnvVariable("RENDERDOC_GL_SHADOW_STATE");
+
+    if(shadow == "validate")
+      m_ShadowStateMode = eShadowState_Validate;
+    else if(!shadow.empty() && shadow != "0")
+      m_ShadowStateMode = eShadowState_Enabled;
+
+    if(m_ShadowStateMode != eShadowState_Disabled)
+      RDCLOG("Shadowing GL indexed bindings%s",
+             m_ShadowStateMode == eShadowState_Validate ? ", with validation" : "");
+  }
+
   m_DeviceRecord = NULL;
 
   m_ResourceManager = new GLResourceManager(m_State, m_pSerialiser, this);
@@ -1461,6 +1480,7 @@ struct RenderTextState
   GLenum ActiveTexture;
   GLuint tex0;
   GLuint ubo[3];
+  GLint64 uboOffset[3], uboSize[3];
   GLuint prog;
   GLuint pipe;
   GLuint VAO;
@@ -1577,9 +1597,12 @@ struct RenderTextState
 
     if(modern)
     {
-      gl.glGetIntegeri_v(eGL_UNIFORM_BUFFER_BINDING, 0, (GLint *)&ubo[0]);
-      gl.glGetIntegeri_v(eGL_UNIFORM_BUFFER_BINDING, 1, (GLint *)&ubo[1]);
-      gl.glGetIntegeri_v(eGL_UNIFORM_BUFFER_BINDING, 2, (GLint *)&ubo[2]);
+      for(GLuint i = 0; i < 3; i++)
+      {
+        gl.glGetIntegeri_v(eGL_UNIFORM_BUFFER_BINDING, i, (GLint *)&ubo[i]);
+        gl.glGetInteger64i_v(eGL_UNIFORM_BUFFER_START, i, &uboOffset[i]);
+        gl.glGetInteger64i_v(eGL_UNIFORM_BUFFER_SIZE, i, &uboSize[i]);
+      }
 
       gl.glGetIntegerv(eGL_VERTEX_ARRAY_BINDING, (GLint *)&VAO);
     }
@@ -1691,9 +1714,15 @@ struct RenderTextState
 
     if(modern)
     {
-      gl.glBindBufferBase(eGL_UNIFORM_BUFFER, 0, ubo[0]);
-      gl.glBindBufferBase(eGL_UNIFORM_BUFFER, 1, ubo[1]);
-      gl.glBindBufferBase(eGL_UNIFORM_BUFFER, 2, ubo[2]);
+      // restore ranged bindings exactly, so they still match any shadowed state
+      for(GLuint i = 0; i < 3; i++)
+      {
+        if(ubo[i] && uboSize[i] > 0)
+          gl.glBindBufferRange(eGL_UNIFORM_BUFFER, i, ubo[i], (GLintptr)uboOffset[i],
+                               (GLsizeiptr)uboSize[i]);
+        else
+          gl.glBindBufferBase(eGL_UNIFORM_BUFFER, i, ubo[i]);
+      }
 
       gl.glUseProgram(prog);
 
@@ -2437,6 +2466,7 @@ void WrappedOpenGL::StartFrameCapture(void *dev, void *wnd)
 
   m_Real.glBindVertexArray(prevVAO);
 
+  GetResourceManager()->FreeInitialReadbacks();
   GetResourceManager()->PrepareInitialContents();
 
   FreeCaptureData();
@@ -2521,6 +2551,8 @@ bool WrappedOpenGL::EndFrameCapture(void *dev, void *wnd)
 
     GetResourceManager()->InsertInitialContentsChunks(m_pFileSerialiser);
 
+    GetResourceManager()->FreeInitialReadbacks();
+
     RDCDEBUG("Creating Capture Scope");
 
     {
@@ -2619,6 +2651,8 @@ bool WrappedOpenGL::EndFrameCapture(void *dev, void *wnd)
 
       FreeCaptureData();
 
+      GetResourceManager()->FreeInitialReadbacks();
+
       m_FailedFrame = m_FrameCounter;
       m_FailedReason = reason;
 
@@ -2629,6 +2663,7 @@ bool WrappedOpenGL::EndFrameCapture(void *dev, void *wnd)
     else
     {
       GetResourceManager()->MarkResourceFrameReferenced(m_DeviceResourceID, eFrameRef_Write);
+      GetResourceManager()->FreeInitialReadbacks();
       GetResourceManager()->PrepareInitialContents();
 
       AttemptCapture();
@@ -2812,16 +2847,7 @@ void WrappedOpenGL::ContextEndFrame()
   m_pSerialiser->Serialise("HasCallstack", HasCallstack);
 
   if(HasCallstack)
-  {
-    Callstack::Stackwalk *call = Callstack::Collect();
-
-    uint32_t numLevels = (uint32_t)call->NumLevels();
-    uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-    m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-    delete call;
-  }
+    m_pSerialiser->SerialiseCallstack("callstack");
 
   m_ContextRecord->AddChunk(scope.Get());
 }
@@ -2969,32 +2995,7 @@ void WrappedOpenGL::Serialise_DebugMessages()
                     RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws != 0);
 
   if(HasCallstack)
-  {
-    if(m_State >= WRITING)
-    {
-      Callstack::Stackwalk *call = Callstack::Collect();
-
-      RDCASSERT(call->NumLevels() < 0xff);
-
-      uint32_t numLevels = (uint32_t)call->NumLevels();
-      uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-      m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-      delete call;
-    }
-    else
-    {
-      uint32_t numLevels = 0;
-      uint64_t *stack = NULL;
-
-      m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-      m_pSerialiser->SetCallstack(stack, numLevels);
-
-      SAFE_DELETE_ARRAY(stack);
-    }
-  }
+    m_pSerialiser->SerialiseCallstack("callstack");
 
   SERIALISE_ELEMENT(uint32_t, NumMessages, (uint32_t)debugMessages.size());
 
@@ -3112,6 +3113,8 @@ void WrappedOpenGL::DebugSnoop(GLenum source, GLenum type, GLuint id, GLenum sev
 
 void WrappedOpenGL::ReadLogInitialisation()
 {
+  RDCTRACE_SCOPE("WrappedOpenGL::ReadLogInitialisation");
+
   uint64_t frameOffset = 0;
 
   m_pSerialiser->SetDebugText(true);
@@ -3140,6 +3143,8 @@ void WrappedOpenGL::ReadLogInitialisation()
 
     GLChunkType context = (GLChunkType)m_pSerialiser->PushContext(NULL, NULL, 1, false);
 
+    RDCTRACE_SCOPE("Initialisation chunk", context);
+
     if(context == CAPTURE_SCOPE)
     {
       // immediately read rest of log into memory
@@ -3158,9 +3163,16 @@ void WrappedOpenGL::ReadLogInitialisation()
     {
       frameOffset = offset;
 
+      // record where each resource is first used, so replays only need the deferred initial
+      // contents they can reach. Anything looked up while applying the initial states or the
+      // frame's starting state counts as used from the start.
+      GetResourceManager()->BeginUseTracking();
+
       GetResourceManager()->ApplyInitialContents();
 
       ContextReplayLog(READING, 0, 0, false);
+
+      GetResourceManager()->EndUseTracking();
     }
 
     uint64_t offset2 = m_pSerialiser->GetOffset();
@@ -3611,16 +3623,7 @@ void WrappedOpenGL::ProcessChunk(uint64_t offset, GLChunkType context)
       m_pSerialiser->Serialise("HasCallstack", HasCallstack);
 
       if(HasCallstack)
-      {
-        uint32_t numLevels = 0;
-        uint64_t *stack = NULL;
-
-        m_pSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-        m_pSerialiser->SetCallstack(stack, numLevels);
-
-        SAFE_DELETE_ARRAY(stack);
-      }
+        m_pSerialiser->SerialiseCallstack("callstack");
 
       if(m_State == READING)
       {
@@ -3644,7 +3647,10 @@ void WrappedOpenGL::ProcessChunk(uint64_t offset, GLChunkType context)
     default:
       // ignore system chunks
       if((int)context == (int)INITIAL_CONTENTS)
-        GetResourceManager()->Serialise_InitialState(ResourceId(), GLResource(MakeNullResource));
+      {
+        if(!GetResourceManager()->DeferInitialState(offset))
+          GetResourceManager()->Serialise_InitialState(ResourceId(), GLResource(MakeNullResource));
+      }
       else if((int)context < (int)FIRST_CHUNK_ID)
         m_pSerialiser->SkipCurrentChunk();
       else
@@ -3728,6 +3734,9 @@ void WrappedOpenGL::ContextReplayLog(LogState readType, uint32_t startEventID, u
 
     uint64_t offset = m_pSerialiser->GetOffset();
 
+    if(m_State == READING)
+      GetResourceManager()->SetUseTrackingEvent(m_CurEventID);
+
     GLChunkType chunktype = (GLChunkType)m_pSerialiser->PushContext(NULL, NULL, 1, false);
 
     ContextProcessChunk(offset, chunktype);
@@ -4179,6 +4188,8 @@ const FetchDrawcall *WrappedOpenGL::GetDrawcall(uint32_t eventID)
 
 void WrappedOpenGL::ReplayLog(uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType)
 {
+  RDCTRACE_SCOPE("WrappedOpenGL::ReplayLog", endEventID);
+
   uint64_t offs = m_FrameRecord.frameInfo.fileOffset;
 
   m_pSerialiser->SetOffset(offs);
@@ -4201,9 +4212,14 @@ void WrappedOpenGL::ReplayLog(uint32_t startEventID, uint32_t endEventID, Replay
 
   if(!partial)
   {
+    GetResourceManager()->SetReplayEnd(endEventID);
     GetResourceManager()->ApplyInitialContents();
     GetResourceManager()->ReleaseInFrameResources();
   }
+  else
+  {
+    GetResourceManager()->ApplyLazyInitialStates(endEventID);
+  }
 
   {
     if(replayType == eReplay_Full)
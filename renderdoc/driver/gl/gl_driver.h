@@ -238,6 +238,8 @@ private:
 
   bool m_FetchCounters;
 
+  ShadowStateMode m_ShadowStateMode;
+
   // buffer used
   vector<byte> m_ScratchBuf;
 
@@ -438,6 +440,8 @@ private:
     GLuint m_ProgramPipeline;
     GLuint m_Program;
 
+    GLShadowState m_Shadow;
+
     GLResourceRecord *GetActiveTexRecord() { return m_TextureRecord[m_TextureUnit]; }
   };
 
@@ -504,6 +508,11 @@ public:
   void SetFetchCounters(bool in) { m_FetchCounters = in; };
   const GLHookSet &GetHookset() { return m_Real; }
   const GLHookSet &GetInternalHookset() { return m_Internal; }
+  ShadowStateMode GetShadowStateMode() { return m_ShadowStateMode; }
+  GLShadowState *GetShadowState()
+  {
+    return m_ShadowStateMode == eShadowState_Disabled ? NULL : &GetCtxData().m_Shadow;
+  }
   void SetDebugMsgContext(const char *context) { m_DebugMsgContext = context; }
   void AddDebugMessage(DebugMessage msg)
   {
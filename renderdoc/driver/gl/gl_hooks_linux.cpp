@@ -25,6 +25,7 @@
 
 #include <dlfcn.h>
 #include <stdio.h>
+#include <strings.h>
 #include "common/threading.h"
 #include "driver/gl/gl_common.h"
 #include "driver/gl/gl_driver.h"
@@ -53,45 +54,6 @@ typedef Bool (*PFNGLXISDIRECTPROC)(Display *dpy, GLXContext ctx);
 void *libGLdlsymHandle =
     RTLD_NEXT;    // default to RTLD_NEXT, but overwritten if app calls dlopen() on real libGL
 
-#define HookInit(function)                                                   \
-  if(!strcmp(func, STRINGIZE(function)))                                     \
-  {                                                                          \
-    OpenGLHook::glhooks.GL.function = (CONCAT(function, _hooktype))realFunc; \
-    return (__GLXextFuncPtr)&CONCAT(function, _renderdoc_hooked);            \
-  }
-
-#define HookExtension(funcPtrType, function)                      \
-  if(!strcmp(func, STRINGIZE(function)))                          \
-  {                                                               \
-    OpenGLHook::glhooks.GL.function = (funcPtrType)realFunc;      \
-    return (__GLXextFuncPtr)&CONCAT(function, _renderdoc_hooked); \
-  }
-
-#define HookExtensionAlias(funcPtrType, function, alias)          \
-  if(!strcmp(func, STRINGIZE(alias)))                             \
-  {                                                               \
-    if(OpenGLHook::glhooks.GL.function == NULL)                   \
-      OpenGLHook::glhooks.GL.function = (funcPtrType)realFunc;    \
-    return (__GLXextFuncPtr)&CONCAT(function, _renderdoc_hooked); \
-  }
-
-#if 0    // debug print for each unsupported function requested (but not used)
-#define HandleUnsupported(funcPtrType, function)                                           \
-  if(lowername == STRINGIZE(function))                                                     \
-  {                                                                                        \
-    CONCAT(unsupported_real_, function) = (CONCAT(function, _hooktype))realFunc;           \
-    RDCDEBUG("Requesting function pointer for unsupported function " STRINGIZE(function)); \
-    return (__GLXextFuncPtr)&CONCAT(function, _renderdoc_hooked);                          \
-  }
-#else
-#define HandleUnsupported(funcPtrType, function)                                 \
-  if(lowername == STRINGIZE(function))                                           \
-  {                                                                              \
-    CONCAT(unsupported_real_, function) = (CONCAT(function, _hooktype))realFunc; \
-    return (__GLXextFuncPtr)&CONCAT(function, _renderdoc_hooked);                \
-  }
-#endif
-
 /*
   in bash:
 
@@ -907,6 +869,69 @@ DefineGLExtensionHooks();
 
 DefineUnsupportedDummies();
 
+// glXGetProcAddress looks names up in these tables rather than comparing against every hooked
+// function in turn. hookset.pl generates both sorted by name.
+struct GLHookEntry
+{
+  const char *name;
+  // the function pointer that receives the real function
+  void *real;
+  __GLXextFuncPtr hooked;
+  // aliases only provide the real function if it hasn't been fetched under its own name
+  bool alias;
+  bool unsupported;
+};
+
+#define HookTableEntry(function)                                         \
+  {STRINGIZE(function), &OpenGLHook::glhooks.GL.function,                \
+   (__GLXextFuncPtr)&CONCAT(function, _renderdoc_hooked), false, false},
+
+#define HookTableAlias(function, alias)                                 \
+  {STRINGIZE(alias), &OpenGLHook::glhooks.GL.function,                  \
+   (__GLXextFuncPtr)&CONCAT(function, _renderdoc_hooked), true, false},
+
+#define UnsupportedTableEntry(function)                                 \
+  {STRINGIZE(function), &CONCAT(unsupported_real_, function),           \
+   (__GLXextFuncPtr)&CONCAT(function, _renderdoc_hooked), false, true},
+
+static const GLHookEntry glHookTable[] = {GLHookTable()};
+
+// at the moment the unsupported functions are all lowercase (as their name is generated from the
+// typedef name), so they're compared case-insensitively.
+static const GLHookEntry glUnsupportedTable[] = {GLUnsupportedTable()};
+
+static const GLHookEntry *FindHookEntry(const GLHookEntry *table, size_t count, const char *name,
+                                        bool ignoreCase)
+{
+  size_t lo = 0, hi = count;
+
+  while(lo < hi)
+  {
+    size_t mid = (lo + hi) / 2;
+    int cmp = ignoreCase ? strcasecmp(name, table[mid].name) : strcmp(name, table[mid].name);
+
+    if(cmp == 0)
+      return table + mid;
+
+    if(cmp < 0)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+
+  return NULL;
+}
+
+const GLHookEntry *FindGLHookEntry(const char *name)
+{
+  const GLHookEntry *ret = FindHookEntry(glHookTable, ARRAY_COUNT(glHookTable), name, false);
+
+  if(ret == NULL)
+    ret = FindHookEntry(glUnsupportedTable, ARRAY_COUNT(glUnsupportedTable), name, true);
+
+  return ret;
+}
+
 // everything below here needs to have C linkage
 extern "C" {
 
@@ -1193,18 +1218,25 @@ __attribute__((visibility("default"))) __GLXextFuncPtr glXGetProcAddress(const G
   if(realFunc == NULL)
     return realFunc;
 
-  DLLExportHooks();
-  HookCheckGLExtensions();
-
-  // at the moment the unsupported functions are all lowercase (as their name is generated from the
-  // typedef name).
-  string lowername = strlower(string(func));
-
-  CheckUnsupported();
+  const GLHookEntry *hook = FindGLHookEntry(func);
 
   // for any other function, if it's not a core or extension function we know about,
   // just return NULL
-  return NULL;
+  if(hook == NULL)
+    return NULL;
+
+  __GLXextFuncPtr current = NULL;
+  memcpy(&current, hook->real, sizeof(current));
+
+  if(!hook->alias || current == NULL)
+    memcpy(hook->real, &realFunc, sizeof(realFunc));
+
+#if 0    // debug print for each unsupported function requested (but not used)
+  if(hook->unsupported)
+    RDCDEBUG("Requesting function pointer for unsupported function %s", func);
+#endif
+
+  return hook->hooked;
 }
 
 __attribute__((visibility("default"))) __GLXextFuncPtr glXGetProcAddressARB(const GLubyte *f)
@@ -1248,7 +1280,6 @@ bool OpenGLHook::PopulateHooks()
 
   glXGetProcAddress_real((const GLubyte *)"glXCreateContextAttribsARB");
 
-#undef HookInit
 #define HookInit(function)                                                                   \
   if(GL.function == NULL)                                                                    \
   {                                                                                          \
@@ -1257,9 +1288,7 @@ bool OpenGLHook::PopulateHooks()
   }
 
 // cheeky
-#undef HookExtension
 #define HookExtension(funcPtrType, function) glXGetProcAddress((const GLubyte *)STRINGIZE(function))
-#undef HookExtensionAlias
 #define HookExtensionAlias(funcPtrType, function, alias)
 
   DLLExportHooks();
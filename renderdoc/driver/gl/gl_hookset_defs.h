@@ -5567,6 +5567,2875 @@
     HandleUnsupported(PFNGLINDEXUBPROC, glindexub); \
     HandleUnsupported(PFNGLINDEXUBVPROC, glindexubv); \
     HandleUnsupported(PFNGLPOPCLIENTATTRIBPROC, glpopclientattrib); \
-    HandleUnsupported(PFNGLPUSHCLIENTATTRIBPROC, glpushclientattrib);
+    HandleUnsupported(PFNGLPUSHCLIENTATTRIBPROC, glpushclientattrib); \
+
+
+
+// all hooked functions and aliases, sorted by name
+#define GLHookTable() \
+  HookTableEntry(glActiveShaderProgram) \
+  HookTableEntry(glActiveTexture) \
+  HookTableAlias(glActiveTexture, glActiveTextureARB) \
+  HookTableEntry(glAttachShader) \
+  HookTableEntry(glBeginConditionalRender) \
+  HookTableEntry(glBeginQuery) \
+  HookTableAlias(glBeginQuery, glBeginQueryARB) \
+  HookTableEntry(glBeginQueryIndexed) \
+  HookTableEntry(glBeginTransformFeedback) \
+  HookTableAlias(glBeginTransformFeedback, glBeginTransformFeedbackEXT) \
+  HookTableEntry(glBindAttribLocation) \
+  HookTableEntry(glBindBuffer) \
+  HookTableAlias(glBindBuffer, glBindBufferARB) \
+  HookTableEntry(glBindBufferBase) \
+  HookTableAlias(glBindBufferBase, glBindBufferBaseEXT) \
+  HookTableEntry(glBindBufferRange) \
+  HookTableAlias(glBindBufferRange, glBindBufferRangeEXT) \
+  HookTableEntry(glBindBuffersBase) \
+  HookTableEntry(glBindBuffersRange) \
+  HookTableEntry(glBindFragDataLocation) \
+  HookTableAlias(glBindFragDataLocation, glBindFragDataLocationEXT) \
+  HookTableEntry(glBindFragDataLocationIndexed) \
+  HookTableEntry(glBindFramebuffer) \
+  HookTableAlias(glBindFramebuffer, glBindFramebufferEXT) \
+  HookTableEntry(glBindImageTexture) \
+  HookTableAlias(glBindImageTexture, glBindImageTextureEXT) \
+  HookTableEntry(glBindImageTextures) \
+  HookTableEntry(glBindMultiTextureEXT) \
+  HookTableEntry(glBindProgramPipeline) \
+  HookTableEntry(glBindRenderbuffer) \
+  HookTableAlias(glBindRenderbuffer, glBindRenderbufferEXT) \
+  HookTableEntry(glBindSampler) \
+  HookTableEntry(glBindSamplers) \
+  HookTableEntry(glBindTexture) \
+  HookTableEntry(glBindTextureUnit) \
+  HookTableEntry(glBindTextures) \
+  HookTableEntry(glBindTransformFeedback) \
+  HookTableEntry(glBindVertexArray) \
+  HookTableEntry(glBindVertexBuffer) \
+  HookTableEntry(glBindVertexBuffers) \
+  HookTableEntry(glBlendBarrierKHR) \
+  HookTableEntry(glBlendColor) \
+  HookTableAlias(glBlendColor, glBlendColorEXT) \
+  HookTableEntry(glBlendEquation) \
+  HookTableAlias(glBlendEquation, glBlendEquationEXT) \
+  HookTableEntry(glBlendEquationSeparate) \
+  HookTableAlias(glBlendEquationSeparate, glBlendEquationSeparateARB) \
+  HookTableAlias(glBlendEquationSeparate, glBlendEquationSeparateEXT) \
+  HookTableEntry(glBlendEquationSeparatei) \
+  HookTableAlias(glBlendEquationSeparatei, glBlendEquationSeparateiARB) \
+  HookTableEntry(glBlendEquationi) \
+  HookTableAlias(glBlendEquationi, glBlendEquationiARB) \
+  HookTableEntry(glBlendFunc) \
+  HookTableEntry(glBlendFuncSeparate) \
+  HookTableAlias(glBlendFuncSeparate, glBlendFuncSeparateARB) \
+  HookTableEntry(glBlendFuncSeparatei) \
+  HookTableAlias(glBlendFuncSeparatei, glBlendFuncSeparateiARB) \
+  HookTableEntry(glBlendFunci) \
+  HookTableAlias(glBlendFunci, glBlendFunciARB) \
+  HookTableEntry(glBlitFramebuffer) \
+  HookTableAlias(glBlitFramebuffer, glBlitFramebufferEXT) \
+  HookTableEntry(glBlitNamedFramebuffer) \
+  HookTableEntry(glBufferData) \
+  HookTableAlias(glBufferData, glBufferDataARB) \
+  HookTableEntry(glBufferStorage) \
+  HookTableEntry(glBufferSubData) \
+  HookTableAlias(glBufferSubData, glBufferSubDataARB) \
+  HookTableEntry(glCheckFramebufferStatus) \
+  HookTableAlias(glCheckFramebufferStatus, glCheckFramebufferStatusEXT) \
+  HookTableAlias(glCheckNamedFramebufferStatusEXT, glCheckNamedFramebufferStatus) \
+  HookTableEntry(glCheckNamedFramebufferStatusEXT) \
+  HookTableEntry(glClampColor) \
+  HookTableAlias(glClampColor, glClampColorARB) \
+  HookTableEntry(glClear) \
+  HookTableEntry(glClearBufferData) \
+  HookTableEntry(glClearBufferSubData) \
+  HookTableEntry(glClearBufferfi) \
+  HookTableEntry(glClearBufferfv) \
+  HookTableEntry(glClearBufferiv) \
+  HookTableEntry(glClearBufferuiv) \
+  HookTableEntry(glClearColor) \
+  HookTableEntry(glClearDepth) \
+  HookTableEntry(glClearDepthf) \
+  HookTableAlias(glClearNamedBufferDataEXT, glClearNamedBufferData) \
+  HookTableEntry(glClearNamedBufferDataEXT) \
+  HookTableEntry(glClearNamedBufferSubData) \
+  HookTableEntry(glClearNamedBufferSubDataEXT) \
+  HookTableEntry(glClearNamedFramebufferfi) \
+  HookTableEntry(glClearNamedFramebufferfv) \
+  HookTableEntry(glClearNamedFramebufferiv) \
+  HookTableEntry(glClearNamedFramebufferuiv) \
+  HookTableEntry(glClearStencil) \
+  HookTableEntry(glClearTexImage) \
+  HookTableEntry(glClearTexSubImage) \
+  HookTableEntry(glClientWaitSync) \
+  HookTableEntry(glClipControl) \
+  HookTableEntry(glColorMask) \
+  HookTableAlias(glColorMaski, glColorMaskIndexedEXT) \
+  HookTableEntry(glColorMaski) \
+  HookTableEntry(glCompileShader) \
+  HookTableEntry(glCompileShaderIncludeARB) \
+  HookTableEntry(glCompressedMultiTexImage1DEXT) \
+  HookTableEntry(glCompressedMultiTexImage2DEXT) \
+  HookTableEntry(glCompressedMultiTexImage3DEXT) \
+  HookTableEntry(glCompressedMultiTexSubImage1DEXT) \
+  HookTableEntry(glCompressedMultiTexSubImage2DEXT) \
+  HookTableEntry(glCompressedMultiTexSubImage3DEXT) \
+  HookTableEntry(glCompressedTexImage1D) \
+  HookTableAlias(glCompressedTexImage1D, glCompressedTexImage1DARB) \
+  HookTableEntry(glCompressedTexImage2D) \
+  HookTableAlias(glCompressedTexImage2D, glCompressedTexImage2DARB) \
+  HookTableEntry(glCompressedTexImage3D) \
+  HookTableAlias(glCompressedTexImage3D, glCompressedTexImage3DARB) \
+  HookTableEntry(glCompressedTexSubImage1D) \
+  HookTableAlias(glCompressedTexSubImage1D, glCompressedTexSubImage1DARB) \
+  HookTableEntry(glCompressedTexSubImage2D) \
+  HookTableAlias(glCompressedTexSubImage2D, glCompressedTexSubImage2DARB) \
+  HookTableEntry(glCompressedTexSubImage3D) \
+  HookTableAlias(glCompressedTexSubImage3D, glCompressedTexSubImage3DARB) \
+  HookTableEntry(glCompressedTextureImage1DEXT) \
+  HookTableEntry(glCompressedTextureImage2DEXT) \
+  HookTableEntry(glCompressedTextureImage3DEXT) \
+  HookTableEntry(glCompressedTextureSubImage1D) \
+  HookTableEntry(glCompressedTextureSubImage1DEXT) \
+  HookTableEntry(glCompressedTextureSubImage2D) \
+  HookTableEntry(glCompressedTextureSubImage2DEXT) \
+  HookTableEntry(glCompressedTextureSubImage3D) \
+  HookTableEntry(glCompressedTextureSubImage3DEXT) \
+  HookTableEntry(glCopyBufferSubData) \
+  HookTableEntry(glCopyImageSubData) \
+  HookTableEntry(glCopyMultiTexImage1DEXT) \
+  HookTableEntry(glCopyMultiTexImage2DEXT) \
+  HookTableEntry(glCopyMultiTexSubImage1DEXT) \
+  HookTableEntry(glCopyMultiTexSubImage2DEXT) \
+  HookTableEntry(glCopyMultiTexSubImage3DEXT) \
+  HookTableEntry(glCopyNamedBufferSubData) \
+  HookTableEntry(glCopyTexImage1D) \
+  HookTableEntry(glCopyTexImage2D) \
+  HookTableEntry(glCopyTexSubImage1D) \
+  HookTableEntry(glCopyTexSubImage2D) \
+  HookTableEntry(glCopyTexSubImage3D) \
+  HookTableEntry(glCopyTextureImage1DEXT) \
+  HookTableEntry(glCopyTextureImage2DEXT) \
+  HookTableEntry(glCopyTextureSubImage1D) \
+  HookTableEntry(glCopyTextureSubImage1DEXT) \
+  HookTableEntry(glCopyTextureSubImage2D) \
+  HookTableEntry(glCopyTextureSubImage2DEXT) \
+  HookTableEntry(glCopyTextureSubImage3D) \
+  HookTableEntry(glCopyTextureSubImage3DEXT) \
+  HookTableEntry(glCreateBuffers) \
+  HookTableEntry(glCreateFramebuffers) \
+  HookTableEntry(glCreateProgram) \
+  HookTableEntry(glCreateProgramPipelines) \
+  HookTableEntry(glCreateQueries) \
+  HookTableEntry(glCreateRenderbuffers) \
+  HookTableEntry(glCreateSamplers) \
+  HookTableEntry(glCreateShader) \
+  HookTableEntry(glCreateShaderProgramv) \
+  HookTableEntry(glCreateTextures) \
+  HookTableEntry(glCreateTransformFeedbacks) \
+  HookTableEntry(glCreateVertexArrays) \
+  HookTableEntry(glCullFace) \
+  HookTableEntry(glDebugMessageCallback) \
+  HookTableAlias(glDebugMessageCallback, glDebugMessageCallbackARB) \
+  HookTableEntry(glDebugMessageControl) \
+  HookTableAlias(glDebugMessageControl, glDebugMessageControlARB) \
+  HookTableEntry(glDebugMessageInsert) \
+  HookTableAlias(glDebugMessageInsert, glDebugMessageInsertARB) \
+  HookTableEntry(glDeleteBuffers) \
+  HookTableAlias(glDeleteBuffers, glDeleteBuffersARB) \
+  HookTableEntry(glDeleteFramebuffers) \
+  HookTableAlias(glDeleteFramebuffers, glDeleteFramebuffersEXT) \
+  HookTableEntry(glDeleteNamedStringARB) \
+  HookTableEntry(glDeleteProgram) \
+  HookTableEntry(glDeleteProgramPipelines) \
+  HookTableEntry(glDeleteQueries) \
+  HookTableAlias(glDeleteQueries, glDeleteQueriesARB) \
+  HookTableEntry(glDeleteRenderbuffers) \
+  HookTableAlias(glDeleteRenderbuffers, glDeleteRenderbuffersEXT) \
+  HookTableEntry(glDeleteSamplers) \
+  HookTableEntry(glDeleteShader) \
+  HookTableEntry(glDeleteSync) \
+  HookTableEntry(glDeleteTextures) \
+  HookTableEntry(glDeleteTransformFeedbacks) \
+  HookTableEntry(glDeleteVertexArrays) \
+  HookTableEntry(glDepthBoundsEXT) \
+  HookTableEntry(glDepthFunc) \
+  HookTableEntry(glDepthMask) \
+  HookTableEntry(glDepthRange) \
+  HookTableEntry(glDepthRangeArrayv) \
+  HookTableEntry(glDepthRangeIndexed) \
+  HookTableEntry(glDepthRangef) \
+  HookTableEntry(glDetachShader) \
+  HookTableEntry(glDisable) \
+  HookTableAlias(glDisablei, glDisableIndexedEXT) \
+  HookTableAlias(glDisableVertexArrayAttribEXT, glDisableVertexArrayAttrib) \
+  HookTableEntry(glDisableVertexArrayAttribEXT) \
+  HookTableEntry(glDisableVertexAttribArray) \
+  HookTableAlias(glDisableVertexAttribArray, glDisableVertexAttribArrayARB) \
+  HookTableEntry(glDisablei) \
+  HookTableEntry(glDispatchCompute) \
+  HookTableEntry(glDispatchComputeGroupSizeARB) \
+  HookTableEntry(glDispatchComputeIndirect) \
+  HookTableEntry(glDrawArrays) \
+  HookTableEntry(glDrawArraysIndirect) \
+  HookTableEntry(glDrawArraysInstanced) \
+  HookTableAlias(glDrawArraysInstanced, glDrawArraysInstancedARB) \
+  HookTableEntry(glDrawArraysInstancedBaseInstance) \
+  HookTableAlias(glDrawArraysInstanced, glDrawArraysInstancedEXT) \
+  HookTableEntry(glDrawBuffer) \
+  HookTableEntry(glDrawBuffers) \
+  HookTableAlias(glDrawBuffers, glDrawBuffersARB) \
+  HookTableEntry(glDrawElements) \
+  HookTableEntry(glDrawElementsBaseVertex) \
+  HookTableEntry(glDrawElementsIndirect) \
+  HookTableEntry(glDrawElementsInstanced) \
+  HookTableAlias(glDrawElementsInstanced, glDrawElementsInstancedARB) \
+  HookTableEntry(glDrawElementsInstancedBaseInstance) \
+  HookTableEntry(glDrawElementsInstancedBaseVertex) \
+  HookTableEntry(glDrawElementsInstancedBaseVertexBaseInstance) \
+  HookTableAlias(glDrawElementsInstanced, glDrawElementsInstancedEXT) \
+  HookTableEntry(glDrawRangeElements) \
+  HookTableEntry(glDrawRangeElementsBaseVertex) \
+  HookTableAlias(glDrawRangeElements, glDrawRangeElementsEXT) \
+  HookTableEntry(glDrawTransformFeedback) \
+  HookTableEntry(glDrawTransformFeedbackInstanced) \
+  HookTableEntry(glDrawTransformFeedbackStream) \
+  HookTableEntry(glDrawTransformFeedbackStreamInstanced) \
+  HookTableEntry(glEnable) \
+  HookTableAlias(glEnablei, glEnableIndexedEXT) \
+  HookTableAlias(glEnableVertexArrayAttribEXT, glEnableVertexArrayAttrib) \
+  HookTableEntry(glEnableVertexArrayAttribEXT) \
+  HookTableEntry(glEnableVertexAttribArray) \
+  HookTableAlias(glEnableVertexAttribArray, glEnableVertexAttribArrayARB) \
+  HookTableEntry(glEnablei) \
+  HookTableEntry(glEndConditionalRender) \
+  HookTableEntry(glEndQuery) \
+  HookTableAlias(glEndQuery, glEndQueryARB) \
+  HookTableEntry(glEndQueryIndexed) \
+  HookTableEntry(glEndTransformFeedback) \
+  HookTableAlias(glEndTransformFeedback, glEndTransformFeedbackEXT) \
+  HookTableEntry(glFenceSync) \
+  HookTableEntry(glFinish) \
+  HookTableEntry(glFlush) \
+  HookTableEntry(glFlushMappedBufferRange) \
+  HookTableEntry(glFlushMappedNamedBufferRange) \
+  HookTableEntry(glFlushMappedNamedBufferRangeEXT) \
+  HookTableEntry(glFrameTerminatorGREMEDY) \
+  HookTableEntry(glFramebufferDrawBufferEXT) \
+  HookTableEntry(glFramebufferDrawBuffersEXT) \
+  HookTableEntry(glFramebufferParameteri) \
+  HookTableEntry(glFramebufferReadBufferEXT) \
+  HookTableEntry(glFramebufferRenderbuffer) \
+  HookTableAlias(glFramebufferRenderbuffer, glFramebufferRenderbufferEXT) \
+  HookTableEntry(glFramebufferTexture) \
+  HookTableEntry(glFramebufferTexture1D) \
+  HookTableAlias(glFramebufferTexture1D, glFramebufferTexture1DEXT) \
+  HookTableEntry(glFramebufferTexture2D) \
+  HookTableAlias(glFramebufferTexture2D, glFramebufferTexture2DEXT) \
+  HookTableEntry(glFramebufferTexture3D) \
+  HookTableAlias(glFramebufferTexture3D, glFramebufferTexture3DEXT) \
+  HookTableAlias(glFramebufferTexture, glFramebufferTextureARB) \
+  HookTableEntry(glFramebufferTextureLayer) \
+  HookTableAlias(glFramebufferTextureLayer, glFramebufferTextureLayerARB) \
+  HookTableAlias(glFramebufferTextureLayer, glFramebufferTextureLayerEXT) \
+  HookTableEntry(glFrontFace) \
+  HookTableEntry(glGenBuffers) \
+  HookTableAlias(glGenBuffers, glGenBuffersARB) \
+  HookTableEntry(glGenFramebuffers) \
+  HookTableAlias(glGenFramebuffers, glGenFramebuffersEXT) \
+  HookTableEntry(glGenProgramPipelines) \
+  HookTableEntry(glGenQueries) \
+  HookTableAlias(glGenQueries, glGenQueriesARB) \
+  HookTableEntry(glGenRenderbuffers) \
+  HookTableAlias(glGenRenderbuffers, glGenRenderbuffersEXT) \
+  HookTableEntry(glGenSamplers) \
+  HookTableEntry(glGenTextures) \
+  HookTableEntry(glGenTransformFeedbacks) \
+  HookTableEntry(glGenVertexArrays) \
+  HookTableEntry(glGenerateMipmap) \
+  HookTableAlias(glGenerateMipmap, glGenerateMipmapEXT) \
+  HookTableEntry(glGenerateMultiTexMipmapEXT) \
+  HookTableEntry(glGenerateTextureMipmap) \
+  HookTableEntry(glGenerateTextureMipmapEXT) \
+  HookTableEntry(glGetActiveAtomicCounterBufferiv) \
+  HookTableEntry(glGetActiveAttrib) \
+  HookTableEntry(glGetActiveSubroutineName) \
+  HookTableEntry(glGetActiveSubroutineUniformName) \
+  HookTableEntry(glGetActiveSubroutineUniformiv) \
+  HookTableEntry(glGetActiveUniform) \
+  HookTableEntry(glGetActiveUniformBlockName) \
+  HookTableEntry(glGetActiveUniformBlockiv) \
+  HookTableEntry(glGetActiveUniformName) \
+  HookTableEntry(glGetActiveUniformsiv) \
+  HookTableEntry(glGetAttachedShaders) \
+  HookTableEntry(glGetAttribLocation) \
+  HookTableEntry(glGetBooleanIndexedvEXT) \
+  HookTableEntry(glGetBooleani_v) \
+  HookTableEntry(glGetBooleanv) \
+  HookTableEntry(glGetBufferParameteri64v) \
+  HookTableEntry(glGetBufferParameteriv) \
+  HookTableAlias(glGetBufferParameteriv, glGetBufferParameterivARB) \
+  HookTableEntry(glGetBufferPointerv) \
+  HookTableAlias(glGetBufferPointerv, glGetBufferPointervARB) \
+  HookTableEntry(glGetBufferSubData) \
+  HookTableAlias(glGetBufferSubData, glGetBufferSubDataARB) \
+  HookTableEntry(glGetCompressedMultiTexImageEXT) \
+  HookTableEntry(glGetCompressedTexImage) \
+  HookTableAlias(glGetCompressedTexImage, glGetCompressedTexImageARB) \
+  HookTableEntry(glGetCompressedTextureImage) \
+  HookTableEntry(glGetCompressedTextureImageEXT) \
+  HookTableEntry(glGetCompressedTextureSubImage) \
+  HookTableEntry(glGetDebugMessageLog) \
+  HookTableAlias(glGetDebugMessageLog, glGetDebugMessageLogARB) \
+  HookTableEntry(glGetDoubleIndexedvEXT) \
+  HookTableEntry(glGetDoublei_v) \
+  HookTableAlias(glGetDoublei_v, glGetDoublei_vEXT) \
+  HookTableEntry(glGetDoublev) \
+  HookTableEntry(glGetError) \
+  HookTableEntry(glGetFloatIndexedvEXT) \
+  HookTableEntry(glGetFloati_v) \
+  HookTableAlias(glGetFloati_v, glGetFloati_vEXT) \
+  HookTableEntry(glGetFloatv) \
+  HookTableEntry(glGetFragDataIndex) \
+  HookTableEntry(glGetFragDataLocation) \
+  HookTableAlias(glGetFragDataLocation, glGetFragDataLocationEXT) \
+  HookTableEntry(glGetFramebufferAttachmentParameteriv) \
+  HookTableAlias(glGetFramebufferAttachmentParameteriv, glGetFramebufferAttachmentParameterivEXT) \
+  HookTableEntry(glGetFramebufferParameteriv) \
+  HookTableAlias(glGetNamedFramebufferParameterivEXT, glGetFramebufferParameterivEXT) \
+  HookTableEntry(glGetGraphicsResetStatus) \
+  HookTableAlias(glGetGraphicsResetStatus, glGetGraphicsResetStatusARB) \
+  HookTableEntry(glGetInteger64i_v) \
+  HookTableEntry(glGetInteger64v) \
+  HookTableEntry(glGetIntegerIndexedvEXT) \
+  HookTableEntry(glGetIntegeri_v) \
+  HookTableEntry(glGetIntegerv) \
+  HookTableEntry(glGetInternalformati64v) \
+  HookTableEntry(glGetInternalformativ) \
+  HookTableEntry(glGetMultiTexImageEXT) \
+  HookTableEntry(glGetMultiTexLevelParameterfvEXT) \
+  HookTableEntry(glGetMultiTexLevelParameterivEXT) \
+  HookTableEntry(glGetMultiTexParameterIivEXT) \
+  HookTableEntry(glGetMultiTexParameterIuivEXT) \
+  HookTableEntry(glGetMultiTexParameterfvEXT) \
+  HookTableEntry(glGetMultiTexParameterivEXT) \
+  HookTableEntry(glGetMultisamplefv) \
+  HookTableEntry(glGetNamedBufferParameteri64v) \
+  HookTableAlias(glGetNamedBufferParameterivEXT, glGetNamedBufferParameteriv) \
+  HookTableEntry(glGetNamedBufferParameterivEXT) \
+  HookTableAlias(glGetNamedBufferPointervEXT, glGetNamedBufferPointerv) \
+  HookTableEntry(glGetNamedBufferPointervEXT) \
+  HookTableEntry(glGetNamedBufferSubData) \
+  HookTableEntry(glGetNamedBufferSubDataEXT) \
+  HookTableAlias(glGetNamedFramebufferAttachmentParameterivEXT, glGetNamedFramebufferAttachmentParameteriv) \
+  HookTableEntry(glGetNamedFramebufferAttachmentParameterivEXT) \
+  HookTableAlias(glGetNamedFramebufferParameterivEXT, glGetNamedFramebufferParameteriv) \
+  HookTableEntry(glGetNamedFramebufferParameterivEXT) \
+  HookTableEntry(glGetNamedProgramivEXT) \
+  HookTableAlias(glGetNamedRenderbufferParameterivEXT, glGetNamedRenderbufferParameteriv) \
+  HookTableEntry(glGetNamedRenderbufferParameterivEXT) \
+  HookTableEntry(glGetNamedStringARB) \
+  HookTableEntry(glGetNamedStringivARB) \
+  HookTableEntry(glGetObjectLabel) \
+  HookTableEntry(glGetObjectLabelEXT) \
+  HookTableEntry(glGetObjectPtrLabel) \
+  HookTableEntry(glGetPointerIndexedvEXT) \
+  HookTableEntry(glGetPointeri_vEXT) \
+  HookTableEntry(glGetPointerv) \
+  HookTableEntry(glGetProgramBinary) \
+  HookTableEntry(glGetProgramInfoLog) \
+  HookTableEntry(glGetProgramInterfaceiv) \
+  HookTableEntry(glGetProgramPipelineInfoLog) \
+  HookTableEntry(glGetProgramPipelineiv) \
+  HookTableEntry(glGetProgramResourceIndex) \
+  HookTableEntry(glGetProgramResourceLocation) \
+  HookTableEntry(glGetProgramResourceLocationIndex) \
+  HookTableEntry(glGetProgramResourceName) \
+  HookTableEntry(glGetProgramResourceiv) \
+  HookTableEntry(glGetProgramStageiv) \
+  HookTableEntry(glGetProgramiv) \
+  HookTableEntry(glGetQueryBufferObjecti64v) \
+  HookTableEntry(glGetQueryBufferObjectiv) \
+  HookTableEntry(glGetQueryBufferObjectui64v) \
+  HookTableEntry(glGetQueryBufferObjectuiv) \
+  HookTableEntry(glGetQueryIndexediv) \
+  HookTableEntry(glGetQueryObjecti64v) \
+  HookTableAlias(glGetQueryObjecti64v, glGetQueryObjecti64vEXT) \
+  HookTableEntry(glGetQueryObjectiv) \
+  HookTableAlias(glGetQueryObjectiv, glGetQueryObjectivARB) \
+  HookTableEntry(glGetQueryObjectui64v) \
+  HookTableAlias(glGetQueryObjectui64v, glGetQueryObjectui64vEXT) \
+  HookTableEntry(glGetQueryObjectuiv) \
+  HookTableAlias(glGetQueryObjectuiv, glGetQueryObjectuivARB) \
+  HookTableEntry(glGetQueryiv) \
+  HookTableAlias(glGetQueryiv, glGetQueryivARB) \
+  HookTableEntry(glGetRenderbufferParameteriv) \
+  HookTableAlias(glGetRenderbufferParameteriv, glGetRenderbufferParameterivEXT) \
+  HookTableEntry(glGetSamplerParameterIiv) \
+  HookTableEntry(glGetSamplerParameterIuiv) \
+  HookTableEntry(glGetSamplerParameterfv) \
+  HookTableEntry(glGetSamplerParameteriv) \
+  HookTableEntry(glGetShaderInfoLog) \
+  HookTableEntry(glGetShaderPrecisionFormat) \
+  HookTableEntry(glGetShaderSource) \
+  HookTableEntry(glGetShaderiv) \
+  HookTableEntry(glGetString) \
+  HookTableEntry(glGetStringi) \
+  HookTableEntry(glGetSubroutineIndex) \
+  HookTableEntry(glGetSubroutineUniformLocation) \
+  HookTableEntry(glGetSynciv) \
+  HookTableEntry(glGetTexImage) \
+  HookTableEntry(glGetTexLevelParameterfv) \
+  HookTableEntry(glGetTexLevelParameteriv) \
+  HookTableEntry(glGetTexParameterIiv) \
+  HookTableAlias(glGetTexParameterIiv, glGetTexParameterIivEXT) \
+  HookTableEntry(glGetTexParameterIuiv) \
+  HookTableAlias(glGetTexParameterIuiv, glGetTexParameterIuivEXT) \
+  HookTableEntry(glGetTexParameterfv) \
+  HookTableEntry(glGetTexParameteriv) \
+  HookTableEntry(glGetTextureImage) \
+  HookTableEntry(glGetTextureImageEXT) \
+  HookTableEntry(glGetTextureLevelParameterfv) \
+  HookTableEntry(glGetTextureLevelParameterfvEXT) \
+  HookTableEntry(glGetTextureLevelParameteriv) \
+  HookTableEntry(glGetTextureLevelParameterivEXT) \
+  HookTableEntry(glGetTextureParameterIiv) \
+  HookTableEntry(glGetTextureParameterIivEXT) \
+  HookTableEntry(glGetTextureParameterIuiv) \
+  HookTableEntry(glGetTextureParameterIuivEXT) \
+  HookTableEntry(glGetTextureParameterfv) \
+  HookTableEntry(glGetTextureParameterfvEXT) \
+  HookTableEntry(glGetTextureParameteriv) \
+  HookTableEntry(glGetTextureParameterivEXT) \
+  HookTableEntry(glGetTextureSubImage) \
+  HookTableEntry(glGetTransformFeedbackVarying) \
+  HookTableAlias(glGetTransformFeedbackVarying, glGetTransformFeedbackVaryingEXT) \
+  HookTableEntry(glGetTransformFeedbacki64_v) \
+  HookTableEntry(glGetTransformFeedbacki_v) \
+  HookTableEntry(glGetTransformFeedbackiv) \
+  HookTableEntry(glGetUniformBlockIndex) \
+  HookTableEntry(glGetUniformIndices) \
+  HookTableEntry(glGetUniformLocation) \
+  HookTableEntry(glGetUniformSubroutineuiv) \
+  HookTableEntry(glGetUniformdv) \
+  HookTableEntry(glGetUniformfv) \
+  HookTableEntry(glGetUniformiv) \
+  HookTableEntry(glGetUniformuiv) \
+  HookTableAlias(glGetUniformuiv, glGetUniformuivEXT) \
+  HookTableEntry(glGetVertexArrayIndexed64iv) \
+  HookTableEntry(glGetVertexArrayIndexediv) \
+  HookTableEntry(glGetVertexArrayIntegeri_vEXT) \
+  HookTableEntry(glGetVertexArrayIntegervEXT) \
+  HookTableEntry(glGetVertexArrayPointeri_vEXT) \
+  HookTableEntry(glGetVertexArrayPointervEXT) \
+  HookTableEntry(glGetVertexArrayiv) \
+  HookTableEntry(glGetVertexAttribIiv) \
+  HookTableAlias(glGetVertexAttribIiv, glGetVertexAttribIivEXT) \
+  HookTableEntry(glGetVertexAttribIuiv) \
+  HookTableAlias(glGetVertexAttribIuiv, glGetVertexAttribIuivEXT) \
+  HookTableEntry(glGetVertexAttribLdv) \
+  HookTableAlias(glGetVertexAttribLdv, glGetVertexAttribLdvEXT) \
+  HookTableEntry(glGetVertexAttribPointerv) \
+  HookTableEntry(glGetVertexAttribdv) \
+  HookTableEntry(glGetVertexAttribfv) \
+  HookTableEntry(glGetVertexAttribiv) \
+  HookTableEntry(glGetnCompressedTexImage) \
+  HookTableAlias(glGetnCompressedTexImage, glGetnCompressedTexImageARB) \
+  HookTableEntry(glGetnTexImage) \
+  HookTableAlias(glGetnTexImage, glGetnTexImageARB) \
+  HookTableEntry(glGetnUniformdv) \
+  HookTableAlias(glGetnUniformdv, glGetnUniformdvARB) \
+  HookTableEntry(glGetnUniformfv) \
+  HookTableAlias(glGetnUniformfv, glGetnUniformfvARB) \
+  HookTableEntry(glGetnUniformiv) \
+  HookTableAlias(glGetnUniformiv, glGetnUniformivARB) \
+  HookTableEntry(glGetnUniformuiv) \
+  HookTableAlias(glGetnUniformuiv, glGetnUniformuivARB) \
+  HookTableEntry(glHint) \
+  HookTableEntry(glInsertEventMarkerEXT) \
+  HookTableEntry(glInvalidateBufferData) \
+  HookTableEntry(glInvalidateBufferSubData) \
+  HookTableEntry(glInvalidateFramebuffer) \
+  HookTableEntry(glInvalidateNamedFramebufferData) \
+  HookTableEntry(glInvalidateNamedFramebufferSubData) \
+  HookTableEntry(glInvalidateSubFramebuffer) \
+  HookTableEntry(glInvalidateTexImage) \
+  HookTableEntry(glInvalidateTexSubImage) \
+  HookTableEntry(glIsBuffer) \
+  HookTableAlias(glIsBuffer, glIsBufferARB) \
+  HookTableEntry(glIsEnabled) \
+  HookTableAlias(glIsEnabledi, glIsEnabledIndexedEXT) \
+  HookTableEntry(glIsEnabledi) \
+  HookTableEntry(glIsFramebuffer) \
+  HookTableAlias(glIsFramebuffer, glIsFramebufferEXT) \
+  HookTableEntry(glIsNamedStringARB) \
+  HookTableEntry(glIsProgram) \
+  HookTableEntry(glIsProgramPipeline) \
+  HookTableEntry(glIsQuery) \
+  HookTableAlias(glIsQuery, glIsQueryARB) \
+  HookTableEntry(glIsRenderbuffer) \
+  HookTableAlias(glIsRenderbuffer, glIsRenderbufferEXT) \
+  HookTableEntry(glIsSampler) \
+  HookTableEntry(glIsShader) \
+  HookTableEntry(glIsSync) \
+  HookTableEntry(glIsTexture) \
+  HookTableEntry(glIsTransformFeedback) \
+  HookTableEntry(glIsVertexArray) \
+  HookTableEntry(glLabelObjectEXT) \
+  HookTableEntry(glLineWidth) \
+  HookTableEntry(glLinkProgram) \
+  HookTableEntry(glLogicOp) \
+  HookTableEntry(glMapBuffer) \
+  HookTableAlias(glMapBuffer, glMapBufferARB) \
+  HookTableEntry(glMapBufferRange) \
+  HookTableAlias(glMapNamedBufferEXT, glMapNamedBuffer) \
+  HookTableEntry(glMapNamedBufferEXT) \
+  HookTableEntry(glMapNamedBufferRange) \
+  HookTableEntry(glMapNamedBufferRangeEXT) \
+  HookTableEntry(glMemoryBarrier) \
+  HookTableEntry(glMemoryBarrierByRegion) \
+  HookTableAlias(glMemoryBarrier, glMemoryBarrierEXT) \
+  HookTableEntry(glMinSampleShading) \
+  HookTableAlias(glMinSampleShading, glMinSampleShadingARB) \
+  HookTableEntry(glMultiDrawArrays) \
+  HookTableAlias(glMultiDrawArrays, glMultiDrawArraysEXT) \
+  HookTableEntry(glMultiDrawArraysIndirect) \
+  HookTableEntry(glMultiDrawArraysIndirectCountARB) \
+  HookTableEntry(glMultiDrawElements) \
+  HookTableEntry(glMultiDrawElementsBaseVertex) \
+  HookTableEntry(glMultiDrawElementsIndirect) \
+  HookTableEntry(glMultiDrawElementsIndirectCountARB) \
+  HookTableEntry(glMultiTexBufferEXT) \
+  HookTableEntry(glMultiTexImage1DEXT) \
+  HookTableEntry(glMultiTexImage2DEXT) \
+  HookTableEntry(glMultiTexImage3DEXT) \
+  HookTableEntry(glMultiTexParameterIivEXT) \
+  HookTableEntry(glMultiTexParameterIuivEXT) \
+  HookTableEntry(glMultiTexParameterfEXT) \
+  HookTableEntry(glMultiTexParameterfvEXT) \
+  HookTableEntry(glMultiTexParameteriEXT) \
+  HookTableEntry(glMultiTexParameterivEXT) \
+  HookTableEntry(glMultiTexSubImage1DEXT) \
+  HookTableEntry(glMultiTexSubImage2DEXT) \
+  HookTableEntry(glMultiTexSubImage3DEXT) \
+  HookTableEntry(glNamedBufferData) \
+  HookTableEntry(glNamedBufferDataEXT) \
+  HookTableEntry(glNamedBufferStorage) \
+  HookTableEntry(glNamedBufferStorageEXT) \
+  HookTableEntry(glNamedBufferSubData) \
+  HookTableEntry(glNamedBufferSubDataEXT) \
+  HookTableEntry(glNamedCopyBufferSubDataEXT) \
+  HookTableAlias(glFramebufferDrawBufferEXT, glNamedFramebufferDrawBuffer) \
+  HookTableAlias(glFramebufferDrawBuffersEXT, glNamedFramebufferDrawBuffers) \
+  HookTableAlias(glNamedFramebufferParameteriEXT, glNamedFramebufferParameteri) \
+  HookTableEntry(glNamedFramebufferParameteriEXT) \
+  HookTableAlias(glFramebufferReadBufferEXT, glNamedFramebufferReadBuffer) \
+  HookTableAlias(glNamedFramebufferRenderbufferEXT, glNamedFramebufferRenderbuffer) \
+  HookTableEntry(glNamedFramebufferRenderbufferEXT) \
+  HookTableAlias(glNamedFramebufferTextureEXT, glNamedFramebufferTexture) \
+  HookTableEntry(glNamedFramebufferTexture1DEXT) \
+  HookTableEntry(glNamedFramebufferTexture2DEXT) \
+  HookTableEntry(glNamedFramebufferTexture3DEXT) \
+  HookTableEntry(glNamedFramebufferTextureEXT) \
+  HookTableAlias(glNamedFramebufferTextureLayerEXT, glNamedFramebufferTextureLayer) \
+  HookTableEntry(glNamedFramebufferTextureLayerEXT) \
+  HookTableAlias(glNamedRenderbufferStorageEXT, glNamedRenderbufferStorage) \
+  HookTableEntry(glNamedRenderbufferStorageEXT) \
+  HookTableAlias(glNamedRenderbufferStorageMultisampleEXT, glNamedRenderbufferStorageMultisample) \
+  HookTableEntry(glNamedRenderbufferStorageMultisampleEXT) \
+  HookTableEntry(glNamedStringARB) \
+  HookTableEntry(glObjectLabel) \
+  HookTableEntry(glObjectPtrLabel) \
+  HookTableEntry(glPatchParameterfv) \
+  HookTableEntry(glPatchParameteri) \
+  HookTableEntry(glPauseTransformFeedback) \
+  HookTableEntry(glPixelStoref) \
+  HookTableEntry(glPixelStorei) \
+  HookTableEntry(glPointParameterf) \
+  HookTableAlias(glPointParameterf, glPointParameterfARB) \
+  HookTableAlias(glPointParameterf, glPointParameterfEXT) \
+  HookTableEntry(glPointParameterfv) \
+  HookTableAlias(glPointParameterfv, glPointParameterfvARB) \
+  HookTableAlias(glPointParameterfv, glPointParameterfvEXT) \
+  HookTableEntry(glPointParameteri) \
+  HookTableEntry(glPointParameteriv) \
+  HookTableEntry(glPointSize) \
+  HookTableEntry(glPolygonMode) \
+  HookTableEntry(glPolygonOffset) \
+  HookTableEntry(glPolygonOffsetClampEXT) \
+  HookTableEntry(glPopDebugGroup) \
+  HookTableEntry(glPopGroupMarkerEXT) \
+  HookTableEntry(glPrimitiveRestartIndex) \
+  HookTableEntry(glProgramBinary) \
+  HookTableEntry(glProgramParameteri) \
+  HookTableAlias(glProgramParameteri, glProgramParameteriARB) \
+  HookTableEntry(glProgramUniform1d) \
+  HookTableAlias(glProgramUniform1d, glProgramUniform1dEXT) \
+  HookTableEntry(glProgramUniform1dv) \
+  HookTableAlias(glProgramUniform1dv, glProgramUniform1dvEXT) \
+  HookTableEntry(glProgramUniform1f) \
+  HookTableAlias(glProgramUniform1f, glProgramUniform1fEXT) \
+  HookTableEntry(glProgramUniform1fv) \
+  HookTableAlias(glProgramUniform1fv, glProgramUniform1fvEXT) \
+  HookTableEntry(glProgramUniform1i) \
+  HookTableAlias(glProgramUniform1i, glProgramUniform1iEXT) \
+  HookTableEntry(glProgramUniform1iv) \
+  HookTableAlias(glProgramUniform1iv, glProgramUniform1ivEXT) \
+  HookTableEntry(glProgramUniform1ui) \
+  HookTableAlias(glProgramUniform1ui, glProgramUniform1uiEXT) \
+  HookTableEntry(glProgramUniform1uiv) \
+  HookTableAlias(glProgramUniform1uiv, glProgramUniform1uivEXT) \
+  HookTableEntry(glProgramUniform2d) \
+  HookTableAlias(glProgramUniform2d, glProgramUniform2dEXT) \
+  HookTableEntry(glProgramUniform2dv) \
+  HookTableAlias(glProgramUniform2dv, glProgramUniform2dvEXT) \
+  HookTableEntry(glProgramUniform2f) \
+  HookTableAlias(glProgramUniform2f, glProgramUniform2fEXT) \
+  HookTableEntry(glProgramUniform2fv) \
+  HookTableAlias(glProgramUniform2fv, glProgramUniform2fvEXT) \
+  HookTableEntry(glProgramUniform2i) \
+  HookTableAlias(glProgramUniform2i, glProgramUniform2iEXT) \
+  HookTableEntry(glProgramUniform2iv) \
+  HookTableAlias(glProgramUniform2iv, glProgramUniform2ivEXT) \
+  HookTableEntry(glProgramUniform2ui) \
+  HookTableAlias(glProgramUniform2ui, glProgramUniform2uiEXT) \
+  HookTableEntry(glProgramUniform2uiv) \
+  HookTableAlias(glProgramUniform2uiv, glProgramUniform2uivEXT) \
+  HookTableEntry(glProgramUniform3d) \
+  HookTableAlias(glProgramUniform3d, glProgramUniform3dEXT) \
+  HookTableEntry(glProgramUniform3dv) \
+  HookTableAlias(glProgramUniform3dv, glProgramUniform3dvEXT) \
+  HookTableEntry(glProgramUniform3f) \
+  HookTableAlias(glProgramUniform3f, glProgramUniform3fEXT) \
+  HookTableEntry(glProgramUniform3fv) \
+  HookTableAlias(glProgramUniform3fv, glProgramUniform3fvEXT) \
+  HookTableEntry(glProgramUniform3i) \
+  HookTableAlias(glProgramUniform3i, glProgramUniform3iEXT) \
+  HookTableEntry(glProgramUniform3iv) \
+  HookTableAlias(glProgramUniform3iv, glProgramUniform3ivEXT) \
+  HookTableEntry(glProgramUniform3ui) \
+  HookTableAlias(glProgramUniform3ui, glProgramUniform3uiEXT) \
+  HookTableEntry(glProgramUniform3uiv) \
+  HookTableAlias(glProgramUniform3uiv, glProgramUniform3uivEXT) \
+  HookTableEntry(glProgramUniform4d) \
+  HookTableAlias(glProgramUniform4d, glProgramUniform4dEXT) \
+  HookTableEntry(glProgramUniform4dv) \
+  HookTableAlias(glProgramUniform4dv, glProgramUniform4dvEXT) \
+  HookTableEntry(glProgramUniform4f) \
+  HookTableAlias(glProgramUniform4f, glProgramUniform4fEXT) \
+  HookTableEntry(glProgramUniform4fv) \
+  HookTableAlias(glProgramUniform4fv, glProgramUniform4fvEXT) \
+  HookTableEntry(glProgramUniform4i) \
+  HookTableAlias(glProgramUniform4i, glProgramUniform4iEXT) \
+  HookTableEntry(glProgramUniform4iv) \
+  HookTableAlias(glProgramUniform4iv, glProgramUniform4ivEXT) \
+  HookTableEntry(glProgramUniform4ui) \
+  HookTableAlias(glProgramUniform4ui, glProgramUniform4uiEXT) \
+  HookTableEntry(glProgramUniform4uiv) \
+  HookTableAlias(glProgramUniform4uiv, glProgramUniform4uivEXT) \
+  HookTableEntry(glProgramUniformMatrix2dv) \
+  HookTableAlias(glProgramUniformMatrix2dv, glProgramUniformMatrix2dvEXT) \
+  HookTableEntry(glProgramUniformMatrix2fv) \
+  HookTableAlias(glProgramUniformMatrix2fv, glProgramUniformMatrix2fvEXT) \
+  HookTableEntry(glProgramUniformMatrix2x3dv) \
+  HookTableAlias(glProgramUniformMatrix2x3dv, glProgramUniformMatrix2x3dvEXT) \
+  HookTableEntry(glProgramUniformMatrix2x3fv) \
+  HookTableAlias(glProgramUniformMatrix2x3fv, glProgramUniformMatrix2x3fvEXT) \
+  HookTableEntry(glProgramUniformMatrix2x4dv) \
+  HookTableAlias(glProgramUniformMatrix2x4dv, glProgramUniformMatrix2x4dvEXT) \
+  HookTableEntry(glProgramUniformMatrix2x4fv) \
+  HookTableAlias(glProgramUniformMatrix2x4fv, glProgramUniformMatrix2x4fvEXT) \
+  HookTableEntry(glProgramUniformMatrix3dv) \
+  HookTableAlias(glProgramUniformMatrix3dv, glProgramUniformMatrix3dvEXT) \
+  HookTableEntry(glProgramUniformMatrix3fv) \
+  HookTableAlias(glProgramUniformMatrix3fv, glProgramUniformMatrix3fvEXT) \
+  HookTableEntry(glProgramUniformMatrix3x2dv) \
+  HookTableAlias(glProgramUniformMatrix3x2dv, glProgramUniformMatrix3x2dvEXT) \
+  HookTableEntry(glProgramUniformMatrix3x2fv) \
+  HookTableAlias(glProgramUniformMatrix3x2fv, glProgramUniformMatrix3x2fvEXT) \
+  HookTableEntry(glProgramUniformMatrix3x4dv) \
+  HookTableAlias(glProgramUniformMatrix3x4dv, glProgramUniformMatrix3x4dvEXT) \
+  HookTableEntry(glProgramUniformMatrix3x4fv) \
+  HookTableAlias(glProgramUniformMatrix3x4fv, glProgramUniformMatrix3x4fvEXT) \
+  HookTableEntry(glProgramUniformMatrix4dv) \
+  HookTableAlias(glProgramUniformMatrix4dv, glProgramUniformMatrix4dvEXT) \
+  HookTableEntry(glProgramUniformMatrix4fv) \
+  HookTableAlias(glProgramUniformMatrix4fv, glProgramUniformMatrix4fvEXT) \
+  HookTableEntry(glProgramUniformMatrix4x2dv) \
+  HookTableAlias(glProgramUniformMatrix4x2dv, glProgramUniformMatrix4x2dvEXT) \
+  HookTableEntry(glProgramUniformMatrix4x2fv) \
+  HookTableAlias(glProgramUniformMatrix4x2fv, glProgramUniformMatrix4x2fvEXT) \
+  HookTableEntry(glProgramUniformMatrix4x3dv) \
+  HookTableAlias(glProgramUniformMatrix4x3dv, glProgramUniformMatrix4x3dvEXT) \
+  HookTableEntry(glProgramUniformMatrix4x3fv) \
+  HookTableAlias(glProgramUniformMatrix4x3fv, glProgramUniformMatrix4x3fvEXT) \
+  HookTableEntry(glProvokingVertex) \
+  HookTableAlias(glProvokingVertex, glProvokingVertexEXT) \
+  HookTableEntry(glPushDebugGroup) \
+  HookTableEntry(glPushGroupMarkerEXT) \
+  HookTableEntry(glQueryCounter) \
+  HookTableEntry(glRasterSamplesEXT) \
+  HookTableEntry(glReadBuffer) \
+  HookTableEntry(glReadPixels) \
+  HookTableEntry(glReadnPixels) \
+  HookTableAlias(glReadnPixels, glReadnPixelsARB) \
+  HookTableEntry(glReleaseShaderCompiler) \
+  HookTableEntry(glRenderbufferStorage) \
+  HookTableAlias(glRenderbufferStorage, glRenderbufferStorageEXT) \
+  HookTableEntry(glRenderbufferStorageMultisample) \
+  HookTableAlias(glRenderbufferStorageMultisample, glRenderbufferStorageMultisampleEXT) \
+  HookTableEntry(glResumeTransformFeedback) \
+  HookTableEntry(glSampleCoverage) \
+  HookTableAlias(glSampleCoverage, glSampleCoverageARB) \
+  HookTableEntry(glSampleMaski) \
+  HookTableEntry(glSamplerParameterIiv) \
+  HookTableEntry(glSamplerParameterIuiv) \
+  HookTableEntry(glSamplerParameterf) \
+  HookTableEntry(glSamplerParameterfv) \
+  HookTableEntry(glSamplerParameteri) \
+  HookTableEntry(glSamplerParameteriv) \
+  HookTableEntry(glScissor) \
+  HookTableEntry(glScissorArrayv) \
+  HookTableEntry(glScissorIndexed) \
+  HookTableEntry(glScissorIndexedv) \
+  HookTableEntry(glShaderBinary) \
+  HookTableEntry(glShaderSource) \
+  HookTableEntry(glShaderStorageBlockBinding) \
+  HookTableEntry(glStencilFunc) \
+  HookTableEntry(glStencilFuncSeparate) \
+  HookTableEntry(glStencilMask) \
+  HookTableEntry(glStencilMaskSeparate) \
+  HookTableEntry(glStencilOp) \
+  HookTableEntry(glStencilOpSeparate) \
+  HookTableEntry(glStringMarkerGREMEDY) \
+  HookTableEntry(glTexBuffer) \
+  HookTableAlias(glTexBuffer, glTexBufferARB) \
+  HookTableAlias(glTexBuffer, glTexBufferEXT) \
+  HookTableEntry(glTexBufferRange) \
+  HookTableEntry(glTexImage1D) \
+  HookTableEntry(glTexImage2D) \
+  HookTableEntry(glTexImage2DMultisample) \
+  HookTableEntry(glTexImage3D) \
+  HookTableAlias(glTexImage3D, glTexImage3DEXT) \
+  HookTableEntry(glTexImage3DMultisample) \
+  HookTableEntry(glTexParameterIiv) \
+  HookTableAlias(glTexParameterIiv, glTexParameterIivEXT) \
+  HookTableEntry(glTexParameterIuiv) \
+  HookTableAlias(glTexParameterIuiv, glTexParameterIuivEXT) \
+  HookTableEntry(glTexParameterf) \
+  HookTableEntry(glTexParameterfv) \
+  HookTableEntry(glTexParameteri) \
+  HookTableEntry(glTexParameteriv) \
+  HookTableEntry(glTexStorage1D) \
+  HookTableEntry(glTexStorage2D) \
+  HookTableEntry(glTexStorage2DMultisample) \
+  HookTableEntry(glTexStorage3D) \
+  HookTableEntry(glTexStorage3DMultisample) \
+  HookTableEntry(glTexSubImage1D) \
+  HookTableEntry(glTexSubImage2D) \
+  HookTableEntry(glTexSubImage3D) \
+  HookTableEntry(glTextureBarrier) \
+  HookTableEntry(glTextureBuffer) \
+  HookTableEntry(glTextureBufferEXT) \
+  HookTableEntry(glTextureBufferRange) \
+  HookTableEntry(glTextureBufferRangeEXT) \
+  HookTableEntry(glTextureImage1DEXT) \
+  HookTableEntry(glTextureImage2DEXT) \
+  HookTableEntry(glTextureImage3DEXT) \
+  HookTableEntry(glTextureParameterIiv) \
+  HookTableEntry(glTextureParameterIivEXT) \
+  HookTableEntry(glTextureParameterIuiv) \
+  HookTableEntry(glTextureParameterIuivEXT) \
+  HookTableEntry(glTextureParameterf) \
+  HookTableEntry(glTextureParameterfEXT) \
+  HookTableEntry(glTextureParameterfv) \
+  HookTableEntry(glTextureParameterfvEXT) \
+  HookTableEntry(glTextureParameteri) \
+  HookTableEntry(glTextureParameteriEXT) \
+  HookTableEntry(glTextureParameteriv) \
+  HookTableEntry(glTextureParameterivEXT) \
+  HookTableEntry(glTextureStorage1D) \
+  HookTableEntry(glTextureStorage1DEXT) \
+  HookTableEntry(glTextureStorage2D) \
+  HookTableEntry(glTextureStorage2DEXT) \
+  HookTableEntry(glTextureStorage2DMultisample) \
+  HookTableEntry(glTextureStorage2DMultisampleEXT) \
+  HookTableEntry(glTextureStorage3D) \
+  HookTableEntry(glTextureStorage3DEXT) \
+  HookTableEntry(glTextureStorage3DMultisample) \
+  HookTableEntry(glTextureStorage3DMultisampleEXT) \
+  HookTableEntry(glTextureSubImage1D) \
+  HookTableEntry(glTextureSubImage1DEXT) \
+  HookTableEntry(glTextureSubImage2D) \
+  HookTableEntry(glTextureSubImage2DEXT) \
+  HookTableEntry(glTextureSubImage3D) \
+  HookTableEntry(glTextureSubImage3DEXT) \
+  HookTableEntry(glTextureView) \
+  HookTableEntry(glTransformFeedbackBufferBase) \
+  HookTableEntry(glTransformFeedbackBufferRange) \
+  HookTableEntry(glTransformFeedbackVaryings) \
+  HookTableAlias(glTransformFeedbackVaryings, glTransformFeedbackVaryingsEXT) \
+  HookTableEntry(glUniform1d) \
+  HookTableEntry(glUniform1dv) \
+  HookTableEntry(glUniform1f) \
+  HookTableEntry(glUniform1fv) \
+  HookTableEntry(glUniform1i) \
+  HookTableEntry(glUniform1iv) \
+  HookTableEntry(glUniform1ui) \
+  HookTableAlias(glUniform1ui, glUniform1uiEXT) \
+  HookTableEntry(glUniform1uiv) \
+  HookTableAlias(glUniform1uiv, glUniform1uivEXT) \
+  HookTableEntry(glUniform2d) \
+  HookTableEntry(glUniform2dv) \
+  HookTableEntry(glUniform2f) \
+  HookTableEntry(glUniform2fv) \
+  HookTableEntry(glUniform2i) \
+  HookTableEntry(glUniform2iv) \
+  HookTableEntry(glUniform2ui) \
+  HookTableAlias(glUniform2ui, glUniform2uiEXT) \
+  HookTableEntry(glUniform2uiv) \
+  HookTableAlias(glUniform2uiv, glUniform2uivEXT) \
+  HookTableEntry(glUniform3d) \
+  HookTableEntry(glUniform3dv) \
+  HookTableEntry(glUniform3f) \
+  HookTableEntry(glUniform3fv) \
+  HookTableEntry(glUniform3i) \
+  HookTableEntry(glUniform3iv) \
+  HookTableEntry(glUniform3ui) \
+  HookTableAlias(glUniform3ui, glUniform3uiEXT) \
+  HookTableEntry(glUniform3uiv) \
+  HookTableAlias(glUniform3uiv, glUniform3uivEXT) \
+  HookTableEntry(glUniform4d) \
+  HookTableEntry(glUniform4dv) \
+  HookTableEntry(glUniform4f) \
+  HookTableEntry(glUniform4fv) \
+  HookTableEntry(glUniform4i) \
+  HookTableEntry(glUniform4iv) \
+  HookTableEntry(glUniform4ui) \
+  HookTableAlias(glUniform4ui, glUniform4uiEXT) \
+  HookTableEntry(glUniform4uiv) \
+  HookTableAlias(glUniform4uiv, glUniform4uivEXT) \
+  HookTableEntry(glUniformBlockBinding) \
+  HookTableEntry(glUniformMatrix2dv) \
+  HookTableEntry(glUniformMatrix2fv) \
+  HookTableEntry(glUniformMatrix2x3dv) \
+  HookTableEntry(glUniformMatrix2x3fv) \
+  HookTableEntry(glUniformMatrix2x4dv) \
+  HookTableEntry(glUniformMatrix2x4fv) \
+  HookTableEntry(glUniformMatrix3dv) \
+  HookTableEntry(glUniformMatrix3fv) \
+  HookTableEntry(glUniformMatrix3x2dv) \
+  HookTableEntry(glUniformMatrix3x2fv) \
+  HookTableEntry(glUniformMatrix3x4dv) \
+  HookTableEntry(glUniformMatrix3x4fv) \
+  HookTableEntry(glUniformMatrix4dv) \
+  HookTableEntry(glUniformMatrix4fv) \
+  HookTableEntry(glUniformMatrix4x2dv) \
+  HookTableEntry(glUniformMatrix4x2fv) \
+  HookTableEntry(glUniformMatrix4x3dv) \
+  HookTableEntry(glUniformMatrix4x3fv) \
+  HookTableEntry(glUniformSubroutinesuiv) \
+  HookTableEntry(glUnmapBuffer) \
+  HookTableAlias(glUnmapBuffer, glUnmapBufferARB) \
+  HookTableAlias(glUnmapNamedBufferEXT, glUnmapNamedBuffer) \
+  HookTableEntry(glUnmapNamedBufferEXT) \
+  HookTableEntry(glUseProgram) \
+  HookTableEntry(glUseProgramStages) \
+  HookTableEntry(glValidateProgram) \
+  HookTableEntry(glValidateProgramPipeline) \
+  HookTableAlias(glVertexArrayVertexAttribBindingEXT, glVertexArrayAttribBinding) \
+  HookTableAlias(glVertexArrayVertexAttribFormatEXT, glVertexArrayAttribFormat) \
+  HookTableAlias(glVertexArrayVertexAttribIFormatEXT, glVertexArrayAttribIFormat) \
+  HookTableAlias(glVertexArrayVertexAttribLFormatEXT, glVertexArrayAttribLFormat) \
+  HookTableEntry(glVertexArrayBindVertexBufferEXT) \
+  HookTableAlias(glVertexArrayVertexBindingDivisorEXT, glVertexArrayBindingDivisor) \
+  HookTableEntry(glVertexArrayElementBuffer) \
+  HookTableEntry(glVertexArrayVertexAttribBindingEXT) \
+  HookTableEntry(glVertexArrayVertexAttribDivisorEXT) \
+  HookTableEntry(glVertexArrayVertexAttribFormatEXT) \
+  HookTableEntry(glVertexArrayVertexAttribIFormatEXT) \
+  HookTableEntry(glVertexArrayVertexAttribIOffsetEXT) \
+  HookTableEntry(glVertexArrayVertexAttribLFormatEXT) \
+  HookTableEntry(glVertexArrayVertexAttribLOffsetEXT) \
+  HookTableEntry(glVertexArrayVertexAttribOffsetEXT) \
+  HookTableEntry(glVertexArrayVertexBindingDivisorEXT) \
+  HookTableAlias(glVertexArrayBindVertexBufferEXT, glVertexArrayVertexBuffer) \
+  HookTableEntry(glVertexArrayVertexBuffers) \
+  HookTableEntry(glVertexAttrib1d) \
+  HookTableAlias(glVertexAttrib1d, glVertexAttrib1dARB) \
+  HookTableEntry(glVertexAttrib1dv) \
+  HookTableAlias(glVertexAttrib1dv, glVertexAttrib1dvARB) \
+  HookTableEntry(glVertexAttrib1f) \
+  HookTableAlias(glVertexAttrib1f, glVertexAttrib1fARB) \
+  HookTableEntry(glVertexAttrib1fv) \
+  HookTableAlias(glVertexAttrib1fv, glVertexAttrib1fvARB) \
+  HookTableEntry(glVertexAttrib1s) \
+  HookTableAlias(glVertexAttrib1s, glVertexAttrib1sARB) \
+  HookTableEntry(glVertexAttrib1sv) \
+  HookTableAlias(glVertexAttrib1sv, glVertexAttrib1svARB) \
+  HookTableEntry(glVertexAttrib2d) \
+  HookTableAlias(glVertexAttrib2d, glVertexAttrib2dARB) \
+  HookTableEntry(glVertexAttrib2dv) \
+  HookTableAlias(glVertexAttrib2dv, glVertexAttrib2dvARB) \
+  HookTableEntry(glVertexAttrib2f) \
+  HookTableAlias(glVertexAttrib2f, glVertexAttrib2fARB) \
+  HookTableEntry(glVertexAttrib2fv) \
+  HookTableAlias(glVertexAttrib2fv, glVertexAttrib2fvARB) \
+  HookTableEntry(glVertexAttrib2s) \
+  HookTableAlias(glVertexAttrib2s, glVertexAttrib2sARB) \
+  HookTableEntry(glVertexAttrib2sv) \
+  HookTableAlias(glVertexAttrib2sv, glVertexAttrib2svARB) \
+  HookTableEntry(glVertexAttrib3d) \
+  HookTableAlias(glVertexAttrib3d, glVertexAttrib3dARB) \
+  HookTableEntry(glVertexAttrib3dv) \
+  HookTableAlias(glVertexAttrib3dv, glVertexAttrib3dvARB) \
+  HookTableEntry(glVertexAttrib3f) \
+  HookTableAlias(glVertexAttrib3f, glVertexAttrib3fARB) \
+  HookTableEntry(glVertexAttrib3fv) \
+  HookTableAlias(glVertexAttrib3fv, glVertexAttrib3fvARB) \
+  HookTableEntry(glVertexAttrib3s) \
+  HookTableAlias(glVertexAttrib3s, glVertexAttrib3sARB) \
+  HookTableEntry(glVertexAttrib3sv) \
+  HookTableAlias(glVertexAttrib3sv, glVertexAttrib3svARB) \
+  HookTableEntry(glVertexAttrib4Nbv) \
+  HookTableAlias(glVertexAttrib4Nbv, glVertexAttrib4NbvARB) \
+  HookTableEntry(glVertexAttrib4Niv) \
+  HookTableAlias(glVertexAttrib4Niv, glVertexAttrib4NivARB) \
+  HookTableEntry(glVertexAttrib4Nsv) \
+  HookTableAlias(glVertexAttrib4Nsv, glVertexAttrib4NsvARB) \
+  HookTableEntry(glVertexAttrib4Nub) \
+  HookTableEntry(glVertexAttrib4Nubv) \
+  HookTableAlias(glVertexAttrib4Nubv, glVertexAttrib4NubvARB) \
+  HookTableEntry(glVertexAttrib4Nuiv) \
+  HookTableAlias(glVertexAttrib4Nuiv, glVertexAttrib4NuivARB) \
+  HookTableEntry(glVertexAttrib4Nusv) \
+  HookTableAlias(glVertexAttrib4Nusv, glVertexAttrib4NusvARB) \
+  HookTableEntry(glVertexAttrib4bv) \
+  HookTableAlias(glVertexAttrib4bv, glVertexAttrib4bvARB) \
+  HookTableEntry(glVertexAttrib4d) \
+  HookTableAlias(glVertexAttrib4d, glVertexAttrib4dARB) \
+  HookTableEntry(glVertexAttrib4dv) \
+  HookTableAlias(glVertexAttrib4dv, glVertexAttrib4dvARB) \
+  HookTableEntry(glVertexAttrib4f) \
+  HookTableAlias(glVertexAttrib4f, glVertexAttrib4fARB) \
+  HookTableEntry(glVertexAttrib4fv) \
+  HookTableAlias(glVertexAttrib4fv, glVertexAttrib4fvARB) \
+  HookTableEntry(glVertexAttrib4iv) \
+  HookTableAlias(glVertexAttrib4iv, glVertexAttrib4ivARB) \
+  HookTableEntry(glVertexAttrib4s) \
+  HookTableAlias(glVertexAttrib4s, glVertexAttrib4sARB) \
+  HookTableEntry(glVertexAttrib4sv) \
+  HookTableAlias(glVertexAttrib4sv, glVertexAttrib4svARB) \
+  HookTableEntry(glVertexAttrib4ubv) \
+  HookTableAlias(glVertexAttrib4ubv, glVertexAttrib4ubvARB) \
+  HookTableEntry(glVertexAttrib4uiv) \
+  HookTableAlias(glVertexAttrib4uiv, glVertexAttrib4uivARB) \
+  HookTableEntry(glVertexAttrib4usv) \
+  HookTableAlias(glVertexAttrib4usv, glVertexAttrib4usvARB) \
+  HookTableEntry(glVertexAttribBinding) \
+  HookTableEntry(glVertexAttribDivisor) \
+  HookTableAlias(glVertexAttribDivisor, glVertexAttribDivisorARB) \
+  HookTableEntry(glVertexAttribFormat) \
+  HookTableEntry(glVertexAttribI1i) \
+  HookTableAlias(glVertexAttribI1i, glVertexAttribI1iEXT) \
+  HookTableEntry(glVertexAttribI1iv) \
+  HookTableAlias(glVertexAttribI1iv, glVertexAttribI1ivEXT) \
+  HookTableEntry(glVertexAttribI1ui) \
+  HookTableAlias(glVertexAttribI1ui, glVertexAttribI1uiEXT) \
+  HookTableEntry(glVertexAttribI1uiv) \
+  HookTableAlias(glVertexAttribI1uiv, glVertexAttribI1uivEXT) \
+  HookTableEntry(glVertexAttribI2i) \
+  HookTableAlias(glVertexAttribI2i, glVertexAttribI2iEXT) \
+  HookTableEntry(glVertexAttribI2iv) \
+  HookTableAlias(glVertexAttribI2iv, glVertexAttribI2ivEXT) \
+  HookTableEntry(glVertexAttribI2ui) \
+  HookTableAlias(glVertexAttribI2ui, glVertexAttribI2uiEXT) \
+  HookTableEntry(glVertexAttribI2uiv) \
+  HookTableAlias(glVertexAttribI2uiv, glVertexAttribI2uivEXT) \
+  HookTableEntry(glVertexAttribI3i) \
+  HookTableAlias(glVertexAttribI3i, glVertexAttribI3iEXT) \
+  HookTableEntry(glVertexAttribI3iv) \
+  HookTableAlias(glVertexAttribI3iv, glVertexAttribI3ivEXT) \
+  HookTableEntry(glVertexAttribI3ui) \
+  HookTableAlias(glVertexAttribI3ui, glVertexAttribI3uiEXT) \
+  HookTableEntry(glVertexAttribI3uiv) \
+  HookTableAlias(glVertexAttribI3uiv, glVertexAttribI3uivEXT) \
+  HookTableEntry(glVertexAttribI4bv) \
+  HookTableAlias(glVertexAttribI4bv, glVertexAttribI4bvEXT) \
+  HookTableEntry(glVertexAttribI4i) \
+  HookTableAlias(glVertexAttribI4i, glVertexAttribI4iEXT) \
+  HookTableEntry(glVertexAttribI4iv) \
+  HookTableAlias(glVertexAttribI4iv, glVertexAttribI4ivEXT) \
+  HookTableEntry(glVertexAttribI4sv) \
+  HookTableAlias(glVertexAttribI4sv, glVertexAttribI4svEXT) \
+  HookTableEntry(glVertexAttribI4ubv) \
+  HookTableAlias(glVertexAttribI4ubv, glVertexAttribI4ubvEXT) \
+  HookTableEntry(glVertexAttribI4ui) \
+  HookTableAlias(glVertexAttribI4ui, glVertexAttribI4uiEXT) \
+  HookTableEntry(glVertexAttribI4uiv) \
+  HookTableAlias(glVertexAttribI4uiv, glVertexAttribI4uivEXT) \
+  HookTableEntry(glVertexAttribI4usv) \
+  HookTableAlias(glVertexAttribI4usv, glVertexAttribI4usvEXT) \
+  HookTableEntry(glVertexAttribIFormat) \
+  HookTableEntry(glVertexAttribIPointer) \
+  HookTableAlias(glVertexAttribIPointer, glVertexAttribIPointerEXT) \
+  HookTableEntry(glVertexAttribL1d) \
+  HookTableAlias(glVertexAttribL1d, glVertexAttribL1dEXT) \
+  HookTableEntry(glVertexAttribL1dv) \
+  HookTableAlias(glVertexAttribL1dv, glVertexAttribL1dvEXT) \
+  HookTableEntry(glVertexAttribL2d) \
+  HookTableAlias(glVertexAttribL2d, glVertexAttribL2dEXT) \
+  HookTableEntry(glVertexAttribL2dv) \
+  HookTableAlias(glVertexAttribL2dv, glVertexAttribL2dvEXT) \
+  HookTableEntry(glVertexAttribL3d) \
+  HookTableAlias(glVertexAttribL3d, glVertexAttribL3dEXT) \
+  HookTableEntry(glVertexAttribL3dv) \
+  HookTableAlias(glVertexAttribL3dv, glVertexAttribL3dvEXT) \
+  HookTableEntry(glVertexAttribL4d) \
+  HookTableAlias(glVertexAttribL4d, glVertexAttribL4dEXT) \
+  HookTableEntry(glVertexAttribL4dv) \
+  HookTableAlias(glVertexAttribL4dv, glVertexAttribL4dvEXT) \
+  HookTableEntry(glVertexAttribLFormat) \
+  HookTableEntry(glVertexAttribLPointer) \
+  HookTableAlias(glVertexAttribLPointer, glVertexAttribLPointerEXT) \
+  HookTableEntry(glVertexAttribP1ui) \
+  HookTableEntry(glVertexAttribP1uiv) \
+  HookTableEntry(glVertexAttribP2ui) \
+  HookTableEntry(glVertexAttribP2uiv) \
+  HookTableEntry(glVertexAttribP3ui) \
+  HookTableEntry(glVertexAttribP3uiv) \
+  HookTableEntry(glVertexAttribP4ui) \
+  HookTableEntry(glVertexAttribP4uiv) \
+  HookTableEntry(glVertexAttribPointer) \
+  HookTableAlias(glVertexAttribPointer, glVertexAttribPointerARB) \
+  HookTableEntry(glVertexBindingDivisor) \
+  HookTableEntry(glViewport) \
+  HookTableEntry(glViewportArrayv) \
+  HookTableEntry(glViewportIndexedf) \
+  HookTableEntry(glViewportIndexedfv) \
+  HookTableEntry(glWaitSync) \
+  HookTableEntry(wglDXCloseDeviceNV) \
+  HookTableEntry(wglDXLockObjectsNV) \
+  HookTableEntry(wglDXObjectAccessNV) \
+  HookTableEntry(wglDXOpenDeviceNV) \
+  HookTableEntry(wglDXRegisterObjectNV) \
+  HookTableEntry(wglDXSetResourceShareHandleNV) \
+  HookTableEntry(wglDXUnlockObjectsNV) \
+  HookTableEntry(wglDXUnregisterObjectNV) \
+
+
+
+// unsupported entry points, sorted by (lowercase) name
+#define GLUnsupportedTable() \
+  UnsupportedTableEntry(glaccum) \
+  UnsupportedTableEntry(glaccumxoes) \
+  UnsupportedTableEntry(glactiveprogramext) \
+  UnsupportedTableEntry(glactivestencilfaceext) \
+  UnsupportedTableEntry(glactivevaryingnv) \
+  UnsupportedTableEntry(glalphafragmentop1ati) \
+  UnsupportedTableEntry(glalphafragmentop2ati) \
+  UnsupportedTableEntry(glalphafragmentop3ati) \
+  UnsupportedTableEntry(glalphafunc) \
+  UnsupportedTableEntry(glalphafuncxoes) \
+  UnsupportedTableEntry(glapplyframebufferattachmentcmaaintel) \
+  UnsupportedTableEntry(glapplytextureext) \
+  UnsupportedTableEntry(glareprogramsresidentnv) \
+  UnsupportedTableEntry(glaretexturesresident) \
+  UnsupportedTableEntry(glaretexturesresidentext) \
+  UnsupportedTableEntry(glarrayelement) \
+  UnsupportedTableEntry(glarrayelementext) \
+  UnsupportedTableEntry(glarrayobjectati) \
+  UnsupportedTableEntry(glasyncmarkersgix) \
+  UnsupportedTableEntry(glattachobjectarb) \
+  UnsupportedTableEntry(glbegin) \
+  UnsupportedTableEntry(glbeginconditionalrendernv) \
+  UnsupportedTableEntry(glbeginconditionalrendernvx) \
+  UnsupportedTableEntry(glbeginfragmentshaderati) \
+  UnsupportedTableEntry(glbeginocclusionquerynv) \
+  UnsupportedTableEntry(glbeginperfmonitoramd) \
+  UnsupportedTableEntry(glbeginperfqueryintel) \
+  UnsupportedTableEntry(glbegintransformfeedbacknv) \
+  UnsupportedTableEntry(glbeginvertexshaderext) \
+  UnsupportedTableEntry(glbeginvideocapturenv) \
+  UnsupportedTableEntry(glbindattriblocationarb) \
+  UnsupportedTableEntry(glbindbufferbasenv) \
+  UnsupportedTableEntry(glbindbufferoffsetext) \
+  UnsupportedTableEntry(glbindbufferoffsetnv) \
+  UnsupportedTableEntry(glbindbufferrangenv) \
+  UnsupportedTableEntry(glbindfragmentshaderati) \
+  UnsupportedTableEntry(glbindlightparameterext) \
+  UnsupportedTableEntry(glbindmaterialparameterext) \
+  UnsupportedTableEntry(glbindparameterext) \
+  UnsupportedTableEntry(glbindprogramarb) \
+  UnsupportedTableEntry(glbindprogramnv) \
+  UnsupportedTableEntry(glbindtexgenparameterext) \
+  UnsupportedTableEntry(glbindtextureext) \
+  UnsupportedTableEntry(glbindtextureunitparameterext) \
+  UnsupportedTableEntry(glbindtransformfeedbacknv) \
+  UnsupportedTableEntry(glbindvertexarrayapple) \
+  UnsupportedTableEntry(glbindvertexshaderext) \
+  UnsupportedTableEntry(glbindvideocapturestreambuffernv) \
+  UnsupportedTableEntry(glbindvideocapturestreamtexturenv) \
+  UnsupportedTableEntry(glbinormal3bext) \
+  UnsupportedTableEntry(glbinormal3bvext) \
+  UnsupportedTableEntry(glbinormal3dext) \
+  UnsupportedTableEntry(glbinormal3dvext) \
+  UnsupportedTableEntry(glbinormal3fext) \
+  UnsupportedTableEntry(glbinormal3fvext) \
+  UnsupportedTableEntry(glbinormal3iext) \
+  UnsupportedTableEntry(glbinormal3ivext) \
+  UnsupportedTableEntry(glbinormal3sext) \
+  UnsupportedTableEntry(glbinormal3svext) \
+  UnsupportedTableEntry(glbinormalpointerext) \
+  UnsupportedTableEntry(glbitmap) \
+  UnsupportedTableEntry(glbitmapxoes) \
+  UnsupportedTableEntry(glblendbarriernv) \
+  UnsupportedTableEntry(glblendcolorxoes) \
+  UnsupportedTableEntry(glblendequationindexedamd) \
+  UnsupportedTableEntry(glblendequationseparateindexedamd) \
+  UnsupportedTableEntry(glblendfuncindexedamd) \
+  UnsupportedTableEntry(glblendfuncseparateext) \
+  UnsupportedTableEntry(glblendfuncseparateindexedamd) \
+  UnsupportedTableEntry(glblendfuncseparateingr) \
+  UnsupportedTableEntry(glblendparameterinv) \
+  UnsupportedTableEntry(glbufferaddressrangenv) \
+  UnsupportedTableEntry(glbufferpagecommitmentarb) \
+  UnsupportedTableEntry(glbufferparameteriapple) \
+  UnsupportedTableEntry(glcallcommandlistnv) \
+  UnsupportedTableEntry(glcalllist) \
+  UnsupportedTableEntry(glcalllists) \
+  UnsupportedTableEntry(glclearaccum) \
+  UnsupportedTableEntry(glclearaccumxoes) \
+  UnsupportedTableEntry(glclearcoloriiext) \
+  UnsupportedTableEntry(glclearcoloriuiext) \
+  UnsupportedTableEntry(glclearcolorxoes) \
+  UnsupportedTableEntry(glcleardepthdnv) \
+  UnsupportedTableEntry(glcleardepthfoes) \
+  UnsupportedTableEntry(glcleardepthxoes) \
+  UnsupportedTableEntry(glclearindex) \
+  UnsupportedTableEntry(glclientactivetexture) \
+  UnsupportedTableEntry(glclientactivetexturearb) \
+  UnsupportedTableEntry(glclientactivevertexstreamati) \
+  UnsupportedTableEntry(glclientattribdefaultext) \
+  UnsupportedTableEntry(glclipplane) \
+  UnsupportedTableEntry(glclipplanefoes) \
+  UnsupportedTableEntry(glclipplanexoes) \
+  UnsupportedTableEntry(glcolor3b) \
+  UnsupportedTableEntry(glcolor3bv) \
+  UnsupportedTableEntry(glcolor3d) \
+  UnsupportedTableEntry(glcolor3dv) \
+  UnsupportedTableEntry(glcolor3f) \
+  UnsupportedTableEntry(glcolor3fv) \
+  UnsupportedTableEntry(glcolor3fvertex3fsun) \
+  UnsupportedTableEntry(glcolor3fvertex3fvsun) \
+  UnsupportedTableEntry(glcolor3hnv) \
+  UnsupportedTableEntry(glcolor3hvnv) \
+  UnsupportedTableEntry(glcolor3i) \
+  UnsupportedTableEntry(glcolor3iv) \
+  UnsupportedTableEntry(glcolor3s) \
+  UnsupportedTableEntry(glcolor3sv) \
+  UnsupportedTableEntry(glcolor3ub) \
+  UnsupportedTableEntry(glcolor3ubv) \
+  UnsupportedTableEntry(glcolor3ui) \
+  UnsupportedTableEntry(glcolor3uiv) \
+  UnsupportedTableEntry(glcolor3us) \
+  UnsupportedTableEntry(glcolor3usv) \
+  UnsupportedTableEntry(glcolor3xoes) \
+  UnsupportedTableEntry(glcolor3xvoes) \
+  UnsupportedTableEntry(glcolor4b) \
+  UnsupportedTableEntry(glcolor4bv) \
+  UnsupportedTableEntry(glcolor4d) \
+  UnsupportedTableEntry(glcolor4dv) \
+  UnsupportedTableEntry(glcolor4f) \
+  UnsupportedTableEntry(glcolor4fnormal3fvertex3fsun) \
+  UnsupportedTableEntry(glcolor4fnormal3fvertex3fvsun) \
+  UnsupportedTableEntry(glcolor4fv) \
+  UnsupportedTableEntry(glcolor4hnv) \
+  UnsupportedTableEntry(glcolor4hvnv) \
+  UnsupportedTableEntry(glcolor4i) \
+  UnsupportedTableEntry(glcolor4iv) \
+  UnsupportedTableEntry(glcolor4s) \
+  UnsupportedTableEntry(glcolor4sv) \
+  UnsupportedTableEntry(glcolor4ub) \
+  UnsupportedTableEntry(glcolor4ubv) \
+  UnsupportedTableEntry(glcolor4ubvertex2fsun) \
+  UnsupportedTableEntry(glcolor4ubvertex2fvsun) \
+  UnsupportedTableEntry(glcolor4ubvertex3fsun) \
+  UnsupportedTableEntry(glcolor4ubvertex3fvsun) \
+  UnsupportedTableEntry(glcolor4ui) \
+  UnsupportedTableEntry(glcolor4uiv) \
+  UnsupportedTableEntry(glcolor4us) \
+  UnsupportedTableEntry(glcolor4usv) \
+  UnsupportedTableEntry(glcolor4xoes) \
+  UnsupportedTableEntry(glcolor4xvoes) \
+  UnsupportedTableEntry(glcolorformatnv) \
+  UnsupportedTableEntry(glcolorfragmentop1ati) \
+  UnsupportedTableEntry(glcolorfragmentop2ati) \
+  UnsupportedTableEntry(glcolorfragmentop3ati) \
+  UnsupportedTableEntry(glcolormaterial) \
+  UnsupportedTableEntry(glcolorp3ui) \
+  UnsupportedTableEntry(glcolorp3uiv) \
+  UnsupportedTableEntry(glcolorp4ui) \
+  UnsupportedTableEntry(glcolorp4uiv) \
+  UnsupportedTableEntry(glcolorpointer) \
+  UnsupportedTableEntry(glcolorpointerext) \
+  UnsupportedTableEntry(glcolorpointerlistibm) \
+  UnsupportedTableEntry(glcolorpointervintel) \
+  UnsupportedTableEntry(glcolorsubtable) \
+  UnsupportedTableEntry(glcolorsubtableext) \
+  UnsupportedTableEntry(glcolortable) \
+  UnsupportedTableEntry(glcolortableext) \
+  UnsupportedTableEntry(glcolortableparameterfv) \
+  UnsupportedTableEntry(glcolortableparameterfvsgi) \
+  UnsupportedTableEntry(glcolortableparameteriv) \
+  UnsupportedTableEntry(glcolortableparameterivsgi) \
+  UnsupportedTableEntry(glcolortablesgi) \
+  UnsupportedTableEntry(glcombinerinputnv) \
+  UnsupportedTableEntry(glcombineroutputnv) \
+  UnsupportedTableEntry(glcombinerparameterfnv) \
+  UnsupportedTableEntry(glcombinerparameterfvnv) \
+  UnsupportedTableEntry(glcombinerparameterinv) \
+  UnsupportedTableEntry(glcombinerparameterivnv) \
+  UnsupportedTableEntry(glcombinerstageparameterfvnv) \
+  UnsupportedTableEntry(glcommandlistsegmentsnv) \
+  UnsupportedTableEntry(glcompilecommandlistnv) \
+  UnsupportedTableEntry(glcompileshaderarb) \
+  UnsupportedTableEntry(glconservativerasterparameterfnv) \
+  UnsupportedTableEntry(glconvolutionfilter1d) \
+  UnsupportedTableEntry(glconvolutionfilter1dext) \
+  UnsupportedTableEntry(glconvolutionfilter2d) \
+  UnsupportedTableEntry(glconvolutionfilter2dext) \
+  UnsupportedTableEntry(glconvolutionparameterf) \
+  UnsupportedTableEntry(glconvolutionparameterfext) \
+  UnsupportedTableEntry(glconvolutionparameterfv) \
+  UnsupportedTableEntry(glconvolutionparameterfvext) \
+  UnsupportedTableEntry(glconvolutionparameteri) \
+  UnsupportedTableEntry(glconvolutionparameteriext) \
+  UnsupportedTableEntry(glconvolutionparameteriv) \
+  UnsupportedTableEntry(glconvolutionparameterivext) \
+  UnsupportedTableEntry(glconvolutionparameterxoes) \
+  UnsupportedTableEntry(glconvolutionparameterxvoes) \
+  UnsupportedTableEntry(glcopycolorsubtable) \
+  UnsupportedTableEntry(glcopycolorsubtableext) \
+  UnsupportedTableEntry(glcopycolortable) \
+  UnsupportedTableEntry(glcopycolortablesgi) \
+  UnsupportedTableEntry(glcopyconvolutionfilter1d) \
+  UnsupportedTableEntry(glcopyconvolutionfilter1dext) \
+  UnsupportedTableEntry(glcopyconvolutionfilter2d) \
+  UnsupportedTableEntry(glcopyconvolutionfilter2dext) \
+  UnsupportedTableEntry(glcopyimagesubdatanv) \
+  UnsupportedTableEntry(glcopypathnv) \
+  UnsupportedTableEntry(glcopypixels) \
+  UnsupportedTableEntry(glcopyteximage1dext) \
+  UnsupportedTableEntry(glcopyteximage2dext) \
+  UnsupportedTableEntry(glcopytexsubimage1dext) \
+  UnsupportedTableEntry(glcopytexsubimage2dext) \
+  UnsupportedTableEntry(glcopytexsubimage3dext) \
+  UnsupportedTableEntry(glcoveragemodulationnv) \
+  UnsupportedTableEntry(glcoveragemodulationtablenv) \
+  UnsupportedTableEntry(glcoverfillpathinstancednv) \
+  UnsupportedTableEntry(glcoverfillpathnv) \
+  UnsupportedTableEntry(glcoverstrokepathinstancednv) \
+  UnsupportedTableEntry(glcoverstrokepathnv) \
+  UnsupportedTableEntry(glcreatecommandlistsnv) \
+  UnsupportedTableEntry(glcreateperfqueryintel) \
+  UnsupportedTableEntry(glcreateprogramobjectarb) \
+  UnsupportedTableEntry(glcreateshaderobjectarb) \
+  UnsupportedTableEntry(glcreateshaderprogramext) \
+  UnsupportedTableEntry(glcreatestatesnv) \
+  UnsupportedTableEntry(glcreatesyncfromcleventarb) \
+  UnsupportedTableEntry(glcullparameterdvext) \
+  UnsupportedTableEntry(glcullparameterfvext) \
+  UnsupportedTableEntry(glcurrentpalettematrixarb) \
+  UnsupportedTableEntry(gldebugmessagecallbackamd) \
+  UnsupportedTableEntry(gldebugmessageenableamd) \
+  UnsupportedTableEntry(gldebugmessageinsertamd) \
+  UnsupportedTableEntry(gldeformationmap3dsgix) \
+  UnsupportedTableEntry(gldeformationmap3fsgix) \
+  UnsupportedTableEntry(gldeformsgix) \
+  UnsupportedTableEntry(gldeleteasyncmarkerssgix) \
+  UnsupportedTableEntry(gldeletecommandlistsnv) \
+  UnsupportedTableEntry(gldeletefencesapple) \
+  UnsupportedTableEntry(gldeletefencesnv) \
+  UnsupportedTableEntry(gldeletefragmentshaderati) \
+  UnsupportedTableEntry(gldeletelists) \
+  UnsupportedTableEntry(gldeletenamesamd) \
+  UnsupportedTableEntry(gldeleteobjectarb) \
+  UnsupportedTableEntry(gldeleteocclusionqueriesnv) \
+  UnsupportedTableEntry(gldeletepathsnv) \
+  UnsupportedTableEntry(gldeleteperfmonitorsamd) \
+  UnsupportedTableEntry(gldeleteperfqueryintel) \
+  UnsupportedTableEntry(gldeleteprogramsarb) \
+  UnsupportedTableEntry(gldeleteprogramsnv) \
+  UnsupportedTableEntry(gldeletestatesnv) \
+  UnsupportedTableEntry(gldeletetexturesext) \
+  UnsupportedTableEntry(gldeletetransformfeedbacksnv) \
+  UnsupportedTableEntry(gldeletevertexarraysapple) \
+  UnsupportedTableEntry(gldeletevertexshaderext) \
+  UnsupportedTableEntry(gldepthboundsdnv) \
+  UnsupportedTableEntry(gldepthrangednv) \
+  UnsupportedTableEntry(gldepthrangefoes) \
+  UnsupportedTableEntry(gldepthrangexoes) \
+  UnsupportedTableEntry(gldetachobjectarb) \
+  UnsupportedTableEntry(gldetailtexfuncsgis) \
+  UnsupportedTableEntry(gldisableclientstate) \
+  UnsupportedTableEntry(gldisableclientstateiext) \
+  UnsupportedTableEntry(gldisableclientstateindexedext) \
+  UnsupportedTableEntry(gldisablevariantclientstateext) \
+  UnsupportedTableEntry(gldisablevertexarrayext) \
+  UnsupportedTableEntry(gldisablevertexattribapple) \
+  UnsupportedTableEntry(gldrawarraysext) \
+  UnsupportedTableEntry(gldrawbuffersati) \
+  UnsupportedTableEntry(gldrawcommandsaddressnv) \
+  UnsupportedTableEntry(gldrawcommandsnv) \
+  UnsupportedTableEntry(gldrawcommandsstatesaddressnv) \
+  UnsupportedTableEntry(gldrawcommandsstatesnv) \
+  UnsupportedTableEntry(gldrawelementarrayapple) \
+  UnsupportedTableEntry(gldrawelementarrayati) \
+  UnsupportedTableEntry(gldrawmesharrayssun) \
+  UnsupportedTableEntry(gldrawpixels) \
+  UnsupportedTableEntry(gldrawrangeelementarrayapple) \
+  UnsupportedTableEntry(gldrawrangeelementarrayati) \
+  UnsupportedTableEntry(gldrawtexturenv) \
+  UnsupportedTableEntry(gldrawtransformfeedbacknv) \
+  UnsupportedTableEntry(gledgeflag) \
+  UnsupportedTableEntry(gledgeflagformatnv) \
+  UnsupportedTableEntry(gledgeflagpointer) \
+  UnsupportedTableEntry(gledgeflagpointerext) \
+  UnsupportedTableEntry(gledgeflagpointerlistibm) \
+  UnsupportedTableEntry(gledgeflagv) \
+  UnsupportedTableEntry(glelementpointerapple) \
+  UnsupportedTableEntry(glelementpointerati) \
+  UnsupportedTableEntry(glenableclientstate) \
+  UnsupportedTableEntry(glenableclientstateiext) \
+  UnsupportedTableEntry(glenableclientstateindexedext) \
+  UnsupportedTableEntry(glenablevariantclientstateext) \
+  UnsupportedTableEntry(glenablevertexarrayext) \
+  UnsupportedTableEntry(glenablevertexattribapple) \
+  UnsupportedTableEntry(glend) \
+  UnsupportedTableEntry(glendconditionalrendernv) \
+  UnsupportedTableEntry(glendconditionalrendernvx) \
+  UnsupportedTableEntry(glendfragmentshaderati) \
+  UnsupportedTableEntry(glendlist) \
+  UnsupportedTableEntry(glendocclusionquerynv) \
+  UnsupportedTableEntry(glendperfmonitoramd) \
+  UnsupportedTableEntry(glendperfqueryintel) \
+  UnsupportedTableEntry(glendtransformfeedbacknv) \
+  UnsupportedTableEntry(glendvertexshaderext) \
+  UnsupportedTableEntry(glendvideocapturenv) \
+  UnsupportedTableEntry(glevalcoord1d) \
+  UnsupportedTableEntry(glevalcoord1dv) \
+  UnsupportedTableEntry(glevalcoord1f) \
+  UnsupportedTableEntry(glevalcoord1fv) \
+  UnsupportedTableEntry(glevalcoord1xoes) \
+  UnsupportedTableEntry(glevalcoord1xvoes) \
+  UnsupportedTableEntry(glevalcoord2d) \
+  UnsupportedTableEntry(glevalcoord2dv) \
+  UnsupportedTableEntry(glevalcoord2f) \
+  UnsupportedTableEntry(glevalcoord2fv) \
+  UnsupportedTableEntry(glevalcoord2xoes) \
+  UnsupportedTableEntry(glevalcoord2xvoes) \
+  UnsupportedTableEntry(glevalmapsnv) \
+  UnsupportedTableEntry(glevalmesh1) \
+  UnsupportedTableEntry(glevalmesh2) \
+  UnsupportedTableEntry(glevalpoint1) \
+  UnsupportedTableEntry(glevalpoint2) \
+  UnsupportedTableEntry(glevaluatedepthvaluesarb) \
+  UnsupportedTableEntry(glexecuteprogramnv) \
+  UnsupportedTableEntry(glextractcomponentext) \
+  UnsupportedTableEntry(glfeedbackbuffer) \
+  UnsupportedTableEntry(glfeedbackbufferxoes) \
+  UnsupportedTableEntry(glfinalcombinerinputnv) \
+  UnsupportedTableEntry(glfinishasyncsgix) \
+  UnsupportedTableEntry(glfinishfenceapple) \
+  UnsupportedTableEntry(glfinishfencenv) \
+  UnsupportedTableEntry(glfinishobjectapple) \
+  UnsupportedTableEntry(glfinishtexturesunx) \
+  UnsupportedTableEntry(glflushmappedbufferrangeapple) \
+  UnsupportedTableEntry(glflushpixeldatarangenv) \
+  UnsupportedTableEntry(glflushrastersgix) \
+  UnsupportedTableEntry(glflushstaticdataibm) \
+  UnsupportedTableEntry(glflushvertexarrayrangeapple) \
+  UnsupportedTableEntry(glflushvertexarrayrangenv) \
+  UnsupportedTableEntry(glfogcoordd) \
+  UnsupportedTableEntry(glfogcoorddext) \
+  UnsupportedTableEntry(glfogcoorddv) \
+  UnsupportedTableEntry(glfogcoorddvext) \
+  UnsupportedTableEntry(glfogcoordf) \
+  UnsupportedTableEntry(glfogcoordfext) \
+  UnsupportedTableEntry(glfogcoordformatnv) \
+  UnsupportedTableEntry(glfogcoordfv) \
+  UnsupportedTableEntry(glfogcoordfvext) \
+  UnsupportedTableEntry(glfogcoordhnv) \
+  UnsupportedTableEntry(glfogcoordhvnv) \
+  UnsupportedTableEntry(glfogcoordpointer) \
+  UnsupportedTableEntry(glfogcoordpointerext) \
+  UnsupportedTableEntry(glfogcoordpointerlistibm) \
+  UnsupportedTableEntry(glfogf) \
+  UnsupportedTableEntry(glfogfuncsgis) \
+  UnsupportedTableEntry(glfogfv) \
+  UnsupportedTableEntry(glfogi) \
+  UnsupportedTableEntry(glfogiv) \
+  UnsupportedTableEntry(glfogxoes) \
+  UnsupportedTableEntry(glfogxvoes) \
+  UnsupportedTableEntry(glfragmentcolormaterialsgix) \
+  UnsupportedTableEntry(glfragmentcoveragecolornv) \
+  UnsupportedTableEntry(glfragmentlightfsgix) \
+  UnsupportedTableEntry(glfragmentlightfvsgix) \
+  UnsupportedTableEntry(glfragmentlightisgix) \
+  UnsupportedTableEntry(glfragmentlightivsgix) \
+  UnsupportedTableEntry(glfragmentlightmodelfsgix) \
+  UnsupportedTableEntry(glfragmentlightmodelfvsgix) \
+  UnsupportedTableEntry(glfragmentlightmodelisgix) \
+  UnsupportedTableEntry(glfragmentlightmodelivsgix) \
+  UnsupportedTableEntry(glfragmentmaterialfsgix) \
+  UnsupportedTableEntry(glfragmentmaterialfvsgix) \
+  UnsupportedTableEntry(glfragmentmaterialisgix) \
+  UnsupportedTableEntry(glfragmentmaterialivsgix) \
+  UnsupportedTableEntry(glframebuffersamplelocationsfvarb) \
+  UnsupportedTableEntry(glframebuffersamplelocationsfvnv) \
+  UnsupportedTableEntry(glframebuffertextureext) \
+  UnsupportedTableEntry(glframebuffertexturefacearb) \
+  UnsupportedTableEntry(glframebuffertexturefaceext) \
+  UnsupportedTableEntry(glframebuffertexturemultiviewovr) \
+  UnsupportedTableEntry(glframezoomsgix) \
+  UnsupportedTableEntry(glfreeobjectbufferati) \
+  UnsupportedTableEntry(glfrustum) \
+  UnsupportedTableEntry(glfrustumfoes) \
+  UnsupportedTableEntry(glfrustumxoes) \
+  UnsupportedTableEntry(glgenasyncmarkerssgix) \
+  UnsupportedTableEntry(glgenfencesapple) \
+  UnsupportedTableEntry(glgenfencesnv) \
+  UnsupportedTableEntry(glgenfragmentshadersati) \
+  UnsupportedTableEntry(glgenlists) \
+  UnsupportedTableEntry(glgennamesamd) \
+  UnsupportedTableEntry(glgenocclusionqueriesnv) \
+  UnsupportedTableEntry(glgenpathsnv) \
+  UnsupportedTableEntry(glgenperfmonitorsamd) \
+  UnsupportedTableEntry(glgenprogramsarb) \
+  UnsupportedTableEntry(glgenprogramsnv) \
+  UnsupportedTableEntry(glgensymbolsext) \
+  UnsupportedTableEntry(glgentexturesext) \
+  UnsupportedTableEntry(glgentransformfeedbacksnv) \
+  UnsupportedTableEntry(glgenvertexarraysapple) \
+  UnsupportedTableEntry(glgenvertexshadersext) \
+  UnsupportedTableEntry(glgetactiveattribarb) \
+  UnsupportedTableEntry(glgetactiveuniformarb) \
+  UnsupportedTableEntry(glgetactivevaryingnv) \
+  UnsupportedTableEntry(glgetarrayobjectfvati) \
+  UnsupportedTableEntry(glgetarrayobjectivati) \
+  UnsupportedTableEntry(glgetattachedobjectsarb) \
+  UnsupportedTableEntry(glgetattriblocationarb) \
+  UnsupportedTableEntry(glgetbufferparameterui64vnv) \
+  UnsupportedTableEntry(glgetclipplane) \
+  UnsupportedTableEntry(glgetclipplanefoes) \
+  UnsupportedTableEntry(glgetclipplanexoes) \
+  UnsupportedTableEntry(glgetcolortable) \
+  UnsupportedTableEntry(glgetcolortableext) \
+  UnsupportedTableEntry(glgetcolortableparameterfv) \
+  UnsupportedTableEntry(glgetcolortableparameterfvext) \
+  UnsupportedTableEntry(glgetcolortableparameterfvsgi) \
+  UnsupportedTableEntry(glgetcolortableparameteriv) \
+  UnsupportedTableEntry(glgetcolortableparameterivext) \
+  UnsupportedTableEntry(glgetcolortableparameterivsgi) \
+  UnsupportedTableEntry(glgetcolortablesgi) \
+  UnsupportedTableEntry(glgetcombinerinputparameterfvnv) \
+  UnsupportedTableEntry(glgetcombinerinputparameterivnv) \
+  UnsupportedTableEntry(glgetcombineroutputparameterfvnv) \
+  UnsupportedTableEntry(glgetcombineroutputparameterivnv) \
+  UnsupportedTableEntry(glgetcombinerstageparameterfvnv) \
+  UnsupportedTableEntry(glgetcommandheadernv) \
+  UnsupportedTableEntry(glgetconvolutionfilter) \
+  UnsupportedTableEntry(glgetconvolutionfilterext) \
+  UnsupportedTableEntry(glgetconvolutionparameterfv) \
+  UnsupportedTableEntry(glgetconvolutionparameterfvext) \
+  UnsupportedTableEntry(glgetconvolutionparameteriv) \
+  UnsupportedTableEntry(glgetconvolutionparameterivext) \
+  UnsupportedTableEntry(glgetconvolutionparameterxvoes) \
+  UnsupportedTableEntry(glgetcoveragemodulationtablenv) \
+  UnsupportedTableEntry(glgetdebugmessagelogamd) \
+  UnsupportedTableEntry(glgetdetailtexfuncsgis) \
+  UnsupportedTableEntry(glgetfenceivnv) \
+  UnsupportedTableEntry(glgetfinalcombinerinputparameterfvnv) \
+  UnsupportedTableEntry(glgetfinalcombinerinputparameterivnv) \
+  UnsupportedTableEntry(glgetfirstperfqueryidintel) \
+  UnsupportedTableEntry(glgetfixedvoes) \
+  UnsupportedTableEntry(glgetfogfuncsgis) \
+  UnsupportedTableEntry(glgetfragmentlightfvsgix) \
+  UnsupportedTableEntry(glgetfragmentlightivsgix) \
+  UnsupportedTableEntry(glgetfragmentmaterialfvsgix) \
+  UnsupportedTableEntry(glgetfragmentmaterialivsgix) \
+  UnsupportedTableEntry(glgethandlearb) \
+  UnsupportedTableEntry(glgethistogram) \
+  UnsupportedTableEntry(glgethistogramext) \
+  UnsupportedTableEntry(glgethistogramparameterfv) \
+  UnsupportedTableEntry(glgethistogramparameterfvext) \
+  UnsupportedTableEntry(glgethistogramparameteriv) \
+  UnsupportedTableEntry(glgethistogramparameterivext) \
+  UnsupportedTableEntry(glgethistogramparameterxvoes) \
+  UnsupportedTableEntry(glgetimagehandlearb) \
+  UnsupportedTableEntry(glgetimagehandlenv) \
+  UnsupportedTableEntry(glgetimagetransformparameterfvhp) \
+  UnsupportedTableEntry(glgetimagetransformparameterivhp) \
+  UnsupportedTableEntry(glgetinfologarb) \
+  UnsupportedTableEntry(glgetinstrumentssgix) \
+  UnsupportedTableEntry(glgetintegerui64i_vnv) \
+  UnsupportedTableEntry(glgetintegerui64vnv) \
+  UnsupportedTableEntry(glgetinternalformatsampleivnv) \
+  UnsupportedTableEntry(glgetinvariantbooleanvext) \
+  UnsupportedTableEntry(glgetinvariantfloatvext) \
+  UnsupportedTableEntry(glgetinvariantintegervext) \
+  UnsupportedTableEntry(glgetlightfv) \
+  UnsupportedTableEntry(glgetlightiv) \
+  UnsupportedTableEntry(glgetlightxoes) \
+  UnsupportedTableEntry(glgetlistparameterfvsgix) \
+  UnsupportedTableEntry(glgetlistparameterivsgix) \
+  UnsupportedTableEntry(glgetlocalconstantbooleanvext) \
+  UnsupportedTableEntry(glgetlocalconstantfloatvext) \
+  UnsupportedTableEntry(glgetlocalconstantintegervext) \
+  UnsupportedTableEntry(glgetmapattribparameterfvnv) \
+  UnsupportedTableEntry(glgetmapattribparameterivnv) \
+  UnsupportedTableEntry(glgetmapcontrolpointsnv) \
+  UnsupportedTableEntry(glgetmapdv) \
+  UnsupportedTableEntry(glgetmapfv) \
+  UnsupportedTableEntry(glgetmapiv) \
+  UnsupportedTableEntry(glgetmapparameterfvnv) \
+  UnsupportedTableEntry(glgetmapparameterivnv) \
+  UnsupportedTableEntry(glgetmapxvoes) \
+  UnsupportedTableEntry(glgetmaterialfv) \
+  UnsupportedTableEntry(glgetmaterialiv) \
+  UnsupportedTableEntry(glgetmaterialxoes) \
+  UnsupportedTableEntry(glgetminmax) \
+  UnsupportedTableEntry(glgetminmaxext) \
+  UnsupportedTableEntry(glgetminmaxparameterfv) \
+  UnsupportedTableEntry(glgetminmaxparameterfvext) \
+  UnsupportedTableEntry(glgetminmaxparameteriv) \
+  UnsupportedTableEntry(glgetminmaxparameterivext) \
+  UnsupportedTableEntry(glgetmultisamplefvnv) \
+  UnsupportedTableEntry(glgetmultitexenvfvext) \
+  UnsupportedTableEntry(glgetmultitexenvivext) \
+  UnsupportedTableEntry(glgetmultitexgendvext) \
+  UnsupportedTableEntry(glgetmultitexgenfvext) \
+  UnsupportedTableEntry(glgetmultitexgenivext) \
+  UnsupportedTableEntry(glgetnamedbufferparameterui64vnv) \
+  UnsupportedTableEntry(glgetnamedprogramlocalparameterdvext) \
+  UnsupportedTableEntry(glgetnamedprogramlocalparameterfvext) \
+  UnsupportedTableEntry(glgetnamedprogramlocalparameteriivext) \
+  UnsupportedTableEntry(glgetnamedprogramlocalparameteriuivext) \
+  UnsupportedTableEntry(glgetnamedprogramstringext) \
+  UnsupportedTableEntry(glgetncolortable) \
+  UnsupportedTableEntry(glgetncolortablearb) \
+  UnsupportedTableEntry(glgetnconvolutionfilter) \
+  UnsupportedTableEntry(glgetnconvolutionfilterarb) \
+  UnsupportedTableEntry(glgetnextperfqueryidintel) \
+  UnsupportedTableEntry(glgetnhistogram) \
+  UnsupportedTableEntry(glgetnhistogramarb) \
+  UnsupportedTableEntry(glgetnmapdv) \
+  UnsupportedTableEntry(glgetnmapdvarb) \
+  UnsupportedTableEntry(glgetnmapfv) \
+  UnsupportedTableEntry(glgetnmapfvarb) \
+  UnsupportedTableEntry(glgetnmapiv) \
+  UnsupportedTableEntry(glgetnmapivarb) \
+  UnsupportedTableEntry(glgetnminmax) \
+  UnsupportedTableEntry(glgetnminmaxarb) \
+  UnsupportedTableEntry(glgetnpixelmapfv) \
+  UnsupportedTableEntry(glgetnpixelmapfvarb) \
+  UnsupportedTableEntry(glgetnpixelmapuiv) \
+  UnsupportedTableEntry(glgetnpixelmapuivarb) \
+  UnsupportedTableEntry(glgetnpixelmapusv) \
+  UnsupportedTableEntry(glgetnpixelmapusvarb) \
+  UnsupportedTableEntry(glgetnpolygonstipple) \
+  UnsupportedTableEntry(glgetnpolygonstipplearb) \
+  UnsupportedTableEntry(glgetnseparablefilter) \
+  UnsupportedTableEntry(glgetnseparablefilterarb) \
+  UnsupportedTableEntry(glgetnuniformi64varb) \
+  UnsupportedTableEntry(glgetnuniformui64varb) \
+  UnsupportedTableEntry(glgetobjectbufferfvati) \
+  UnsupportedTableEntry(glgetobjectbufferivati) \
+  UnsupportedTableEntry(glgetobjectparameterfvarb) \
+  UnsupportedTableEntry(glgetobjectparameterivapple) \
+  UnsupportedTableEntry(glgetobjectparameterivarb) \
+  UnsupportedTableEntry(glgetocclusionqueryivnv) \
+  UnsupportedTableEntry(glgetocclusionqueryuivnv) \
+  UnsupportedTableEntry(glgetpathcolorgenfvnv) \
+  UnsupportedTableEntry(glgetpathcolorgenivnv) \
+  UnsupportedTableEntry(glgetpathcommandsnv) \
+  UnsupportedTableEntry(glgetpathcoordsnv) \
+  UnsupportedTableEntry(glgetpathdasharraynv) \
+  UnsupportedTableEntry(glgetpathlengthnv) \
+  UnsupportedTableEntry(glgetpathmetricrangenv) \
+  UnsupportedTableEntry(glgetpathmetricsnv) \
+  UnsupportedTableEntry(glgetpathparameterfvnv) \
+  UnsupportedTableEntry(glgetpathparameterivnv) \
+  UnsupportedTableEntry(glgetpathspacingnv) \
+  UnsupportedTableEntry(glgetpathtexgenfvnv) \
+  UnsupportedTableEntry(glgetpathtexgenivnv) \
+  UnsupportedTableEntry(glgetperfcounterinfointel) \
+  UnsupportedTableEntry(glgetperfmonitorcounterdataamd) \
+  UnsupportedTableEntry(glgetperfmonitorcounterinfoamd) \
+  UnsupportedTableEntry(glgetperfmonitorcountersamd) \
+  UnsupportedTableEntry(glgetperfmonitorcounterstringamd) \
+  UnsupportedTableEntry(glgetperfmonitorgroupsamd) \
+  UnsupportedTableEntry(glgetperfmonitorgroupstringamd) \
+  UnsupportedTableEntry(glgetperfquerydataintel) \
+  UnsupportedTableEntry(glgetperfqueryidbynameintel) \
+  UnsupportedTableEntry(glgetperfqueryinfointel) \
+  UnsupportedTableEntry(glgetpixelmapfv) \
+  UnsupportedTableEntry(glgetpixelmapuiv) \
+  UnsupportedTableEntry(glgetpixelmapusv) \
+  UnsupportedTableEntry(glgetpixelmapxv) \
+  UnsupportedTableEntry(glgetpixeltexgenparameterfvsgis) \
+  UnsupportedTableEntry(glgetpixeltexgenparameterivsgis) \
+  UnsupportedTableEntry(glgetpixeltransformparameterfvext) \
+  UnsupportedTableEntry(glgetpixeltransformparameterivext) \
+  UnsupportedTableEntry(glgetpointervext) \
+  UnsupportedTableEntry(glgetpolygonstipple) \
+  UnsupportedTableEntry(glgetprogramenvparameterdvarb) \
+  UnsupportedTableEntry(glgetprogramenvparameterfvarb) \
+  UnsupportedTableEntry(glgetprogramenvparameteriivnv) \
+  UnsupportedTableEntry(glgetprogramenvparameteriuivnv) \
+  UnsupportedTableEntry(glgetprogramivarb) \
+  UnsupportedTableEntry(glgetprogramivnv) \
+  UnsupportedTableEntry(glgetprogramlocalparameterdvarb) \
+  UnsupportedTableEntry(glgetprogramlocalparameterfvarb) \
+  UnsupportedTableEntry(glgetprogramlocalparameteriivnv) \
+  UnsupportedTableEntry(glgetprogramlocalparameteriuivnv) \
+  UnsupportedTableEntry(glgetprogramnamedparameterdvnv) \
+  UnsupportedTableEntry(glgetprogramnamedparameterfvnv) \
+  UnsupportedTableEntry(glgetprogramparameterdvnv) \
+  UnsupportedTableEntry(glgetprogramparameterfvnv) \
+  UnsupportedTableEntry(glgetprogramresourcefvnv) \
+  UnsupportedTableEntry(glgetprogramstringarb) \
+  UnsupportedTableEntry(glgetprogramstringnv) \
+  UnsupportedTableEntry(glgetprogramsubroutineparameteruivnv) \
+  UnsupportedTableEntry(glgetseparablefilter) \
+  UnsupportedTableEntry(glgetseparablefilterext) \
+  UnsupportedTableEntry(glgetshadersourcearb) \
+  UnsupportedTableEntry(glgetsharpentexfuncsgis) \
+  UnsupportedTableEntry(glgetstageindexnv) \
+  UnsupportedTableEntry(glgettexbumpparameterfvati) \
+  UnsupportedTableEntry(glgettexbumpparameterivati) \
+  UnsupportedTableEntry(glgettexenvfv) \
+  UnsupportedTableEntry(glgettexenviv) \
+  UnsupportedTableEntry(glgettexenvxvoes) \
+  UnsupportedTableEntry(glgettexfilterfuncsgis) \
+  UnsupportedTableEntry(glgettexgendv) \
+  UnsupportedTableEntry(glgettexgenfv) \
+  UnsupportedTableEntry(glgettexgeniv) \
+  UnsupportedTableEntry(glgettexgenxvoes) \
+  UnsupportedTableEntry(glgettexlevelparameterxvoes) \
+  UnsupportedTableEntry(glgettexparameterpointervapple) \
+  UnsupportedTableEntry(glgettexparameterxvoes) \
+  UnsupportedTableEntry(glgettexturehandlearb) \
+  UnsupportedTableEntry(glgettexturehandlenv) \
+  UnsupportedTableEntry(glgettexturesamplerhandlearb) \
+  UnsupportedTableEntry(glgettexturesamplerhandlenv) \
+  UnsupportedTableEntry(glgettrackmatrixivnv) \
+  UnsupportedTableEntry(glgettransformfeedbackvaryingnv) \
+  UnsupportedTableEntry(glgetuniformbuffersizeext) \
+  UnsupportedTableEntry(glgetuniformfvarb) \
+  UnsupportedTableEntry(glgetuniformi64varb) \
+  UnsupportedTableEntry(glgetuniformi64vnv) \
+  UnsupportedTableEntry(glgetuniformivarb) \
+  UnsupportedTableEntry(glgetuniformlocationarb) \
+  UnsupportedTableEntry(glgetuniformoffsetext) \
+  UnsupportedTableEntry(glgetuniformui64varb) \
+  UnsupportedTableEntry(glgetuniformui64vnv) \
+  UnsupportedTableEntry(glgetvariantarrayobjectfvati) \
+  UnsupportedTableEntry(glgetvariantarrayobjectivati) \
+  UnsupportedTableEntry(glgetvariantbooleanvext) \
+  UnsupportedTableEntry(glgetvariantfloatvext) \
+  UnsupportedTableEntry(glgetvariantintegervext) \
+  UnsupportedTableEntry(glgetvariantpointervext) \
+  UnsupportedTableEntry(glgetvaryinglocationnv) \
+  UnsupportedTableEntry(glgetvertexattribarrayobjectfvati) \
+  UnsupportedTableEntry(glgetvertexattribarrayobjectivati) \
+  UnsupportedTableEntry(glgetvertexattribdvarb) \
+  UnsupportedTableEntry(glgetvertexattribdvnv) \
+  UnsupportedTableEntry(glgetvertexattribfvarb) \
+  UnsupportedTableEntry(glgetvertexattribfvnv) \
+  UnsupportedTableEntry(glgetvertexattribivarb) \
+  UnsupportedTableEntry(glgetvertexattribivnv) \
+  UnsupportedTableEntry(glgetvertexattribli64vnv) \
+  UnsupportedTableEntry(glgetvertexattriblui64varb) \
+  UnsupportedTableEntry(glgetvertexattriblui64vnv) \
+  UnsupportedTableEntry(glgetvertexattribpointervarb) \
+  UnsupportedTableEntry(glgetvertexattribpointervnv) \
+  UnsupportedTableEntry(glgetvideocaptureivnv) \
+  UnsupportedTableEntry(glgetvideocapturestreamdvnv) \
+  UnsupportedTableEntry(glgetvideocapturestreamfvnv) \
+  UnsupportedTableEntry(glgetvideocapturestreamivnv) \
+  UnsupportedTableEntry(glgetvideoi64vnv) \
+  UnsupportedTableEntry(glgetvideoivnv) \
+  UnsupportedTableEntry(glgetvideoui64vnv) \
+  UnsupportedTableEntry(glgetvideouivnv) \
+  UnsupportedTableEntry(glglobalalphafactorbsun) \
+  UnsupportedTableEntry(glglobalalphafactordsun) \
+  UnsupportedTableEntry(glglobalalphafactorfsun) \
+  UnsupportedTableEntry(glglobalalphafactorisun) \
+  UnsupportedTableEntry(glglobalalphafactorssun) \
+  UnsupportedTableEntry(glglobalalphafactorubsun) \
+  UnsupportedTableEntry(glglobalalphafactoruisun) \
+  UnsupportedTableEntry(glglobalalphafactorussun) \
+  UnsupportedTableEntry(glhintpgi) \
+  UnsupportedTableEntry(glhistogram) \
+  UnsupportedTableEntry(glhistogramext) \
+  UnsupportedTableEntry(gligloointerfacesgix) \
+  UnsupportedTableEntry(glimagetransformparameterfhp) \
+  UnsupportedTableEntry(glimagetransformparameterfvhp) \
+  UnsupportedTableEntry(glimagetransformparameterihp) \
+  UnsupportedTableEntry(glimagetransformparameterivhp) \
+  UnsupportedTableEntry(glimportsyncext) \
+  UnsupportedTableEntry(glindexd) \
+  UnsupportedTableEntry(glindexdv) \
+  UnsupportedTableEntry(glindexf) \
+  UnsupportedTableEntry(glindexformatnv) \
+  UnsupportedTableEntry(glindexfuncext) \
+  UnsupportedTableEntry(glindexfv) \
+  UnsupportedTableEntry(glindexi) \
+  UnsupportedTableEntry(glindexiv) \
+  UnsupportedTableEntry(glindexmask) \
+  UnsupportedTableEntry(glindexmaterialext) \
+  UnsupportedTableEntry(glindexpointer) \
+  UnsupportedTableEntry(glindexpointerext) \
+  UnsupportedTableEntry(glindexpointerlistibm) \
+  UnsupportedTableEntry(glindexs) \
+  UnsupportedTableEntry(glindexsv) \
+  UnsupportedTableEntry(glindexub) \
+  UnsupportedTableEntry(glindexubv) \
+  UnsupportedTableEntry(glindexxoes) \
+  UnsupportedTableEntry(glindexxvoes) \
+  UnsupportedTableEntry(glinitnames) \
+  UnsupportedTableEntry(glinsertcomponentext) \
+  UnsupportedTableEntry(glinstrumentsbuffersgix) \
+  UnsupportedTableEntry(glinterleavedarrays) \
+  UnsupportedTableEntry(glinterpolatepathsnv) \
+  UnsupportedTableEntry(glisasyncmarkersgix) \
+  UnsupportedTableEntry(glisbufferresidentnv) \
+  UnsupportedTableEntry(gliscommandlistnv) \
+  UnsupportedTableEntry(glisfenceapple) \
+  UnsupportedTableEntry(glisfencenv) \
+  UnsupportedTableEntry(glisimagehandleresidentarb) \
+  UnsupportedTableEntry(glisimagehandleresidentnv) \
+  UnsupportedTableEntry(glislist) \
+  UnsupportedTableEntry(glisnameamd) \
+  UnsupportedTableEntry(glisnamedbufferresidentnv) \
+  UnsupportedTableEntry(glisobjectbufferati) \
+  UnsupportedTableEntry(glisocclusionquerynv) \
+  UnsupportedTableEntry(glispathnv) \
+  UnsupportedTableEntry(glispointinfillpathnv) \
+  UnsupportedTableEntry(glispointinstrokepathnv) \
+  UnsupportedTableEntry(glisprogramarb) \
+  UnsupportedTableEntry(glisprogramnv) \
+  UnsupportedTableEntry(glisstatenv) \
+  UnsupportedTableEntry(glistextureext) \
+  UnsupportedTableEntry(glistexturehandleresidentarb) \
+  UnsupportedTableEntry(glistexturehandleresidentnv) \
+  UnsupportedTableEntry(glistransformfeedbacknv) \
+  UnsupportedTableEntry(glisvariantenabledext) \
+  UnsupportedTableEntry(glisvertexarrayapple) \
+  UnsupportedTableEntry(glisvertexattribenabledapple) \
+  UnsupportedTableEntry(gllightenvisgix) \
+  UnsupportedTableEntry(gllightf) \
+  UnsupportedTableEntry(gllightfv) \
+  UnsupportedTableEntry(gllighti) \
+  UnsupportedTableEntry(gllightiv) \
+  UnsupportedTableEntry(gllightmodelf) \
+  UnsupportedTableEntry(gllightmodelfv) \
+  UnsupportedTableEntry(gllightmodeli) \
+  UnsupportedTableEntry(gllightmodeliv) \
+  UnsupportedTableEntry(gllightmodelxoes) \
+  UnsupportedTableEntry(gllightmodelxvoes) \
+  UnsupportedTableEntry(gllightxoes) \
+  UnsupportedTableEntry(gllightxvoes) \
+  UnsupportedTableEntry(gllinestipple) \
+  UnsupportedTableEntry(gllinewidthxoes) \
+  UnsupportedTableEntry(gllinkprogramarb) \
+  UnsupportedTableEntry(gllistbase) \
+  UnsupportedTableEntry(gllistdrawcommandsstatesclientnv) \
+  UnsupportedTableEntry(gllistparameterfsgix) \
+  UnsupportedTableEntry(gllistparameterfvsgix) \
+  UnsupportedTableEntry(gllistparameterisgix) \
+  UnsupportedTableEntry(gllistparameterivsgix) \
+  UnsupportedTableEntry(glloadidentity) \
+  UnsupportedTableEntry(glloadidentitydeformationmapsgix) \
+  UnsupportedTableEntry(glloadmatrixd) \
+  UnsupportedTableEntry(glloadmatrixf) \
+  UnsupportedTableEntry(glloadmatrixxoes) \
+  UnsupportedTableEntry(glloadname) \
+  UnsupportedTableEntry(glloadprogramnv) \
+  UnsupportedTableEntry(glloadtransposematrixd) \
+  UnsupportedTableEntry(glloadtransposematrixdarb) \
+  UnsupportedTableEntry(glloadtransposematrixf) \
+  UnsupportedTableEntry(glloadtransposematrixfarb) \
+  UnsupportedTableEntry(glloadtransposematrixxoes) \
+  UnsupportedTableEntry(gllockarraysext) \
+  UnsupportedTableEntry(glmakebuffernonresidentnv) \
+  UnsupportedTableEntry(glmakebufferresidentnv) \
+  UnsupportedTableEntry(glmakeimagehandlenonresidentarb) \
+  UnsupportedTableEntry(glmakeimagehandlenonresidentnv) \
+  UnsupportedTableEntry(glmakeimagehandleresidentarb) \
+  UnsupportedTableEntry(glmakeimagehandleresidentnv) \
+  UnsupportedTableEntry(glmakenamedbuffernonresidentnv) \
+  UnsupportedTableEntry(glmakenamedbufferresidentnv) \
+  UnsupportedTableEntry(glmaketexturehandlenonresidentarb) \
+  UnsupportedTableEntry(glmaketexturehandlenonresidentnv) \
+  UnsupportedTableEntry(glmaketexturehandleresidentarb) \
+  UnsupportedTableEntry(glmaketexturehandleresidentnv) \
+  UnsupportedTableEntry(glmap1d) \
+  UnsupportedTableEntry(glmap1f) \
+  UnsupportedTableEntry(glmap1xoes) \
+  UnsupportedTableEntry(glmap2d) \
+  UnsupportedTableEntry(glmap2f) \
+  UnsupportedTableEntry(glmap2xoes) \
+  UnsupportedTableEntry(glmapcontrolpointsnv) \
+  UnsupportedTableEntry(glmapgrid1d) \
+  UnsupportedTableEntry(glmapgrid1f) \
+  UnsupportedTableEntry(glmapgrid1xoes) \
+  UnsupportedTableEntry(glmapgrid2d) \
+  UnsupportedTableEntry(glmapgrid2f) \
+  UnsupportedTableEntry(glmapgrid2xoes) \
+  UnsupportedTableEntry(glmapobjectbufferati) \
+  UnsupportedTableEntry(glmapparameterfvnv) \
+  UnsupportedTableEntry(glmapparameterivnv) \
+  UnsupportedTableEntry(glmaptexture2dintel) \
+  UnsupportedTableEntry(glmapvertexattrib1dapple) \
+  UnsupportedTableEntry(glmapvertexattrib1fapple) \
+  UnsupportedTableEntry(glmapvertexattrib2dapple) \
+  UnsupportedTableEntry(glmapvertexattrib2fapple) \
+  UnsupportedTableEntry(glmaterialf) \
+  UnsupportedTableEntry(glmaterialfv) \
+  UnsupportedTableEntry(glmateriali) \
+  UnsupportedTableEntry(glmaterialiv) \
+  UnsupportedTableEntry(glmaterialxoes) \
+  UnsupportedTableEntry(glmaterialxvoes) \
+  UnsupportedTableEntry(glmatrixfrustumext) \
+  UnsupportedTableEntry(glmatrixindexpointerarb) \
+  UnsupportedTableEntry(glmatrixindexubvarb) \
+  UnsupportedTableEntry(glmatrixindexuivarb) \
+  UnsupportedTableEntry(glmatrixindexusvarb) \
+  UnsupportedTableEntry(glmatrixload3x2fnv) \
+  UnsupportedTableEntry(glmatrixload3x3fnv) \
+  UnsupportedTableEntry(glmatrixloaddext) \
+  UnsupportedTableEntry(glmatrixloadfext) \
+  UnsupportedTableEntry(glmatrixloadidentityext) \
+  UnsupportedTableEntry(glmatrixloadtranspose3x3fnv) \
+  UnsupportedTableEntry(glmatrixloadtransposedext) \
+  UnsupportedTableEntry(glmatrixloadtransposefext) \
+  UnsupportedTableEntry(glmatrixmode) \
+  UnsupportedTableEntry(glmatrixmult3x2fnv) \
+  UnsupportedTableEntry(glmatrixmult3x3fnv) \
+  UnsupportedTableEntry(glmatrixmultdext) \
+  UnsupportedTableEntry(glmatrixmultfext) \
+  UnsupportedTableEntry(glmatrixmulttranspose3x3fnv) \
+  UnsupportedTableEntry(glmatrixmulttransposedext) \
+  UnsupportedTableEntry(glmatrixmulttransposefext) \
+  UnsupportedTableEntry(glmatrixorthoext) \
+  UnsupportedTableEntry(glmatrixpopext) \
+  UnsupportedTableEntry(glmatrixpushext) \
+  UnsupportedTableEntry(glmatrixrotatedext) \
+  UnsupportedTableEntry(glmatrixrotatefext) \
+  UnsupportedTableEntry(glmatrixscaledext) \
+  UnsupportedTableEntry(glmatrixscalefext) \
+  UnsupportedTableEntry(glmatrixtranslatedext) \
+  UnsupportedTableEntry(glmatrixtranslatefext) \
+  UnsupportedTableEntry(glmaxshadercompilerthreadsarb) \
+  UnsupportedTableEntry(glminmax) \
+  UnsupportedTableEntry(glminmaxext) \
+  UnsupportedTableEntry(glmultidrawarraysindirectamd) \
+  UnsupportedTableEntry(glmultidrawarraysindirectbindlesscountnv) \
+  UnsupportedTableEntry(glmultidrawarraysindirectbindlessnv) \
+  UnsupportedTableEntry(glmultidrawelementarrayapple) \
+  UnsupportedTableEntry(glmultidrawelementsext) \
+  UnsupportedTableEntry(glmultidrawelementsindirectamd) \
+  UnsupportedTableEntry(glmultidrawelementsindirectbindlesscountnv) \
+  UnsupportedTableEntry(glmultidrawelementsindirectbindlessnv) \
+  UnsupportedTableEntry(glmultidrawrangeelementarrayapple) \
+  UnsupportedTableEntry(glmultimodedrawarraysibm) \
+  UnsupportedTableEntry(glmultimodedrawelementsibm) \
+  UnsupportedTableEntry(glmultitexcoord1boes) \
+  UnsupportedTableEntry(glmultitexcoord1bvoes) \
+  UnsupportedTableEntry(glmultitexcoord1d) \
+  UnsupportedTableEntry(glmultitexcoord1darb) \
+  UnsupportedTableEntry(glmultitexcoord1dv) \
+  UnsupportedTableEntry(glmultitexcoord1dvarb) \
+  UnsupportedTableEntry(glmultitexcoord1f) \
+  UnsupportedTableEntry(glmultitexcoord1farb) \
+  UnsupportedTableEntry(glmultitexcoord1fv) \
+  UnsupportedTableEntry(glmultitexcoord1fvarb) \
+  UnsupportedTableEntry(glmultitexcoord1hnv) \
+  UnsupportedTableEntry(glmultitexcoord1hvnv) \
+  UnsupportedTableEntry(glmultitexcoord1i) \
+  UnsupportedTableEntry(glmultitexcoord1iarb) \
+  UnsupportedTableEntry(glmultitexcoord1iv) \
+  UnsupportedTableEntry(glmultitexcoord1ivarb) \
+  UnsupportedTableEntry(glmultitexcoord1s) \
+  UnsupportedTableEntry(glmultitexcoord1sarb) \
+  UnsupportedTableEntry(glmultitexcoord1sv) \
+  UnsupportedTableEntry(glmultitexcoord1svarb) \
+  UnsupportedTableEntry(glmultitexcoord1xoes) \
+  UnsupportedTableEntry(glmultitexcoord1xvoes) \
+  UnsupportedTableEntry(glmultitexcoord2boes) \
+  UnsupportedTableEntry(glmultitexcoord2bvoes) \
+  UnsupportedTableEntry(glmultitexcoord2d) \
+  UnsupportedTableEntry(glmultitexcoord2darb) \
+  UnsupportedTableEntry(glmultitexcoord2dv) \
+  UnsupportedTableEntry(glmultitexcoord2dvarb) \
+  UnsupportedTableEntry(glmultitexcoord2f) \
+  UnsupportedTableEntry(glmultitexcoord2farb) \
+  UnsupportedTableEntry(glmultitexcoord2fv) \
+  UnsupportedTableEntry(glmultitexcoord2fvarb) \
+  UnsupportedTableEntry(glmultitexcoord2hnv) \
+  UnsupportedTableEntry(glmultitexcoord2hvnv) \
+  UnsupportedTableEntry(glmultitexcoord2i) \
+  UnsupportedTableEntry(glmultitexcoord2iarb) \
+  UnsupportedTableEntry(glmultitexcoord2iv) \
+  UnsupportedTableEntry(glmultitexcoord2ivarb) \
+  UnsupportedTableEntry(glmultitexcoord2s) \
+  UnsupportedTableEntry(glmultitexcoord2sarb) \
+  UnsupportedTableEntry(glmultitexcoord2sv) \
+  UnsupportedTableEntry(glmultitexcoord2svarb) \
+  UnsupportedTableEntry(glmultitexcoord2xoes) \
+  UnsupportedTableEntry(glmultitexcoord2xvoes) \
+  UnsupportedTableEntry(glmultitexcoord3boes) \
+  UnsupportedTableEntry(glmultitexcoord3bvoes) \
+  UnsupportedTableEntry(glmultitexcoord3d) \
+  UnsupportedTableEntry(glmultitexcoord3darb) \
+  UnsupportedTableEntry(glmultitexcoord3dv) \
+  UnsupportedTableEntry(glmultitexcoord3dvarb) \
+  UnsupportedTableEntry(glmultitexcoord3f) \
+  UnsupportedTableEntry(glmultitexcoord3farb) \
+  UnsupportedTableEntry(glmultitexcoord3fv) \
+  UnsupportedTableEntry(glmultitexcoord3fvarb) \
+  UnsupportedTableEntry(glmultitexcoord3hnv) \
+  UnsupportedTableEntry(glmultitexcoord3hvnv) \
+  UnsupportedTableEntry(glmultitexcoord3i) \
+  UnsupportedTableEntry(glmultitexcoord3iarb) \
+  UnsupportedTableEntry(glmultitexcoord3iv) \
+  UnsupportedTableEntry(glmultitexcoord3ivarb) \
+  UnsupportedTableEntry(glmultitexcoord3s) \
+  UnsupportedTableEntry(glmultitexcoord3sarb) \
+  UnsupportedTableEntry(glmultitexcoord3sv) \
+  UnsupportedTableEntry(glmultitexcoord3svarb) \
+  UnsupportedTableEntry(glmultitexcoord3xoes) \
+  UnsupportedTableEntry(glmultitexcoord3xvoes) \
+  UnsupportedTableEntry(glmultitexcoord4boes) \
+  UnsupportedTableEntry(glmultitexcoord4bvoes) \
+  UnsupportedTableEntry(glmultitexcoord4d) \
+  UnsupportedTableEntry(glmultitexcoord4darb) \
+  UnsupportedTableEntry(glmultitexcoord4dv) \
+  UnsupportedTableEntry(glmultitexcoord4dvarb) \
+  UnsupportedTableEntry(glmultitexcoord4f) \
+  UnsupportedTableEntry(glmultitexcoord4farb) \
+  UnsupportedTableEntry(glmultitexcoord4fv) \
+  UnsupportedTableEntry(glmultitexcoord4fvarb) \
+  UnsupportedTableEntry(glmultitexcoord4hnv) \
+  UnsupportedTableEntry(glmultitexcoord4hvnv) \
+  UnsupportedTableEntry(glmultitexcoord4i) \
+  UnsupportedTableEntry(glmultitexcoord4iarb) \
+  UnsupportedTableEntry(glmultitexcoord4iv) \
+  UnsupportedTableEntry(glmultitexcoord4ivarb) \
+  UnsupportedTableEntry(glmultitexcoord4s) \
+  UnsupportedTableEntry(glmultitexcoord4sarb) \
+  UnsupportedTableEntry(glmultitexcoord4sv) \
+  UnsupportedTableEntry(glmultitexcoord4svarb) \
+  UnsupportedTableEntry(glmultitexcoord4xoes) \
+  UnsupportedTableEntry(glmultitexcoord4xvoes) \
+  UnsupportedTableEntry(glmultitexcoordp1ui) \
+  UnsupportedTableEntry(glmultitexcoordp1uiv) \
+  UnsupportedTableEntry(glmultitexcoordp2ui) \
+  UnsupportedTableEntry(glmultitexcoordp2uiv) \
+  UnsupportedTableEntry(glmultitexcoordp3ui) \
+  UnsupportedTableEntry(glmultitexcoordp3uiv) \
+  UnsupportedTableEntry(glmultitexcoordp4ui) \
+  UnsupportedTableEntry(glmultitexcoordp4uiv) \
+  UnsupportedTableEntry(glmultitexcoordpointerext) \
+  UnsupportedTableEntry(glmultitexenvfext) \
+  UnsupportedTableEntry(glmultitexenvfvext) \
+  UnsupportedTableEntry(glmultitexenviext) \
+  UnsupportedTableEntry(glmultitexenvivext) \
+  UnsupportedTableEntry(glmultitexgendext) \
+  UnsupportedTableEntry(glmultitexgendvext) \
+  UnsupportedTableEntry(glmultitexgenfext) \
+  UnsupportedTableEntry(glmultitexgenfvext) \
+  UnsupportedTableEntry(glmultitexgeniext) \
+  UnsupportedTableEntry(glmultitexgenivext) \
+  UnsupportedTableEntry(glmultitexrenderbufferext) \
+  UnsupportedTableEntry(glmultmatrixd) \
+  UnsupportedTableEntry(glmultmatrixf) \
+  UnsupportedTableEntry(glmultmatrixxoes) \
+  UnsupportedTableEntry(glmulttransposematrixd) \
+  UnsupportedTableEntry(glmulttransposematrixdarb) \
+  UnsupportedTableEntry(glmulttransposematrixf) \
+  UnsupportedTableEntry(glmulttransposematrixfarb) \
+  UnsupportedTableEntry(glmulttransposematrixxoes) \
+  UnsupportedTableEntry(glnamedbufferpagecommitmentarb) \
+  UnsupportedTableEntry(glnamedbufferpagecommitmentext) \
+  UnsupportedTableEntry(glnamedframebuffersamplelocationsfvarb) \
+  UnsupportedTableEntry(glnamedframebuffersamplelocationsfvnv) \
+  UnsupportedTableEntry(glnamedframebuffertexturefaceext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameter4dext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameter4dvext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameter4fext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameter4fvext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameteri4iext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameteri4ivext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameteri4uiext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameteri4uivext) \
+  UnsupportedTableEntry(glnamedprogramlocalparameters4fvext) \
+  UnsupportedTableEntry(glnamedprogramlocalparametersi4ivext) \
+  UnsupportedTableEntry(glnamedprogramlocalparametersi4uivext) \
+  UnsupportedTableEntry(glnamedprogramstringext) \
+  UnsupportedTableEntry(glnamedrenderbufferstoragemultisamplecoverageext) \
+  UnsupportedTableEntry(glnewlist) \
+  UnsupportedTableEntry(glnewobjectbufferati) \
+  UnsupportedTableEntry(glnormal3b) \
+  UnsupportedTableEntry(glnormal3bv) \
+  UnsupportedTableEntry(glnormal3d) \
+  UnsupportedTableEntry(glnormal3dv) \
+  UnsupportedTableEntry(glnormal3f) \
+  UnsupportedTableEntry(glnormal3fv) \
+  UnsupportedTableEntry(glnormal3fvertex3fsun) \
+  UnsupportedTableEntry(glnormal3fvertex3fvsun) \
+  UnsupportedTableEntry(glnormal3hnv) \
+  UnsupportedTableEntry(glnormal3hvnv) \
+  UnsupportedTableEntry(glnormal3i) \
+  UnsupportedTableEntry(glnormal3iv) \
+  UnsupportedTableEntry(glnormal3s) \
+  UnsupportedTableEntry(glnormal3sv) \
+  UnsupportedTableEntry(glnormal3xoes) \
+  UnsupportedTableEntry(glnormal3xvoes) \
+  UnsupportedTableEntry(glnormalformatnv) \
+  UnsupportedTableEntry(glnormalp3ui) \
+  UnsupportedTableEntry(glnormalp3uiv) \
+  UnsupportedTableEntry(glnormalpointer) \
+  UnsupportedTableEntry(glnormalpointerext) \
+  UnsupportedTableEntry(glnormalpointerlistibm) \
+  UnsupportedTableEntry(glnormalpointervintel) \
+  UnsupportedTableEntry(glnormalstream3bati) \
+  UnsupportedTableEntry(glnormalstream3bvati) \
+  UnsupportedTableEntry(glnormalstream3dati) \
+  UnsupportedTableEntry(glnormalstream3dvati) \
+  UnsupportedTableEntry(glnormalstream3fati) \
+  UnsupportedTableEntry(glnormalstream3fvati) \
+  UnsupportedTableEntry(glnormalstream3iati) \
+  UnsupportedTableEntry(glnormalstream3ivati) \
+  UnsupportedTableEntry(glnormalstream3sati) \
+  UnsupportedTableEntry(glnormalstream3svati) \
+  UnsupportedTableEntry(globjectpurgeableapple) \
+  UnsupportedTableEntry(globjectunpurgeableapple) \
+  UnsupportedTableEntry(glortho) \
+  UnsupportedTableEntry(glorthofoes) \
+  UnsupportedTableEntry(glorthoxoes) \
+  UnsupportedTableEntry(glpasstexcoordati) \
+  UnsupportedTableEntry(glpassthrough) \
+  UnsupportedTableEntry(glpassthroughxoes) \
+  UnsupportedTableEntry(glpathcolorgennv) \
+  UnsupportedTableEntry(glpathcommandsnv) \
+  UnsupportedTableEntry(glpathcoordsnv) \
+  UnsupportedTableEntry(glpathcoverdepthfuncnv) \
+  UnsupportedTableEntry(glpathdasharraynv) \
+  UnsupportedTableEntry(glpathfoggennv) \
+  UnsupportedTableEntry(glpathglyphindexarraynv) \
+  UnsupportedTableEntry(glpathglyphindexrangenv) \
+  UnsupportedTableEntry(glpathglyphrangenv) \
+  UnsupportedTableEntry(glpathglyphsnv) \
+  UnsupportedTableEntry(glpathmemoryglyphindexarraynv) \
+  UnsupportedTableEntry(glpathparameterfnv) \
+  UnsupportedTableEntry(glpathparameterfvnv) \
+  UnsupportedTableEntry(glpathparameterinv) \
+  UnsupportedTableEntry(glpathparameterivnv) \
+  UnsupportedTableEntry(glpathstencildepthoffsetnv) \
+  UnsupportedTableEntry(glpathstencilfuncnv) \
+  UnsupportedTableEntry(glpathstringnv) \
+  UnsupportedTableEntry(glpathsubcommandsnv) \
+  UnsupportedTableEntry(glpathsubcoordsnv) \
+  UnsupportedTableEntry(glpathtexgennv) \
+  UnsupportedTableEntry(glpausetransformfeedbacknv) \
+  UnsupportedTableEntry(glpixeldatarangenv) \
+  UnsupportedTableEntry(glpixelmapfv) \
+  UnsupportedTableEntry(glpixelmapuiv) \
+  UnsupportedTableEntry(glpixelmapusv) \
+  UnsupportedTableEntry(glpixelmapx) \
+  UnsupportedTableEntry(glpixelstorex) \
+  UnsupportedTableEntry(glpixeltexgenparameterfsgis) \
+  UnsupportedTableEntry(glpixeltexgenparameterfvsgis) \
+  UnsupportedTableEntry(glpixeltexgenparameterisgis) \
+  UnsupportedTableEntry(glpixeltexgenparameterivsgis) \
+  UnsupportedTableEntry(glpixeltexgensgix) \
+  UnsupportedTableEntry(glpixeltransferf) \
+  UnsupportedTableEntry(glpixeltransferi) \
+  UnsupportedTableEntry(glpixeltransferxoes) \
+  UnsupportedTableEntry(glpixeltransformparameterfext) \
+  UnsupportedTableEntry(glpixeltransformparameterfvext) \
+  UnsupportedTableEntry(glpixeltransformparameteriext) \
+  UnsupportedTableEntry(glpixeltransformparameterivext) \
+  UnsupportedTableEntry(glpixelzoom) \
+  UnsupportedTableEntry(glpixelzoomxoes) \
+  UnsupportedTableEntry(glpntrianglesfati) \
+  UnsupportedTableEntry(glpntrianglesiati) \
+  UnsupportedTableEntry(glpointalongpathnv) \
+  UnsupportedTableEntry(glpointparameterfsgis) \
+  UnsupportedTableEntry(glpointparameterfvsgis) \
+  UnsupportedTableEntry(glpointparameterinv) \
+  UnsupportedTableEntry(glpointparameterivnv) \
+  UnsupportedTableEntry(glpointparameterxvoes) \
+  UnsupportedTableEntry(glpointsizexoes) \
+  UnsupportedTableEntry(glpollasyncsgix) \
+  UnsupportedTableEntry(glpollinstrumentssgix) \
+  UnsupportedTableEntry(glpolygonoffsetext) \
+  UnsupportedTableEntry(glpolygonoffsetxoes) \
+  UnsupportedTableEntry(glpolygonstipple) \
+  UnsupportedTableEntry(glpopattrib) \
+  UnsupportedTableEntry(glpopclientattrib) \
+  UnsupportedTableEntry(glpopmatrix) \
+  UnsupportedTableEntry(glpopname) \
+  UnsupportedTableEntry(glpresentframedualfillnv) \
+  UnsupportedTableEntry(glpresentframekeyednv) \
+  UnsupportedTableEntry(glprimitiveboundingboxarb) \
+  UnsupportedTableEntry(glprimitiverestartindexnv) \
+  UnsupportedTableEntry(glprimitiverestartnv) \
+  UnsupportedTableEntry(glprioritizetextures) \
+  UnsupportedTableEntry(glprioritizetexturesext) \
+  UnsupportedTableEntry(glprioritizetexturesxoes) \
+  UnsupportedTableEntry(glprogrambufferparametersfvnv) \
+  UnsupportedTableEntry(glprogrambufferparametersiivnv) \
+  UnsupportedTableEntry(glprogrambufferparametersiuivnv) \
+  UnsupportedTableEntry(glprogramenvparameter4darb) \
+  UnsupportedTableEntry(glprogramenvparameter4dvarb) \
+  UnsupportedTableEntry(glprogramenvparameter4farb) \
+  UnsupportedTableEntry(glprogramenvparameter4fvarb) \
+  UnsupportedTableEntry(glprogramenvparameteri4inv) \
+  UnsupportedTableEntry(glprogramenvparameteri4ivnv) \
+  UnsupportedTableEntry(glprogramenvparameteri4uinv) \
+  UnsupportedTableEntry(glprogramenvparameteri4uivnv) \
+  UnsupportedTableEntry(glprogramenvparameters4fvext) \
+  UnsupportedTableEntry(glprogramenvparametersi4ivnv) \
+  UnsupportedTableEntry(glprogramenvparametersi4uivnv) \
+  UnsupportedTableEntry(glprogramlocalparameter4darb) \
+  UnsupportedTableEntry(glprogramlocalparameter4dvarb) \
+  UnsupportedTableEntry(glprogramlocalparameter4farb) \
+  UnsupportedTableEntry(glprogramlocalparameter4fvarb) \
+  UnsupportedTableEntry(glprogramlocalparameteri4inv) \
+  UnsupportedTableEntry(glprogramlocalparameteri4ivnv) \
+  UnsupportedTableEntry(glprogramlocalparameteri4uinv) \
+  UnsupportedTableEntry(glprogramlocalparameteri4uivnv) \
+  UnsupportedTableEntry(glprogramlocalparameters4fvext) \
+  UnsupportedTableEntry(glprogramlocalparametersi4ivnv) \
+  UnsupportedTableEntry(glprogramlocalparametersi4uivnv) \
+  UnsupportedTableEntry(glprogramnamedparameter4dnv) \
+  UnsupportedTableEntry(glprogramnamedparameter4dvnv) \
+  UnsupportedTableEntry(glprogramnamedparameter4fnv) \
+  UnsupportedTableEntry(glprogramnamedparameter4fvnv) \
+  UnsupportedTableEntry(glprogramparameter4dnv) \
+  UnsupportedTableEntry(glprogramparameter4dvnv) \
+  UnsupportedTableEntry(glprogramparameter4fnv) \
+  UnsupportedTableEntry(glprogramparameter4fvnv) \
+  UnsupportedTableEntry(glprogramparameteriext) \
+  UnsupportedTableEntry(glprogramparameters4dvnv) \
+  UnsupportedTableEntry(glprogramparameters4fvnv) \
+  UnsupportedTableEntry(glprogrampathfragmentinputgennv) \
+  UnsupportedTableEntry(glprogramstringarb) \
+  UnsupportedTableEntry(glprogramsubroutineparametersuivnv) \
+  UnsupportedTableEntry(glprogramuniform1i64arb) \
+  UnsupportedTableEntry(glprogramuniform1i64nv) \
+  UnsupportedTableEntry(glprogramuniform1i64varb) \
+  UnsupportedTableEntry(glprogramuniform1i64vnv) \
+  UnsupportedTableEntry(glprogramuniform1ui64arb) \
+  UnsupportedTableEntry(glprogramuniform1ui64nv) \
+  UnsupportedTableEntry(glprogramuniform1ui64varb) \
+  UnsupportedTableEntry(glprogramuniform1ui64vnv) \
+  UnsupportedTableEntry(glprogramuniform2i64arb) \
+  UnsupportedTableEntry(glprogramuniform2i64nv) \
+  UnsupportedTableEntry(glprogramuniform2i64varb) \
+  UnsupportedTableEntry(glprogramuniform2i64vnv) \
+  UnsupportedTableEntry(glprogramuniform2ui64arb) \
+  UnsupportedTableEntry(glprogramuniform2ui64nv) \
+  UnsupportedTableEntry(glprogramuniform2ui64varb) \
+  UnsupportedTableEntry(glprogramuniform2ui64vnv) \
+  UnsupportedTableEntry(glprogramuniform3i64arb) \
+  UnsupportedTableEntry(glprogramuniform3i64nv) \
+  UnsupportedTableEntry(glprogramuniform3i64varb) \
+  UnsupportedTableEntry(glprogramuniform3i64vnv) \
+  UnsupportedTableEntry(glprogramuniform3ui64arb) \
+  UnsupportedTableEntry(glprogramuniform3ui64nv) \
+  UnsupportedTableEntry(glprogramuniform3ui64varb) \
+  UnsupportedTableEntry(glprogramuniform3ui64vnv) \
+  UnsupportedTableEntry(glprogramuniform4i64arb) \
+  UnsupportedTableEntry(glprogramuniform4i64nv) \
+  UnsupportedTableEntry(glprogramuniform4i64varb) \
+  UnsupportedTableEntry(glprogramuniform4i64vnv) \
+  UnsupportedTableEntry(glprogramuniform4ui64arb) \
+  UnsupportedTableEntry(glprogramuniform4ui64nv) \
+  UnsupportedTableEntry(glprogramuniform4ui64varb) \
+  UnsupportedTableEntry(glprogramuniform4ui64vnv) \
+  UnsupportedTableEntry(glprogramuniformhandleui64arb) \
+  UnsupportedTableEntry(glprogramuniformhandleui64nv) \
+  UnsupportedTableEntry(glprogramuniformhandleui64varb) \
+  UnsupportedTableEntry(glprogramuniformhandleui64vnv) \
+  UnsupportedTableEntry(glprogramuniformui64nv) \
+  UnsupportedTableEntry(glprogramuniformui64vnv) \
+  UnsupportedTableEntry(glprogramvertexlimitnv) \
+  UnsupportedTableEntry(glpushattrib) \
+  UnsupportedTableEntry(glpushclientattrib) \
+  UnsupportedTableEntry(glpushclientattribdefaultext) \
+  UnsupportedTableEntry(glpushmatrix) \
+  UnsupportedTableEntry(glpushname) \
+  UnsupportedTableEntry(glquerymatrixxoes) \
+  UnsupportedTableEntry(glqueryobjectparameteruiamd) \
+  UnsupportedTableEntry(glrasterpos2d) \
+  UnsupportedTableEntry(glrasterpos2dv) \
+  UnsupportedTableEntry(glrasterpos2f) \
+  UnsupportedTableEntry(glrasterpos2fv) \
+  UnsupportedTableEntry(glrasterpos2i) \
+  UnsupportedTableEntry(glrasterpos2iv) \
+  UnsupportedTableEntry(glrasterpos2s) \
+  UnsupportedTableEntry(glrasterpos2sv) \
+  UnsupportedTableEntry(glrasterpos2xoes) \
+  UnsupportedTableEntry(glrasterpos2xvoes) \
+  UnsupportedTableEntry(glrasterpos3d) \
+  UnsupportedTableEntry(glrasterpos3dv) \
+  UnsupportedTableEntry(glrasterpos3f) \
+  UnsupportedTableEntry(glrasterpos3fv) \
+  UnsupportedTableEntry(glrasterpos3i) \
+  UnsupportedTableEntry(glrasterpos3iv) \
+  UnsupportedTableEntry(glrasterpos3s) \
+  UnsupportedTableEntry(glrasterpos3sv) \
+  UnsupportedTableEntry(glrasterpos3xoes) \
+  UnsupportedTableEntry(glrasterpos3xvoes) \
+  UnsupportedTableEntry(glrasterpos4d) \
+  UnsupportedTableEntry(glrasterpos4dv) \
+  UnsupportedTableEntry(glrasterpos4f) \
+  UnsupportedTableEntry(glrasterpos4fv) \
+  UnsupportedTableEntry(glrasterpos4i) \
+  UnsupportedTableEntry(glrasterpos4iv) \
+  UnsupportedTableEntry(glrasterpos4s) \
+  UnsupportedTableEntry(glrasterpos4sv) \
+  UnsupportedTableEntry(glrasterpos4xoes) \
+  UnsupportedTableEntry(glrasterpos4xvoes) \
+  UnsupportedTableEntry(glreadinstrumentssgix) \
+  UnsupportedTableEntry(glrectd) \
+  UnsupportedTableEntry(glrectdv) \
+  UnsupportedTableEntry(glrectf) \
+  UnsupportedTableEntry(glrectfv) \
+  UnsupportedTableEntry(glrecti) \
+  UnsupportedTableEntry(glrectiv) \
+  UnsupportedTableEntry(glrects) \
+  UnsupportedTableEntry(glrectsv) \
+  UnsupportedTableEntry(glrectxoes) \
+  UnsupportedTableEntry(glrectxvoes) \
+  UnsupportedTableEntry(glreferenceplanesgix) \
+  UnsupportedTableEntry(glrenderbufferstoragemultisamplecoveragenv) \
+  UnsupportedTableEntry(glrendermode) \
+  UnsupportedTableEntry(glreplacementcodepointersun) \
+  UnsupportedTableEntry(glreplacementcodeubsun) \
+  UnsupportedTableEntry(glreplacementcodeubvsun) \
+  UnsupportedTableEntry(glreplacementcodeuicolor3fvertex3fsun) \
+  UnsupportedTableEntry(glreplacementcodeuicolor3fvertex3fvsun) \
+  UnsupportedTableEntry(glreplacementcodeuicolor4fnormal3fvertex3fsun) \
+  UnsupportedTableEntry(glreplacementcodeuicolor4fnormal3fvertex3fvsun) \
+  UnsupportedTableEntry(glreplacementcodeuicolor4ubvertex3fsun) \
+  UnsupportedTableEntry(glreplacementcodeuicolor4ubvertex3fvsun) \
+  UnsupportedTableEntry(glreplacementcodeuinormal3fvertex3fsun) \
+  UnsupportedTableEntry(glreplacementcodeuinormal3fvertex3fvsun) \
+  UnsupportedTableEntry(glreplacementcodeuisun) \
+  UnsupportedTableEntry(glreplacementcodeuitexcoord2fcolor4fnormal3fvertex3fsun) \
+  UnsupportedTableEntry(glreplacementcodeuitexcoord2fcolor4fnormal3fvertex3fvsun) \
+  UnsupportedTableEntry(glreplacementcodeuitexcoord2fnormal3fvertex3fsun) \
+  UnsupportedTableEntry(glreplacementcodeuitexcoord2fnormal3fvertex3fvsun) \
+  UnsupportedTableEntry(glreplacementcodeuitexcoord2fvertex3fsun) \
+  UnsupportedTableEntry(glreplacementcodeuitexcoord2fvertex3fvsun) \
+  UnsupportedTableEntry(glreplacementcodeuivertex3fsun) \
+  UnsupportedTableEntry(glreplacementcodeuivertex3fvsun) \
+  UnsupportedTableEntry(glreplacementcodeuivsun) \
+  UnsupportedTableEntry(glreplacementcodeussun) \
+  UnsupportedTableEntry(glreplacementcodeusvsun) \
+  UnsupportedTableEntry(glrequestresidentprogramsnv) \
+  UnsupportedTableEntry(glresethistogram) \
+  UnsupportedTableEntry(glresethistogramext) \
+  UnsupportedTableEntry(glresetminmax) \
+  UnsupportedTableEntry(glresetminmaxext) \
+  UnsupportedTableEntry(glresizebuffersmesa) \
+  UnsupportedTableEntry(glresolvedepthvaluesnv) \
+  UnsupportedTableEntry(glresumetransformfeedbacknv) \
+  UnsupportedTableEntry(glrotated) \
+  UnsupportedTableEntry(glrotatef) \
+  UnsupportedTableEntry(glrotatexoes) \
+  UnsupportedTableEntry(glsamplemapati) \
+  UnsupportedTableEntry(glsamplemaskext) \
+  UnsupportedTableEntry(glsamplemaskindexednv) \
+  UnsupportedTableEntry(glsamplemasksgis) \
+  UnsupportedTableEntry(glsamplepatternext) \
+  UnsupportedTableEntry(glsamplepatternsgis) \
+  UnsupportedTableEntry(glscaled) \
+  UnsupportedTableEntry(glscalef) \
+  UnsupportedTableEntry(glscalexoes) \
+  UnsupportedTableEntry(glsecondarycolor3b) \
+  UnsupportedTableEntry(glsecondarycolor3bext) \
+  UnsupportedTableEntry(glsecondarycolor3bv) \
+  UnsupportedTableEntry(glsecondarycolor3bvext) \
+  UnsupportedTableEntry(glsecondarycolor3d) \
+  UnsupportedTableEntry(glsecondarycolor3dext) \
+  UnsupportedTableEntry(glsecondarycolor3dv) \
+  UnsupportedTableEntry(glsecondarycolor3dvext) \
+  UnsupportedTableEntry(glsecondarycolor3f) \
+  UnsupportedTableEntry(glsecondarycolor3fext) \
+  UnsupportedTableEntry(glsecondarycolor3fv) \
+  UnsupportedTableEntry(glsecondarycolor3fvext) \
+  UnsupportedTableEntry(glsecondarycolor3hnv) \
+  UnsupportedTableEntry(glsecondarycolor3hvnv) \
+  UnsupportedTableEntry(glsecondarycolor3i) \
+  UnsupportedTableEntry(glsecondarycolor3iext) \
+  UnsupportedTableEntry(glsecondarycolor3iv) \
+  UnsupportedTableEntry(glsecondarycolor3ivext) \
+  UnsupportedTableEntry(glsecondarycolor3s) \
+  UnsupportedTableEntry(glsecondarycolor3sext) \
+  UnsupportedTableEntry(glsecondarycolor3sv) \
+  UnsupportedTableEntry(glsecondarycolor3svext) \
+  UnsupportedTableEntry(glsecondarycolor3ub) \
+  UnsupportedTableEntry(glsecondarycolor3ubext) \
+  UnsupportedTableEntry(glsecondarycolor3ubv) \
+  UnsupportedTableEntry(glsecondarycolor3ubvext) \
+  UnsupportedTableEntry(glsecondarycolor3ui) \
+  UnsupportedTableEntry(glsecondarycolor3uiext) \
+  UnsupportedTableEntry(glsecondarycolor3uiv) \
+  UnsupportedTableEntry(glsecondarycolor3uivext) \
+  UnsupportedTableEntry(glsecondarycolor3us) \
+  UnsupportedTableEntry(glsecondarycolor3usext) \
+  UnsupportedTableEntry(glsecondarycolor3usv) \
+  UnsupportedTableEntry(glsecondarycolor3usvext) \
+  UnsupportedTableEntry(glsecondarycolorformatnv) \
+  UnsupportedTableEntry(glsecondarycolorp3ui) \
+  UnsupportedTableEntry(glsecondarycolorp3uiv) \
+  UnsupportedTableEntry(glsecondarycolorpointer) \
+  UnsupportedTableEntry(glsecondarycolorpointerext) \
+  UnsupportedTableEntry(glsecondarycolorpointerlistibm) \
+  UnsupportedTableEntry(glselectbuffer) \
+  UnsupportedTableEntry(glselectperfmonitorcountersamd) \
+  UnsupportedTableEntry(glseparablefilter2d) \
+  UnsupportedTableEntry(glseparablefilter2dext) \
+  UnsupportedTableEntry(glsetfenceapple) \
+  UnsupportedTableEntry(glsetfencenv) \
+  UnsupportedTableEntry(glsetfragmentshaderconstantati) \
+  UnsupportedTableEntry(glsetinvariantext) \
+  UnsupportedTableEntry(glsetlocalconstantext) \
+  UnsupportedTableEntry(glsetmultisamplefvamd) \
+  UnsupportedTableEntry(glshademodel) \
+  UnsupportedTableEntry(glshaderop1ext) \
+  UnsupportedTableEntry(glshaderop2ext) \
+  UnsupportedTableEntry(glshaderop3ext) \
+  UnsupportedTableEntry(glshadersourcearb) \
+  UnsupportedTableEntry(glsharpentexfuncsgis) \
+  UnsupportedTableEntry(glspriteparameterfsgix) \
+  UnsupportedTableEntry(glspriteparameterfvsgix) \
+  UnsupportedTableEntry(glspriteparameterisgix) \
+  UnsupportedTableEntry(glspriteparameterivsgix) \
+  UnsupportedTableEntry(glstartinstrumentssgix) \
+  UnsupportedTableEntry(glstatecapturenv) \
+  UnsupportedTableEntry(glstencilcleartagext) \
+  UnsupportedTableEntry(glstencilfillpathinstancednv) \
+  UnsupportedTableEntry(glstencilfillpathnv) \
+  UnsupportedTableEntry(glstencilfuncseparateati) \
+  UnsupportedTableEntry(glstencilopseparateati) \
+  UnsupportedTableEntry(glstencilopvalueamd) \
+  UnsupportedTableEntry(glstencilstrokepathinstancednv) \
+  UnsupportedTableEntry(glstencilstrokepathnv) \
+  UnsupportedTableEntry(glstencilthencoverfillpathinstancednv) \
+  UnsupportedTableEntry(glstencilthencoverfillpathnv) \
+  UnsupportedTableEntry(glstencilthencoverstrokepathinstancednv) \
+  UnsupportedTableEntry(glstencilthencoverstrokepathnv) \
+  UnsupportedTableEntry(glstopinstrumentssgix) \
+  UnsupportedTableEntry(glsubpixelprecisionbiasnv) \
+  UnsupportedTableEntry(glswizzleext) \
+  UnsupportedTableEntry(glsynctextureintel) \
+  UnsupportedTableEntry(gltagsamplebuffersgix) \
+  UnsupportedTableEntry(gltangent3bext) \
+  UnsupportedTableEntry(gltangent3bvext) \
+  UnsupportedTableEntry(gltangent3dext) \
+  UnsupportedTableEntry(gltangent3dvext) \
+  UnsupportedTableEntry(gltangent3fext) \
+  UnsupportedTableEntry(gltangent3fvext) \
+  UnsupportedTableEntry(gltangent3iext) \
+  UnsupportedTableEntry(gltangent3ivext) \
+  UnsupportedTableEntry(gltangent3sext) \
+  UnsupportedTableEntry(gltangent3svext) \
+  UnsupportedTableEntry(gltangentpointerext) \
+  UnsupportedTableEntry(gltbuffermask3dfx) \
+  UnsupportedTableEntry(gltessellationfactoramd) \
+  UnsupportedTableEntry(gltessellationmodeamd) \
+  UnsupportedTableEntry(gltestfenceapple) \
+  UnsupportedTableEntry(gltestfencenv) \
+  UnsupportedTableEntry(gltestobjectapple) \
+  UnsupportedTableEntry(gltexbumpparameterfvati) \
+  UnsupportedTableEntry(gltexbumpparameterivati) \
+  UnsupportedTableEntry(gltexcoord1boes) \
+  UnsupportedTableEntry(gltexcoord1bvoes) \
+  UnsupportedTableEntry(gltexcoord1d) \
+  UnsupportedTableEntry(gltexcoord1dv) \
+  UnsupportedTableEntry(gltexcoord1f) \
+  UnsupportedTableEntry(gltexcoord1fv) \
+  UnsupportedTableEntry(gltexcoord1hnv) \
+  UnsupportedTableEntry(gltexcoord1hvnv) \
+  UnsupportedTableEntry(gltexcoord1i) \
+  UnsupportedTableEntry(gltexcoord1iv) \
+  UnsupportedTableEntry(gltexcoord1s) \
+  UnsupportedTableEntry(gltexcoord1sv) \
+  UnsupportedTableEntry(gltexcoord1xoes) \
+  UnsupportedTableEntry(gltexcoord1xvoes) \
+  UnsupportedTableEntry(gltexcoord2boes) \
+  UnsupportedTableEntry(gltexcoord2bvoes) \
+  UnsupportedTableEntry(gltexcoord2d) \
+  UnsupportedTableEntry(gltexcoord2dv) \
+  UnsupportedTableEntry(gltexcoord2f) \
+  UnsupportedTableEntry(gltexcoord2fcolor3fvertex3fsun) \
+  UnsupportedTableEntry(gltexcoord2fcolor3fvertex3fvsun) \
+  UnsupportedTableEntry(gltexcoord2fcolor4fnormal3fvertex3fsun) \
+  UnsupportedTableEntry(gltexcoord2fcolor4fnormal3fvertex3fvsun) \
+  UnsupportedTableEntry(gltexcoord2fcolor4ubvertex3fsun) \
+  UnsupportedTableEntry(gltexcoord2fcolor4ubvertex3fvsun) \
+  UnsupportedTableEntry(gltexcoord2fnormal3fvertex3fsun) \
+  UnsupportedTableEntry(gltexcoord2fnormal3fvertex3fvsun) \
+  UnsupportedTableEntry(gltexcoord2fv) \
+  UnsupportedTableEntry(gltexcoord2fvertex3fsun) \
+  UnsupportedTableEntry(gltexcoord2fvertex3fvsun) \
+  UnsupportedTableEntry(gltexcoord2hnv) \
+  UnsupportedTableEntry(gltexcoord2hvnv) \
+  UnsupportedTableEntry(gltexcoord2i) \
+  UnsupportedTableEntry(gltexcoord2iv) \
+  UnsupportedTableEntry(gltexcoord2s) \
+  UnsupportedTableEntry(gltexcoord2sv) \
+  UnsupportedTableEntry(gltexcoord2xoes) \
+  UnsupportedTableEntry(gltexcoord2xvoes) \
+  UnsupportedTableEntry(gltexcoord3boes) \
+  UnsupportedTableEntry(gltexcoord3bvoes) \
+  UnsupportedTableEntry(gltexcoord3d) \
+  UnsupportedTableEntry(gltexcoord3dv) \
+  UnsupportedTableEntry(gltexcoord3f) \
+  UnsupportedTableEntry(gltexcoord3fv) \
+  UnsupportedTableEntry(gltexcoord3hnv) \
+  UnsupportedTableEntry(gltexcoord3hvnv) \
+  UnsupportedTableEntry(gltexcoord3i) \
+  UnsupportedTableEntry(gltexcoord3iv) \
+  UnsupportedTableEntry(gltexcoord3s) \
+  UnsupportedTableEntry(gltexcoord3sv) \
+  UnsupportedTableEntry(gltexcoord3xoes) \
+  UnsupportedTableEntry(gltexcoord3xvoes) \
+  UnsupportedTableEntry(gltexcoord4boes) \
+  UnsupportedTableEntry(gltexcoord4bvoes) \
+  UnsupportedTableEntry(gltexcoord4d) \
+  UnsupportedTableEntry(gltexcoord4dv) \
+  UnsupportedTableEntry(gltexcoord4f) \
+  UnsupportedTableEntry(gltexcoord4fcolor4fnormal3fvertex4fsun) \
+  UnsupportedTableEntry(gltexcoord4fcolor4fnormal3fvertex4fvsun) \
+  UnsupportedTableEntry(gltexcoord4fv) \
+  UnsupportedTableEntry(gltexcoord4fvertex4fsun) \
+  UnsupportedTableEntry(gltexcoord4fvertex4fvsun) \
+  UnsupportedTableEntry(gltexcoord4hnv) \
+  UnsupportedTableEntry(gltexcoord4hvnv) \
+  UnsupportedTableEntry(gltexcoord4i) \
+  UnsupportedTableEntry(gltexcoord4iv) \
+  UnsupportedTableEntry(gltexcoord4s) \
+  UnsupportedTableEntry(gltexcoord4sv) \
+  UnsupportedTableEntry(gltexcoord4xoes) \
+  UnsupportedTableEntry(gltexcoord4xvoes) \
+  UnsupportedTableEntry(gltexcoordformatnv) \
+  UnsupportedTableEntry(gltexcoordp1ui) \
+  UnsupportedTableEntry(gltexcoordp1uiv) \
+  UnsupportedTableEntry(gltexcoordp2ui) \
+  UnsupportedTableEntry(gltexcoordp2uiv) \
+  UnsupportedTableEntry(gltexcoordp3ui) \
+  UnsupportedTableEntry(gltexcoordp3uiv) \
+  UnsupportedTableEntry(gltexcoordp4ui) \
+  UnsupportedTableEntry(gltexcoordp4uiv) \
+  UnsupportedTableEntry(gltexcoordpointer) \
+  UnsupportedTableEntry(gltexcoordpointerext) \
+  UnsupportedTableEntry(gltexcoordpointerlistibm) \
+  UnsupportedTableEntry(gltexcoordpointervintel) \
+  UnsupportedTableEntry(gltexenvf) \
+  UnsupportedTableEntry(gltexenvfv) \
+  UnsupportedTableEntry(gltexenvi) \
+  UnsupportedTableEntry(gltexenviv) \
+  UnsupportedTableEntry(gltexenvxoes) \
+  UnsupportedTableEntry(gltexenvxvoes) \
+  UnsupportedTableEntry(gltexfilterfuncsgis) \
+  UnsupportedTableEntry(gltexgend) \
+  UnsupportedTableEntry(gltexgendv) \
+  UnsupportedTableEntry(gltexgenf) \
+  UnsupportedTableEntry(gltexgenfv) \
+  UnsupportedTableEntry(gltexgeni) \
+  UnsupportedTableEntry(gltexgeniv) \
+  UnsupportedTableEntry(gltexgenxoes) \
+  UnsupportedTableEntry(gltexgenxvoes) \
+  UnsupportedTableEntry(glteximage2dmultisamplecoveragenv) \
+  UnsupportedTableEntry(glteximage3dmultisamplecoveragenv) \
+  UnsupportedTableEntry(glteximage4dsgis) \
+  UnsupportedTableEntry(gltexpagecommitmentarb) \
+  UnsupportedTableEntry(gltexparameterxoes) \
+  UnsupportedTableEntry(gltexparameterxvoes) \
+  UnsupportedTableEntry(gltexrenderbuffernv) \
+  UnsupportedTableEntry(gltexstoragesparseamd) \
+  UnsupportedTableEntry(gltexsubimage1dext) \
+  UnsupportedTableEntry(gltexsubimage2dext) \
+  UnsupportedTableEntry(gltexsubimage3dext) \
+  UnsupportedTableEntry(gltexsubimage4dsgis) \
+  UnsupportedTableEntry(gltexturebarriernv) \
+  UnsupportedTableEntry(gltexturecolormasksgis) \
+  UnsupportedTableEntry(gltextureimage2dmultisamplecoveragenv) \
+  UnsupportedTableEntry(gltextureimage2dmultisamplenv) \
+  UnsupportedTableEntry(gltextureimage3dmultisamplecoveragenv) \
+  UnsupportedTableEntry(gltextureimage3dmultisamplenv) \
+  UnsupportedTableEntry(gltexturelightext) \
+  UnsupportedTableEntry(gltexturematerialext) \
+  UnsupportedTableEntry(gltexturenormalext) \
+  UnsupportedTableEntry(gltexturepagecommitmentext) \
+  UnsupportedTableEntry(gltexturerangeapple) \
+  UnsupportedTableEntry(gltexturerenderbufferext) \
+  UnsupportedTableEntry(gltexturestoragesparseamd) \
+  UnsupportedTableEntry(gltrackmatrixnv) \
+  UnsupportedTableEntry(gltransformfeedbackattribsnv) \
+  UnsupportedTableEntry(gltransformfeedbackstreamattribsnv) \
+  UnsupportedTableEntry(gltransformfeedbackvaryingsnv) \
+  UnsupportedTableEntry(gltransformpathnv) \
+  UnsupportedTableEntry(gltranslated) \
+  UnsupportedTableEntry(gltranslatef) \
+  UnsupportedTableEntry(gltranslatexoes) \
+  UnsupportedTableEntry(gluniform1farb) \
+  UnsupportedTableEntry(gluniform1fvarb) \
+  UnsupportedTableEntry(gluniform1i64arb) \
+  UnsupportedTableEntry(gluniform1i64nv) \
+  UnsupportedTableEntry(gluniform1i64varb) \
+  UnsupportedTableEntry(gluniform1i64vnv) \
+  UnsupportedTableEntry(gluniform1iarb) \
+  UnsupportedTableEntry(gluniform1ivarb) \
+  UnsupportedTableEntry(gluniform1ui64arb) \
+  UnsupportedTableEntry(gluniform1ui64nv) \
+  UnsupportedTableEntry(gluniform1ui64varb) \
+  UnsupportedTableEntry(gluniform1ui64vnv) \
+  UnsupportedTableEntry(gluniform2farb) \
+  UnsupportedTableEntry(gluniform2fvarb) \
+  UnsupportedTableEntry(gluniform2i64arb) \
+  UnsupportedTableEntry(gluniform2i64nv) \
+  UnsupportedTableEntry(gluniform2i64varb) \
+  UnsupportedTableEntry(gluniform2i64vnv) \
+  UnsupportedTableEntry(gluniform2iarb) \
+  UnsupportedTableEntry(gluniform2ivarb) \
+  UnsupportedTableEntry(gluniform2ui64arb) \
+  UnsupportedTableEntry(gluniform2ui64nv) \
+  UnsupportedTableEntry(gluniform2ui64varb) \
+  UnsupportedTableEntry(gluniform2ui64vnv) \
+  UnsupportedTableEntry(gluniform3farb) \
+  UnsupportedTableEntry(gluniform3fvarb) \
+  UnsupportedTableEntry(gluniform3i64arb) \
+  UnsupportedTableEntry(gluniform3i64nv) \
+  UnsupportedTableEntry(gluniform3i64varb) \
+  UnsupportedTableEntry(gluniform3i64vnv) \
+  UnsupportedTableEntry(gluniform3iarb) \
+  UnsupportedTableEntry(gluniform3ivarb) \
+  UnsupportedTableEntry(gluniform3ui64arb) \
+  UnsupportedTableEntry(gluniform3ui64nv) \
+  UnsupportedTableEntry(gluniform3ui64varb) \
+  UnsupportedTableEntry(gluniform3ui64vnv) \
+  UnsupportedTableEntry(gluniform4farb) \
+  UnsupportedTableEntry(gluniform4fvarb) \
+  UnsupportedTableEntry(gluniform4i64arb) \
+  UnsupportedTableEntry(gluniform4i64nv) \
+  UnsupportedTableEntry(gluniform4i64varb) \
+  UnsupportedTableEntry(gluniform4i64vnv) \
+  UnsupportedTableEntry(gluniform4iarb) \
+  UnsupportedTableEntry(gluniform4ivarb) \
+  UnsupportedTableEntry(gluniform4ui64arb) \
+  UnsupportedTableEntry(gluniform4ui64nv) \
+  UnsupportedTableEntry(gluniform4ui64varb) \
+  UnsupportedTableEntry(gluniform4ui64vnv) \
+  UnsupportedTableEntry(gluniformbufferext) \
+  UnsupportedTableEntry(gluniformhandleui64arb) \
+  UnsupportedTableEntry(gluniformhandleui64nv) \
+  UnsupportedTableEntry(gluniformhandleui64varb) \
+  UnsupportedTableEntry(gluniformhandleui64vnv) \
+  UnsupportedTableEntry(gluniformmatrix2fvarb) \
+  UnsupportedTableEntry(gluniformmatrix3fvarb) \
+  UnsupportedTableEntry(gluniformmatrix4fvarb) \
+  UnsupportedTableEntry(gluniformui64nv) \
+  UnsupportedTableEntry(gluniformui64vnv) \
+  UnsupportedTableEntry(glunlockarraysext) \
+  UnsupportedTableEntry(glunmapobjectbufferati) \
+  UnsupportedTableEntry(glunmaptexture2dintel) \
+  UnsupportedTableEntry(glupdateobjectbufferati) \
+  UnsupportedTableEntry(gluseprogramobjectarb) \
+  UnsupportedTableEntry(gluseshaderprogramext) \
+  UnsupportedTableEntry(glvalidateprogramarb) \
+  UnsupportedTableEntry(glvariantarrayobjectati) \
+  UnsupportedTableEntry(glvariantbvext) \
+  UnsupportedTableEntry(glvariantdvext) \
+  UnsupportedTableEntry(glvariantfvext) \
+  UnsupportedTableEntry(glvariantivext) \
+  UnsupportedTableEntry(glvariantpointerext) \
+  UnsupportedTableEntry(glvariantsvext) \
+  UnsupportedTableEntry(glvariantubvext) \
+  UnsupportedTableEntry(glvariantuivext) \
+  UnsupportedTableEntry(glvariantusvext) \
+  UnsupportedTableEntry(glvdpaufininv) \
+  UnsupportedTableEntry(glvdpaugetsurfaceivnv) \
+  UnsupportedTableEntry(glvdpauinitnv) \
+  UnsupportedTableEntry(glvdpauissurfacenv) \
+  UnsupportedTableEntry(glvdpaumapsurfacesnv) \
+  UnsupportedTableEntry(glvdpauregisteroutputsurfacenv) \
+  UnsupportedTableEntry(glvdpauregistervideosurfacenv) \
+  UnsupportedTableEntry(glvdpausurfaceaccessnv) \
+  UnsupportedTableEntry(glvdpauunmapsurfacesnv) \
+  UnsupportedTableEntry(glvdpauunregistersurfacenv) \
+  UnsupportedTableEntry(glvertex2boes) \
+  UnsupportedTableEntry(glvertex2bvoes) \
+  UnsupportedTableEntry(glvertex2d) \
+  UnsupportedTableEntry(glvertex2dv) \
+  UnsupportedTableEntry(glvertex2f) \
+  UnsupportedTableEntry(glvertex2fv) \
+  UnsupportedTableEntry(glvertex2hnv) \
+  UnsupportedTableEntry(glvertex2hvnv) \
+  UnsupportedTableEntry(glvertex2i) \
+  UnsupportedTableEntry(glvertex2iv) \
+  UnsupportedTableEntry(glvertex2s) \
+  UnsupportedTableEntry(glvertex2sv) \
+  UnsupportedTableEntry(glvertex2xoes) \
+  UnsupportedTableEntry(glvertex2xvoes) \
+  UnsupportedTableEntry(glvertex3boes) \
+  UnsupportedTableEntry(glvertex3bvoes) \
+  UnsupportedTableEntry(glvertex3d) \
+  UnsupportedTableEntry(glvertex3dv) \
+  UnsupportedTableEntry(glvertex3f) \
+  UnsupportedTableEntry(glvertex3fv) \
+  UnsupportedTableEntry(glvertex3hnv) \
+  UnsupportedTableEntry(glvertex3hvnv) \
+  UnsupportedTableEntry(glvertex3i) \
+  UnsupportedTableEntry(glvertex3iv) \
+  UnsupportedTableEntry(glvertex3s) \
+  UnsupportedTableEntry(glvertex3sv) \
+  UnsupportedTableEntry(glvertex3xoes) \
+  UnsupportedTableEntry(glvertex3xvoes) \
+  UnsupportedTableEntry(glvertex4boes) \
+  UnsupportedTableEntry(glvertex4bvoes) \
+  UnsupportedTableEntry(glvertex4d) \
+  UnsupportedTableEntry(glvertex4dv) \
+  UnsupportedTableEntry(glvertex4f) \
+  UnsupportedTableEntry(glvertex4fv) \
+  UnsupportedTableEntry(glvertex4hnv) \
+  UnsupportedTableEntry(glvertex4hvnv) \
+  UnsupportedTableEntry(glvertex4i) \
+  UnsupportedTableEntry(glvertex4iv) \
+  UnsupportedTableEntry(glvertex4s) \
+  UnsupportedTableEntry(glvertex4sv) \
+  UnsupportedTableEntry(glvertex4xoes) \
+  UnsupportedTableEntry(glvertex4xvoes) \
+  UnsupportedTableEntry(glvertexarraycoloroffsetext) \
+  UnsupportedTableEntry(glvertexarrayedgeflagoffsetext) \
+  UnsupportedTableEntry(glvertexarrayfogcoordoffsetext) \
+  UnsupportedTableEntry(glvertexarrayindexoffsetext) \
+  UnsupportedTableEntry(glvertexarraymultitexcoordoffsetext) \
+  UnsupportedTableEntry(glvertexarraynormaloffsetext) \
+  UnsupportedTableEntry(glvertexarrayparameteriapple) \
+  UnsupportedTableEntry(glvertexarrayrangeapple) \
+  UnsupportedTableEntry(glvertexarrayrangenv) \
+  UnsupportedTableEntry(glvertexarraysecondarycoloroffsetext) \
+  UnsupportedTableEntry(glvertexarraytexcoordoffsetext) \
+  UnsupportedTableEntry(glvertexarrayvertexoffsetext) \
+  UnsupportedTableEntry(glvertexattrib1dnv) \
+  UnsupportedTableEntry(glvertexattrib1dvnv) \
+  UnsupportedTableEntry(glvertexattrib1fnv) \
+  UnsupportedTableEntry(glvertexattrib1fvnv) \
+  UnsupportedTableEntry(glvertexattrib1hnv) \
+  UnsupportedTableEntry(glvertexattrib1hvnv) \
+  UnsupportedTableEntry(glvertexattrib1snv) \
+  UnsupportedTableEntry(glvertexattrib1svnv) \
+  UnsupportedTableEntry(glvertexattrib2dnv) \
+  UnsupportedTableEntry(glvertexattrib2dvnv) \
+  UnsupportedTableEntry(glvertexattrib2fnv) \
+  UnsupportedTableEntry(glvertexattrib2fvnv) \
+  UnsupportedTableEntry(glvertexattrib2hnv) \
+  UnsupportedTableEntry(glvertexattrib2hvnv) \
+  UnsupportedTableEntry(glvertexattrib2snv) \
+  UnsupportedTableEntry(glvertexattrib2svnv) \
+  UnsupportedTableEntry(glvertexattrib3dnv) \
+  UnsupportedTableEntry(glvertexattrib3dvnv) \
+  UnsupportedTableEntry(glvertexattrib3fnv) \
+  UnsupportedTableEntry(glvertexattrib3fvnv) \
+  UnsupportedTableEntry(glvertexattrib3hnv) \
+  UnsupportedTableEntry(glvertexattrib3hvnv) \
+  UnsupportedTableEntry(glvertexattrib3snv) \
+  UnsupportedTableEntry(glvertexattrib3svnv) \
+  UnsupportedTableEntry(glvertexattrib4dnv) \
+  UnsupportedTableEntry(glvertexattrib4dvnv) \
+  UnsupportedTableEntry(glvertexattrib4fnv) \
+  UnsupportedTableEntry(glvertexattrib4fvnv) \
+  UnsupportedTableEntry(glvertexattrib4hnv) \
+  UnsupportedTableEntry(glvertexattrib4hvnv) \
+  UnsupportedTableEntry(glvertexattrib4nubarb) \
+  UnsupportedTableEntry(glvertexattrib4snv) \
+  UnsupportedTableEntry(glvertexattrib4svnv) \
+  UnsupportedTableEntry(glvertexattrib4ubnv) \
+  UnsupportedTableEntry(glvertexattrib4ubvnv) \
+  UnsupportedTableEntry(glvertexattribarrayobjectati) \
+  UnsupportedTableEntry(glvertexattribformatnv) \
+  UnsupportedTableEntry(glvertexattribiformatnv) \
+  UnsupportedTableEntry(glvertexattribl1i64nv) \
+  UnsupportedTableEntry(glvertexattribl1i64vnv) \
+  UnsupportedTableEntry(glvertexattribl1ui64arb) \
+  UnsupportedTableEntry(glvertexattribl1ui64nv) \
+  UnsupportedTableEntry(glvertexattribl1ui64varb) \
+  UnsupportedTableEntry(glvertexattribl1ui64vnv) \
+  UnsupportedTableEntry(glvertexattribl2i64nv) \
+  UnsupportedTableEntry(glvertexattribl2i64vnv) \
+  UnsupportedTableEntry(glvertexattribl2ui64nv) \
+  UnsupportedTableEntry(glvertexattribl2ui64vnv) \
+  UnsupportedTableEntry(glvertexattribl3i64nv) \
+  UnsupportedTableEntry(glvertexattribl3i64vnv) \
+  UnsupportedTableEntry(glvertexattribl3ui64nv) \
+  UnsupportedTableEntry(glvertexattribl3ui64vnv) \
+  UnsupportedTableEntry(glvertexattribl4i64nv) \
+  UnsupportedTableEntry(glvertexattribl4i64vnv) \
+  UnsupportedTableEntry(glvertexattribl4ui64nv) \
+  UnsupportedTableEntry(glvertexattribl4ui64vnv) \
+  UnsupportedTableEntry(glvertexattriblformatnv) \
+  UnsupportedTableEntry(glvertexattribparameteriamd) \
+  UnsupportedTableEntry(glvertexattribpointernv) \
+  UnsupportedTableEntry(glvertexattribs1dvnv) \
+  UnsupportedTableEntry(glvertexattribs1fvnv) \
+  UnsupportedTableEntry(glvertexattribs1hvnv) \
+  UnsupportedTableEntry(glvertexattribs1svnv) \
+  UnsupportedTableEntry(glvertexattribs2dvnv) \
+  UnsupportedTableEntry(glvertexattribs2fvnv) \
+  UnsupportedTableEntry(glvertexattribs2hvnv) \
+  UnsupportedTableEntry(glvertexattribs2svnv) \
+  UnsupportedTableEntry(glvertexattribs3dvnv) \
+  UnsupportedTableEntry(glvertexattribs3fvnv) \
+  UnsupportedTableEntry(glvertexattribs3hvnv) \
+  UnsupportedTableEntry(glvertexattribs3svnv) \
+  UnsupportedTableEntry(glvertexattribs4dvnv) \
+  UnsupportedTableEntry(glvertexattribs4fvnv) \
+  UnsupportedTableEntry(glvertexattribs4hvnv) \
+  UnsupportedTableEntry(glvertexattribs4svnv) \
+  UnsupportedTableEntry(glvertexattribs4ubvnv) \
+  UnsupportedTableEntry(glvertexblendarb) \
+  UnsupportedTableEntry(glvertexblendenvfati) \
+  UnsupportedTableEntry(glvertexblendenviati) \
+  UnsupportedTableEntry(glvertexformatnv) \
+  UnsupportedTableEntry(glvertexp2ui) \
+  UnsupportedTableEntry(glvertexp2uiv) \
+  UnsupportedTableEntry(glvertexp3ui) \
+  UnsupportedTableEntry(glvertexp3uiv) \
+  UnsupportedTableEntry(glvertexp4ui) \
+  UnsupportedTableEntry(glvertexp4uiv) \
+  UnsupportedTableEntry(glvertexpointer) \
+  UnsupportedTableEntry(glvertexpointerext) \
+  UnsupportedTableEntry(glvertexpointerlistibm) \
+  UnsupportedTableEntry(glvertexpointervintel) \
+  UnsupportedTableEntry(glvertexstream1dati) \
+  UnsupportedTableEntry(glvertexstream1dvati) \
+  UnsupportedTableEntry(glvertexstream1fati) \
+  UnsupportedTableEntry(glvertexstream1fvati) \
+  UnsupportedTableEntry(glvertexstream1iati) \
+  UnsupportedTableEntry(glvertexstream1ivati) \
+  UnsupportedTableEntry(glvertexstream1sati) \
+  UnsupportedTableEntry(glvertexstream1svati) \
+  UnsupportedTableEntry(glvertexstream2dati) \
+  UnsupportedTableEntry(glvertexstream2dvati) \
+  UnsupportedTableEntry(glvertexstream2fati) \
+  UnsupportedTableEntry(glvertexstream2fvati) \
+  UnsupportedTableEntry(glvertexstream2iati) \
+  UnsupportedTableEntry(glvertexstream2ivati) \
+  UnsupportedTableEntry(glvertexstream2sati) \
+  UnsupportedTableEntry(glvertexstream2svati) \
+  UnsupportedTableEntry(glvertexstream3dati) \
+  UnsupportedTableEntry(glvertexstream3dvati) \
+  UnsupportedTableEntry(glvertexstream3fati) \
+  UnsupportedTableEntry(glvertexstream3fvati) \
+  UnsupportedTableEntry(glvertexstream3iati) \
+  UnsupportedTableEntry(glvertexstream3ivati) \
+  UnsupportedTableEntry(glvertexstream3sati) \
+  UnsupportedTableEntry(glvertexstream3svati) \
+  UnsupportedTableEntry(glvertexstream4dati) \
+  UnsupportedTableEntry(glvertexstream4dvati) \
+  UnsupportedTableEntry(glvertexstream4fati) \
+  UnsupportedTableEntry(glvertexstream4fvati) \
+  UnsupportedTableEntry(glvertexstream4iati) \
+  UnsupportedTableEntry(glvertexstream4ivati) \
+  UnsupportedTableEntry(glvertexstream4sati) \
+  UnsupportedTableEntry(glvertexstream4svati) \
+  UnsupportedTableEntry(glvertexweightfext) \
+  UnsupportedTableEntry(glvertexweightfvext) \
+  UnsupportedTableEntry(glvertexweighthnv) \
+  UnsupportedTableEntry(glvertexweighthvnv) \
+  UnsupportedTableEntry(glvertexweightpointerext) \
+  UnsupportedTableEntry(glvideocapturenv) \
+  UnsupportedTableEntry(glvideocapturestreamparameterdvnv) \
+  UnsupportedTableEntry(glvideocapturestreamparameterfvnv) \
+  UnsupportedTableEntry(glvideocapturestreamparameterivnv) \
+  UnsupportedTableEntry(glweightbvarb) \
+  UnsupportedTableEntry(glweightdvarb) \
+  UnsupportedTableEntry(glweightfvarb) \
+  UnsupportedTableEntry(glweightivarb) \
+  UnsupportedTableEntry(glweightpathsnv) \
+  UnsupportedTableEntry(glweightpointerarb) \
+  UnsupportedTableEntry(glweightsvarb) \
+  UnsupportedTableEntry(glweightubvarb) \
+  UnsupportedTableEntry(glweightuivarb) \
+  UnsupportedTableEntry(glweightusvarb) \
+  UnsupportedTableEntry(glwindowpos2d) \
+  UnsupportedTableEntry(glwindowpos2darb) \
+  UnsupportedTableEntry(glwindowpos2dmesa) \
+  UnsupportedTableEntry(glwindowpos2dv) \
+  UnsupportedTableEntry(glwindowpos2dvarb) \
+  UnsupportedTableEntry(glwindowpos2dvmesa) \
+  UnsupportedTableEntry(glwindowpos2f) \
+  UnsupportedTableEntry(glwindowpos2farb) \
+  UnsupportedTableEntry(glwindowpos2fmesa) \
+  UnsupportedTableEntry(glwindowpos2fv) \
+  UnsupportedTableEntry(glwindowpos2fvarb) \
+  UnsupportedTableEntry(glwindowpos2fvmesa) \
+  UnsupportedTableEntry(glwindowpos2i) \
+  UnsupportedTableEntry(glwindowpos2iarb) \
+  UnsupportedTableEntry(glwindowpos2imesa) \
+  UnsupportedTableEntry(glwindowpos2iv) \
+  UnsupportedTableEntry(glwindowpos2ivarb) \
+  UnsupportedTableEntry(glwindowpos2ivmesa) \
+  UnsupportedTableEntry(glwindowpos2s) \
+  UnsupportedTableEntry(glwindowpos2sarb) \
+  UnsupportedTableEntry(glwindowpos2smesa) \
+  UnsupportedTableEntry(glwindowpos2sv) \
+  UnsupportedTableEntry(glwindowpos2svarb) \
+  UnsupportedTableEntry(glwindowpos2svmesa) \
+  UnsupportedTableEntry(glwindowpos3d) \
+  UnsupportedTableEntry(glwindowpos3darb) \
+  UnsupportedTableEntry(glwindowpos3dmesa) \
+  UnsupportedTableEntry(glwindowpos3dv) \
+  UnsupportedTableEntry(glwindowpos3dvarb) \
+  UnsupportedTableEntry(glwindowpos3dvmesa) \
+  UnsupportedTableEntry(glwindowpos3f) \
+  UnsupportedTableEntry(glwindowpos3farb) \
+  UnsupportedTableEntry(glwindowpos3fmesa) \
+  UnsupportedTableEntry(glwindowpos3fv) \
+  UnsupportedTableEntry(glwindowpos3fvarb) \
+  UnsupportedTableEntry(glwindowpos3fvmesa) \
+  UnsupportedTableEntry(glwindowpos3i) \
+  UnsupportedTableEntry(glwindowpos3iarb) \
+  UnsupportedTableEntry(glwindowpos3imesa) \
+  UnsupportedTableEntry(glwindowpos3iv) \
+  UnsupportedTableEntry(glwindowpos3ivarb) \
+  UnsupportedTableEntry(glwindowpos3ivmesa) \
+  UnsupportedTableEntry(glwindowpos3s) \
+  UnsupportedTableEntry(glwindowpos3sarb) \
+  UnsupportedTableEntry(glwindowpos3smesa) \
+  UnsupportedTableEntry(glwindowpos3sv) \
+  UnsupportedTableEntry(glwindowpos3svarb) \
+  UnsupportedTableEntry(glwindowpos3svmesa) \
+  UnsupportedTableEntry(glwindowpos4dmesa) \
+  UnsupportedTableEntry(glwindowpos4dvmesa) \
+  UnsupportedTableEntry(glwindowpos4fmesa) \
+  UnsupportedTableEntry(glwindowpos4fvmesa) \
+  UnsupportedTableEntry(glwindowpos4imesa) \
+  UnsupportedTableEntry(glwindowpos4ivmesa) \
+  UnsupportedTableEntry(glwindowpos4smesa) \
+  UnsupportedTableEntry(glwindowpos4svmesa) \
+  UnsupportedTableEntry(glwritemaskext) \
 
 // clang-format on
+
@@ -24,6 +24,7 @@
  ******************************************************************************/
 
 #include "driver/gl/gl_manager.h"
+#include <algorithm>
 #include "driver/gl/gl_driver.h"
 
 struct VertexAttribInitialData
@@ -187,6 +188,163 @@ void Serialiser::Serialise(const char *name, TextureStateInitialData &el)
   Serialise("texBufSize", el.texBufSize);
 }
 
+// upper bound on the size of pixel-pack buffers in flight with initial contents readbacks
+static const uint64_t InitialReadbackBudget = 256 * 1024 * 1024;
+
+// on replay, the size of deferred initial contents kept resident past the current replay range
+static const uint64_t LazyInitialStateBudget = 1024 * 1024 * 1024;
+
+struct TextureSubresource
+{
+  GLenum target;
+  int mip;
+  size_t size;
+};
+
+// lists the images that are serialised for a texture's initial contents, in the order they're
+// written. Used both to lay out an asynchronous readback and to serialise it.
+static void GetInitialTextureSubresources(GLenum textype, GLenum internalFormat, int width,
+                                          int height, int depth, int mips,
+                                          vector<TextureSubresource> &subs)
+{
+  bool isCompressed = IsCompressedFormat(internalFormat);
+
+  GLenum fmt = eGL_NONE;
+  GLenum type = eGL_NONE;
+  if(!isCompressed)
+  {
+    fmt = GetBaseFormat(internalFormat);
+    type = GetDataType(internalFormat);
+  }
+
+  GLenum targets[] = {
+      eGL_TEXTURE_CUBE_MAP_POSITIVE_X, eGL_TEXTURE_CUBE_MAP_NEGATIVE_X,
+      eGL_TEXTURE_CUBE_MAP_POSITIVE_Y, eGL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
+      eGL_TEXTURE_CUBE_MAP_POSITIVE_Z, eGL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
+  };
+
+  int count = ARRAY_COUNT(targets);
+
+  if(textype != eGL_TEXTURE_CUBE_MAP)
+  {
+    targets[0] = textype;
+    count = 1;
+  }
+
+  for(int i = 0; i < mips; i++)
+  {
+    TextureSubresource sub;
+    sub.mip = i;
+
+    if(isCompressed)
+    {
+      sub.size = GetCompressedByteSize(width, height, depth, internalFormat, i);
+
+      if(textype == eGL_TEXTURE_CUBE_MAP)
+        sub.size /= 6;
+    }
+    else
+    {
+      int w = RDCMAX(width >> i, 1);
+      int h = RDCMAX(height >> i, 1);
+      int d = RDCMAX(depth >> i, 1);
+
+      if(textype == eGL_TEXTURE_CUBE_MAP_ARRAY || textype == eGL_TEXTURE_1D_ARRAY ||
+         textype == eGL_TEXTURE_2D_ARRAY)
+        d = depth;
+
+      sub.size = GetByteSize(w, h, d, fmt, type);
+    }
+
+    for(int trg = 0; trg < count; trg++)
+    {
+      sub.target = targets[trg];
+      subs.push_back(sub);
+    }
+  }
+}
+
+bool GLResourceManager::ReserveInitialReadback(uint64_t size)
+{
+  if(m_State < WRITING)
+    return false;
+
+  // readbacks are copied into a pixel pack buffer and fenced. Without either, the contents are
+  // read back synchronously when they're serialised.
+  if(!HasExt[ARB_pixel_buffer_object] || !HasExt[ARB_sync])
+    return false;
+
+  if(m_InitialReadbackBytes + size > InitialReadbackBudget)
+  {
+    RDCDEBUG("Initial contents readback of %llu bytes over budget, falling back to synchronous",
+             size);
+    return false;
+  }
+
+  m_InitialReadbackBytes += size;
+
+  return true;
+}
+
+void GLResourceManager::AddInitialReadback(ResourceId id, GLuint buf, uint64_t size)
+{
+  const GLHookSet &gl = m_GL->GetInternalHookset();
+
+  InitialReadback &readback = m_InitialReadbacks[id];
+  readback.buf = buf;
+  readback.fence = gl.glFenceSync(eGL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  readback.size = size;
+
+  // make sure the copies are submitted so they can progress while the frame is captured
+  gl.glFlush();
+}
+
+bool GLResourceManager::WaitInitialReadback(ResourceId id, InitialReadback &readback)
+{
+  auto it = m_InitialReadbacks.find(id);
+  if(it == m_InitialReadbacks.end())
+    return false;
+
+  const GLHookSet &gl = m_GL->GetInternalHookset();
+
+  readback = it->second;
+
+  // by the time we serialise the copy has normally long finished, so this rarely waits at all
+  GLenum status = eGL_TIMEOUT_EXPIRED;
+  while(status == eGL_TIMEOUT_EXPIRED)
+    status = gl.glClientWaitSync(readback.fence, eGL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ULL);
+
+  if(status == eGL_WAIT_FAILED)
+    RDCERR("Failed to wait on initial contents readback of %llu", id);
+
+  return true;
+}
+
+void GLResourceManager::ReleaseInitialReadback(ResourceId id)
+{
+  auto it = m_InitialReadbacks.find(id);
+  if(it == m_InitialReadbacks.end())
+    return;
+
+  const GLHookSet &gl = m_GL->GetInternalHookset();
+
+  gl.glDeleteSync(it->second.fence);
+  if(it->second.buf)
+    gl.glDeleteBuffers(1, &it->second.buf);
+
+  m_InitialReadbackBytes -= it->second.size;
+
+  m_InitialReadbacks.erase(it);
+}
+
+void GLResourceManager::FreeInitialReadbacks()
+{
+  while(!m_InitialReadbacks.empty())
+    ReleaseInitialReadback(m_InitialReadbacks.begin()->first);
+
+  m_InitialReadbackBytes = 0;
+}
+
 void GLResourceManager::MarkVAOReferenced(GLResource res, FrameRefType ref, bool allowFake0)
 {
   const GLHookSet &gl = m_GL->GetInternalHookset();
@@ -438,6 +596,9 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
 
   const GLHookSet &gl = m_State < WRITING ? m_GL->GetHookset() : m_GL->GetInternalHookset();
 
+  // drop any readback from a previous attempt at preparing this resource
+  ReleaseInitialReadback(Id);
+
   if(res.Namespace == eResBuffer)
   {
     // get the length of the buffer
@@ -449,11 +610,15 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
     gl.glGetIntegerv(eGL_COPY_READ_BUFFER_BINDING, (GLint *)&oldbuf1);
     gl.glGetIntegerv(eGL_COPY_WRITE_BUFFER_BINDING, (GLint *)&oldbuf2);
 
+    // if we can, the copy doubles as the readback buffer - hint that it'll be read on the CPU and
+    // fence it so serialising doesn't have to stall on the copy.
+    bool async = ReserveInitialReadback(length);
+
     // create a new buffer big enough to hold the contents
     GLuint buf = 0;
     gl.glGenBuffers(1, &buf);
     gl.glBindBuffer(eGL_COPY_WRITE_BUFFER, buf);
-    gl.glNamedBufferData(buf, (GLsizeiptr)length, NULL, eGL_STATIC_READ);
+    gl.glNamedBufferData(buf, (GLsizeiptr)length, NULL, async ? eGL_STREAM_READ : eGL_STATIC_READ);
 
     // bind the live buffer for copying
     gl.glBindBuffer(eGL_COPY_READ_BUFFER, res.name);
@@ -465,6 +630,9 @@ bool GLResourceManager::Prepare_InitialState(GLResource res)
     gl.glBindBuffer(eGL_COPY_READ_BUFFER, oldbuf1);
     gl.glBindBuffer(eGL_COPY_WRITE_BUFFER, oldbuf2);
 
+    if(async)
+      AddInitialReadback(Id, 0, length);
+
     SetInitialContents(Id, InitialContentData(BufferRes(res.Context, buf), length, NULL));
   }
   else if(res.Namespace == eResProgram)
@@ -916,6 +1084,10 @@ void GLResourceManager::PrepareTextureInitialContents(ResourceId liveid, Resourc
 
       gl.glTextureParameterivEXT(res.name, details.curType, eGL_TEXTURE_MAX_LEVEL,
                                  (GLint *)&state->maxLevel);
+
+      // multisampled textures aren't serialised, so there's nothing to read back
+      if(!ms)
+        PrepareTextureReadback(liveid, origid, tex);
     }
 
     SetInitialContents(origid, InitialContentData(TextureRes(res.Context, tex), 0, (byte *)state));
@@ -938,6 +1110,98 @@ void GLResourceManager::PrepareTextureInitialContents(ResourceId liveid, Resourc
   }
 }
 
+void GLResourceManager::PrepareTextureReadback(ResourceId liveid, ResourceId origid, GLuint tex)
+{
+  const GLHookSet &gl = m_GL->GetInternalHookset();
+
+  WrappedOpenGL::TextureData &details = m_GL->m_Textures[liveid];
+
+  int mips = GetNumMips(gl, details.curType, tex, details.width, details.height, details.depth);
+
+  vector<TextureSubresource> subs;
+  GetInitialTextureSubresources(details.curType, details.internalFormat, details.width,
+                                details.height, details.depth, mips, subs);
+
+  uint64_t size = 0;
+  for(size_t i = 0; i < subs.size(); i++)
+    size += subs[i].size;
+
+  if(size == 0 || !ReserveInitialReadback(size))
+    return;
+
+  bool isCompressed = IsCompressedFormat(details.internalFormat);
+
+  GLenum fmt = eGL_NONE;
+  GLenum type = eGL_NONE;
+  if(!isCompressed)
+  {
+    fmt = GetBaseFormat(details.internalFormat);
+    type = GetDataType(details.internalFormat);
+  }
+
+  GLuint ppb = 0;
+  gl.glGetIntegerv(eGL_PIXEL_PACK_BUFFER_BINDING, (GLint *)&ppb);
+
+  GLint packParams[8];
+  gl.glGetIntegerv(eGL_PACK_SWAP_BYTES, &packParams[0]);
+  gl.glGetIntegerv(eGL_PACK_LSB_FIRST, &packParams[1]);
+  gl.glGetIntegerv(eGL_PACK_ROW_LENGTH, &packParams[2]);
+  gl.glGetIntegerv(eGL_PACK_IMAGE_HEIGHT, &packParams[3]);
+  gl.glGetIntegerv(eGL_PACK_SKIP_PIXELS, &packParams[4]);
+  gl.glGetIntegerv(eGL_PACK_SKIP_ROWS, &packParams[5]);
+  gl.glGetIntegerv(eGL_PACK_SKIP_IMAGES, &packParams[6]);
+  gl.glGetIntegerv(eGL_PACK_ALIGNMENT, &packParams[7]);
+
+  gl.glPixelStorei(eGL_PACK_SWAP_BYTES, 0);
+  gl.glPixelStorei(eGL_PACK_LSB_FIRST, 0);
+  gl.glPixelStorei(eGL_PACK_ROW_LENGTH, 0);
+  gl.glPixelStorei(eGL_PACK_IMAGE_HEIGHT, 0);
+  gl.glPixelStorei(eGL_PACK_SKIP_PIXELS, 0);
+  gl.glPixelStorei(eGL_PACK_SKIP_ROWS, 0);
+  gl.glPixelStorei(eGL_PACK_SKIP_IMAGES, 0);
+  gl.glPixelStorei(eGL_PACK_ALIGNMENT, 1);
+
+  GLuint buf = 0;
+  gl.glGenBuffers(1, &buf);
+  gl.glBindBuffer(eGL_PIXEL_PACK_BUFFER, buf);
+  gl.glNamedBufferData(buf, (GLsizeiptr)size, NULL, eGL_STREAM_READ);
+
+  GLenum binding = TextureBinding(details.curType);
+
+  GLuint prevtex = 0;
+  gl.glGetIntegerv(binding, (GLint *)&prevtex);
+
+  gl.glBindTexture(details.curType, tex);
+
+  // with a pixel pack buffer bound these write into the buffer at the given offset, and return
+  // without waiting for the data.
+  size_t offs = 0;
+  for(size_t i = 0; i < subs.size(); i++)
+  {
+    if(isCompressed)
+      gl.glGetCompressedTextureImageEXT(tex, subs[i].target, subs[i].mip, (void *)offs);
+    else
+      gl.glGetTexImage(subs[i].target, subs[i].mip, fmt, type, (void *)offs);
+
+    offs += subs[i].size;
+  }
+
+  gl.glBindTexture(details.curType, prevtex);
+
+  gl.glBindBuffer(eGL_PIXEL_PACK_BUFFER, ppb);
+
+  gl.glPixelStorei(eGL_PACK_SWAP_BYTES, packParams[0]);
+  gl.glPixelStorei(eGL_PACK_LSB_FIRST, packParams[1]);
+  gl.glPixelStorei(eGL_PACK_ROW_LENGTH, packParams[2]);
+  gl.glPixelStorei(eGL_PACK_IMAGE_HEIGHT, packParams[3]);
+  gl.glPixelStorei(eGL_PACK_SKIP_PIXELS, packParams[4]);
+  gl.glPixelStorei(eGL_PACK_SKIP_ROWS, packParams[5]);
+  gl.glPixelStorei(eGL_PACK_SKIP_IMAGES, packParams[6]);
+  gl.glPixelStorei(eGL_PACK_ALIGNMENT, packParams[7]);
+
+  AddInitialReadback(origid, buf, size);
+}
+
 bool GLResourceManager::Force_InitialState(GLResource res, bool prepare)
 {
   if(res.Namespace != eResBuffer && res.Namespace != eResTexture)
@@ -1002,6 +1266,10 @@ bool GLResourceManager::Serialise_InitialState(ResourceId resid, GLResource res)
 
       m_pSerialiser->Serialise("len", len);
 
+      // if the copy was fenced, wait on it before mapping rather than stalling inside the map
+      InitialReadback pending;
+      WaitInitialReadback(Id, pending);
+
       // save old binding
       GLuint oldbuf = 0;
       gl.glGetIntegerv(eGL_COPY_READ_BUFFER_BINDING, (GLint *)&oldbuf);
@@ -1034,6 +1302,8 @@ bool GLResourceManager::Serialise_InitialState(ResourceId resid, GLResource res)
 
       // restore old binding
       gl.glBindBuffer(eGL_COPY_READ_BUFFER, oldbuf);
+
+      ReleaseInitialReadback(Id);
     }
     else
     {
@@ -1177,54 +1447,50 @@ bool GLResourceManager::Serialise_InitialState(ResourceId resid, GLResource res)
           // no contents to copy for texture buffer (it's copied under the buffer)
           // same applies for texture views, their data is copies under the aliased texture
         }
-        else if(isCompressed)
+        else if(!isCompressed && samples > 1)
         {
-          for(int i = 0; i < mips; i++)
-          {
-            GLenum targets[] = {
-                eGL_TEXTURE_CUBE_MAP_POSITIVE_X, eGL_TEXTURE_CUBE_MAP_NEGATIVE_X,
-                eGL_TEXTURE_CUBE_MAP_POSITIVE_Y, eGL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
-                eGL_TEXTURE_CUBE_MAP_POSITIVE_Z, eGL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
-            };
-
-            int count = ARRAY_COUNT(targets);
+          GLNOTIMP("Not implemented - initial states of multisampled textures");
+        }
+        else
+        {
+          vector<TextureSubresource> subs;
+          GetInitialTextureSubresources(details.curType, details.internalFormat, details.width,
+                                        details.height, details.depth, mips, subs);
 
-            if(t != eGL_TEXTURE_CUBE_MAP)
-            {
-              targets[0] = details.curType;
-              count = 1;
-            }
+          GLenum fmt = eGL_NONE;
+          GLenum type = eGL_NONE;
+          if(!isCompressed)
+          {
+            fmt = GetBaseFormat(details.internalFormat);
+            type = GetDataType(details.internalFormat);
+          }
 
-            for(int trg = 0; trg < count; trg++)
-            {
-              size_t size = GetCompressedByteSize(details.width, details.height, details.depth,
-                                                  details.internalFormat, i);
+          // if the contents were already read back when they were prepared, serialise straight
+          // out of the mapped pixel pack buffer
+          byte *mapped = NULL;
 
-              if(t == eGL_TEXTURE_CUBE_MAP)
-                size /= 6;
+          InitialReadback readback;
+          if(WaitInitialReadback(Id, readback))
+          {
+            gl.glBindBuffer(eGL_PIXEL_PACK_BUFFER, readback.buf);
+            mapped = (byte *)gl.glMapBufferRange(eGL_PIXEL_PACK_BUFFER, 0,
+                                                 (GLsizeiptr)readback.size, GL_MAP_READ_BIT);
+            gl.glBindBuffer(eGL_PIXEL_PACK_BUFFER, 0);
 
-              byte *buf = new byte[size];
+            if(!mapped)
+              RDCERR("Couldn't map initial contents readback, falling back to synchronous");
+          }
 
-              gl.glGetCompressedTextureImageEXT(tex, targets[trg], i, buf);
+          byte *buf = NULL;
 
-              m_pSerialiser->SerialiseBuffer("image", buf, size);
+          if(!mapped)
+          {
+            size_t size = 0;
+            for(size_t i = 0; i < subs.size(); i++)
+              size = RDCMAX(size, subs[i].size);
 
-              delete[] buf;
-            }
+            buf = new byte[size];
           }
-        }
-        else if(samples > 1)
-        {
-          GLNOTIMP("Not implemented - initial states of multisampled textures");
-        }
-        else
-        {
-          GLenum fmt = GetBaseFormat(details.internalFormat);
-          GLenum type = GetDataType(details.internalFormat);
-
-          size_t size = GetByteSize(details.width, details.height, details.depth, fmt, type);
-
-          byte *buf = new byte[size];
 
           GLenum binding = TextureBinding(t);
 
@@ -1233,43 +1499,42 @@ bool GLResourceManager::Serialise_InitialState(ResourceId resid, GLResource res)
 
           gl.glBindTexture(t, tex);
 
-          for(int i = 0; i < mips; i++)
+          size_t offs = 0;
+          for(size_t i = 0; i < subs.size(); i++)
           {
-            int w = RDCMAX(details.width >> i, 1);
-            int h = RDCMAX(details.height >> i, 1);
-            int d = RDCMAX(details.depth >> i, 1);
-
-            if(t == eGL_TEXTURE_CUBE_MAP_ARRAY || t == eGL_TEXTURE_1D_ARRAY ||
-               t == eGL_TEXTURE_2D_ARRAY)
-              d = details.depth;
-
-            size = GetByteSize(w, h, d, fmt, type);
-
-            GLenum targets[] = {
-                eGL_TEXTURE_CUBE_MAP_POSITIVE_X, eGL_TEXTURE_CUBE_MAP_NEGATIVE_X,
-                eGL_TEXTURE_CUBE_MAP_POSITIVE_Y, eGL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
-                eGL_TEXTURE_CUBE_MAP_POSITIVE_Z, eGL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
-            };
-
-            int count = ARRAY_COUNT(targets);
+            size_t size = subs[i].size;
+            byte *data = mapped ? mapped + offs : buf;
 
-            if(t != eGL_TEXTURE_CUBE_MAP)
+            if(mapped)
             {
-              targets[0] = t;
-              count = 1;
+              // already read back
             }
-
-            for(int trg = 0; trg < count; trg++)
+            else if(isCompressed)
+            {
+              gl.glGetCompressedTextureImageEXT(tex, subs[i].target, subs[i].mip, buf);
+            }
+            else
             {
               // we avoid glGetTextureImageEXT as it seems buggy for cubemap faces
-              gl.glGetTexImage(targets[trg], i, fmt, type, buf);
-
-              m_pSerialiser->SerialiseBuffer("image", buf, size);
+              gl.glGetTexImage(subs[i].target, subs[i].mip, fmt, type, buf);
             }
+
+            m_pSerialiser->SerialiseBuffer("image", data, size);
+
+            offs += subs[i].size;
           }
 
           gl.glBindTexture(t, prevtex);
 
+          if(mapped)
+          {
+            gl.glBindBuffer(eGL_PIXEL_PACK_BUFFER, readback.buf);
+            gl.glUnmapBuffer(eGL_PIXEL_PACK_BUFFER);
+            gl.glBindBuffer(eGL_PIXEL_PACK_BUFFER, 0);
+          }
+
+          ReleaseInitialReadback(Id);
+
           SAFE_DELETE_ARRAY(buf);
         }
 
@@ -1705,6 +1970,14 @@ bool GLResourceManager::Serialise_InitialState(ResourceId resid, GLResource res)
 
 void GLResourceManager::Create_InitialState(ResourceId id, GLResource live, bool hasData)
 {
+  // deferred contents are read from the file when they're applied
+  auto lazy = m_LazyInitialStates.find(id);
+  if(lazy != m_LazyInitialStates.end())
+  {
+    lazy->second.needed = true;
+    return;
+  }
+
   if(live.Namespace == eResTexture)
   {
     // we basically need to do exactly the same as Prepare_InitialState -
@@ -2198,3 +2471,316 @@ void GLResourceManager::Apply_InitialState(GLResource live, InitialContentData i
     RDCERR("Unexpected type of resource requiring initial state");
   }
 }
+
+bool GLResourceManager::DeferInitialState(uint64_t offset)
+{
+  // we can only come back for the contents later if we can open the capture again
+  if(m_State >= WRITING || m_pSerialiser->GetFilename().empty())
+    return false;
+
+  // peek at the ID then seek back, so if we don't defer the chunk it's serialised as normal.
+  // This is safe as the serialiser always keeps some data behind the read head.
+  uint64_t start = m_pSerialiser->GetOffset();
+
+  ResourceId Id;
+  m_pSerialiser->Serialise("Id", Id);
+
+  m_pSerialiser->SetOffset(start);
+
+  if(!HasLiveResource(Id))
+    return false;
+
+  // buffers and textures are where all the data is, the remaining types are small enough that
+  // they're not worth deferring.
+  GLResource res = GetLiveResource(Id);
+  if(res.Namespace != eResBuffer && res.Namespace != eResTexture)
+    return false;
+
+  // a texture buffer has no contents of its own, but applying its state during the load pass is
+  // what marks the buffer it reads from as used.
+  if(res.Namespace == eResTexture && m_GL->m_Textures[GetLiveID(Id)].curType == eGL_TEXTURE_BUFFER)
+    return false;
+
+  LazyInitialState &lazy = m_LazyInitialStates[Id];
+  lazy.offset = offset;
+  lazy.size = 0;
+  lazy.lastUsed = 0;
+  lazy.needed = false;
+  lazy.resident = false;
+  lazy.applied = false;
+  lazy.shared = m_LazySharedStorage.find(Id) != m_LazySharedStorage.end();
+
+  m_pSerialiser->SkipCurrentChunk();
+
+  return true;
+}
+
+uint32_t GLResourceManager::GetLazyFirstUse(ResourceId id, const LazyInitialState &lazy)
+{
+  // storage shared with another texture can be used through it, and anything the load pass never
+  // looked up can't be placed, so both are treated as used from the start of the frame.
+  uint32_t firstUse = lazy.shared ? 0 : GetFirstUse(id);
+
+  return firstUse == ~0U ? 0 : firstUse;
+}
+
+void GLResourceManager::ApplyInitialContents()
+{
+  // the load pass only replays the frame to record what it does, nothing looks at the contents so
+  // the deferred ones are left unread.
+  if(IsTrackingUses())
+  {
+    ResourceManager::ApplyInitialContents();
+    return;
+  }
+
+  m_LazyReplayCount++;
+
+  vector<ResourceId> toload;
+
+  for(auto it = m_LazyInitialStates.begin(); it != m_LazyInitialStates.end(); ++it)
+  {
+    LazyInitialState &lazy = it->second;
+
+    lazy.applied = false;
+
+    if(!lazy.needed || !HasLiveResource(it->first) ||
+       GetLazyFirstUse(it->first, lazy) > m_LazyReplayEnd)
+      continue;
+
+    lazy.lastUsed = m_LazyReplayCount;
+
+    if(!lazy.resident)
+      toload.push_back(it->first);
+  }
+
+  LoadLazyInitialStates(toload);
+
+  // contents outside the range are applied too while they're resident, so a resource inspected
+  // after the replay still shows its initial contents.
+  ResourceManager::ApplyInitialContents();
+
+  for(auto it = m_LazyInitialStates.begin(); it != m_LazyInitialStates.end(); ++it)
+    it->second.applied = it->second.resident;
+
+  EvictLazyInitialStates();
+}
+
+void GLResourceManager::ApplyLazyInitialStates(uint32_t endEventID)
+{
+  if(endEventID <= m_LazyReplayEnd)
+    return;
+
+  m_LazyReplayEnd = endEventID;
+
+  vector<ResourceId> toapply;
+
+  for(auto it = m_LazyInitialStates.begin(); it != m_LazyInitialStates.end(); ++it)
+  {
+    LazyInitialState &lazy = it->second;
+
+    if(!lazy.needed || lazy.applied || !HasLiveResource(it->first) ||
+       GetLazyFirstUse(it->first, lazy) > m_LazyReplayEnd)
+      continue;
+
+    lazy.lastUsed = m_LazyReplayCount;
+
+    toapply.push_back(it->first);
+  }
+
+  if(toapply.empty())
+    return;
+
+  // resident contents are skipped by the load
+  LoadLazyInitialStates(toapply);
+
+  // nothing before the previous replay's end used these, so applying them now is the same as
+  // having applied them at the start of the frame.
+  for(size_t i = 0; i < toapply.size(); i++)
+  {
+    LazyInitialState &lazy = m_LazyInitialStates[toapply[i]];
+
+    if(!lazy.resident)
+      continue;
+
+    Apply_InitialState(GetLiveResource(toapply[i]), GetInitialContents(toapply[i]));
+    lazy.applied = true;
+  }
+
+  EvictLazyInitialStates();
+}
+
+void GLResourceManager::EnsureInitialState(ResourceId liveid)
+{
+  // resources created by the replay itself have no original ID
+  auto orig = m_OriginalIDs.find(liveid);
+  if(orig == m_OriginalIDs.end())
+    return;
+
+  ResourceId id = orig->second;
+
+  auto it = m_LazyInitialStates.find(id);
+  if(it == m_LazyInitialStates.end() || !it->second.needed || it->second.applied)
+    return;
+
+  // everything the last replay could reach was applied, so this resource hasn't been used yet and
+  // its initial contents are what it should hold.
+  it->second.lastUsed = m_LazyReplayCount;
+
+  vector<ResourceId> toload;
+  toload.push_back(id);
+  LoadLazyInitialStates(toload);
+
+  if(!it->second.resident)
+    return;
+
+  Apply_InitialState(GetLiveResource(id), GetInitialContents(id));
+  it->second.applied = true;
+
+  EvictLazyInitialStates();
+}
+
+void GLResourceManager::LoadLazyInitialStates(const vector<ResourceId> &ids)
+{
+  vector<pair<uint64_t, ResourceId> > toload;
+
+  for(size_t i = 0; i < ids.size(); i++)
+  {
+    LazyInitialState &lazy = m_LazyInitialStates[ids[i]];
+    if(!lazy.resident)
+      toload.push_back(std::make_pair(lazy.offset, ids[i]));
+  }
+
+  if(toload.empty())
+    return;
+
+  // load in file order, so we only have to stream forward through the capture once
+  std::sort(toload.begin(), toload.end());
+
+  if(m_LazyReader == NULL)
+    m_LazyReader = new Serialiser(m_pSerialiser->GetFilename().c_str(), Serialiser::READING, false);
+
+  if(m_LazyReader->HasError())
+  {
+    RDCERR("Couldn't re-open capture to read %u initial contents", (uint32_t)toload.size());
+    return;
+  }
+
+  RDCDEBUG("Loading %u deferred initial contents", (uint32_t)toload.size());
+
+  // Serialise_InitialState reads from m_pSerialiser, so point it at our reader while we load
+  Serialiser *ser = m_pSerialiser;
+  m_pSerialiser = m_LazyReader;
+
+  for(size_t i = 0; i < toload.size(); i++)
+  {
+    uint64_t offset = toload[i].first;
+    ResourceId id = toload[i].second;
+
+    // the reader can only rewind to the start, so if we've gone past the chunk go back there
+    if(m_LazyReader->GetOffset() > offset)
+      m_LazyReader->Rewind();
+
+    while(m_LazyReader->GetOffset() < offset && !m_LazyReader->AtEnd())
+    {
+      uint32_t chunk = m_LazyReader->PushContext(NULL, NULL, 1, false);
+      m_LazyReader->SkipCurrentChunk();
+      m_LazyReader->PopContext(chunk);
+    }
+
+    if(m_LazyReader->GetOffset() != offset)
+    {
+      RDCERR("Couldn't find initial contents chunk for %llu at %llu", id, offset);
+      continue;
+    }
+
+    uint32_t chunk = m_LazyReader->PushContext(NULL, NULL, 1, false);
+    RDCASSERTEQUAL(chunk, (uint32_t)INITIAL_CONTENTS);
+
+    Serialise_InitialState(ResourceId(), GLResource(MakeNullResource));
+
+    m_LazyReader->PopContext(chunk);
+
+    LazyInitialState &lazy = m_LazyInitialStates[id];
+    lazy.resident = true;
+    lazy.size = GetLazyResidentSize(id);
+
+    m_LazyResidentBytes += lazy.size;
+  }
+
+  m_pSerialiser = ser;
+}
+
+uint64_t GLResourceManager::GetLazyResidentSize(ResourceId id)
+{
+  InitialContentData contents = GetInitialContents(id);
+
+  if(contents.resource.Namespace == eResBuffer)
+    return contents.num;
+
+  if(contents.resource.Namespace != eResTexture)
+    return 0;
+
+  WrappedOpenGL::TextureData &details = m_GL->m_Textures[GetLiveID(id)];
+
+  vector<TextureSubresource> subs;
+  GetInitialTextureSubresources(details.curType, details.internalFormat, details.width,
+                                details.height, details.depth, details.mips, subs);
+
+  uint64_t size = 0;
+  for(size_t i = 0; i < subs.size(); i++)
+    size += subs[i].size;
+
+  return size * RDCMAX(1, details.samples);
+}
+
+void GLResourceManager::EvictLazyInitialStates()
+{
+  if(m_LazyResidentBytes <= LazyInitialStateBudget)
+    return;
+
+  // (last needed, -size) so the least recently needed go first, and the largest of those
+  vector<pair<pair<uint64_t, int64_t>, ResourceId> > candidates;
+
+  for(auto it = m_LazyInitialStates.begin(); it != m_LazyInitialStates.end(); ++it)
+  {
+    const LazyInitialState &lazy = it->second;
+
+    // contents the current replay range uses would only be read straight back in
+    if(!lazy.resident || GetLazyFirstUse(it->first, lazy) <= m_LazyReplayEnd)
+      continue;
+
+    candidates.push_back(
+        std::make_pair(std::make_pair(lazy.lastUsed, -(int64_t)lazy.size), it->first));
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+
+  const GLHookSet &gl = m_GL->GetHookset();
+
+  for(size_t i = 0; i < candidates.size() && m_LazyResidentBytes > LazyInitialStateBudget; i++)
+  {
+    ResourceId id = candidates[i].second;
+
+    auto it = m_InitialContents.find(id);
+    if(it != m_InitialContents.end())
+    {
+      GLResource res = it->second.resource;
+
+      if(res.Namespace == eResBuffer && res.name)
+        gl.glDeleteBuffers(1, &res.name);
+      else if(res.Namespace == eResTexture && res.name)
+        gl.glDeleteTextures(1, &res.name);
+
+      Serialiser::FreeAlignedBuffer(it->second.blob);
+      m_InitialContents.erase(it);
+    }
+
+    LazyInitialState &lazy = m_LazyInitialStates[id];
+    lazy.resident = false;
+    m_LazyResidentBytes -= lazy.size;
+    lazy.size = 0;
+  }
+
+  RDCDEBUG("Deferred initial contents evicted down to %llu bytes", m_LazyResidentBytes);
+}
@@ -34,10 +34,17 @@ class GLResourceManager : public ResourceManager<GLResource, GLResource, GLResou
 {
 public:
   GLResourceManager(LogState state, Serialiser *ser, WrappedOpenGL *gl)
-      : ResourceManager(state, ser), m_GL(gl), m_SyncName(1)
+      : ResourceManager(state, ser),
+        m_GL(gl),
+        m_SyncName(1),
+        m_InitialReadbackBytes(0),
+        m_LazyReader(NULL),
+        m_LazyResidentBytes(0),
+        m_LazyReplayEnd(0),
+        m_LazyReplayCount(0)
   {
   }
-  ~GLResourceManager() {}
+  ~GLResourceManager() { SAFE_DELETE(m_LazyReader); }
   void Shutdown()
   {
     // there's a bit of a dependency issue here. We're essentially forcibly deleting/garbage
@@ -208,6 +215,34 @@ public:
   bool Prepare_InitialState(GLResource res, byte *blob);
   bool Serialise_InitialState(ResourceId resid, GLResource res);
 
+  // releases any initial contents readbacks that were never serialised, e.g. because the resource
+  // wasn't referenced in the captured frame or the capture failed.
+  void FreeInitialReadbacks();
+
+  // on replay, called for an INITIAL_CONTENTS chunk that has just been entered. If the contents
+  // can be loaded later the chunk is skipped and true is returned, otherwise the caller should
+  // serialise it as normal.
+  bool DeferInitialState(uint64_t offset);
+
+  // on replay, texture views share their storage with the viewed texture, so the initial contents
+  // of both must be applied whenever either could be used.
+  void MarkSharedStorage(ResourceId id) { m_LazySharedStorage.insert(id); }
+
+  // sets the last event the next full replay will execute, before ApplyInitialContents.
+  void SetReplayEnd(uint32_t endEventID) { m_LazyReplayEnd = endEventID; }
+
+  // loads and applies the deferred contents the replay up to m_LazyReplayEnd can touch, and any
+  // that are still resident, then applies the rest of the initial contents.
+  void ApplyInitialContents();
+
+  // a partial replay continues on from the last one, so it needs any deferred contents first
+  // used after the previous replay's end and up to its own.
+  void ApplyLazyInitialStates(uint32_t endEventID);
+
+  // before a resource is inspected directly after a replay, make sure its deferred contents were
+  // applied even if the replay never got as far as its first use.
+  void EnsureInitialState(ResourceId liveid);
+
 private:
   bool SerialisableResource(ResourceId id, GLResourceRecord *record);
 
@@ -218,9 +253,54 @@ private:
 
   void PrepareTextureInitialContents(ResourceId liveid, ResourceId origid, GLResource res);
 
+  // When preparing initial contents we kick off the readback to the CPU straight away into a
+  // pixel-pack buffer with a fence after it, so the transfer overlaps the captured frame instead
+  // of stalling when the contents are serialised. The total size of these buffers is capped, any
+  // resource that doesn't fit, or any readback on a driver without ARB_sync and pixel buffer
+  // objects, falls back to a synchronous readback at serialise time.
+  struct InitialReadback
+  {
+    // the buffer the contents are read back into. For buffers this is 0 as the initial contents
+    // copy itself is used.
+    GLuint buf;
+    GLsync fence;
+    uint64_t size;
+  };
+
+  bool ReserveInitialReadback(uint64_t size);
+  void AddInitialReadback(ResourceId id, GLuint buf, uint64_t size);
+  bool WaitInitialReadback(ResourceId id, InitialReadback &readback);
+  void ReleaseInitialReadback(ResourceId id);
+  void PrepareTextureReadback(ResourceId liveid, ResourceId origid, GLuint tex);
+
   void Create_InitialState(ResourceId id, GLResource live, bool hasData);
   void Apply_InitialState(GLResource live, InitialContentData initial);
 
+  // On replay the initial contents of buffers and textures aren't read when the capture is
+  // opened, we only note where their chunk is in the file. The load pass doesn't look at any
+  // contents, it only records the first event each resource is used at. A replay then reads in
+  // only the contents it can reach before its last event.
+  //
+  // Contents used within the current replay range are never evicted, since they'd only be read
+  // straight back in by the next replay. If the total resident size goes over budget the least
+  // recently needed contents outside the range are evicted, to be read again once a replay
+  // reaches them.
+  struct LazyInitialState
+  {
+    uint64_t offset;
+    uint64_t size;
+    uint64_t lastUsed;
+    bool needed;
+    bool resident;
+    bool applied;
+    bool shared;
+  };
+
+  uint32_t GetLazyFirstUse(ResourceId id, const LazyInitialState &lazy);
+  void LoadLazyInitialStates(const vector<ResourceId> &ids);
+  uint64_t GetLazyResidentSize(ResourceId id);
+  void EvictLazyInitialStates();
+
   map<GLResource, GLResourceRecord *> m_GLResourceRecords;
 
   map<GLResource, ResourceId> m_CurrentResourceIds;
@@ -231,5 +311,15 @@ private:
   map<GLuint, GLsync> m_CurrentSyncs;
   volatile int64_t m_SyncName;
 
+  uint64_t m_InitialReadbackBytes;
+  map<ResourceId, InitialReadback> m_InitialReadbacks;
+
+  map<ResourceId, LazyInitialState> m_LazyInitialStates;
+  set<ResourceId> m_LazySharedStorage;
+  Serialiser *m_LazyReader;
+  uint64_t m_LazyResidentBytes;
+  uint32_t m_LazyReplayEnd;
+  uint64_t m_LazyReplayCount;
+
   WrappedOpenGL *m_GL;
 };
@@ -292,6 +292,200 @@ byte *PixelUnpackState::UnpackCompressed(byte *pixels, GLsizei width, GLsizei he
   return ret;
 }
 
+void GLShadowState::Reset()
+{
+  RDCEraseEl(AtomicCounter);
+  RDCEraseEl(ShaderStorage);
+  RDCEraseEl(UniformBinding);
+
+  for(size_t i = 0; i < ARRAY_COUNT(Images); i++)
+    BindImage((GLuint)i, 0, 0, false, 0, eGL_READ_ONLY, eGL_R8);
+
+  BuffersOverflowed = false;
+  ImagesOverflowed = false;
+}
+
+void GLShadowState::BindBuffer(GLenum target, GLuint index, GLuint buffer, uint64_t start,
+                               uint64_t size)
+{
+  IdxBuffer *bufs = NULL;
+  GLuint count = 0;
+
+  if(target == eGL_ATOMIC_COUNTER_BUFFER)
+  {
+    bufs = AtomicCounter;
+    count = ARRAY_COUNT(AtomicCounter);
+  }
+  else if(target == eGL_SHADER_STORAGE_BUFFER)
+  {
+    bufs = ShaderStorage;
+    count = ARRAY_COUNT(ShaderStorage);
+  }
+  else if(target == eGL_UNIFORM_BUFFER)
+  {
+    bufs = UniformBinding;
+    count = ARRAY_COUNT(UniformBinding);
+  }
+  else
+  {
+    return;
+  }
+
+  if(index >= count)
+  {
+    BuffersOverflowed = true;
+    return;
+  }
+
+  bufs[index].name = buffer;
+  bufs[index].start = buffer ? start : 0;
+  bufs[index].size = buffer ? size : 0;
+}
+
+void GLShadowState::BindImage(GLuint unit, GLuint texture, GLint level, bool layered, GLint layer,
+                              GLenum access, GLenum format)
+{
+  if(unit >= ARRAY_COUNT(Images))
+  {
+    ImagesOverflowed = true;
+    return;
+  }
+
+  // binding texture 0 resets the unit's other state to the defaults
+  if(texture == 0)
+  {
+    level = 0;
+    layered = false;
+    layer = 0;
+    access = eGL_READ_ONLY;
+    format = eGL_R8;
+  }
+
+  Images[unit].name = texture;
+  Images[unit].level = (GLuint)level;
+  Images[unit].layered = layered;
+  Images[unit].layer = (GLuint)layer;
+  Images[unit].access = access;
+  Images[unit].format = format;
+}
+
+void GLShadowState::BufferDeleted(GLuint buffer)
+{
+  IdxBuffer *lists[] = {AtomicCounter, ShaderStorage, UniformBinding};
+  size_t counts[] = {ARRAY_COUNT(AtomicCounter), ARRAY_COUNT(ShaderStorage),
+                     ARRAY_COUNT(UniformBinding)};
+
+  for(size_t l = 0; l < ARRAY_COUNT(lists); l++)
+  {
+    for(size_t i = 0; i < counts[l]; i++)
+    {
+      if(lists[l][i].name == buffer)
+      {
+        lists[l][i].name = 0;
+        lists[l][i].start = lists[l][i].size = 0;
+      }
+    }
+  }
+}
+
+void GLShadowState::TextureDeleted(GLuint texture)
+{
+  for(size_t i = 0; i < ARRAY_COUNT(Images); i++)
+    if(Images[i].name == texture)
+      BindImage((GLuint)i, 0, 0, false, 0, eGL_READ_ONLY, eGL_R8);
+}
+
+void GLShadowState::Validate(const GLHookSet *funcs)
+{
+  struct
+  {
+    IdxBuffer *bufs;
+    int count;
+    GLenum binding;
+    GLenum start;
+    GLenum size;
+    GLenum maxcount;
+  } idxBufs[] = {
+      {
+          AtomicCounter, ARRAY_COUNT(AtomicCounter), eGL_ATOMIC_COUNTER_BUFFER_BINDING,
+          eGL_ATOMIC_COUNTER_BUFFER_START, eGL_ATOMIC_COUNTER_BUFFER_SIZE,
+          eGL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS,
+      },
+      {
+          ShaderStorage, ARRAY_COUNT(ShaderStorage), eGL_SHADER_STORAGE_BUFFER_BINDING,
+          eGL_SHADER_STORAGE_BUFFER_START, eGL_SHADER_STORAGE_BUFFER_SIZE,
+          eGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS,
+      },
+      {
+          UniformBinding, ARRAY_COUNT(UniformBinding), eGL_UNIFORM_BUFFER_BINDING,
+          eGL_UNIFORM_BUFFER_START, eGL_UNIFORM_BUFFER_SIZE, eGL_MAX_UNIFORM_BUFFER_BINDINGS,
+      },
+  };
+
+  for(GLuint b = 0; b < (GLuint)ARRAY_COUNT(idxBufs); b++)
+  {
+    if(idxBufs[b].binding == eGL_ATOMIC_COUNTER_BUFFER_BINDING &&
+       !HasExt[ARB_shader_atomic_counters])
+      continue;
+
+    if(idxBufs[b].binding == eGL_SHADER_STORAGE_BUFFER_BINDING &&
+       !HasExt[ARB_shader_storage_buffer_object])
+      continue;
+
+    GLint maxCount = 0;
+    funcs->glGetIntegerv(idxBufs[b].maxcount, &maxCount);
+    for(int i = 0; i < idxBufs[b].count && i < maxCount; i++)
+    {
+      IdxBuffer real = {};
+      funcs->glGetIntegeri_v(idxBufs[b].binding, i, (GLint *)&real.name);
+      funcs->glGetInteger64i_v(idxBufs[b].start, i, (GLint64 *)&real.start);
+      funcs->glGetInteger64i_v(idxBufs[b].size, i, (GLint64 *)&real.size);
+
+      IdxBuffer &shadow = idxBufs[b].bufs[i];
+
+      if(real.name != shadow.name || real.start != shadow.start || real.size != shadow.size)
+      {
+        RDCERR("Shadowed %s[%d] is %u (%llu, %llu) but driver has %u (%llu, %llu)",
+               ToStr::Get(idxBufs[b].binding).c_str(), i, shadow.name, shadow.start, shadow.size,
+               real.name, real.start, real.size);
+        shadow = real;
+      }
+    }
+  }
+
+  if(HasExt[ARB_shader_image_load_store])
+  {
+    GLuint maxImages = 0;
+    funcs->glGetIntegerv(eGL_MAX_IMAGE_UNITS, (GLint *)&maxImages);
+
+    for(GLuint i = 0; i < RDCMIN(maxImages, (GLuint)ARRAY_COUNT(Images)); i++)
+    {
+      Image real = {};
+      GLboolean layered = GL_FALSE;
+
+      funcs->glGetIntegeri_v(eGL_IMAGE_BINDING_NAME, i, (GLint *)&real.name);
+      funcs->glGetIntegeri_v(eGL_IMAGE_BINDING_LEVEL, i, (GLint *)&real.level);
+      funcs->glGetIntegeri_v(eGL_IMAGE_BINDING_ACCESS, i, (GLint *)&real.access);
+      funcs->glGetIntegeri_v(eGL_IMAGE_BINDING_FORMAT, i, (GLint *)&real.format);
+      funcs->glGetBooleani_v(eGL_IMAGE_BINDING_LAYERED, i, &layered);
+      funcs->glGetIntegeri_v(eGL_IMAGE_BINDING_LAYER, i, (GLint *)&real.layer);
+      real.layered = (layered == GL_TRUE);
+
+      Image &shadow = Images[i];
+
+      if(real.name != shadow.name || real.level != shadow.level || real.access != shadow.access ||
+         real.format != shadow.format || real.layered != shadow.layered ||
+         real.layer != shadow.layer)
+      {
+        RDCERR("Shadowed image unit %u is %u (level %u layer %u) but driver has %u (level %u "
+               "layer %u)",
+               i, shadow.name, shadow.level, shadow.layer, real.name, real.level, real.layer);
+        shadow = real;
+      }
+    }
+  }
+}
+
 GLRenderState::GLRenderState(const GLHookSet *funcs, Serialiser *ser, LogState state)
     : m_Real(funcs), m_pSerialiser(ser), m_State(state)
 {
@@ -399,6 +593,11 @@ void GLRenderState::MarkDirty(WrappedOpenGL *gl)
   GLint maxCount = 0;
   GLuint name = 0;
 
+  GLShadowState *shadow = gl->GetShadowState();
+
+  if(shadow && gl->GetShadowStateMode() == eShadowState_Validate)
+    shadow->Validate(m_Real);
+
   if(HasExt[ARB_transform_feedback2])
   {
     m_Real->glGetIntegerv(eGL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS, &maxCount);
@@ -413,7 +612,13 @@ void GLRenderState::MarkDirty(WrappedOpenGL *gl)
     }
   }
 
-  if(HasExt[ARB_shader_image_load_store])
+  if(shadow && !shadow->ImagesOverflowed)
+  {
+    for(size_t i = 0; i < ARRAY_COUNT(shadow->Images); i++)
+      if(shadow->Images[i].name)
+        manager->MarkDirtyResource(TextureRes(ctx, shadow->Images[i].name));
+  }
+  else if(HasExt[ARB_shader_image_load_store])
   {
     m_Real->glGetIntegerv(eGL_MAX_IMAGE_UNITS, &maxCount);
 
@@ -427,31 +632,44 @@ void GLRenderState::MarkDirty(WrappedOpenGL *gl)
     }
   }
 
-  if(HasExt[ARB_shader_atomic_counters])
+  if(shadow && !shadow->BuffersOverflowed)
   {
-    m_Real->glGetIntegerv(eGL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS, &maxCount);
+    for(size_t i = 0; i < ARRAY_COUNT(shadow->AtomicCounter); i++)
+      if(shadow->AtomicCounter[i].name)
+        manager->MarkDirtyResource(BufferRes(ctx, shadow->AtomicCounter[i].name));
 
-    for(GLint i = 0; i < maxCount; i++)
+    for(size_t i = 0; i < ARRAY_COUNT(shadow->ShaderStorage); i++)
+      if(shadow->ShaderStorage[i].name)
+        manager->MarkDirtyResource(BufferRes(ctx, shadow->ShaderStorage[i].name));
+  }
+  else
+  {
+    if(HasExt[ARB_shader_atomic_counters])
     {
-      name = 0;
-      m_Real->glGetIntegeri_v(eGL_ATOMIC_COUNTER_BUFFER_BINDING, i, (GLint *)&name);
+      m_Real->glGetIntegerv(eGL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS, &maxCount);
 
-      if(name)
-        manager->MarkDirtyResource(BufferRes(ctx, name));
-    }
-  }
+      for(GLint i = 0; i < maxCount; i++)
+      {
+        name = 0;
+        m_Real->glGetIntegeri_v(eGL_ATOMIC_COUNTER_BUFFER_BINDING, i, (GLint *)&name);
 
-  if(HasExt[ARB_shader_storage_buffer_object])
-  {
-    m_Real->glGetIntegerv(eGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &maxCount);
+        if(name)
+          manager->MarkDirtyResource(BufferRes(ctx, name));
+      }
+    }
 
-    for(GLint i = 0; i < maxCount; i++)
+    if(HasExt[ARB_shader_storage_buffer_object])
     {
-      name = 0;
-      m_Real->glGetIntegeri_v(eGL_SHADER_STORAGE_BUFFER_BINDING, i, (GLint *)&name);
+      m_Real->glGetIntegerv(eGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &maxCount);
 
-      if(name)
-        manager->MarkDirtyResource(BufferRes(ctx, name));
+      for(GLint i = 0; i < maxCount; i++)
+      {
+        name = 0;
+        m_Real->glGetIntegeri_v(eGL_SHADER_STORAGE_BUFFER_BINDING, i, (GLint *)&name);
+
+        if(name)
+          manager->MarkDirtyResource(BufferRes(ctx, name));
+      }
     }
   }
 
@@ -522,6 +740,16 @@ void GLRenderState::FetchState(void *ctx, WrappedOpenGL *gl)
     return;
   }
 
+  // while capturing, the indexed bindings that are shadowed can be read without querying
+  GLShadowState *shadow = NULL;
+  if(m_State >= WRITING && ctx == gl->GetCtx())
+  {
+    shadow = gl->GetShadowState();
+
+    if(shadow && gl->GetShadowStateMode() == eShadowState_Validate)
+      shadow->Validate(m_Real);
+  }
+
   {
     GLenum pnames[] = {
         eGL_CLIP_DISTANCE0,
@@ -637,7 +865,28 @@ void GLRenderState::FetchState(void *ctx, WrappedOpenGL *gl)
       Samplers[i] = 0;
   }
 
-  if(HasExt[ARB_shader_image_load_store])
+  if(shadow)
+  {
+    RDCCOMPILE_ASSERT(ARRAY_COUNT(Images) == ARRAY_COUNT(shadow->Images),
+                      "Shadowed image units don't match render state");
+    RDCCOMPILE_ASSERT(ARRAY_COUNT(AtomicCounter) == ARRAY_COUNT(shadow->AtomicCounter),
+                      "Shadowed atomic counter bindings don't match render state");
+    RDCCOMPILE_ASSERT(ARRAY_COUNT(ShaderStorage) == ARRAY_COUNT(shadow->ShaderStorage),
+                      "Shadowed shader storage bindings don't match render state");
+    RDCCOMPILE_ASSERT(ARRAY_COUNT(UniformBinding) == ARRAY_COUNT(shadow->UniformBinding),
+                      "Shadowed uniform buffer bindings don't match render state");
+
+    for(size_t i = 0; i < ARRAY_COUNT(Images); i++)
+    {
+      Images[i].name = shadow->Images[i].name;
+      Images[i].level = shadow->Images[i].level;
+      Images[i].access = shadow->Images[i].access;
+      Images[i].format = shadow->Images[i].format;
+      Images[i].layered = shadow->Images[i].layered;
+      Images[i].layer = shadow->Images[i].layer;
+    }
+  }
+  else if(HasExt[ARB_shader_image_load_store])
   {
     GLuint maxImages = 0;
     m_Real->glGetIntegerv(eGL_MAX_IMAGE_UNITS, (GLint *)&maxImages);
@@ -769,25 +1018,27 @@ void GLRenderState::FetchState(void *ctx, WrappedOpenGL *gl)
     GLenum start;
     GLenum size;
     GLenum maxcount;
+    GLShadowState::IdxBuffer *shadowBufs;
   } idxBufs[] = {
       {
           AtomicCounter, ARRAY_COUNT(AtomicCounter), eGL_ATOMIC_COUNTER_BUFFER_BINDING,
           eGL_ATOMIC_COUNTER_BUFFER_START, eGL_ATOMIC_COUNTER_BUFFER_SIZE,
-          eGL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS,
+          eGL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS, shadow ? shadow->AtomicCounter : NULL,
       },
       {
           ShaderStorage, ARRAY_COUNT(ShaderStorage), eGL_SHADER_STORAGE_BUFFER_BINDING,
           eGL_SHADER_STORAGE_BUFFER_START, eGL_SHADER_STORAGE_BUFFER_SIZE,
-          eGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS,
+          eGL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, shadow ? shadow->ShaderStorage : NULL,
       },
       {
           TransformFeedback, ARRAY_COUNT(TransformFeedback), eGL_TRANSFORM_FEEDBACK_BUFFER_BINDING,
           eGL_TRANSFORM_FEEDBACK_BUFFER_START, eGL_TRANSFORM_FEEDBACK_BUFFER_SIZE,
-          eGL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS,
+          eGL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS, NULL,
       },
       {
           UniformBinding, ARRAY_COUNT(UniformBinding), eGL_UNIFORM_BUFFER_BINDING,
           eGL_UNIFORM_BUFFER_START, eGL_UNIFORM_BUFFER_SIZE, eGL_MAX_UNIFORM_BUFFER_BINDINGS,
+          shadow ? shadow->UniformBinding : NULL,
       },
   };
 
@@ -803,6 +1054,20 @@ void GLRenderState::FetchState(void *ctx, WrappedOpenGL *gl)
     if(idxBufs[b].binding == eGL_TRANSFORM_FEEDBACK_BUFFER_BINDING && !HasExt[ARB_transform_feedback2])
       continue;
 
+    // the shadowed arrays are the same size as ours, and anything past the implementation's
+    // limit can't have been bound
+    if(idxBufs[b].shadowBufs)
+    {
+      for(int i = 0; i < idxBufs[b].count; i++)
+      {
+        idxBufs[b].bufs[i].name = idxBufs[b].shadowBufs[i].name;
+        idxBufs[b].bufs[i].start = idxBufs[b].shadowBufs[i].start;
+        idxBufs[b].bufs[i].size = idxBufs[b].shadowBufs[i].size;
+      }
+
+      continue;
+    }
+
     GLint maxCount = 0;
     m_Real->glGetIntegerv(idxBufs[b].maxcount, &maxCount);
     for(int i = 0; i < idxBufs[b].count && i < maxCount; i++)
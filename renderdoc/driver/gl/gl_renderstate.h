@@ -52,6 +52,60 @@ struct PixelUnpackState
                          GLsizei &imageSize);
 };
 
+enum ShadowStateMode
+{
+  eShadowState_Disabled,
+  eShadowState_Enabled,
+  eShadowState_Validate,
+};
+
+// A CPU-side copy of a context's indexed buffer and image unit bindings, kept up to date by the
+// WrappedOpenGL binding functions while capturing. With it GLRenderState::FetchState and MarkDirty
+// can read the bindings without a glGet round-trip per index, which on some drivers stalls.
+// Transform feedback buffer bindings belong to the bound feedback object rather than the context
+// so they are always queried.
+struct GLShadowState
+{
+  GLShadowState() { Reset(); }
+  void Reset();
+
+  void BindBuffer(GLenum target, GLuint index, GLuint buffer, uint64_t start, uint64_t size);
+  void BindImage(GLuint unit, GLuint texture, GLint level, bool layered, GLint layer, GLenum access,
+                 GLenum format);
+
+  // deleting an object resets any of its bindings on the current context
+  void BufferDeleted(GLuint buffer);
+  void TextureDeleted(GLuint texture);
+
+  // compares the shadowed bindings to the driver's, logging and correcting any differences.
+  void Validate(const GLHookSet *funcs);
+
+  struct IdxBuffer
+  {
+    GLuint name;
+    uint64_t start;
+    uint64_t size;
+  };
+
+  struct Image
+  {
+    GLuint name;
+    GLuint level;
+    bool layered;
+    GLuint layer;
+    GLenum access;
+    GLenum format;
+  };
+
+  // sized to match GLRenderState. If the application binds past the end the bindings are no longer
+  // completely known, and we fall back to querying the driver.
+  IdxBuffer AtomicCounter[8], ShaderStorage[96], UniformBinding[84];
+  Image Images[8];
+
+  bool BuffersOverflowed;
+  bool ImagesOverflowed;
+};
+
 struct GLRenderState
 {
   GLRenderState(const GLHookSet *funcs, Serialiser *ser, LogState state);
@@ -372,6 +372,8 @@ void GLReplay::GetBufferData(ResourceId buff, uint64_t offset, uint64_t len, vec
 
   auto &buf = m_pDriver->m_Buffers[buff];
 
+  m_pDriver->GetResourceManager()->EnsureInitialState(buff);
+
   uint64_t bufsize = buf.size;
 
   if(len > 0 && offset + len > bufsize)
@@ -2234,6 +2236,8 @@ byte *GLReplay::GetTextureData(ResourceId tex, uint32_t arrayIdx, uint32_t mip,
 
   auto &texDetails = m_pDriver->m_Textures[tex];
 
+  m_pDriver->GetResourceManager()->EnsureInitialState(tex);
+
   byte *ret = NULL;
 
   GLuint tempTex = 0;
@@ -280,6 +280,48 @@ foreach my $el (@unsupported)
        print "    HandleUnsupported($el->{typedef}, $el->{name}); \\\n"
 }
 print "\n";
+print "\n";
+print "\n";
+
+# the same names as the checks above, sorted so they can be binary searched. If a name appears
+# more than once the first check above that would match it wins, same as the if() chain.
+my %hooktable = ();
+foreach my $el (@dllexportfuncs)
+{
+	$hooktable{$el->{name}} = "HookTableEntry($el->{name})" if not exists $hooktable{$el->{name}};
+}
+foreach my $el (@glextfuncs)
+{
+	$hooktable{$el->{name}} = "HookTableEntry($el->{name})" if not exists $hooktable{$el->{name}};
+	foreach my $alias (@{$el->{aliases}})
+	{
+		$hooktable{$alias} = "HookTableAlias($el->{name}, $alias)" if not exists $hooktable{$alias};
+	}
+}
+
+print "// all hooked functions and aliases, sorted by name\n";
+print "#define GLHookTable() \\\n";
+foreach my $name (sort keys %hooktable)
+{
+	print "  $hooktable{$name} \\\n";
+}
+print "\n";
+print "\n";
+print "\n";
+
+my %unsupportedtable = ();
+foreach my $el (@unsupported)
+{
+	$unsupportedtable{$el->{name}} = "UnsupportedTableEntry($el->{name})";
+}
+
+print "// unsupported entry points, sorted by (lowercase) name\n";
+print "#define GLUnsupportedTable() \\\n";
+foreach my $name (sort keys %unsupportedtable)
+{
+	print "  $unsupportedtable{$name} \\\n";
+}
+print "\n";
 print "// clang-format on\n";
 print "\n";
 
@@ -1102,6 +1102,9 @@ void WrappedOpenGL::glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
   }
 
   m_Real.glBindBufferBase(target, index, buffer);
+
+  if(m_ShadowStateMode != eShadowState_Disabled)
+    cd.m_Shadow.BindBuffer(target, index, buffer, 0, 0);
 }
 
 bool WrappedOpenGL::Serialise_glBindBufferRange(GLenum target, GLuint index, GLuint buffer,
@@ -1210,6 +1213,9 @@ void WrappedOpenGL::glBindBufferRange(GLenum target, GLuint index, GLuint buffer
   }
 
   m_Real.glBindBufferRange(target, index, buffer, offset, size);
+
+  if(m_ShadowStateMode != eShadowState_Disabled)
+    cd.m_Shadow.BindBuffer(target, index, buffer, (uint64_t)offset, (uint64_t)size);
 }
 
 bool WrappedOpenGL::Serialise_glBindBuffersBase(GLenum target, GLuint first, GLsizei count,
@@ -1256,6 +1262,12 @@ void WrappedOpenGL::glBindBuffersBase(GLenum target, GLuint first, GLsizei count
 
   ContextData &cd = GetCtxData();
 
+  if(m_ShadowStateMode != eShadowState_Disabled)
+  {
+    for(GLsizei i = 0; i < count; i++)
+      cd.m_Shadow.BindBuffer(target, first + i, buffers ? buffers[i] : 0, 0, 0);
+  }
+
   if(m_State >= WRITING && buffers && count > 0)
   {
     size_t idx = BufferIdx(target);
@@ -1407,6 +1419,18 @@ void WrappedOpenGL::glBindBuffersRange(GLenum target, GLuint first, GLsizei coun
 
   ContextData &cd = GetCtxData();
 
+  if(m_ShadowStateMode != eShadowState_Disabled)
+  {
+    for(GLsizei i = 0; i < count; i++)
+    {
+      if(buffers)
+        cd.m_Shadow.BindBuffer(target, first + i, buffers[i], (uint64_t)offsets[i],
+                               (uint64_t)sizes[i]);
+      else
+        cd.m_Shadow.BindBuffer(target, first + i, 0, 0, 0);
+    }
+  }
+
   if(m_State >= WRITING && buffers && count > 0)
   {
     size_t idx = BufferIdx(target);
@@ -4397,6 +4421,9 @@ void WrappedOpenGL::glDeleteBuffers(GLsizei n, const GLuint *buffers)
         record->FreeShadowStorage();
       }
 
+      if(m_ShadowStateMode != eShadowState_Disabled)
+        GetCtxData().m_Shadow.BufferDeleted(buffers[i]);
+
       GetResourceManager()->MarkCleanResource(res);
       if(GetResourceManager()->HasResourceRecord(res))
         GetResourceManager()->GetResourceRecord(res)->Delete(GetResourceManager());
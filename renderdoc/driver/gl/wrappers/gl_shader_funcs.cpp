@@ -194,7 +194,7 @@ bool WrappedOpenGL::Serialise_glShaderSource(GLuint shader, GLsizei count,
     {
       m_Real.glDeleteProgram(m_Shaders[liveId].prog);
       m_Shaders[liveId].prog = 0;
-      m_Shaders[liveId].spirv = SPVModule();
+      m_Shaders[liveId].spirv.Clear();
       m_Shaders[liveId].reflection = ShaderReflection();
     }
 
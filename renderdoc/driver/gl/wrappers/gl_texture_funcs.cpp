@@ -179,6 +179,9 @@ void WrappedOpenGL::glDeleteTextures(GLsizei n, const GLuint *textures)
         GetResourceManager()->GetResourceRecord(res)->Delete(GetResourceManager());
       GetResourceManager()->UnregisterResource(res);
     }
+
+    if(m_ShadowStateMode != eShadowState_Disabled)
+      GetCtxData().m_Shadow.TextureDeleted(textures[i]);
   }
 
   m_Real.glDeleteTextures(n, textures);
@@ -533,6 +536,10 @@ void WrappedOpenGL::glBindImageTexture(GLuint unit, GLuint texture, GLint level,
 {
   m_Real.glBindImageTexture(unit, texture, level, layered, layer, access, format);
 
+  if(m_ShadowStateMode != eShadowState_Disabled)
+    GetCtxData().m_Shadow.BindImage(unit, texture, level, layered == GL_TRUE, layer, access,
+                                    format);
+
   if(m_State == WRITING_CAPFRAME)
   {
     Chunk *chunk = NULL;
@@ -594,6 +601,34 @@ void WrappedOpenGL::glBindImageTextures(GLuint first, GLsizei count, const GLuin
 {
   m_Real.glBindImageTextures(first, count, textures);
 
+  if(m_ShadowStateMode != eShadowState_Disabled)
+  {
+    GLShadowState &shadow = GetCtxData().m_Shadow;
+
+    for(GLsizei i = 0; i < count; i++)
+    {
+      GLuint tex = textures ? textures[i] : 0;
+
+      if(tex == 0)
+      {
+        shadow.BindImage(first + i, 0, 0, false, 0, eGL_READ_ONLY, eGL_R8);
+        continue;
+      }
+
+      // multi-bind binds the whole of level 0, layered if the texture has layers
+      TextureData &details = m_Textures[GetResourceManager()->GetID(TextureRes(GetCtx(), tex))];
+
+      bool layered = details.curType == eGL_TEXTURE_1D_ARRAY ||
+                     details.curType == eGL_TEXTURE_2D_ARRAY ||
+                     details.curType == eGL_TEXTURE_CUBE_MAP ||
+                     details.curType == eGL_TEXTURE_CUBE_MAP_ARRAY ||
+                     details.curType == eGL_TEXTURE_3D ||
+                     details.curType == eGL_TEXTURE_2D_MULTISAMPLE_ARRAY;
+
+      shadow.BindImage(first + i, tex, 0, layered, 0, eGL_READ_WRITE, details.internalFormat);
+    }
+  }
+
   if(m_State >= WRITING_CAPFRAME)
   {
     SCOPED_SERIALISE_CONTEXT(BIND_IMAGE_TEXTURES);
@@ -632,6 +667,9 @@ bool WrappedOpenGL::Serialise_glTextureView(GLuint texture, GLenum target, GLuin
     ResourceId liveTexId = GetResourceManager()->GetLiveID(texid);
     ResourceId liveOrigId = GetResourceManager()->GetLiveID(origid);
 
+    GetResourceManager()->MarkSharedStorage(texid);
+    GetResourceManager()->MarkSharedStorage(origid);
+
     m_Textures[liveTexId].curType = TextureTarget(Target);
     m_Textures[liveTexId].internalFormat = InternalFormat;
     m_Textures[liveTexId].view = true;
@@ -52,3 +52,59 @@ void ShutdownSPIRVCompiler()
     glslang::FinalizeProcess();
   }
 }
+
+SPVArena::SPVArena()
+{
+  m_Cur = m_End = NULL;
+  m_NextBlockSize = 64 * 1024;
+}
+
+SPVArena::~SPVArena()
+{
+  Clear();
+}
+
+void SPVArena::Reserve(size_t bytes)
+{
+  if(size_t(m_End - m_Cur) < bytes && m_NextBlockSize < bytes)
+    m_NextBlockSize = bytes;
+}
+
+void *SPVArena::Alloc(size_t size, size_t alignment)
+{
+  char *ret = AlignUpPtr(m_Cur, alignment);
+
+  if(m_Cur == NULL || ret + size > m_End)
+  {
+    size_t blockSize = RDCMAX(m_NextBlockSize, size + alignment);
+
+    m_Blocks.push_back(new char[blockSize]);
+    m_Cur = m_Blocks.back();
+    m_End = m_Cur + blockSize;
+
+    ret = AlignUpPtr(m_Cur, alignment);
+  }
+
+  m_Cur = ret + size;
+
+  return ret;
+}
+
+void SPVArena::RegisterDestructor(void *obj, DestroyFunc func, size_t count)
+{
+  Destructor d = {obj, func, count};
+  m_Destructors.push_back(d);
+}
+
+void SPVArena::Clear()
+{
+  for(size_t i = m_Destructors.size(); i > 0; i--)
+    m_Destructors[i - 1].func(m_Destructors[i - 1].obj, m_Destructors[i - 1].count);
+  m_Destructors.clear();
+
+  for(size_t i = 0; i < m_Blocks.size(); i++)
+    delete[] m_Blocks[i];
+  m_Blocks.clear();
+
+  m_Cur = m_End = NULL;
+}
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <new>
 #include <string>
 #include <vector>
 #include "3rdparty/glslang/SPIRV/spirv.hpp"
@@ -47,17 +48,98 @@ void InitSPIRVCompiler();
 void ShutdownSPIRVCompiler();
 
 struct SPVInstruction;
+struct SPVDecoration;
 
 struct ShaderReflection;
 struct ShaderBindpointMapping;
 
+// Bump allocator owning everything parsed out of a module. Objects are constructed in place in
+// large blocks and all destroyed together, instead of one heap allocation per instruction.
+class SPVArena
+{
+public:
+  SPVArena();
+  ~SPVArena();
+
+  // size the next block to hold at least this many bytes, to avoid growing in small steps
+  void Reserve(size_t bytes);
+
+  template <typename T>
+  T *New()
+  {
+    T *ret = new(Alloc(sizeof(T), alignof(T))) T();
+    RegisterDestructor(ret, &Destroy<T>, 1);
+    return ret;
+  }
+
+  template <typename T>
+  T *NewArray(size_t count)
+  {
+    if(count == 0)
+      return NULL;
+
+    T *ret = (T *)Alloc(sizeof(T) * count, alignof(T));
+    for(size_t i = 0; i < count; i++)
+      new(ret + i) T();
+    RegisterDestructor(ret, &Destroy<T>, count);
+    return ret;
+  }
+
+  // destroys all objects in reverse order of creation and frees all blocks
+  void Clear();
+
+private:
+  SPVArena(const SPVArena &);
+  SPVArena &operator=(const SPVArena &);
+
+  template <typename T>
+  static void Destroy(void *obj, size_t count)
+  {
+    for(size_t i = 0; i < count; i++)
+      ((T *)obj)[i].~T();
+  }
+
+  typedef void (*DestroyFunc)(void *obj, size_t count);
+
+  void *Alloc(size_t size, size_t alignment);
+  void RegisterDestructor(void *obj, DestroyFunc func, size_t count);
+
+  struct Destructor
+  {
+    void *obj;
+    DestroyFunc func;
+    size_t count;
+  };
+
+  vector<char *> m_Blocks;
+  char *m_Cur;
+  char *m_End;
+  size_t m_NextBlockSize;
+  vector<Destructor> m_Destructors;
+};
+
+// A parsed module. Parsing still builds the SPVInstruction graph that Disassemble and
+// MakeReflection walk, but every node in it comes from the arena and decorations live in one flat
+// array, so a module is freed in bulk rather than instruction by instruction. There is no separate
+// SoA word stream or id-to-offset table - the graph is the only representation both consumers use.
 struct SPVModule
 {
   SPVModule();
   ~SPVModule();
 
+  // releases everything parsed, returning the module to its default-constructed state
+  void Clear();
+
+  // owns all SPVInstructions and their data, and the flat decoration array
+  SPVArena arena;
+
   vector<uint32_t> spirv;
 
+  // every decoration in the module, sorted by target ID then member. Instructions and struct
+  // members reference contiguous ranges of this.
+  SPVDecoration *decorations;
+  size_t numDecorations;
+
   struct
   {
     uint8_t major, minor;
@@ -376,6 +376,18 @@ struct SPVDecoration
   }
 };
 
+// a contiguous run of decorations in the module's flat decoration array
+struct SPVDecorationList
+{
+  SPVDecorationList() : data(NULL), count(0) {}
+  const SPVDecoration *data;
+  uint32_t count;
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  const SPVDecoration &operator[](size_t i) const { return data[i]; }
+};
+
 struct SPVExtInstSet
 {
   SPVExtInstSet() : canonicalNames(NULL), friendlyNames(NULL) {}
@@ -453,7 +465,7 @@ struct SPVTypeData
 
   bool IsBasicInt() const { return type == eUInt || type == eSInt; }
   bool IsScalar() const { return type < eBasicCount && type != eVoid; }
-  string DeclareVariable(const vector<SPVDecoration> &vardecorations, const string &varName)
+  string DeclareVariable(const SPVDecorationList &vardecorations, const string &varName)
   {
     string ret = "";
 
@@ -574,11 +586,11 @@ struct SPVTypeData
     return name;
   }
 
-  vector<SPVDecoration> *decorations;
+  const SPVDecorationList *decorations;
 
   // struct/function
   vector<pair<SPVTypeData *, string> > children;
-  vector<vector<SPVDecoration> > childDecorations;    // matches children
+  vector<SPVDecorationList> childDecorations;    // matches children
 
   // pointer
   spv::StorageClass storage;
@@ -873,19 +885,6 @@ struct SPVInstruction
     source.col = source.line = 0;
   }
 
-  ~SPVInstruction()
-  {
-    SAFE_DELETE(ext);
-    SAFE_DELETE(entry);
-    SAFE_DELETE(op);
-    SAFE_DELETE(flow);
-    SAFE_DELETE(type);
-    SAFE_DELETE(func);
-    SAFE_DELETE(block);
-    SAFE_DELETE(constant);
-    SAFE_DELETE(var);
-  }
-
   spv::Op opcode;
   uint32_t id;
 
@@ -1978,9 +1977,9 @@ struct SPVInstruction
     return ret;
   }
 
-  vector<SPVDecoration> decorations;
+  SPVDecorationList decorations;
 
-  // zero or one of these pointers might be set
+  // zero or one of these pointers might be set. They're owned by the module's arena
   SPVExtInstSet *ext;       // this ID is an extended instruction set
   SPVEntryPoint *entry;     // this ID is an entry point
   SPVOperation *op;         // this ID is the result of an operation
@@ -2087,13 +2086,39 @@ SPVModule::SPVModule()
   generator = 0;
   sourceVer = 0;
   sourceLang = spv::SourceLanguageUnknown;
+  decorations = NULL;
+  numDecorations = 0;
 }
 
 SPVModule::~SPVModule()
 {
-  for(size_t i = 0; i < operations.size(); i++)
-    delete operations[i];
+  Clear();
+}
+
+void SPVModule::Clear()
+{
   operations.clear();
+  ids.clear();
+  sourceexts.clear();
+  entries.clear();
+  globals.clear();
+  specConstants.clear();
+  funcs.clear();
+  structs.clear();
+
+  spirv.clear();
+  extensions.clear();
+  capabilities.clear();
+
+  decorations = NULL;
+  numDecorations = 0;
+
+  arena.Clear();
+
+  moduleVersion.major = moduleVersion.minor = 0;
+  generator = 0;
+  sourceVer = 0;
+  sourceLang = spv::SourceLanguageUnknown;
 }
 
 SPVInstruction *SPVModule::GetByID(uint32_t id)
@@ -2105,7 +2130,7 @@ SPVInstruction *SPVModule::GetByID(uint32_t id)
   // an ID, it won't be in our list so we have to add a dummy instruction for it
   RDCWARN("Expected to find ID %u but didn't - returning dummy instruction", id);
 
-  operations.push_back(new SPVInstruction());
+  operations.push_back(arena.New<SPVInstruction>());
   SPVInstruction &op = *operations.back();
   op.opcode = spv::OpUnknown;
   op.id = id;
@@ -3422,7 +3447,7 @@ string SPVModule::Disassemble(const string &entryPoint)
 void MakeConstantBlockVariables(SPVTypeData *structType, rdctype::array<ShaderConstant> &cblock);
 
 void MakeConstantBlockVariable(ShaderConstant &outConst, SPVTypeData *type, const std::string &name,
-                               const std::vector<SPVDecoration> &decorations)
+                               const SPVDecorationList &decorations)
 {
   outConst.name = name;
 
@@ -3678,7 +3703,7 @@ typedef bindpair<ConstantBlock> cblockpair;
 typedef bindpair<ShaderResource> shaderrespair;
 
 void AddSignatureParameter(uint32_t id, uint32_t childIdx, string varName, SPVTypeData *type,
-                           const vector<SPVDecoration> &decorations, vector<SigParameter> &sigarray)
+                           const SPVDecorationList &decorations, vector<SigParameter> &sigarray)
 {
   SigParameter sig;
 
@@ -3918,7 +3943,7 @@ void SPVModule::MakeReflection(const string &entryPoint, ShaderReflection *refle
         if(inst->var->type->type == SPVTypeData::ePointer &&
            inst->var->type->baseType->type == SPVTypeData::eStruct)
         {
-          vector<vector<SPVDecoration> > &childDecorations =
+          vector<SPVDecorationList> &childDecorations =
               inst->var->type->baseType->childDecorations;
 
           for(size_t c = 0; c < childDecorations.size(); c++)
@@ -4381,6 +4406,24 @@ void SPVModule::MakeReflection(const string &entryPoint, ShaderReflection *refle
   }
 }
 
+struct FlatDecoration
+{
+  uint32_t id;
+  // ~0U for decorations on the ID itself, otherwise the struct member index
+  uint32_t member;
+  SPVDecoration decoration;
+};
+
+struct SortByTarget
+{
+  bool operator()(const FlatDecoration &a, const FlatDecoration &b) const
+  {
+    if(a.id != b.id)
+      return a.id < b.id;
+    return a.member < b.member;
+  }
+};
+
 void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
 {
   if(spirv[0] != (uint32_t)spv::MagicNumber)
@@ -4410,15 +4453,38 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
 
   RDCASSERT(spirv[4] == 0);
 
+  // count instructions up front so that the instruction list and the arena are allocated once,
+  // rather than growing as we go
+  size_t numInstructions = 0;
+
+  size_t it = 5;
+  while(it < spirvLength)
+  {
+    uint16_t WordCount = spirv[it] >> spv::WordCountShift;
+
+    // a zero word count would loop forever, and means the module is malformed anyway
+    if(WordCount == 0)
+    {
+      RDCERR("Invalid SPIR-V - zero word count at offset %u", (uint32_t)it);
+      return;
+    }
+
+    numInstructions++;
+    it += WordCount;
+  }
+
+  module.operations.reserve(numInstructions);
+  module.arena.Reserve(numInstructions * (sizeof(SPVInstruction) + sizeof(SPVOperation)));
+
   SPVFunction *curFunc = NULL;
   SPVBlock *curBlock = NULL;
 
-  size_t it = 5;
+  it = 5;
   while(it < spirvLength)
   {
     uint16_t WordCount = spirv[it] >> spv::WordCountShift;
 
-    module.operations.push_back(new SPVInstruction());
+    module.operations.push_back(module.arena.New<SPVInstruction>());
     SPVInstruction &op = *module.operations.back();
 
     op.opcode = spv::Op(spirv[it] & spv::OpCodeMask);
@@ -4484,7 +4550,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpEntryPoint:
       {
-        op.entry = new SPVEntryPoint();
+        op.entry = module.arena.New<SPVEntryPoint>();
         op.entry->func = spirv[it + 2];
         op.entry->model = spv::ExecutionModel(spirv[it + 1]);
         op.entry->name = (const char *)&spirv[it + 3];
@@ -4518,7 +4584,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpExtInstImport:
       {
-        op.ext = new SPVExtInstSet();
+        op.ext = module.arena.New<SPVExtInstSet>();
         op.ext->setname = (const char *)&spirv[it + 2];
         op.ext->canonicalNames = NULL;
 
@@ -4544,7 +4610,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       // Type opcodes
       case spv::OpTypeVoid:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eVoid;
 
         op.id = spirv[it + 1];
@@ -4553,7 +4619,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeBool:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eBool;
 
         op.id = spirv[it + 1];
@@ -4562,7 +4628,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeInt:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = spirv[it + 3] ? SPVTypeData::eSInt : SPVTypeData::eUInt;
         op.type->bitCount = spirv[it + 2];
 
@@ -4572,7 +4638,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeFloat:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eFloat;
         op.type->bitCount = spirv[it + 2];
 
@@ -4582,7 +4648,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeVector:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eVector;
 
         SPVInstruction *baseTypeInst = module.GetByID(spirv[it + 2]);
@@ -4597,7 +4663,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeMatrix:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eMatrix;
 
         SPVInstruction *baseTypeInst = module.GetByID(spirv[it + 2]);
@@ -4615,7 +4681,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeArray:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eArray;
 
         SPVInstruction *baseTypeInst = module.GetByID(spirv[it + 2]);
@@ -4634,7 +4700,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeRuntimeArray:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eArray;
 
         SPVInstruction *baseTypeInst = module.GetByID(spirv[it + 2]);
@@ -4649,7 +4715,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeStruct:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eStruct;
 
         for(int i = 2; i < WordCount; i++)
@@ -4659,7 +4725,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
 
           // names might come later from OpMemberName instructions
           op.type->children.push_back(make_pair(memberInst->type, ""));
-          op.type->childDecorations.push_back(vector<SPVDecoration>());
+          op.type->childDecorations.push_back(SPVDecorationList());
         }
 
         module.structs.push_back(&op);
@@ -4670,7 +4736,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypePointer:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::ePointer;
 
         SPVInstruction *baseTypeInst = module.GetByID(spirv[it + 3]);
@@ -4685,7 +4751,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeImage:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eImage;
 
         SPVInstruction *baseTypeInst = module.GetByID(spirv[it + 2]);
@@ -4708,7 +4774,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeSampler:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eSampler;
 
         op.id = spirv[it + 1];
@@ -4717,7 +4783,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeSampledImage:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eSampledImage;
 
         SPVInstruction *baseTypeInst = module.GetByID(spirv[it + 2]);
@@ -4731,7 +4797,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpTypeFunction:
       {
-        op.type = new SPVTypeData();
+        op.type = module.arena.New<SPVTypeData>();
         op.type->type = SPVTypeData::eFunction;
 
         for(int i = 3; i < WordCount; i++)
@@ -4741,7 +4807,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
 
           // function parameters have no name
           op.type->children.push_back(make_pair(argInst->type, ""));
-          op.type->childDecorations.push_back(vector<SPVDecoration>());
+          op.type->childDecorations.push_back(SPVDecorationList());
         }
 
         SPVInstruction *baseTypeInst = module.GetByID(spirv[it + 2]);
@@ -4764,7 +4830,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.constant = new SPVConstant();
+        op.constant = module.arena.New<SPVConstant>();
         op.constant->specialized =
             (op.opcode == spv::OpSpecConstantTrue || op.opcode == spv::OpSpecConstantFalse);
         op.constant->type = typeInst->type;
@@ -4781,7 +4847,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.constant = new SPVConstant();
+        op.constant = module.arena.New<SPVConstant>();
         op.constant->type = typeInst->type;
 
         op.constant->u32 = 0;
@@ -4796,7 +4862,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.constant = new SPVConstant();
+        op.constant = module.arena.New<SPVConstant>();
         op.constant->specialized = op.opcode == spv::OpSpecConstant;
         op.constant->type = typeInst->type;
 
@@ -4823,7 +4889,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.constant = new SPVConstant();
+        op.constant = module.arena.New<SPVConstant>();
         op.constant->specialized = op.opcode == spv::OpSpecConstantComposite;
         op.constant->type = typeInst->type;
 
@@ -4845,7 +4911,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.constant = new SPVConstant();
+        op.constant = module.arena.New<SPVConstant>();
         op.constant->type = typeInst->type;
 
         op.constant->sampler.addressing = spv::SamplerAddressingMode(spirv[it + 3]);
@@ -4862,7 +4928,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.constant = new SPVConstant();
+        op.constant = module.arena.New<SPVConstant>();
         op.constant->specialized = true;
         op.constant->type = typeInst->type;
 
@@ -4891,7 +4957,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 4]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.func = new SPVFunction();
+        op.func = module.arena.New<SPVFunction>();
         op.func->retType = retTypeInst->type;
         op.func->funcType = typeInst->type;
         op.func->control = spv::FunctionControlMask(spirv[it + 3]);
@@ -4928,7 +4994,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.var = new SPVVariable();
+        op.var = module.arena.New<SPVVariable>();
         op.var->type = typeInst->type;
         op.var->storage = spv::StorageClass(spirv[it + 3]);
 
@@ -4953,7 +5019,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.var = new SPVVariable();
+        op.var = module.arena.New<SPVVariable>();
         op.var->type = typeInst->type;
         op.var->storage = spv::StorageClassFunction;
 
@@ -4968,7 +5034,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       // Branching/flow control
       case spv::OpLabel:
       {
-        op.block = new SPVBlock();
+        op.block = module.arena.New<SPVBlock>();
 
         RDCASSERT(curFunc);
 
@@ -4983,7 +5049,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       case spv::OpUnreachable:
       case spv::OpReturn:
       {
-        op.flow = new SPVFlowControl();
+        op.flow = module.arena.New<SPVFlowControl>();
 
         curBlock->exitFlow = &op;
         curBlock = NULL;
@@ -4991,7 +5057,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpReturnValue:
       {
-        op.flow = new SPVFlowControl();
+        op.flow = module.arena.New<SPVFlowControl>();
 
         op.flow->targets.push_back(spirv[it + 1]);
 
@@ -5001,7 +5067,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpBranch:
       {
-        op.flow = new SPVFlowControl();
+        op.flow = module.arena.New<SPVFlowControl>();
 
         op.flow->targets.push_back(spirv[it + 1]);
 
@@ -5011,7 +5077,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpBranchConditional:
       {
-        op.flow = new SPVFlowControl();
+        op.flow = module.arena.New<SPVFlowControl>();
 
         SPVInstruction *condInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(condInst);
@@ -5032,7 +5098,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpSwitch:
       {
-        op.flow = new SPVFlowControl();
+        op.flow = module.arena.New<SPVFlowControl>();
 
         SPVInstruction *condInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(condInst);
@@ -5059,7 +5125,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpSelectionMerge:
       {
-        op.flow = new SPVFlowControl();
+        op.flow = module.arena.New<SPVFlowControl>();
 
         op.flow->targets.push_back(spirv[it + 1]);
         op.flow->selControl = spv::SelectionControlMask(spirv[it + 2]);
@@ -5069,7 +5135,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       }
       case spv::OpLoopMerge:
       {
-        op.flow = new SPVFlowControl();
+        op.flow = module.arena.New<SPVFlowControl>();
 
         op.flow->targets.push_back(spirv[it + 1]);
         op.flow->loopControl = spv::LoopControlMask(spirv[it + 2]);
@@ -5084,7 +5150,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = typeInst->type;
 
         SPVInstruction *ptrInst = module.GetByID(spirv[it + 3]);
@@ -5105,7 +5171,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       case spv::OpStore:
       case spv::OpCopyMemory:
       {
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = NULL;
 
         SPVInstruction *ptrInst = module.GetByID(spirv[it + 1]);
@@ -5129,7 +5195,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = typeInst->type;
 
         for(int i = 3; i < WordCount; i += 2)
@@ -5158,7 +5224,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = typeInst->type;
 
         SPVInstruction *imageInst = module.GetByID(spirv[it + 3]);
@@ -5265,7 +5331,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
           default: break;
         }
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
 
         if(op.opcode != spv::OpImageWrite)
         {
@@ -5510,7 +5576,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
 
         word++;
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = typeInst->type;
         op.op->mathop = mathop;
 
@@ -5549,7 +5615,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       {
         // these don't emit an ID, don't take a type, they are just
         // single operations
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = NULL;
 
         curBlock->instructions.push_back(&op);
@@ -5559,7 +5625,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       case spv::OpMemoryBarrier:
       {
         // these don't emit an ID, just have some properties
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = NULL;
 
         int word = 1;
@@ -5603,7 +5669,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = typeInst->type;
 
         {
@@ -5634,7 +5700,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + 1]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = typeInst->type;
 
         {
@@ -5669,7 +5735,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         SPVInstruction *typeInst = module.GetByID(spirv[it + word]);
         RDCASSERT(typeInst && typeInst->type);
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
         op.op->type = typeInst->type;
 
         word++;
@@ -5722,7 +5788,7 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
       {
         int word = 1;
 
-        op.op = new SPVOperation();
+        op.op = module.arena.New<SPVOperation>();
 
         // all atomic operations but store return a new ID of a given type
         if(op.opcode != spv::OpAtomicStore)
@@ -5834,6 +5900,10 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
     it += WordCount;
   }
 
+  // decorations are gathered in file order and then sorted into one flat array, so that each
+  // instruction and struct member references a contiguous range of it
+  vector<FlatDecoration> flatDecorations;
+
   // second pass now that we have all ids set up, apply decorations/names/etc
   it = 5;
   while(it < spirvLength)
@@ -5894,10 +5964,8 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         if(WordCount > 3)
           d.val = spirv[it + 3];
 
-        inst->decorations.push_back(d);
-
-        if(inst->type)
-          inst->type->decorations = &inst->decorations;
+        FlatDecoration flat = {spirv[it + 1], ~0U, d};
+        flatDecorations.push_back(flat);
 
         if(d.decoration == spv::DecorationSpecId && inst->opcode != spv::OpSpecConstantOp)
         {
@@ -5925,7 +5993,8 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
         if(WordCount > 4)
           d.val = spirv[it + 4];
 
-        structInst->type->childDecorations[memberIdx].push_back(d);
+        FlatDecoration flat = {spirv[it + 1], memberIdx, d};
+        flatDecorations.push_back(flat);
         break;
       }
       case spv::OpGroupDecorate:
@@ -5937,6 +6006,43 @@ void ParseSPIRV(uint32_t *spirv, size_t spirvLength, SPVModule &module)
     it += WordCount;
   }
 
+  // stable so that decorations on the same target keep their declaration order
+  std::stable_sort(flatDecorations.begin(), flatDecorations.end(), SortByTarget());
+
+  module.numDecorations = flatDecorations.size();
+  module.decorations = module.arena.NewArray<SPVDecoration>(flatDecorations.size());
+
+  for(size_t d = 0; d < flatDecorations.size();)
+  {
+    uint32_t id = flatDecorations[d].id;
+    uint32_t member = flatDecorations[d].member;
+
+    SPVDecorationList list;
+    list.data = module.decorations + d;
+
+    for(; d < flatDecorations.size() && flatDecorations[d].id == id &&
+          flatDecorations[d].member == member;
+        d++)
+    {
+      module.decorations[d] = flatDecorations[d].decoration;
+      list.count++;
+    }
+
+    SPVInstruction *inst = module.ids[id];
+
+    if(member == ~0U)
+    {
+      inst->decorations = list;
+
+      if(inst->type)
+        inst->type->decorations = &inst->decorations;
+    }
+    else if(inst->type && member < inst->type->childDecorations.size())
+    {
+      inst->type->childDecorations[member] = list;
+    }
+  }
+
   struct SortByVarClass
   {
     bool operator()(const SPVInstruction *a, const SPVInstruction *b)
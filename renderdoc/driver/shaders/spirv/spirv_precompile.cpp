@@ -0,0 +1,311 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+// Build-time tool that compiles the vulkan debug shaders in data/glsl to SPIR-V and writes them out
+// as a C++ table, which is linked into renderdoc and looked up by VulkanDebugManager::GetSPIRVBlob
+// before falling back to compiling with glslang at runtime.
+//
+// This only has to produce the same *sources* as VulkanDebugManager does, the lookup is keyed by
+// HashGLSLShader. Any permutation missing from the list below is still compiled at runtime, but
+// VulkanDebugManager::GetSPIRVBlob logs an error for it, so the list must be kept in step with
+// vk_debug.cpp.
+//
+// Usage: spirv-precompile <path to data/glsl> <output.cpp>
+
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "3rdparty/glslang/SPIRV/GlslangToSpv.h"
+#include "3rdparty/glslang/glslang/Public/ShaderLang.h"
+#include "data/glsl_shaders.h"
+#include "spirv_common.h"
+#include "spirv_resources.h"
+
+struct ShaderPermutation
+{
+  const char *file;
+  SPIRVShaderStage stage;
+  std::string defines;
+  bool uniforms;
+};
+
+struct CompiledShader
+{
+  uint64_t hash;
+  SPIRVShaderStage stage;
+  std::string name;
+  std::vector<uint32_t> spirv;
+
+  bool operator<(const CompiledShader &o) const { return hash < o.hash; }
+};
+
+static bool ReadFile(const std::string &path, std::string &contents)
+{
+  std::ifstream f(path.c_str(), std::ios::in | std::ios::binary);
+  if(!f)
+    return false;
+
+  std::stringstream ss;
+  ss << f.rdbuf();
+  contents = ss.str();
+  return true;
+}
+
+// mirrors the permutations generated in VulkanDebugManager's constructor
+static std::vector<ShaderPermutation> GetPermutations()
+{
+  std::vector<ShaderPermutation> ret;
+
+  ShaderPermutation p;
+
+  // MS <-> array depth copies, text rendering
+  struct
+  {
+    const char *file;
+    SPIRVShaderStage stage;
+  } plain[] = {
+      {"blit.vert", eSPIRVVertex},
+      {"depthms2arr.frag", eSPIRVFragment},
+      {"deptharr2ms.frag", eSPIRVFragment},
+      {"text.vert", eSPIRVVertex},
+      {"text.frag", eSPIRVFragment},
+  };
+
+  for(size_t i = 0; i < sizeof(plain) / sizeof(plain[0]); i++)
+  {
+    p.file = plain[i].file;
+    p.stage = plain[i].stage;
+    p.defines = "";
+    p.uniforms = true;
+    ret.push_back(p);
+  }
+
+  // shaders compiled without the debug uniforms
+  struct
+  {
+    const char *file;
+    SPIRVShaderStage stage;
+  } nouniforms[] = {
+      {"array2ms.comp", eSPIRVCompute},
+      {"ms2array.comp", eSPIRVCompute},
+      {"fixedcol.frag", eSPIRVFragment},
+  };
+
+  for(size_t i = 0; i < sizeof(nouniforms) / sizeof(nouniforms[0]); i++)
+  {
+    p.file = nouniforms[i].file;
+    p.stage = nouniforms[i].stage;
+    p.defines = "";
+    p.uniforms = false;
+    ret.push_back(p);
+  }
+
+  // the main set of debug shaders, with and without the texelFetch workaround
+  struct
+  {
+    const char *file;
+    SPIRVShaderStage stage;
+    bool uniforms;
+  } debug[] = {
+      {"blit.vert", eSPIRVVertex, true},          {"checkerboard.frag", eSPIRVFragment, true},
+      {"texdisplay.frag", eSPIRVFragment, true},  {"mesh.vert", eSPIRVVertex, true},
+      {"mesh.geom", eSPIRVGeometry, true},        {"mesh.frag", eSPIRVFragment, true},
+      {"outline.frag", eSPIRVFragment, true},     {"quadresolve.frag", eSPIRVFragment, true},
+      {"quadwrite.frag", eSPIRVFragment, false},  {"mesh.comp", eSPIRVCompute, true},
+      {"ms2array.comp", eSPIRVCompute, true},     {"array2ms.comp", eSPIRVCompute, true},
+      {"trisize.geom", eSPIRVGeometry, true},     {"trisize.frag", eSPIRVFragment, true},
+  };
+
+  const char *texelFetch[] = {"", "#define NO_TEXEL_FETCH\n"};
+
+  for(size_t tf = 0; tf < 2; tf++)
+  {
+    for(size_t i = 0; i < sizeof(debug) / sizeof(debug[0]); i++)
+    {
+      p.file = debug[i].file;
+      p.stage = debug[i].stage;
+      p.defines = texelFetch[tf];
+      p.uniforms = debug[i].uniforms;
+      ret.push_back(p);
+    }
+
+    // histogram and min/max for each texture type (eTexType_1D to eTexType_2DMS) and
+    // float/uint/sint
+    for(int t = 1; t <= 4; t++)
+    {
+      for(int f = 0; f < 3; f++)
+      {
+        char defines[256];
+        snprintf(defines, sizeof(defines),
+                 "%s#define SHADER_RESTYPE %d\n#define UINT_TEX %d\n#define SINT_TEX %d\n",
+                 texelFetch[tf], t, f == 1 ? 1 : 0, f == 2 ? 1 : 0);
+
+        p.stage = eSPIRVCompute;
+        p.defines = defines;
+        p.uniforms = true;
+
+        p.file = "histogram.comp";
+        ret.push_back(p);
+
+        p.file = "minmaxtile.comp";
+        ret.push_back(p);
+
+        if(t == 1)
+        {
+          p.file = "minmaxresult.comp";
+          ret.push_back(p);
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
+static bool Compile(SPIRVShaderStage stage, const std::vector<std::string> &sources,
+                    std::vector<uint32_t> &spirv, std::string &errors)
+{
+  std::vector<const char *> strs;
+  for(size_t i = 0; i < sources.size(); i++)
+    strs.push_back(sources[i].c_str());
+
+  EShLanguage lang = EShLanguage((int)stage);
+
+  glslang::TShader shader(lang);
+  shader.setStrings(&strs[0], (int)strs.size());
+
+  // must match the parameters in CompileSPIRV
+  if(!shader.parse(&DefaultResources, 110, false, EShMessages(EShMsgSpvRules | EShMsgVulkanRules)))
+  {
+    errors = shader.getInfoLog();
+    return false;
+  }
+
+  glslang::TProgram program;
+  program.addShader(&shader);
+
+  if(!program.link(EShMsgDefault))
+  {
+    errors = program.getInfoLog();
+    return false;
+  }
+
+  glslang::GlslangToSpv(*program.getIntermediate(lang), spirv);
+
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  if(argc != 3)
+  {
+    fprintf(stderr, "Usage: %s <glsl dir> <output.cpp>\n", argv[0]);
+    return 1;
+  }
+
+  std::string dir = argv[1];
+
+  std::string uniforms, texsample;
+  if(!ReadFile(dir + "/debuguniforms.h", uniforms) || !ReadFile(dir + "/vk_texsample.h", texsample))
+  {
+    fprintf(stderr, "Couldn't read shader headers from %s\n", dir.c_str());
+    return 1;
+  }
+
+  glslang::InitializeProcess();
+
+  std::vector<ShaderPermutation> perms = GetPermutations();
+  std::vector<CompiledShader> compiled;
+
+  for(size_t i = 0; i < perms.size(); i++)
+  {
+    std::string shader;
+    if(!ReadFile(dir + "/" + perms[i].file, shader))
+    {
+      fprintf(stderr, "Couldn't read %s/%s\n", dir.c_str(), perms[i].file);
+      return 1;
+    }
+
+    std::vector<std::string> sources;
+    ComposeGLSLShader(sources, perms[i].defines, shader, 430, perms[i].uniforms ? uniforms : "",
+                      texsample);
+
+    CompiledShader c;
+    c.hash = HashGLSLShader((uint32_t)perms[i].stage, sources);
+    c.stage = perms[i].stage;
+    c.name = perms[i].file;
+
+    std::string errors;
+    if(!Compile(perms[i].stage, sources, c.spirv, errors))
+    {
+      fprintf(stderr, "%s failed to compile:\n%s\n", perms[i].file, errors.c_str());
+      return 1;
+    }
+
+    // identical sources can be listed more than once, e.g. blit.vert is used both for the MSAA
+    // depth copies and in the main set
+    bool dup = false;
+    for(size_t j = 0; j < compiled.size(); j++)
+      dup |= (compiled[j].hash == c.hash);
+
+    if(!dup)
+      compiled.push_back(c);
+  }
+
+  glslang::FinalizeProcess();
+
+  std::sort(compiled.begin(), compiled.end());
+
+  FILE *f = fopen(argv[2], "w");
+  if(!f)
+  {
+    fprintf(stderr, "Couldn't open %s for writing\n", argv[2]);
+    return 1;
+  }
+
+  fprintf(f, "// generated by spirv-precompile, do not edit\n\n");
+  fprintf(f, "#include \"data/glsl_shaders.h\"\n\n");
+
+  for(size_t i = 0; i < compiled.size(); i++)
+  {
+    fprintf(f, "// %s\nstatic const uint32_t spirv_%u[] = {", compiled[i].name.c_str(), (uint32_t)i);
+    for(size_t w = 0; w < compiled[i].spirv.size(); w++)
+      fprintf(f, "%s0x%08x,", (w % 8) == 0 ? "\n  " : " ", compiled[i].spirv[w]);
+    fprintf(f, "\n};\n\n");
+  }
+
+  fprintf(f, "extern const PrecompiledSPIRV precompiled_spirv[] = {\n");
+  for(size_t i = 0; i < compiled.size(); i++)
+    fprintf(f, "  {0x%016llxULL, %u, %u, spirv_%u},\n", (unsigned long long)compiled[i].hash,
+            (uint32_t)compiled[i].stage, (uint32_t)compiled[i].spirv.size(), (uint32_t)i);
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "extern const size_t precompiled_spirv_count = %u;\n", (uint32_t)compiled.size());
+
+  fclose(f);
+
+  return 0;
+}
@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include "vk_core.h"
+#include "common/tracing.h"
 #include "jpeg-compressor/jpge.h"
 #include "maths/formatpacking.h"
 #include "serialise/string_utils.h"
@@ -293,6 +294,9 @@ WrappedVulkan::WrappedVulkan(const char *logFilename) : m_RenderState(&m_Creatio
 
   m_DebugManager = NULL;
 
+  m_ReplayPipelineCache = VK_NULL_HANDLE;
+  m_CaptureHash = 0;
+
   m_pSerialiser->SetUserData(m_ResourceManager);
   m_RenderState.m_ResourceManager = GetResourceManager();
 
@@ -893,18 +897,7 @@ void WrappedVulkan::EndCaptureFrame(VkImage presentImage)
   localSerialiser->Serialise("HasCallstack", HasCallstack);
 
   if(HasCallstack)
-  {
-    Callstack::Stackwalk *call = Callstack::Collect();
-
-    RDCASSERT(call->NumLevels() < 0xff);
-
-    uint64_t numLevels = (uint64_t)call->NumLevels();
-    uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-    localSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-    delete call;
-  }
+    localSerialiser->SerialiseCallstack("callstack");
 
   m_FrameCaptureRecord->AddChunk(scope.Get());
 }
@@ -932,10 +925,7 @@ bool WrappedVulkan::Serialise_BeginCaptureFrame(bool applyInitialState)
 
   vector<VkImageMemoryBarrier> imgBarriers;
 
-  {
-    SCOPED_LOCK(m_ImageLayoutsLock);    // not needed on replay, but harmless also
-    GetResourceManager()->SerialiseImageStates(m_ImageLayouts, imgBarriers);
-  }
+  GetResourceManager()->SerialiseImageStates(m_ImageLayouts, m_ImageLayoutsLock, imgBarriers);
 
   if(applyInitialState && !imgBarriers.empty())
   {
@@ -1499,6 +1489,8 @@ bool WrappedVulkan::EndFrameCapture(void *dev, void *wnd)
 
 void WrappedVulkan::ReadLogInitialisation()
 {
+  RDCTRACE_SCOPE("WrappedVulkan::ReadLogInitialisation");
+
   uint64_t lastFrame = 0;
   uint64_t firstFrame = 0;
 
@@ -1548,6 +1540,8 @@ void WrappedVulkan::ReadLogInitialisation()
 
     VulkanChunkType context = (VulkanChunkType)m_pSerialiser->PushContext(NULL, NULL, 1, false);
 
+    RDCTRACE_SCOPE("Initialisation chunk", context);
+
     if(context == CAPTURE_SCOPE)
     {
       // immediately read rest of log into memory
@@ -2164,16 +2158,7 @@ void WrappedVulkan::ProcessChunk(uint64_t offset, VulkanChunkType context)
       localSerialiser->Serialise("HasCallstack", HasCallstack);
 
       if(HasCallstack)
-      {
-        uint64_t numLevels = 0;
-        uint64_t *stack = NULL;
-
-        localSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-        localSerialiser->SetCallstack(stack, (size_t)numLevels);
-
-        SAFE_DELETE_ARRAY(stack);
-      }
+        localSerialiser->SerialiseCallstack("callstack");
 
       if(m_State == READING)
       {
@@ -2205,6 +2190,8 @@ void WrappedVulkan::ProcessChunk(uint64_t offset, VulkanChunkType context)
 
 void WrappedVulkan::ReplayLog(uint32_t startEventID, uint32_t endEventID, ReplayLogType replayType)
 {
+  RDCTRACE_SCOPE("WrappedVulkan::ReplayLog", endEventID);
+
   uint64_t offs = m_FrameRecord.frameInfo.fileOffset;
 
   m_pSerialiser->SetOffset(offs);
@@ -2288,8 +2275,8 @@ void WrappedVulkan::ReplayLog(uint32_t startEventID, uint32_t endEventID, Replay
         }
 
         GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[GetResID(cmd)].imgbarriers,
-                                             m_ImageLayouts, (uint32_t)imgBarriers.size(),
-                                             &imgBarriers[0]);
+                                             m_ImageLayouts, m_ImageLayoutsLock,
+                                             (uint32_t)imgBarriers.size(), &imgBarriers[0]);
 
         ObjDisp(cmd)->CmdPipelineBarrier(Unwrap(cmd), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                          VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, false, 0, NULL, 0, NULL,
@@ -2365,32 +2352,7 @@ void WrappedVulkan::Serialise_DebugMessages(Serialiser *localSerialiser, bool is
       isDrawcall &&RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws != 0);
 
   if(HasCallstack)
-  {
-    if(m_State >= WRITING)
-    {
-      Callstack::Stackwalk *call = Callstack::Collect();
-
-      RDCASSERT(call->NumLevels() < 0xff);
-
-      uint64_t numLevels = (uint64_t)call->NumLevels();
-      uint64_t *stack = (uint64_t *)call->GetAddrs();
-
-      localSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-      delete call;
-    }
-    else
-    {
-      uint64_t numLevels = 0;
-      uint64_t *stack = NULL;
-
-      localSerialiser->SerialisePODArray("callstack", stack, numLevels);
-
-      localSerialiser->SetCallstack(stack, (size_t)numLevels);
-
-      SAFE_DELETE_ARRAY(stack);
-    }
-  }
+    localSerialiser->SerialiseCallstack("callstack");
 
   SERIALISE_ELEMENT(uint32_t, NumMessages, (uint32_t)debugMessages.size());
 
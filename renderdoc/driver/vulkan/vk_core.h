@@ -226,6 +226,16 @@ private:
 
   VkInitParams m_InitParams;
 
+  // pipeline cache used for every pipeline created on replay, both the application's and our
+  // own debug pipelines. Persisted to disk keyed on the capture and the driver/device so that
+  // re-opening a capture can skip driver compilation.
+  VkPipelineCache m_ReplayPipelineCache;
+  uint64_t m_CaptureHash;
+
+  string GetReplayPipelineCacheFilename();
+  void CreateReplayPipelineCache();
+  void DestroyReplayPipelineCache();
+
   VkResourceRecord *m_FrameCaptureRecord;
   Chunk *m_HeaderChunk;
 
@@ -670,6 +680,8 @@ public:
   static const char *GetChunkName(uint32_t idx);
   VulkanResourceManager *GetResourceManager() { return m_ResourceManager; }
   VulkanDebugManager *GetDebugManager() { return m_DebugManager; }
+  // returns VK_NULL_HANDLE while capturing, only replay pipelines are cached
+  VkPipelineCache GetReplayPipelineCache() { return m_ReplayPipelineCache; }
   LogState GetState() { return m_State; }
   VulkanReplay *GetReplay() { return &m_Replay; }
   // replay interface
@@ -26,7 +26,6 @@
 #include <float.h>
 #include "3rdparty/glslang/SPIRV/spirv.hpp"
 #include "3rdparty/stb/stb_truetype.h"
-#include "common/shader_cache.h"
 #include "data/glsl_shaders.h"
 #include "driver/shaders/spirv/spirv_common.h"
 #include "maths/camera.h"
@@ -144,45 +143,46 @@ void VulkanDebugManager::GPUBuffer::Unmap()
   m_pDriver->vkUnmapMemory(device, mem);
 }
 
-struct VulkanBlobShaderCallbacks
+string VulkanDebugManager::GetSPIRVBlob(SPIRVShaderStage shadType,
+                                        const std::vector<std::string> &sources,
+                                        vector<uint32_t> **outBlob)
 {
-  bool Create(uint32_t size, byte *data, vector<uint32_t> **ret) const
-  {
-    RDCASSERT(ret);
+  RDCASSERT(sources.size() > 0);
 
-    vector<uint32_t> *blob = new vector<uint32_t>();
+  // our own shaders are compiled at build time, so only fall back to glslang if they're not
+  uint64_t precompiledHash = HashGLSLShader((uint32_t)shadType, sources);
 
-    blob->resize(size / sizeof(uint32_t));
+  if(m_PrecompiledShaders.find(precompiledHash) != m_PrecompiledShaders.end())
+  {
+    *outBlob = m_PrecompiledShaders[precompiledHash];
+    return "";
+  }
 
-    memcpy(&(*blob)[0], data, size);
+  const PrecompiledSPIRV *precompiled = FindPrecompiledSPIRV(precompiledHash);
 
-    *ret = blob;
+  if(precompiled && precompiled->stage == (uint32_t)shadType)
+  {
+    vector<uint32_t> *spirv =
+        new vector<uint32_t>(precompiled->words, precompiled->words + precompiled->numWords);
 
-    return true;
-  }
+    m_PrecompiledShaders[precompiledHash] = spirv;
 
-  void Destroy(vector<uint32_t> *blob) const { delete blob; }
-  uint32_t GetSize(vector<uint32_t> *blob) const
-  {
-    return (uint32_t)(blob->size() * sizeof(uint32_t));
+    *outBlob = spirv;
+    return "";
   }
 
-  byte *GetData(vector<uint32_t> *blob) const { return (byte *)&(*blob)[0]; }
-} ShaderCacheCallbacks;
+  // every shader we request should have been precompiled when the build has that step, so a miss
+  // means spirv-precompile's list of permutations has fallen behind this file. It still works by
+  // compiling at runtime, but shouldn't go unnoticed.
+  size_t numPrecompiled = 0;
+  GetPrecompiledSPIRV(numPrecompiled);
 
-string VulkanDebugManager::GetSPIRVBlob(SPIRVShaderStage shadType,
-                                        const std::vector<std::string> &sources,
-                                        vector<uint32_t> **outBlob)
-{
-  RDCASSERT(sources.size() > 0);
-
-  uint32_t hash = strhash(sources[0].c_str());
-  for(size_t i = 1; i < sources.size(); i++)
-    hash = strhash(sources[i].c_str(), hash);
+  if(numPrecompiled > 0)
+    RDCERR("Debug shader %016llx for stage %d wasn't precompiled - update the permutations in "
+           "spirv_precompile.cpp to match VulkanDebugManager",
+           precompiledHash, (int)shadType);
 
-  char typestr[2] = {'a', 0};
-  typestr[0] += (char)shadType;
-  hash = strhash(typestr, hash);
+  uint64_t hash = precompiledHash;
 
   if(m_ShaderCache.find(hash) != m_ShaderCache.end())
   {
@@ -190,6 +190,22 @@ string VulkanDebugManager::GetSPIRVBlob(SPIRVShaderStage shadType,
     return "";
   }
 
+  const byte *cached = NULL;
+  uint32_t cachedSize = 0;
+
+  if(m_ShaderBlobCache.Find(hash, cached, cachedSize) && cachedSize > 0 &&
+     (cachedSize % sizeof(uint32_t)) == 0)
+  {
+    const uint32_t *words = (const uint32_t *)cached;
+
+    vector<uint32_t> *spirv = new vector<uint32_t>(words, words + cachedSize / sizeof(uint32_t));
+
+    m_ShaderCache[hash] = spirv;
+
+    *outBlob = spirv;
+    return "";
+  }
+
   vector<uint32_t> *spirv = new vector<uint32_t>();
   string errors = CompileSPIRV(shadType, sources, *spirv);
 
@@ -211,7 +227,7 @@ string VulkanDebugManager::GetSPIRVBlob(SPIRVShaderStage shadType,
   if(m_CacheShaders)
   {
     m_ShaderCache[hash] = spirv;
-    m_ShaderCacheDirty = true;
+    m_ShaderBlobCache.Insert(hash, spirv->data(), uint32_t(spirv->size() * sizeof(uint32_t)));
   }
 
   return errors;
@@ -340,15 +356,13 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
 
   m_Device = dev;
 
+  m_PipeCache = m_pDriver->GetReplayPipelineCache();
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Do some work that's needed both during capture and during replay
 
   // Load shader cache, if present
-  bool success = LoadShaderCache("vkshaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion,
-                                 m_ShaderCache, ShaderCacheCallbacks);
-
-  // if we failed to load from the cache
-  m_ShaderCacheDirty = !success;
+  m_ShaderBlobCache.Open("vkshaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion);
 
   VkResult vkr = VK_SUCCESS;
 
@@ -903,7 +917,7 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
 
       pipeInfo.renderPass = rp;
 
-      vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+      vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                  &m_DepthMS2ArrayPipe[f]);
       RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -923,7 +937,7 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
 
         pipeInfo.renderPass = rp;
 
-        vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+        vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                    &m_DepthArray2MSPipe[f][s]);
         RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -1060,14 +1074,14 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
       compPipeInfo.stage.module = ms2arrayModule;
       compPipeInfo.layout = m_ArrayMSPipeLayout;
 
-      vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &compPipeInfo, NULL,
+      vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &compPipeInfo, NULL,
                                                 &m_MS2ArrayPipe);
       RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
       compPipeInfo.stage.module = array2msModule;
       compPipeInfo.layout = m_ArrayMSPipeLayout;
 
-      vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &compPipeInfo, NULL,
+      vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &compPipeInfo, NULL,
                                                 &m_Array2MSPipe);
       RDCASSERTEQUAL(vkr, VK_SUCCESS);
     }
@@ -1076,25 +1090,25 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
 
     pipeInfo.layout = m_TextPipeLayout;
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                &m_TextPipeline[0]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
     pipeInfo.renderPass = RGBA8LinearRP;
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                &m_TextPipeline[1]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
     pipeInfo.renderPass = BGRA8sRGBRP;
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                &m_TextPipeline[2]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
     pipeInfo.renderPass = BGRA8LinearRP;
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                &m_TextPipeline[3]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -1803,14 +1817,14 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
   stages[0].module = module[BLITVS];
   stages[1].module = module[CHECKERBOARDFS];
 
-  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                              &m_CheckerboardPipeline);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
   msaa.rasterizationSamples = VULKAN_MESH_VIEW_SAMPLES;
   pipeInfo.renderPass = RGBA8MSRP;
 
-  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                              &m_CheckerboardMSAAPipeline);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -1822,13 +1836,13 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
 
   pipeInfo.layout = m_TexDisplayPipeLayout;
 
-  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                              &m_TexDisplayPipeline);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
   pipeInfo.renderPass = RGBA32RP;
 
-  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                              &m_TexDisplayF32Pipeline);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -1838,7 +1852,7 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
   attState.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
   attState.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
 
-  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                              &m_TexDisplayBlendPipeline);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -1860,7 +1874,7 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
 
     msaa.rasterizationSamples = VkSampleCountFlagBits(1 << i);
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                &m_OutlinePipeline[i]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
   }
@@ -1881,7 +1895,7 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
 
     msaa.rasterizationSamples = VkSampleCountFlagBits(1 << i);
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                &m_QuadResolvePipeline[i]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
   }
@@ -1948,13 +1962,13 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
 
       compPipeInfo.stage.module = minmaxtile;
 
-      vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &compPipeInfo, NULL,
+      vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &compPipeInfo, NULL,
                                                 &m_MinMaxTilePipe[t][f]);
       RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
       compPipeInfo.stage.module = histogram;
 
-      vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &compPipeInfo, NULL,
+      vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &compPipeInfo, NULL,
                                                 &m_HistogramPipe[t][f]);
       RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -1962,7 +1976,7 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
       {
         compPipeInfo.stage.module = minmaxresult;
 
-        vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &compPipeInfo, NULL,
+        vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &compPipeInfo, NULL,
                                                   &m_MinMaxResultPipe[f]);
         RDCASSERTEQUAL(vkr, VK_SUCCESS);
       }
@@ -1978,7 +1992,7 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
     compPipeInfo.stage.module = module[MESHCS];
     compPipeInfo.layout = m_MeshPickLayout;
 
-    vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &compPipeInfo, NULL,
+    vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &compPipeInfo, NULL,
                                               &m_MeshPickPipeline);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
   }
@@ -1989,14 +2003,14 @@ VulkanDebugManager::VulkanDebugManager(WrappedVulkan *driver, VkDevice dev)
     compPipeInfo.stage.module = module[MS2ARRAYCS];
     compPipeInfo.layout = m_ArrayMSPipeLayout;
 
-    vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &compPipeInfo, NULL,
+    vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &compPipeInfo, NULL,
                                               &m_MS2ArrayPipe);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
     compPipeInfo.stage.module = module[ARRAY2MSCS];
     compPipeInfo.layout = m_ArrayMSPipeLayout;
 
-    vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &compPipeInfo, NULL,
+    vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &compPipeInfo, NULL,
                                               &m_Array2MSPipe);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
   }
@@ -2445,16 +2459,13 @@ VulkanDebugManager::~VulkanDebugManager()
 {
   VkDevice dev = m_Device;
 
-  if(m_ShaderCacheDirty)
-  {
-    SaveShaderCache("vkshaders.cache", m_ShaderCacheMagic, m_ShaderCacheVersion, m_ShaderCache,
-                    ShaderCacheCallbacks);
-  }
-  else
-  {
-    for(auto it = m_ShaderCache.begin(); it != m_ShaderCache.end(); ++it)
-      ShaderCacheCallbacks.Destroy(it->second);
-  }
+  m_ShaderBlobCache.Close();
+
+  for(auto it = m_ShaderCache.begin(); it != m_ShaderCache.end(); ++it)
+    delete it->second;
+
+  for(auto it = m_PrecompiledShaders.begin(); it != m_PrecompiledShaders.end(); ++it)
+    delete it->second;
 
   for(auto it = m_PostVSData.begin(); it != m_PostVSData.end(); ++it)
   {
@@ -2761,7 +2772,7 @@ void VulkanDebugManager::ReplaceResource(ResourceId from, ResourceId to)
         }
 
         // create the new graphics pipeline
-        VkResult vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeCreateInfo,
+        VkResult vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeCreateInfo,
                                                             NULL, &pipe);
         RDCASSERTEQUAL(vkr, VK_SUCCESS);
       }
@@ -2776,7 +2787,7 @@ void VulkanDebugManager::ReplaceResource(ResourceId from, ResourceId to)
         sh.module = dstShaderModule;
 
         // create the new compute pipeline
-        VkResult vkr = m_pDriver->vkCreateComputePipelines(dev, VK_NULL_HANDLE, 1, &pipeCreateInfo,
+        VkResult vkr = m_pDriver->vkCreateComputePipelines(dev, m_PipeCache, 1, &pipeCreateInfo,
                                                            NULL, &pipe);
         RDCASSERTEQUAL(vkr, VK_SUCCESS);
       }
@@ -3174,7 +3185,7 @@ void VulkanDebugManager::CreateCustomShaderPipeline(ResourceId shader)
       -1,                // base pipeline index
   };
 
-  VkResult vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  VkResult vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_PipeCache, 1, &pipeInfo, NULL,
                                                       &m_CustomTexPipeline);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 }
@@ -3881,66 +3892,8 @@ FloatVector VulkanDebugManager::InterpretVertex(byte *data, uint32_t vert, const
 
   data += vert * cfg.position.stride;
 
-  float *out = &ret.x;
-
-  ResourceFormat fmt;
-  fmt.compByteWidth = cfg.position.compByteWidth;
-  fmt.compCount = cfg.position.compCount;
-  fmt.compType = cfg.position.compType;
-
-  if(cfg.position.specialFormat == eSpecial_R10G10B10A2)
-  {
-    if(data + 4 >= end)
-    {
-      valid = false;
-      return ret;
-    }
-
-    Vec4f v = ConvertFromR10G10B10A2(*(uint32_t *)data);
-    ret.x = v.x;
-    ret.y = v.y;
-    ret.z = v.z;
-    ret.w = v.w;
-    return ret;
-  }
-  else if(cfg.position.specialFormat == eSpecial_R11G11B10)
-  {
-    if(data + 4 >= end)
-    {
-      valid = false;
-      return ret;
-    }
-
-    Vec3f v = ConvertFromR11G11B10(*(uint32_t *)data);
-    ret.x = v.x;
-    ret.y = v.y;
-    ret.z = v.z;
-    return ret;
-  }
-
-  if(data + cfg.position.compCount * cfg.position.compByteWidth > end)
-  {
+  if(DecodeFormattedComponents(cfg.position, data, end, 1, &ret) == 0)
     valid = false;
-    return ret;
-  }
-
-  for(uint32_t i = 0; i < cfg.position.compCount; i++)
-  {
-    *out = ConvertComponent(fmt, data);
-
-    data += cfg.position.compByteWidth;
-    out++;
-  }
-
-  if(cfg.position.bgraOrder)
-  {
-    FloatVector reversed;
-    reversed.x = ret.z;
-    reversed.y = ret.y;
-    reversed.z = ret.x;
-    reversed.w = ret.w;
-    return reversed;
-  }
 
   return ret;
 }
@@ -4159,29 +4112,28 @@ uint32_t VulkanDebugManager::PickVertex(uint32_t eventID, const MeshDisplay &cfg
     byte *data = &oldData[0];
     byte *dataEnd = data + oldData.size();
 
-    bool valid = true;
-
     FloatVector *vbData = (FloatVector *)m_MeshPickVBUpload.Map();
 
+    // apply baseVertex but clamp to 0 (don't allow index to become negative). The first idxclamp
+    // vertices all read vertex 0, and the rest are one contiguous run we can decode in one go.
     uint32_t idxclamp = 0;
     if(cfg.position.baseVertex < 0)
-      idxclamp = uint32_t(-cfg.position.baseVertex);
+      idxclamp = RDCMIN(uint32_t(-cfg.position.baseVertex), cfg.position.numVerts);
 
-    for(uint32_t i = 0; i < cfg.position.numVerts; i++)
-    {
-      uint32_t idx = i;
-
-      // apply baseVertex but clamp to 0 (don't allow index to become negative)
-      if(idx < idxclamp)
-        idx = 0;
-      else if(cfg.position.baseVertex < 0)
-        idx -= idxclamp;
-      else if(cfg.position.baseVertex > 0)
-        idx += cfg.position.baseVertex;
+    byte *runStart = data;
+    if(cfg.position.baseVertex > 0)
+      runStart += cfg.position.baseVertex * cfg.position.stride;
 
-      vbData[i] = InterpretVertex(data, idx, cfg, dataEnd, valid);
+    if(idxclamp > 0)
+    {
+      DecodeFormattedComponents(cfg.position, data, dataEnd, 1, vbData);
+      for(uint32_t i = 1; i < idxclamp; i++)
+        vbData[i] = vbData[0];
     }
 
+    DecodeFormattedComponents(cfg.position, runStart, dataEnd, cfg.position.numVerts - idxclamp,
+                              vbData + idxclamp);
+
     m_MeshPickVBUpload.Unmap();
   }
 
@@ -5007,8 +4959,8 @@ struct VulkanQuadOverdrawCallback : public VulkanDrawcallCallback
         sh.pSpecializationInfo = NULL;
       }
 
-      vkr = m_pDriver->vkCreateGraphicsPipelines(dev, VK_NULL_HANDLE, 1, &pipeCreateInfo, NULL,
-                                                 &pipe.second);
+      vkr = m_pDriver->vkCreateGraphicsPipelines(dev, m_pDriver->GetReplayPipelineCache(), 1,
+                                                 &pipeCreateInfo, NULL, &pipe.second);
       RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
       ObjDisp(dev)->DestroyShaderModule(Unwrap(dev), Unwrap(module), NULL);
@@ -5437,7 +5389,7 @@ ResourceId VulkanDebugManager::RenderOverlay(ResourceId texid, TextureDisplayOve
 
     VkPipeline pipe = VK_NULL_HANDLE;
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipeCreateInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, m_PipeCache, 1, &pipeCreateInfo, NULL,
                                                &pipe);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -5718,14 +5670,14 @@ ResourceId VulkanDebugManager::RenderOverlay(ResourceId texid, TextureDisplayOve
     vkr = vt->EndCommandBuffer(Unwrap(cmd));
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipeCreateInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, m_PipeCache, 1, &pipeCreateInfo, NULL,
                                                &pipe[0]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
     fragShader->module = mod[1];
     rs->cullMode = origCullMode;
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipeCreateInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, m_PipeCache, 1, &pipeCreateInfo, NULL,
                                                &pipe[1]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -5978,7 +5930,7 @@ ResourceId VulkanDebugManager::RenderOverlay(ResourceId texid, TextureDisplayOve
     vkr = vt->EndCommandBuffer(Unwrap(cmd));
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipeCreateInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, m_PipeCache, 1, &pipeCreateInfo, NULL,
                                                &pipe[0]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -5993,7 +5945,7 @@ ResourceId VulkanDebugManager::RenderOverlay(ResourceId texid, TextureDisplayOve
       pipeCreateInfo.renderPass = depthRP;
     }
 
-    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipeCreateInfo, NULL,
+    vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, m_PipeCache, 1, &pipeCreateInfo, NULL,
                                                &pipe[1]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -6700,7 +6652,7 @@ ResourceId VulkanDebugManager::RenderOverlay(ResourceId texid, TextureDisplayOve
 
             if(pipe == VK_NULL_HANDLE)
             {
-              vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1,
+              vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, m_PipeCache, 1,
                                                          &pipeCreateInfo, NULL, &pipe);
               RDCASSERTEQUAL(vkr, VK_SUCCESS);
             }
@@ -7082,13 +7034,13 @@ MeshDisplayPipelines VulkanDebugManager::CacheMeshDisplayPipelines(const MeshFor
   rs.lineWidth = 1.0f;
   ds.depthTestEnable = false;
 
-  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), Unwrap(m_PipeCache), 1, &pipeInfo, NULL,
                                     &cache.pipes[MeshDisplayPipelines::ePipe_Wire]);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
   ds.depthTestEnable = true;
 
-  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), Unwrap(m_PipeCache), 1, &pipeInfo, NULL,
                                     &cache.pipes[MeshDisplayPipelines::ePipe_WireDepth]);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -7096,13 +7048,13 @@ MeshDisplayPipelines VulkanDebugManager::CacheMeshDisplayPipelines(const MeshFor
   rs.polygonMode = VK_POLYGON_MODE_FILL;
   ds.depthTestEnable = false;
 
-  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), Unwrap(m_PipeCache), 1, &pipeInfo, NULL,
                                     &cache.pipes[MeshDisplayPipelines::ePipe_Solid]);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
   ds.depthTestEnable = true;
 
-  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), Unwrap(m_PipeCache), 1, &pipeInfo, NULL,
                                     &cache.pipes[MeshDisplayPipelines::ePipe_SolidDepth]);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -7115,7 +7067,7 @@ MeshDisplayPipelines VulkanDebugManager::CacheMeshDisplayPipelines(const MeshFor
 
     vi.vertexBindingDescriptionCount = 2;
 
-    vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+    vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), Unwrap(m_PipeCache), 1, &pipeInfo, NULL,
                                       &cache.pipes[MeshDisplayPipelines::ePipe_Secondary]);
     RDCASSERTEQUAL(vkr, VK_SUCCESS);
   }
@@ -7132,7 +7084,7 @@ MeshDisplayPipelines VulkanDebugManager::CacheMeshDisplayPipelines(const MeshFor
   stages[2].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
   pipeInfo.stageCount = 3;
 
-  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), VK_NULL_HANDLE, 1, &pipeInfo, NULL,
+  vkr = vt->CreateGraphicsPipelines(Unwrap(m_Device), Unwrap(m_PipeCache), 1, &pipeInfo, NULL,
                                     &cache.pipes[MeshDisplayPipelines::ePipe_Lit]);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
@@ -8221,7 +8173,7 @@ void VulkanDebugManager::InitPostVSBuffers(uint32_t eventID)
 
   // create new pipeline
   VkPipeline pipe;
-  vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipeCreateInfo, NULL,
+  vkr = m_pDriver->vkCreateGraphicsPipelines(m_Device, m_PipeCache, 1, &pipeCreateInfo, NULL,
                                              &pipe);
   RDCASSERTEQUAL(vkr, VK_SUCCESS);
 
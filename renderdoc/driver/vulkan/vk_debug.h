@@ -25,6 +25,7 @@
 #pragma once
 
 #include "api/replay/renderdoc_replay.h"
+#include "common/shader_cache.h"
 #include "core/core.h"
 #include "replay/replay_driver.h"
 #include "vk_common.h"
@@ -342,10 +343,12 @@ private:
 
   VulkanResourceManager *GetResourceManager() { return m_ResourceManager; }
   static const uint32_t m_ShaderCacheMagic = 0xf00d00d5;
-  static const uint32_t m_ShaderCacheVersion = 1;
+  static const uint32_t m_ShaderCacheVersion = 2;
 
-  bool m_ShaderCacheDirty, m_CacheShaders;
-  map<uint32_t, vector<uint32_t> *> m_ShaderCache;
+  bool m_CacheShaders;
+  ShaderBlobCache m_ShaderBlobCache;
+  map<uint64_t, vector<uint32_t> *> m_ShaderCache;
+  map<uint64_t, vector<uint32_t> *> m_PrecompiledShaders;
 
   string GetSPIRVBlob(SPIRVShaderStage shadType, const std::vector<std::string> &sources,
                       vector<uint32_t> **outBlob);
@@ -377,4 +380,7 @@ private:
   VulkanResourceManager *m_ResourceManager;
 
   VkDevice m_Device;
+
+  // the driver's persistent replay pipeline cache, used for all of our own pipelines
+  VkPipelineCache m_PipeCache;
 };
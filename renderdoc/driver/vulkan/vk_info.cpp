@@ -23,6 +23,7 @@
  ******************************************************************************/
 
 #include "vk_info.h"
+#include "vk_reflection_cache.h"
 #include "3rdparty/glslang/SPIRV/spirv.hpp"
 
 void DescSetLayout::Init(VulkanResourceManager *resourceMan, VulkanCreationInfo &info,
@@ -111,8 +112,7 @@ void VulkanCreationInfo::Pipeline::Init(VulkanResourceManager *resourceMan, Vulk
     {
       reflData.entryPoint = shad.entryPoint;
       reflData.stage = stageIndex;
-      info.m_ShaderModule[id].spirv.MakeReflection(reflData.entryPoint, &reflData.refl,
-                                                   &reflData.mapping);
+      info.m_ShaderModule[id].Reflect(reflData);
     }
 
     if(pCreateInfo->pStages[i].pSpecializationInfo)
@@ -325,8 +325,7 @@ void VulkanCreationInfo::Pipeline::Init(VulkanResourceManager *resourceMan, Vulk
     if(reflData.entryPoint.empty())
     {
       reflData.entryPoint = shad.entryPoint;
-      info.m_ShaderModule[id].spirv.MakeReflection(reflData.entryPoint, &reflData.refl,
-                                                   &reflData.mapping);
+      info.m_ShaderModule[id].Reflect(reflData);
     }
 
     if(pCreateInfo->stage.pSpecializationInfo)
@@ -574,4 +573,24 @@ void VulkanCreationInfo::ShaderModule::Init(VulkanResourceManager *resourceMan,
     RDCASSERT(pCreateInfo->codeSize % sizeof(uint32_t) == 0);
     ParseSPIRV((uint32_t *)pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t), spirv);
   }
+
+  spirvHash = VulkanReflectionCache::HashModule(spirv.spirv);
+}
+
+void VulkanCreationInfo::ShaderModule::Reflect(Reflection &reflData)
+{
+  // only go through the cache on replay, there's no point persisting anything while capturing
+  if(RenderDoc::Inst().IsReplayApp())
+    VulkanReflectionCache::Get().MakeReflection(spirv, spirvHash, reflData.entryPoint,
+                                                &reflData.refl, &reflData.mapping);
+  else
+    spirv.MakeReflection(reflData.entryPoint, &reflData.refl, &reflData.mapping);
+}
+
+string VulkanCreationInfo::ShaderModule::Disassemble(const string &entryPoint)
+{
+  if(RenderDoc::Inst().IsReplayApp())
+    return VulkanReflectionCache::Get().Disassemble(spirv, spirvHash, entryPoint);
+
+  return spirv.Disassemble(entryPoint);
 }
@@ -320,10 +320,13 @@ struct VulkanCreationInfo
 
   struct ShaderModule
   {
+    ShaderModule() : spirvHash(0) {}
     void Init(VulkanResourceManager *resourceMan, VulkanCreationInfo &info,
               const VkShaderModuleCreateInfo *pCreateInfo);
 
     SPVModule spirv;
+    // hash of the SPIR-V words, identifies this module in the VulkanReflectionCache
+    uint64_t spirvHash;
 
     string unstrippedPath;
 
@@ -335,6 +338,10 @@ struct VulkanCreationInfo
       ShaderBindpointMapping mapping;
     };
     map<string, Reflection> m_Reflections;
+
+    // fills out refl and mapping for reflData.entryPoint
+    void Reflect(Reflection &reflData);
+    string Disassemble(const string &entryPoint);
   };
   map<ResourceId, ShaderModule> m_ShaderModule;
 
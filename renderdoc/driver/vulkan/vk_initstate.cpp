@@ -1031,6 +1031,14 @@ bool WrappedVulkan::Prepare_InitialState(WrappedVkRes *res)
       layout = &m_ImageLayouts[im->id];
     }
 
+    // take a copy of the current layouts, as submits on other threads can change them while we're
+    // recording the transitions to and from them
+    vector<ImageRegionState> subresourceStates;
+    {
+      SCOPED_LOCK(layout->lock);
+      subresourceStates = layout->subresourceStates;
+    }
+
     // must ensure offset remains valid. Must be multiple of block size, or 4, depending on format
     VkDeviceSize bufAlignment = 4;
     if(IsBlockFormat(layout->format))
@@ -1172,10 +1180,10 @@ bool WrappedVulkan::Prepare_InitialState(WrappedVkRes *res)
     // before we go reading
     srcimBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
 
-    for(size_t si = 0; si < layout->subresourceStates.size(); si++)
+    for(size_t si = 0; si < subresourceStates.size(); si++)
     {
-      srcimBarrier.subresourceRange = layout->subresourceStates[si].subresourceRange;
-      srcimBarrier.oldLayout = layout->subresourceStates[si].newLayout;
+      srcimBarrier.subresourceRange = subresourceStates[si].subresourceRange;
+      srcimBarrier.oldLayout = subresourceStates[si].newLayout;
       DoPipelineBarrier(cmd, 1, &srcimBarrier);
     }
 
@@ -1278,10 +1286,10 @@ bool WrappedVulkan::Prepare_InitialState(WrappedVkRes *res)
     srcimBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
     srcimBarrier.dstAccessMask = 0;
 
-    for(size_t si = 0; si < layout->subresourceStates.size(); si++)
+    for(size_t si = 0; si < subresourceStates.size(); si++)
     {
-      srcimBarrier.subresourceRange = layout->subresourceStates[si].subresourceRange;
-      srcimBarrier.newLayout = layout->subresourceStates[si].newLayout;
+      srcimBarrier.subresourceRange = subresourceStates[si].subresourceRange;
+      srcimBarrier.newLayout = subresourceStates[si].newLayout;
       srcimBarrier.dstAccessMask = MakeAccessMask(srcimBarrier.newLayout);
       DoPipelineBarrier(cmd, 1, &srcimBarrier);
     }
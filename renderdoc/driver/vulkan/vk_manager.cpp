@@ -49,6 +49,11 @@ bool VulkanResourceManager::SerialisableResource(ResourceId id, VkResourceRecord
 #define TRDBG(...)
 #endif
 
+static bool StateIdLess(const pair<ResourceId, ImageRegionState> &state, ResourceId id)
+{
+  return state.first < id;
+}
+
 template <typename SrcBarrierType>
 void VulkanResourceManager::RecordSingleBarrier(vector<pair<ResourceId, ImageRegionState> > &dststates,
                                                 ResourceId id, const SrcBarrierType &t,
@@ -56,7 +61,8 @@ void VulkanResourceManager::RecordSingleBarrier(vector<pair<ResourceId, ImageReg
 {
   bool done = false;
 
-  auto it = dststates.begin();
+  // states are kept sorted by id, so skip straight to the states for this image
+  auto it = std::lower_bound(dststates.begin(), dststates.end(), id, StateIdLess);
   for(; it != dststates.end(); ++it)
   {
     // image barriers are handled by initially inserting one subresource range for each aspect,
@@ -64,9 +70,7 @@ void VulkanResourceManager::RecordSingleBarrier(vector<pair<ResourceId, ImageReg
     // each subresource in that aspect. Thereafter if a barrier comes in that covers multiple
     // subresources, we update all matching ranges.
 
-    // find the states matching this id
-    if(it->first < id)
-      continue;
+    // stop once we're past the states matching this id
     if(it->first != id)
       break;
 
@@ -150,10 +154,12 @@ void VulkanResourceManager::RecordSingleBarrier(vector<pair<ResourceId, ImageReg
             it->second.subresourceRange.levelCount = 1;
             it->second.subresourceRange.layerCount = 1;
 
-            // slice-major
+            // slice-major, within the range that was split
             it->second.subresourceRange.baseArrayLayer =
+                existing.second.subresourceRange.baseArrayLayer +
                 uint32_t(i / existing.second.subresourceRange.levelCount);
             it->second.subresourceRange.baseMipLevel =
+                existing.second.subresourceRange.baseMipLevel +
                 uint32_t(i % existing.second.subresourceRange.levelCount);
             it++;
           }
@@ -200,6 +206,7 @@ void VulkanResourceManager::RecordSingleBarrier(vector<pair<ResourceId, ImageReg
 
 void VulkanResourceManager::RecordBarriers(vector<pair<ResourceId, ImageRegionState> > &states,
                                            const map<ResourceId, ImageLayouts> &layouts,
+                                           Threading::CriticalSection &layoutsLock,
                                            uint32_t numBarriers, const VkImageMemoryBarrier *barriers)
 {
   TRDBG("Recording %u barriers", numBarriers);
@@ -219,22 +226,29 @@ void VulkanResourceManager::RecordBarriers(vector<pair<ResourceId, ImageRegionSt
     uint32_t nummips = t.subresourceRange.levelCount;
     uint32_t numslices = t.subresourceRange.layerCount;
 
-    auto it = layouts.find(id);
-
-    if(nummips == VK_REMAINING_MIP_LEVELS)
+    // the image's dimensions never change after creation, so we only need the lock to find it in
+    // the map and only when the barrier doesn't give explicit counts
+    if(nummips == VK_REMAINING_MIP_LEVELS || numslices == VK_REMAINING_ARRAY_LAYERS)
     {
-      if(it != layouts.end())
-        nummips = it->second.levelCount - t.subresourceRange.baseMipLevel;
-      else
-        nummips = 1;
-    }
+      SCOPED_LOCK(layoutsLock);
 
-    if(numslices == VK_REMAINING_ARRAY_LAYERS)
-    {
-      if(it != layouts.end())
-        numslices = it->second.layerCount - t.subresourceRange.baseArrayLayer;
-      else
-        numslices = 1;
+      auto it = layouts.find(id);
+
+      if(nummips == VK_REMAINING_MIP_LEVELS)
+      {
+        if(it != layouts.end())
+          nummips = it->second.levelCount - t.subresourceRange.baseMipLevel;
+        else
+          nummips = 1;
+      }
+
+      if(numslices == VK_REMAINING_ARRAY_LAYERS)
+      {
+        if(it != layouts.end())
+          numslices = it->second.layerCount - t.subresourceRange.baseArrayLayer;
+        else
+          numslices = 1;
+      }
     }
 
     RecordSingleBarrier(states, id, t, nummips, numslices);
@@ -259,10 +273,14 @@ void VulkanResourceManager::MergeBarriers(vector<pair<ResourceId, ImageRegionSta
 }
 
 void VulkanResourceManager::SerialiseImageStates(map<ResourceId, ImageLayouts> &states,
+                                                 Threading::CriticalSection &statesLock,
                                                  vector<VkImageMemoryBarrier> &barriers)
 {
   Serialiser *localSerialiser = m_pSerialiser;
 
+  // not needed on replay, but harmless also
+  SCOPED_LOCK(statesLock);
+
   SERIALISE_ELEMENT(uint32_t, NumMems, (uint32_t)states.size());
 
   auto srcit = states.begin();
@@ -272,6 +290,11 @@ void VulkanResourceManager::SerialiseImageStates(map<ResourceId, ImageLayouts> &
   for(uint32_t i = 0; i < NumMems; i++)
   {
     SERIALISE_ELEMENT(ResourceId, id, srcit->first);
+
+    // while capturing, submits on other threads only lock the image they're modifying
+    if(m_State >= WRITING)
+      srcit->second.lock.Lock();
+
     SERIALISE_ELEMENT(uint32_t, NumStates, (uint32_t)srcit->second.subresourceStates.size());
 
     ResourceId liveid;
@@ -306,10 +329,13 @@ void VulkanResourceManager::SerialiseImageStates(map<ResourceId, ImageLayouts> &
     }
 
     if(m_State >= WRITING)
+    {
+      srcit->second.lock.Unlock();
       srcit++;
+    }
   }
 
-  ApplyBarriers(vec, states);
+  ApplyBarriers(vec, states, statesLock);
 
   for(size_t i = 0; i < vec.size(); i++)
     barriers[i].oldLayout = vec[i].second.oldLayout;
@@ -332,6 +358,8 @@ void VulkanResourceManager::SerialiseImageStates(map<ResourceId, ImageLayouts> &
   {
     ImageLayouts &layouts = it->second;
 
+    SCOPED_LOCK(layouts.lock);
+
     if(layouts.subresourceStates.size() > 1 &&
        layouts.subresourceStates.size() == size_t(layouts.layerCount * layouts.levelCount))
     {
@@ -380,189 +408,171 @@ void VulkanResourceManager::MarkSparseMapReferenced(SparseMapping *sparse)
       MarkResourceFrameReferenced(GetResID(sparse->pages[a][i].first), eFrameRef_Read);
 }
 
-void VulkanResourceManager::ApplyBarriers(vector<pair<ResourceId, ImageRegionState> > &states,
-                                          map<ResourceId, ImageLayouts> &layouts)
+// applies one barrier to an image's layouts. If the barrier covers exactly one tracked state, the
+// barrier's oldLayout is updated to the layout the image was in before.
+static void ApplySingleBarrier(ImageLayouts &layout, ImageRegionState &t)
 {
-  TRDBG("Applying %u barriers", (uint32_t)states.size());
+  vector<ImageRegionState> &subs = layout.subresourceStates;
+
+  const uint32_t levelCount = (uint32_t)layout.levelCount;
+  const uint32_t layerCount = (uint32_t)layout.layerCount;
+
+  const uint32_t baseMip = t.subresourceRange.baseMipLevel;
+  const uint32_t baseLayer = t.subresourceRange.baseArrayLayer;
+
+  uint32_t nummips = t.subresourceRange.levelCount;
+  uint32_t numslices = t.subresourceRange.layerCount;
+  if(nummips == VK_REMAINING_MIP_LEVELS)
+    nummips = levelCount - baseMip;
+  if(numslices == VK_REMAINING_ARRAY_LAYERS)
+    numslices = layerCount - baseLayer;
+
+  if(nummips == 0)
+    nummips = 1;
+  if(numslices == 0)
+    numslices = 1;
+
+  if(t.oldLayout == t.newLayout)
+    return;
+
+  TRDBG("Barrier of %s (%u->%u, %u->%u) from %s to %s",
+        ToStr::Get(t.subresourceRange.aspectMask).c_str(), baseMip, nummips, baseLayer, numslices,
+        ToStr::Get(t.oldLayout).c_str(), ToStr::Get(t.newLayout).c_str());
 
-  for(size_t ti = 0; ti < states.size(); ti++)
+  if(subs.empty() || baseMip >= levelCount || baseLayer >= layerCount)
   {
-    ResourceId id = states[ti].first;
-    ImageRegionState &t = states[ti].second;
+    RDCERR("Couldn't find subresource range to apply barrier to - invalid!");
+    return;
+  }
+
+  const bool wholeImage = (baseMip == 0 && nummips >= levelCount && baseLayer == 0 &&
+                           numslices >= layerCount);
 
-    TRDBG("Applying barrier to %llu", GetOriginalID(id));
+  // if the image is still tracked as a whole and the barrier covers all of it, there's nothing to
+  // split. This is the common case for images with only one subresource (e.g. render targets).
+  if(subs.size() == 1 && wholeImage)
+  {
+    ImageRegionState &st = subs[0];
+
+    // prevstate is from the start of all barriers accumulated, so only set once
+    if(st.oldLayout == UNKNOWN_PREV_IMG_LAYOUT)
+      st.oldLayout = t.oldLayout;
+    t.oldLayout = st.newLayout;
+    st.newLayout = t.newLayout;
+    return;
+  }
+
+  const size_t count = size_t(levelCount) * layerCount;
+
+  // the barrier only covers part of the image, so from now on we need to track each subresource
+  // separately. The single state covers the whole image, so every subresource starts from it.
+  if(subs.size() == 1)
+  {
+    ImageRegionState existing = subs[0];
+    existing.subresourceRange.levelCount = 1;
+    existing.subresourceRange.layerCount = 1;
 
-    auto stit = layouts.find(id);
+    subs[0] = existing;
+    subs.resize(count, existing);
 
-    if(stit == layouts.end())
+    for(uint32_t layer = 0; layer < layerCount; layer++)
     {
-      TRDBG("Didn't find ID in image layouts");
-      continue;
+      for(uint32_t mip = 0; mip < levelCount; mip++)
+      {
+        ImageRegionState &st = subs[layout.SubresourceIndex(mip, layer)];
+        st.subresourceRange.baseMipLevel = mip;
+        st.subresourceRange.baseArrayLayer = layer;
+      }
     }
+  }
 
-    uint32_t nummips = t.subresourceRange.levelCount;
-    uint32_t numslices = t.subresourceRange.layerCount;
-    if(nummips == VK_REMAINING_MIP_LEVELS)
-      nummips = layouts[id].levelCount;
-    if(numslices == VK_REMAINING_ARRAY_LAYERS)
-      numslices = layouts[id].layerCount;
-
-    if(nummips == 0)
-      nummips = 1;
-    if(numslices == 0)
-      numslices = 1;
+  if(subs.size() != count)
+  {
+    RDCERR("Image has %u subresource states, expected %u - can't apply barrier",
+           (uint32_t)subs.size(), (uint32_t)count);
+    return;
+  }
 
-    if(t.oldLayout == t.newLayout)
-      continue;
+  const uint32_t endMip = RDCMIN(baseMip + nummips, levelCount);
+  const uint32_t endLayer = RDCMIN(baseLayer + numslices, layerCount);
 
-    TRDBG("Barrier of %s (%u->%u, %u->%u) from %s to %s",
-          ToStr::Get(t.subresourceRange.aspect).c_str(), t.subresourceRange.baseMipLevel,
-          t.subresourceRange.levelCount, t.subresourceRange.baseArrayLayer,
-          t.subresourceRange.layerCount, ToStr::Get(t.oldLayout).c_str(),
-          ToStr::Get(t.newLayout).c_str());
+  if(endMip - baseMip == 1 && endLayer - baseLayer == 1)
+  {
+    ImageRegionState &st = subs[layout.SubresourceIndex(baseMip, baseLayer)];
 
-    bool done = false;
+    if(st.oldLayout == UNKNOWN_PREV_IMG_LAYOUT)
+      st.oldLayout = t.oldLayout;
+    t.oldLayout = st.newLayout;
+    st.newLayout = t.newLayout;
+    return;
+  }
 
-    TRDBG("Matching image has %u subresource states", stit->second.subresourceStates.size());
+  for(uint32_t layer = baseLayer; layer < endLayer; layer++)
+  {
+    ImageRegionState *st = &subs[layout.SubresourceIndex(baseMip, layer)];
 
-    auto it = stit->second.subresourceStates.begin();
-    for(; it != stit->second.subresourceStates.end(); ++it)
+    for(uint32_t mip = baseMip; mip < endMip; mip++, st++)
     {
-      TRDBG(".. state %s (%u->%u, %u->%u) from %s to %s",
-            ToStr::Get(it->subresourceRange.aspect).c_str(), it->range.baseMipLevel,
-            it->range.levelCount, it->range.baseArrayLayer, it->range.layerCount,
-            ToStr::Get(it->oldLayout).c_str(), ToStr::Get(it->newLayout).c_str());
-
-      // image barriers are handled by initially inserting one subresource range for the whole
-      // object,
-      // and whenever we need more fine-grained detail we split it immediately.
-      // Thereafter if a barrier comes in that covers multiple subresources, we update all matching
-      // ranges.
-      // NOTE: Depth-stencil images must always be trasnsitioned together for both aspects, so we
-      // don't
-      // have to worry about different aspects being in different states and can in fact ignore the
-      // aspect
-      // for the purpose of this case.
+      if(st->oldLayout == UNKNOWN_PREV_IMG_LAYOUT)
+        st->oldLayout = t.oldLayout;
+      st->newLayout = t.newLayout;
+    }
+  }
 
-      {
-        // we've found a range that completely matches our region, doesn't matter if that's
-        // a whole image and the barrier is the whole image, or it's one subresource.
-        // note that for images with only one array/mip slice (e.g. render targets) we'll never
-        // really have to worry about the else{} branch
-        if(it->subresourceRange.baseMipLevel == t.subresourceRange.baseMipLevel &&
-           it->subresourceRange.levelCount == nummips &&
-           it->subresourceRange.baseArrayLayer == t.subresourceRange.baseArrayLayer &&
-           it->subresourceRange.layerCount == numslices)
-        {
-          /*
-          RDCASSERT(t.oldLayout == UNKNOWN_PREV_IMG_LAYOUT || it->newLayout ==
-          UNKNOWN_PREV_IMG_LAYOUT || // renderdoc untracked/ignored
-                    it->newLayout == t.oldLayout || // valid barrier
-                    t.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED); // can barrier from UNDEFINED to any
-          state
-          */
-          if(it->oldLayout == UNKNOWN_PREV_IMG_LAYOUT)
-            it->oldLayout = t.oldLayout;
-          t.oldLayout = it->newLayout;
-          it->newLayout = t.newLayout;
+  // if the whole image is now in one layout again and every subresource started from the same
+  // place, go back to tracking it as a whole.
+  if(wholeImage)
+  {
+    const VkImageLayout oldLayout = subs[0].oldLayout;
 
-          done = true;
-          break;
-        }
-        else
-        {
-          // this handles the case where the barrier covers a number of subresources and we need
-          // to update each matching subresource. If the barrier was only one mip & array slice
-          // it would have hit the case above. Find each subresource within the range, update it,
-          // and continue (marking as done so whenever we stop finding matching ranges, we are
-          // satisfied.
-          //
-          // note that regardless of how we lay out our subresources (slice-major or mip-major) the
-          // new
-          // range could be sparse, but that's OK as we only break out of the loop once we go past
-          // the whole
-          // aspect. Any subresources that don't match the range, after the split, will fail to meet
-          // any
-          // of the handled cases, so we'll just continue processing.
-          if(it->subresourceRange.levelCount == 1 && it->subresourceRange.layerCount == 1 &&
-             it->subresourceRange.baseMipLevel >= t.subresourceRange.baseMipLevel &&
-             it->subresourceRange.baseMipLevel < t.subresourceRange.baseMipLevel + nummips &&
-             it->subresourceRange.baseArrayLayer >= t.subresourceRange.baseArrayLayer &&
-             it->subresourceRange.baseArrayLayer < t.subresourceRange.baseArrayLayer + numslices)
-          {
-            // apply it (prevstate is from the start of all barriers accumulated, so only set once)
-            if(it->oldLayout == UNKNOWN_PREV_IMG_LAYOUT)
-              it->oldLayout = t.oldLayout;
-            it->newLayout = t.newLayout;
+    for(size_t i = 1; i < count; i++)
+      if(subs[i].oldLayout != oldLayout)
+        return;
 
-            // continue as there might be more, but we're done
-            done = true;
-            continue;
-          }
-          // finally handle the case where we have a range that covers a whole image but we need to
-          // split it. If the barrier covered the whole image too it would have hit the very first
-          // case, so we know that the barrier doesn't cover the whole range.
-          // Also, if we've already done the split this case won't be hit and we'll either fall into
-          // the case above, or we'll finish as we've covered the whole barrier.
-          else if(it->subresourceRange.levelCount > 1 || it->subresourceRange.layerCount > 1)
-          {
-            ImageRegionState existing = *it;
-
-            // remember where we were in the array, as after this iterators will be
-            // invalidated.
-            size_t offs = it - stit->second.subresourceStates.begin();
-            size_t count = it->subresourceRange.levelCount * it->subresourceRange.layerCount;
-
-            // only insert count-1 as we want count entries total - one per subresource
-            stit->second.subresourceStates.insert(it, count - 1, existing);
-
-            // it now points at the first subresource, but we need to modify the ranges
-            // to be valid
-            it = stit->second.subresourceStates.begin() + offs;
-
-            for(size_t i = 0; i < count; i++)
-            {
-              it->subresourceRange.levelCount = 1;
-              it->subresourceRange.layerCount = 1;
-
-              // slice-major
-              it->subresourceRange.baseArrayLayer =
-                  uint32_t(i / existing.subresourceRange.levelCount);
-              it->subresourceRange.baseMipLevel = uint32_t(i % existing.subresourceRange.levelCount);
-              it++;
-            }
-
-            // reset the iterator to point to the first subresource
-            it = stit->second.subresourceStates.begin() + offs;
-
-            // the loop will continue after this point and look at the next subresources
-            // so we need to check to see if the first subresource lies in the range here
-            if(it->subresourceRange.baseMipLevel >= t.subresourceRange.baseMipLevel &&
-               it->subresourceRange.baseMipLevel < t.subresourceRange.baseMipLevel + nummips &&
-               it->subresourceRange.baseArrayLayer >= t.subresourceRange.baseArrayLayer &&
-               it->subresourceRange.baseArrayLayer < t.subresourceRange.baseArrayLayer + numslices)
-            {
-              // apply it (prevstate is from the start of all barriers accumulated, so only set
-              // once)
-              if(it->oldLayout == UNKNOWN_PREV_IMG_LAYOUT)
-                it->oldLayout = t.oldLayout;
-              it->newLayout = t.newLayout;
-
-              // continue as there might be more, but we're done
-              done = true;
-            }
-
-            // continue processing from here
-            continue;
-          }
-        }
-      }
+    subs.resize(1);
+    subs[0].subresourceRange.levelCount = levelCount;
+    subs[0].subresourceRange.layerCount = layerCount;
+  }
+}
+
+void VulkanResourceManager::ApplyBarriers(vector<pair<ResourceId, ImageRegionState> > &states,
+                                          map<ResourceId, ImageLayouts> &layouts,
+                                          Threading::CriticalSection &layoutsLock)
+{
+  TRDBG("Applying %u barriers", (uint32_t)states.size());
+
+  size_t ti = 0;
+  while(ti < states.size())
+  {
+    ResourceId id = states[ti].first;
+
+    // states are grouped by image, so find and lock each image once for all of its barriers
+    size_t end = ti + 1;
+    while(end < states.size() && states[end].first == id)
+      end++;
+
+    TRDBG("Applying %u barriers to %llu", uint32_t(end - ti), GetOriginalID(id));
+
+    ImageLayouts *layout = NULL;
+
+    {
+      SCOPED_LOCK(layoutsLock);
+      auto stit = layouts.find(id);
+      if(stit != layouts.end())
+        layout = &stit->second;
+    }
 
-      // otherwise continue to try and find the subresource range
+    if(layout == NULL)
+    {
+      TRDBG("Didn't find ID in image layouts");
+      ti = end;
+      continue;
     }
 
-    if(!done)
-      RDCERR("Couldn't find subresource range to apply barrier to - invalid!");
+    SCOPED_LOCK(layout->lock);
+
+    for(; ti < end; ti++)
+      ApplySingleBarrier(*layout, states[ti].second);
   }
 }
 
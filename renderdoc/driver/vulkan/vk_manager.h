@@ -105,16 +105,19 @@ public:
                            const SrcBarrierType &t, uint32_t nummips, uint32_t numslices);
 
   void RecordBarriers(vector<pair<ResourceId, ImageRegionState> > &states,
-                      const map<ResourceId, ImageLayouts> &layouts, uint32_t numBarriers,
+                      const map<ResourceId, ImageLayouts> &layouts,
+                      Threading::CriticalSection &layoutsLock, uint32_t numBarriers,
                       const VkImageMemoryBarrier *barriers);
 
   void MergeBarriers(vector<pair<ResourceId, ImageRegionState> > &dststates,
                      vector<pair<ResourceId, ImageRegionState> > &srcstates);
 
   void ApplyBarriers(vector<pair<ResourceId, ImageRegionState> > &states,
-                     map<ResourceId, ImageLayouts> &layouts);
+                     map<ResourceId, ImageLayouts> &layouts,
+                     Threading::CriticalSection &layoutsLock);
 
   void SerialiseImageStates(map<ResourceId, ImageLayouts> &states,
+                            Threading::CriticalSection &statesLock,
                             vector<VkImageMemoryBarrier> &barriers);
 
   ResourceId GetID(WrappedVkRes *res)
@@ -0,0 +1,220 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "vk_reflection_cache.h"
+#include "api/replay/version.h"
+#include "driver/shaders/spirv/spirv_common.h"
+#include "serialise/serialiser.h"
+#include "serialise/string_utils.h"
+
+// defined in replay_proxy.cpp
+template <>
+void Serialiser::Serialise(const char *name, ShaderReflection &el);
+template <>
+void Serialiser::Serialise(const char *name, ShaderBindpointMapping &el);
+
+VulkanReflectionCache &VulkanReflectionCache::Get()
+{
+  static VulkanReflectionCache cache;
+  return cache;
+}
+
+VulkanReflectionCache::VulkanReflectionCache()
+{
+  m_Disk = NULL;
+  m_DisassemblyBytes = 0;
+}
+
+VulkanReflectionCache::~VulkanReflectionCache()
+{
+  // deliberately not flushed or freed here - this runs during static destruction, when file I/O
+  // and logging aren't safe. Any unflushed entries are dropped.
+}
+
+uint64_t VulkanReflectionCache::HashModule(const vector<uint32_t> &spirv)
+{
+  if(spirv.empty())
+    return 0;
+
+  return hash64(&spirv[0], spirv.size() * sizeof(uint32_t));
+}
+
+uint64_t VulkanReflectionCache::MakeKey(uint64_t moduleHash, const string &entryPoint,
+                                        KeyType type)
+{
+  uint64_t key = hash64(entryPoint.c_str(), entryPoint.size() + 1, moduleHash);
+  return hash64(&type, sizeof(type), key);
+}
+
+void VulkanReflectionCache::OpenDisk()
+{
+  if(m_Disk)
+    return;
+
+  // entries are only trusted from the same build, since any change to the SPIR-V code can change
+  // what it produces. m_CacheVersion still covers local builds that have no commit hash.
+  const char build[] = RENDERDOC_VERSION_STRING " " GIT_COMMIT_HASH;
+  uint64_t buildHash = hash64(build, sizeof(build), m_CacheVersion);
+
+  m_Disk = new ShaderBlobCache();
+  m_Disk->Open("vkreflection.cache", m_CacheMagic, uint32_t(buildHash ^ (buildHash >> 32)));
+}
+
+void VulkanReflectionCache::Flush()
+{
+  SCOPED_LOCK(m_Lock);
+
+  if(m_Disk)
+    m_Disk->Close();
+
+  SAFE_DELETE(m_Disk);
+}
+
+void VulkanReflectionCache::EvictReflections()
+{
+  while(m_ReflectionOrder.size() > MaxReflections)
+  {
+    m_Reflections.erase(m_ReflectionOrder.front());
+    m_ReflectionOrder.pop_front();
+  }
+}
+
+void VulkanReflectionCache::EvictDisassembly()
+{
+  // always keep the newest entry, even if it's over budget on its own
+  while(m_DisassemblyBytes > MaxDisassemblyBytes && m_DisassemblyOrder.size() > 1)
+  {
+    auto it = m_Disassembly.find(m_DisassemblyOrder.front());
+    m_DisassemblyBytes -= it->second.size();
+    m_Disassembly.erase(it);
+    m_DisassemblyOrder.pop_front();
+  }
+}
+
+void VulkanReflectionCache::MakeReflection(SPVModule &module, uint64_t moduleHash,
+                                           const string &entryPoint, ShaderReflection *refl,
+                                           ShaderBindpointMapping *mapping)
+{
+  // with no code to hash there's nothing worth caching
+  if(moduleHash == 0)
+  {
+    module.MakeReflection(entryPoint, refl, mapping);
+    return;
+  }
+
+  uint64_t key = MakeKey(moduleHash, entryPoint, eKey_Reflection);
+
+  SCOPED_LOCK(m_Lock);
+
+  auto it = m_Reflections.find(key);
+  if(it != m_Reflections.end())
+  {
+    *refl = it->second.refl;
+    *mapping = it->second.mapping;
+    return;
+  }
+
+  OpenDisk();
+
+  m_ReflectionOrder.push_back(key);
+  EvictReflections();
+
+  CachedReflection &cached = m_Reflections[key];
+
+  const byte *data = NULL;
+  uint32_t size = 0;
+  if(m_Disk->Find(key, data, size) && size > 0)
+  {
+    Serialiser ser(size, data, false);
+
+    ser.Serialise("", cached.refl);
+    ser.Serialise("", cached.mapping);
+
+    if(!ser.HasError())
+    {
+      *refl = cached.refl;
+      *mapping = cached.mapping;
+      return;
+    }
+
+    RDCWARN("Corrupt cached reflection data for entry point '%s', regenerating",
+            entryPoint.c_str());
+
+    cached = CachedReflection();
+  }
+
+  module.MakeReflection(entryPoint, &cached.refl, &cached.mapping);
+
+  {
+    Serialiser ser(NULL, Serialiser::WRITING, false);
+
+    ser.Serialise("", cached.refl);
+    ser.Serialise("", cached.mapping);
+
+    m_Disk->Insert(key, ser.GetRawPtr(0), (uint32_t)ser.GetOffset());
+  }
+
+  *refl = cached.refl;
+  *mapping = cached.mapping;
+}
+
+string VulkanReflectionCache::Disassemble(SPVModule &module, uint64_t moduleHash,
+                                          const string &entryPoint)
+{
+  if(moduleHash == 0)
+    return module.Disassemble(entryPoint);
+
+  uint64_t key = MakeKey(moduleHash, entryPoint, eKey_Disassembly);
+
+  SCOPED_LOCK(m_Lock);
+
+  auto it = m_Disassembly.find(key);
+  if(it != m_Disassembly.end())
+    return it->second;
+
+  OpenDisk();
+
+  string disasm;
+
+  const byte *data = NULL;
+  uint32_t size = 0;
+  if(m_Disk->Find(key, data, size))
+  {
+    disasm.assign((const char *)data, (const char *)data + size);
+  }
+  else
+  {
+    disasm = module.Disassemble(entryPoint);
+
+    m_Disk->Insert(key, disasm.c_str(), (uint32_t)disasm.size());
+  }
+
+  m_Disassembly[key] = disasm;
+  m_DisassemblyOrder.push_back(key);
+  m_DisassemblyBytes += disasm.size();
+  EvictDisassembly();
+
+  return disasm;
+}
@@ -0,0 +1,108 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include "common/shader_cache.h"
+#include "common/threading.h"
+#include "api/replay/renderdoc_replay.h"
+
+struct SPVModule;
+
+// Caches SPIR-V reflection data and disassembly, keyed by a hash of the module's words and the
+// entry point. The newest entries are kept in memory across replays, up to a fixed budget, so
+// the same shader loaded from several captures is only reflected once. Everything is written to
+// disk on Flush() so that later sessions can skip it entirely. Only used on replay.
+class VulkanReflectionCache
+{
+public:
+  static VulkanReflectionCache &Get();
+
+  static uint64_t HashModule(const vector<uint32_t> &spirv);
+
+  // fills out the reflection and bindpoint mapping for the given entry point, either from the
+  // cache or by calling SPVModule::MakeReflection and adding the result.
+  void MakeReflection(SPVModule &module, uint64_t moduleHash, const string &entryPoint,
+                      ShaderReflection *refl, ShaderBindpointMapping *mapping);
+
+  // as above for SPVModule::Disassemble
+  string Disassemble(SPVModule &module, uint64_t moduleHash, const string &entryPoint);
+
+  // writes any new entries to disk. The cache is re-opened on next use. Must be called when the
+  // replay is shut down, nothing is written on process exit.
+  void Flush();
+
+private:
+  VulkanReflectionCache();
+  ~VulkanReflectionCache();
+
+  // not copyable
+  VulkanReflectionCache(const VulkanReflectionCache &);
+  VulkanReflectionCache &operator=(const VulkanReflectionCache &);
+
+  struct CachedReflection
+  {
+    ShaderReflection refl;
+    ShaderBindpointMapping mapping;
+  };
+
+  enum KeyType
+  {
+    eKey_Reflection = 1,
+    eKey_Disassembly,
+  };
+
+  static uint64_t MakeKey(uint64_t moduleHash, const string &entryPoint, KeyType type);
+
+  void OpenDisk();
+  void EvictReflections();
+  void EvictDisassembly();
+
+  // the version on disk also includes the RenderDoc version and commit, so a cache is never
+  // re-used by a different build. Bump this whenever the output of MakeReflection or Disassemble
+  // changes, for builds without a commit hash.
+  static const uint32_t m_CacheMagic = 0xf00d5eed;
+  static const uint32_t m_CacheVersion = 1;
+
+  // limits on what's held in memory. Evicted entries are still on disk, so they only cost a lookup
+  // and deserialise if they're needed again.
+  static const size_t MaxReflections = 1024;
+  static const size_t MaxDisassemblyBytes = 16 * 1024 * 1024;
+
+  Threading::CriticalSection m_Lock;
+
+  // allocated on first use and freed on Flush(), so a cache left open at exit isn't written from a
+  // static destructor.
+  ShaderBlobCache *m_Disk;
+
+  // the order lists hold keys oldest first, for evicting from the maps
+  std::map<uint64_t, CachedReflection> m_Reflections;
+  std::deque<uint64_t> m_ReflectionOrder;
+  std::map<uint64_t, string> m_Disassembly;
+  std::deque<uint64_t> m_DisassemblyOrder;
+  size_t m_DisassemblyBytes;
+};
@@ -29,6 +29,7 @@
 #include "serialise/string_utils.h"
 #include "vk_core.h"
 #include "vk_debug.h"
+#include "vk_reflection_cache.h"
 #include "vk_resources.h"
 
 #define VULKAN 1
@@ -640,6 +641,8 @@ void VulkanReplay::Shutdown()
   m_pDriver->Shutdown();
   delete m_pDriver;
 
+  VulkanReflectionCache::Get().Flush();
+
   VulkanReplay::PostDeviceShutdownCounters();
 }
 
@@ -914,8 +917,7 @@ ShaderReflection *VulkanReplay::GetShader(ResourceId shader, string entryPoint)
 
   // disassemble lazily on demand
   if(shad->second.m_Reflections[entryPoint].refl.Disassembly.count == 0)
-    shad->second.m_Reflections[entryPoint].refl.Disassembly =
-        shad->second.spirv.Disassemble(entryPoint);
+    shad->second.m_Reflections[entryPoint].refl.Disassembly = shad->second.Disassemble(entryPoint);
 
   if(shad->second.m_Reflections[entryPoint].refl.RawBytes.count == 0 &&
      !shad->second.spirv.spirv.empty())
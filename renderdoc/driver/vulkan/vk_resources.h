@@ -902,6 +902,11 @@ struct CmdBufferRecordingInfo
   set<VkDescriptorSet> boundDescSets;
 
   vector<VkResourceRecord *> subcmds;
+
+  // commands since the last begin, appended back to back instead of each being its own chunk.
+  // Command buffers are externally synchronised so this needs no lock, and the memory is kept
+  // across resets to be reused by the next recording
+  ChunkStream commands;
 };
 
 struct DescSetLayout;
@@ -1158,7 +1163,20 @@ struct ImageLayouts
     extent.width = extent.height = extent.depth = 1;
   }
 
+  // either a single state covering the whole image, or once a barrier has touched only part of
+  // the image, exactly one state per subresource in slice-major order - see SubresourceIndex().
+  // Aspects are always transitioned together so they share a state.
   vector<ImageRegionState> subresourceStates;
+
+  size_t SubresourceIndex(uint32_t mip, uint32_t layer) const
+  {
+    return size_t(layer) * levelCount + mip;
+  }
+
+  // protects subresourceStates. The map lock only needs to be held while looking up, adding or
+  // removing images, so barriers on different images don't contend
+  Threading::CriticalSection lock;
+
   int layerCount, levelCount, sampleCount;
   VkExtent3D extent;
   VkFormat format;
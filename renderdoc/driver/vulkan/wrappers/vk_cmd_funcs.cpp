@@ -374,6 +374,22 @@ VkResult WrappedVulkan::vkCreateCommandPool(VkDevice device,
 VkResult WrappedVulkan::vkResetCommandPool(VkDevice device, VkCommandPool cmdPool,
                                            VkCommandPoolResetFlags flags)
 {
+  // command buffers keep their recording memory to be reused, unless the application asks for it
+  // back
+  if(flags & VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT)
+  {
+    VkResourceRecord *record = GetRecord(cmdPool);
+
+    if(record)
+    {
+      record->LockChunks();
+      for(auto it = record->pooledChildren.begin(); it != record->pooledChildren.end(); ++it)
+        if((*it)->cmdInfo)
+          (*it)->cmdInfo->commands.Free();
+      record->UnlockChunks();
+    }
+  }
+
   return ObjDisp(device)->ResetCommandPool(Unwrap(device), Unwrap(cmdPool), flags);
 }
 
@@ -636,13 +652,16 @@ VkResult WrappedVulkan::vkBeginCommandBuffer(VkCommandBuffer commandBuffer,
     record->bakedCommands->cmdInfo->device = record->cmdInfo->device;
     record->bakedCommands->cmdInfo->allocInfo = record->cmdInfo->allocInfo;
 
+    // any commands from a previous recording that never ended are discarded
+    record->cmdInfo->commands.Reset();
+
     {
       CACHE_THREAD_SERIALISER();
 
       SCOPED_SERIALISE_CONTEXT(BEGIN_CMD_BUFFER);
       Serialise_vkBeginCommandBuffer(localSerialiser, commandBuffer, pBeginInfo);
 
-      record->AddChunk(scope.Get());
+      scope.Append(&record->cmdInfo->commands);
     }
   }
 
@@ -777,9 +796,14 @@ VkResult WrappedVulkan::vkEndCommandBuffer(VkCommandBuffer commandBuffer)
       SCOPED_SERIALISE_CONTEXT(END_CMD_BUFFER);
       Serialise_vkEndCommandBuffer(localSerialiser, commandBuffer);
 
-      record->AddChunk(scope.Get());
+      scope.Append(&record->cmdInfo->commands);
     }
 
+    // the whole recording becomes one chunk, ordered by when it ended so that anything it uses
+    // that was recorded in the meantime, like secondary command buffers, comes before it
+    record->AddChunk(new Chunk(&record->cmdInfo->commands, BEGIN_CMD_BUFFER, false));
+    record->cmdInfo->commands.Reset();
+
     record->Bake();
   }
 
@@ -809,6 +833,12 @@ VkResult WrappedVulkan::vkResetCommandBuffer(VkCommandBuffer commandBuffer,
       record->bakedCommands->Delete(GetResourceManager());
 
     record->bakedCommands = NULL;
+
+    // the recording memory is kept for the next recording unless the application asks for it back
+    if(flags & VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT)
+      record->cmdInfo->commands.Free();
+    else
+      record->cmdInfo->commands.Reset();
   }
 
   return ObjDisp(commandBuffer)->ResetCommandBuffer(Unwrap(commandBuffer), flags);
@@ -849,7 +879,8 @@ bool WrappedVulkan::Serialise_vkCmdBeginRenderPass(Serialiser *localSerialiser,
 
       ResourceId cmd = GetResID(commandBuffer);
       GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                           (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                           m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                           &imgBarriers[0]);
     }
   }
   else if(m_State == READING)
@@ -869,7 +900,8 @@ bool WrappedVulkan::Serialise_vkCmdBeginRenderPass(Serialiser *localSerialiser,
 
     ResourceId cmd = GetResID(commandBuffer);
     GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                         (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                         m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                         &imgBarriers[0]);
 
     const string desc = localSerialiser->GetDebugStr();
 
@@ -906,7 +938,7 @@ void WrappedVulkan::vkCmdBeginRenderPass(VkCommandBuffer commandBuffer,
     SCOPED_SERIALISE_CONTEXT(BEGIN_RENDERPASS);
     Serialise_vkCmdBeginRenderPass(localSerialiser, commandBuffer, pRenderPassBegin, contents);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(pRenderPassBegin->renderPass), eFrameRef_Read);
 
     VkResourceRecord *fb = GetRecord(pRenderPassBegin->framebuffer);
@@ -956,7 +988,8 @@ bool WrappedVulkan::Serialise_vkCmdNextSubpass(Serialiser *localSerialiser,
 
       ResourceId cmd = GetResID(commandBuffer);
       GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                           (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                           m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                           &imgBarriers[0]);
     }
   }
   else if(m_State == READING)
@@ -972,7 +1005,8 @@ bool WrappedVulkan::Serialise_vkCmdNextSubpass(Serialiser *localSerialiser,
 
     ResourceId cmd = GetResID(commandBuffer);
     GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                         (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                         m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                         &imgBarriers[0]);
 
     const string desc = localSerialiser->GetDebugStr();
 
@@ -1003,7 +1037,7 @@ void WrappedVulkan::vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassCon
     SCOPED_SERIALISE_CONTEXT(NEXT_SUBPASS);
     Serialise_vkCmdNextSubpass(localSerialiser, commandBuffer, contents);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -1030,7 +1064,8 @@ bool WrappedVulkan::Serialise_vkCmdEndRenderPass(Serialiser *localSerialiser,
 
       ResourceId cmd = GetResID(commandBuffer);
       GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                           (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                           m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                           &imgBarriers[0]);
     }
   }
   else if(m_State == READING)
@@ -1043,7 +1078,8 @@ bool WrappedVulkan::Serialise_vkCmdEndRenderPass(Serialiser *localSerialiser,
 
     ResourceId cmd = GetResID(commandBuffer);
     GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                         (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                         m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                         &imgBarriers[0]);
 
     const string desc = localSerialiser->GetDebugStr();
 
@@ -1080,7 +1116,7 @@ void WrappedVulkan::vkCmdEndRenderPass(VkCommandBuffer commandBuffer)
     SCOPED_SERIALISE_CONTEXT(END_RENDERPASS);
     Serialise_vkCmdEndRenderPass(localSerialiser, commandBuffer);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     VkResourceRecord *fb = record->cmdInfo->framebuffer;
 
@@ -1095,11 +1131,9 @@ void WrappedVulkan::vkCmdEndRenderPass(VkCommandBuffer commandBuffer)
     }
 
     // apply the implicit layout transitions here
-    {
-      SCOPED_LOCK(m_ImageLayoutsLock);
-      GetResourceManager()->RecordBarriers(GetRecord(commandBuffer)->cmdInfo->imgbarriers,
-                                           m_ImageLayouts, (uint32_t)barriers.size(), &barriers[0]);
-    }
+    GetResourceManager()->RecordBarriers(GetRecord(commandBuffer)->cmdInfo->imgbarriers,
+                                         m_ImageLayouts, m_ImageLayoutsLock,
+                                         (uint32_t)barriers.size(), &barriers[0]);
   }
 }
 
@@ -1208,7 +1242,7 @@ void WrappedVulkan::vkCmdBindPipeline(VkCommandBuffer commandBuffer,
     SCOPED_SERIALISE_CONTEXT(BIND_PIPELINE);
     Serialise_vkCmdBindPipeline(localSerialiser, commandBuffer, pipelineBindPoint, pipeline);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(pipeline), eFrameRef_Read);
   }
 }
@@ -1395,7 +1429,7 @@ void WrappedVulkan::vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer,
                                       firstSet, setCount, pDescriptorSets, dynamicOffsetCount,
                                       pDynamicOffsets);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(layout), eFrameRef_Read);
     record->cmdInfo->boundDescSets.insert(pDescriptorSets, pDescriptorSets + setCount);
 
@@ -1520,7 +1554,7 @@ void WrappedVulkan::vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32
     Serialise_vkCmdBindVertexBuffers(localSerialiser, commandBuffer, firstBinding, bindingCount,
                                      pBuffers, pOffsets);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     for(uint32_t i = 0; i < bindingCount; i++)
     {
       record->MarkResourceFrameReferenced(GetResID(pBuffers[i]), eFrameRef_Read);
@@ -1593,7 +1627,7 @@ void WrappedVulkan::vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer
     SCOPED_SERIALISE_CONTEXT(BIND_INDEX_BUFFER);
     Serialise_vkCmdBindIndexBuffer(localSerialiser, commandBuffer, buffer, offset, indexType);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(buffer), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(buffer)->baseResource, eFrameRef_Read);
     if(GetRecord(buffer)->sparseInfo)
@@ -1662,7 +1696,7 @@ void WrappedVulkan::vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer de
     Serialise_vkCmdUpdateBuffer(localSerialiser, commandBuffer, destBuffer, destOffset, dataSize,
                                 pData);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     VkResourceRecord *buf = GetRecord(destBuffer);
 
@@ -1730,7 +1764,7 @@ void WrappedVulkan::vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dest
     SCOPED_SERIALISE_CONTEXT(FILL_BUF);
     Serialise_vkCmdFillBuffer(localSerialiser, commandBuffer, destBuffer, destOffset, fillSize, data);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     VkResourceRecord *buf = GetRecord(destBuffer);
 
@@ -1808,7 +1842,7 @@ void WrappedVulkan::vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipeline
     Serialise_vkCmdPushConstants(localSerialiser, commandBuffer, layout, stageFlags, start, length,
                                  values);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(layout), eFrameRef_Read);
   }
 }
@@ -1879,7 +1913,8 @@ bool WrappedVulkan::Serialise_vkCmdPipelineBarrier(
 
       ResourceId cmd = GetResID(commandBuffer);
       GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                           (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                           m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                           &imgBarriers[0]);
     }
   }
   else if(m_State == READING)
@@ -1894,7 +1929,8 @@ bool WrappedVulkan::Serialise_vkCmdPipelineBarrier(
 
     ResourceId cmd = GetResID(commandBuffer);
     GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                         (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                         m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                         &imgBarriers[0]);
 
     for(size_t i = 0; i < imgBarriers.size(); i++)
     {
@@ -1955,15 +1991,12 @@ void WrappedVulkan::vkCmdPipelineBarrier(
                                    bufferMemoryBarrierCount, pBufferMemoryBarriers,
                                    imageMemoryBarrierCount, pImageMemoryBarriers);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     if(imageMemoryBarrierCount > 0)
-    {
-      SCOPED_LOCK(m_ImageLayoutsLock);
-      GetResourceManager()->RecordBarriers(GetRecord(commandBuffer)->cmdInfo->imgbarriers,
-                                           m_ImageLayouts, imageMemoryBarrierCount,
-                                           pImageMemoryBarriers);
-    }
+    GetResourceManager()->RecordBarriers(GetRecord(commandBuffer)->cmdInfo->imgbarriers,
+                                         m_ImageLayouts, m_ImageLayoutsLock,
+                                         imageMemoryBarrierCount, pImageMemoryBarriers);
   }
 }
 
@@ -2021,7 +2054,7 @@ void WrappedVulkan::vkCmdWriteTimestamp(VkCommandBuffer commandBuffer,
     SCOPED_SERIALISE_CONTEXT(WRITE_TIMESTAMP);
     Serialise_vkCmdWriteTimestamp(localSerialiser, commandBuffer, pipelineStage, queryPool, query);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     record->MarkResourceFrameReferenced(GetResID(queryPool), eFrameRef_Read);
   }
@@ -2094,7 +2127,7 @@ void WrappedVulkan::vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQ
     Serialise_vkCmdCopyQueryPoolResults(localSerialiser, commandBuffer, queryPool, firstQuery,
                                         queryCount, destBuffer, destOffset, destStride, flags);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(queryPool), eFrameRef_Read);
 
     VkResourceRecord *buf = GetRecord(destBuffer);
@@ -2162,7 +2195,7 @@ void WrappedVulkan::vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool q
     SCOPED_SERIALISE_CONTEXT(BEGIN_QUERY);
     Serialise_vkCmdBeginQuery(localSerialiser, commandBuffer, queryPool, query, flags);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(queryPool), eFrameRef_Read);
   }
 }
@@ -2216,7 +2249,7 @@ void WrappedVulkan::vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool que
     SCOPED_SERIALISE_CONTEXT(END_QUERY);
     Serialise_vkCmdEndQuery(localSerialiser, commandBuffer, queryPool, query);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(queryPool), eFrameRef_Read);
   }
 }
@@ -2274,7 +2307,7 @@ void WrappedVulkan::vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPo
     SCOPED_SERIALISE_CONTEXT(RESET_QUERY_POOL);
     Serialise_vkCmdResetQueryPool(localSerialiser, commandBuffer, queryPool, firstQuery, queryCount);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(queryPool), eFrameRef_Read);
   }
 }
@@ -2327,7 +2360,8 @@ bool WrappedVulkan::Serialise_vkCmdExecuteCommands(Serialiser *localSerialiser,
     for(uint32_t i = 0; i < count; i++)
     {
       ResourceId cmd = GetResourceManager()->GetLiveID(cmdids[i]);
-      GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts);
+      GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
+                                          m_ImageLayoutsLock);
     }
 
     const string desc = localSerialiser->GetDebugStr();
@@ -2471,7 +2505,7 @@ bool WrappedVulkan::Serialise_vkCmdExecuteCommands(Serialiser *localSerialiser,
           rerecordedCmds.push_back(Unwrap(cmd));
 
           GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[rerecord].imgbarriers,
-                                              m_ImageLayouts);
+                                              m_ImageLayouts, m_ImageLayoutsLock);
         }
 
         ObjDisp(commandBuffer)->CmdExecuteCommands(Unwrap(commandBuffer), count, &rerecordedCmds[0]);
@@ -2536,7 +2570,8 @@ bool WrappedVulkan::Serialise_vkCmdExecuteCommands(Serialiser *localSerialiser,
         for(uint32_t i = 0; i < trimmedCmdIds.size(); i++)
         {
           ResourceId cmd = trimmedCmdIds[i];
-          GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts);
+          GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
+                                              m_ImageLayoutsLock);
         }
       }
       else
@@ -2552,7 +2587,8 @@ bool WrappedVulkan::Serialise_vkCmdExecuteCommands(Serialiser *localSerialiser,
         for(uint32_t i = 0; i < count; i++)
         {
           ResourceId cmd = GetResourceManager()->GetLiveID(cmdids[i]);
-          GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts);
+          GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
+                                              m_ImageLayoutsLock);
         }
       }
     }
@@ -2580,7 +2616,7 @@ void WrappedVulkan::vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t
     SCOPED_SERIALISE_CONTEXT(EXEC_CMDS);
     Serialise_vkCmdExecuteCommands(localSerialiser, commandBuffer, commandBufferCount, pCmdBuffers);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     for(uint32_t i = 0; i < commandBufferCount; i++)
     {
@@ -2650,7 +2686,7 @@ void WrappedVulkan::vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer,
     SCOPED_SERIALISE_CONTEXT(BEGIN_EVENT);
     Serialise_vkCmdDebugMarkerBeginEXT(localSerialiser, commandBuffer, pMarker);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -2699,7 +2735,7 @@ void WrappedVulkan::vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer)
     SCOPED_SERIALISE_CONTEXT(END_EVENT);
     Serialise_vkCmdDebugMarkerEndEXT(localSerialiser, commandBuffer);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -2752,6 +2788,6 @@ void WrappedVulkan::vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer,
     SCOPED_SERIALISE_CONTEXT(SET_MARKER);
     Serialise_vkCmdDebugMarkerInsertEXT(localSerialiser, commandBuffer, pMarker);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
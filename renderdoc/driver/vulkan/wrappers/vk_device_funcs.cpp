@@ -24,6 +24,7 @@
 
 #include "../vk_core.h"
 #include "../vk_debug.h"
+#include "serialise/string_utils.h"
 
 // vk_dispatchtables.cpp
 void InitDeviceTable(VkDevice dev, PFN_vkGetDeviceProcAddr gpa);
@@ -89,6 +90,260 @@ static void StripUnwantedLayers(vector<string> &Layers)
   }
 }
 
+// on-disk pipeline cache header, followed by dataSize bytes of VkPipelineCache data
+struct ReplayPipelineCacheHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t captureHash;
+  uint32_t vendorID;
+  uint32_t deviceID;
+  uint32_t driverVersion;
+  uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+  uint64_t dataSize;
+};
+
+static const uint32_t ReplayPipelineCacheMagic = MAKE_FOURCC('R', 'D', 'P', 'C');
+static const uint32_t ReplayPipelineCacheVersion = 2;
+
+// total size of all the pipeline caches kept in the app folder. When it's exceeded after writing
+// one out, the least recently used caches are deleted.
+static const uint64_t ReplayPipelineCacheBudget = 256 * 1024 * 1024;
+
+// identifies a capture without reading all of it - captures can be gigabytes. The file header and
+// the first chunks (the initialisation parameters and the start of the resource creation) together
+// with the file's size and modification time are enough to tell captures apart.
+static uint64_t HashCaptureFile(const string &filename)
+{
+  FILE *f = FileIO::fopen(filename.c_str(), "rb");
+
+  if(f == NULL)
+    return 0;
+
+  vector<byte> block(64 * 1024);
+
+  size_t read = FileIO::fread(&block[0], 1, block.size(), f);
+
+  FileIO::fseek64(f, 0, SEEK_END);
+  uint64_t size = FileIO::ftell64(f);
+
+  FileIO::fclose(f);
+
+  uint64_t timestamp = FileIO::GetModifiedTimestamp(filename);
+
+  uint64_t hash = hash64(&block[0], read);
+  hash = hash64(&size, sizeof(size), hash);
+  hash = hash64(&timestamp, sizeof(timestamp), hash);
+
+  return hash;
+}
+
+static void PruneReplayPipelineCaches(const string &current)
+{
+  string folder = dirname(current);
+
+  struct CacheFile
+  {
+    bool operator<(const CacheFile &o) const { return timestamp < o.timestamp; }
+    string path;
+    uint64_t timestamp;
+    uint64_t size;
+  };
+
+  vector<CacheFile> caches;
+  uint64_t total = 0;
+
+  vector<FileIO::FoundFile> files = FileIO::GetFilesInDirectory(folder.c_str());
+
+  for(size_t i = 0; i < files.size(); i++)
+  {
+    const string &name = files[i].filename;
+
+    if(files[i].flags & (FileIO::eFileProp_Directory | FileIO::eFileProp_ErrorUnknown |
+                         FileIO::eFileProp_ErrorAccessDenied | FileIO::eFileProp_ErrorInvalidPath))
+      continue;
+
+    if(name.find("vkpipelines_") != 0 || name.find(".cache") != name.size() - 6)
+      continue;
+
+    CacheFile cache;
+    cache.path = folder + "/" + name;
+    cache.timestamp = FileIO::GetModifiedTimestamp(cache.path);
+    cache.size = 0;
+
+    FILE *f = FileIO::fopen(cache.path.c_str(), "rb");
+    if(f)
+    {
+      FileIO::fseek64(f, 0, SEEK_END);
+      cache.size = FileIO::ftell64(f);
+      FileIO::fclose(f);
+    }
+
+    total += cache.size;
+    caches.push_back(cache);
+  }
+
+  if(total <= ReplayPipelineCacheBudget)
+    return;
+
+  // caches are rewritten every time they're used, so the modified time is when it was last used
+  std::sort(caches.begin(), caches.end());
+
+  for(size_t i = 0; i < caches.size() && total > ReplayPipelineCacheBudget; i++)
+  {
+    if(caches[i].path == current)
+      continue;
+
+    RDCDEBUG("Removing least recently used pipeline cache %s", caches[i].path.c_str());
+
+    FileIO::Delete(caches[i].path.c_str());
+    total -= caches[i].size;
+  }
+}
+
+string WrappedVulkan::GetReplayPipelineCacheFilename()
+{
+  // proxied replays have no capture to key on
+  if(m_CaptureHash == 0)
+    return "";
+
+  const VkPhysicalDeviceProperties &props = m_PhysicalDeviceData.props;
+
+  uint64_t key = m_CaptureHash;
+  key = hash64(&props.vendorID, sizeof(props.vendorID), key);
+  key = hash64(&props.deviceID, sizeof(props.deviceID), key);
+  key = hash64(&props.driverVersion, sizeof(props.driverVersion), key);
+  key = hash64(props.pipelineCacheUUID, sizeof(props.pipelineCacheUUID), key);
+
+  return FileIO::GetAppFolderFilename(StringFormat::Fmt("vkpipelines_%016llx.cache", key));
+}
+
+void WrappedVulkan::CreateReplayPipelineCache()
+{
+  const VkPhysicalDeviceProperties &props = m_PhysicalDeviceData.props;
+
+  vector<byte> initialData;
+
+  string filename = GetReplayPipelineCacheFilename();
+
+  FILE *f = filename.empty() ? NULL : FileIO::fopen(filename.c_str(), "rb");
+
+  if(f)
+  {
+    FileIO::fseek64(f, 0, SEEK_END);
+    uint64_t len = FileIO::ftell64(f);
+    FileIO::fseek64(f, 0, SEEK_SET);
+
+    ReplayPipelineCacheHeader header;
+    RDCEraseEl(header);
+
+    if(len >= sizeof(header))
+      FileIO::fread(&header, 1, sizeof(header), f);
+
+    if(header.magic != ReplayPipelineCacheMagic || header.version != ReplayPipelineCacheVersion ||
+       header.captureHash != m_CaptureHash || header.vendorID != props.vendorID ||
+       header.deviceID != props.deviceID || header.driverVersion != props.driverVersion ||
+       memcmp(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE) != 0 ||
+       header.dataSize != len - sizeof(header))
+    {
+      RDCDEBUG("Ignoring out of date or invalid pipeline cache %s", filename.c_str());
+    }
+    else
+    {
+      initialData.resize((size_t)header.dataSize);
+      if(!initialData.empty())
+        FileIO::fread(&initialData[0], 1, initialData.size(), f);
+    }
+
+    FileIO::fclose(f);
+  }
+
+  VkPipelineCacheCreateInfo info = {
+      VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO, NULL, 0, initialData.size(),
+      initialData.empty() ? NULL : &initialData[0],
+  };
+
+  VkResult vkr =
+      ObjDisp(m_Device)->CreatePipelineCache(Unwrap(m_Device), &info, NULL, &m_ReplayPipelineCache);
+
+  // the driver is allowed to reject data it doesn't like, in which case start from empty
+  if(vkr != VK_SUCCESS && !initialData.empty())
+  {
+    RDCWARN("Couldn't create pipeline cache from %s, VkResult: 0x%08x", filename.c_str(), vkr);
+
+    info.initialDataSize = 0;
+    info.pInitialData = NULL;
+
+    vkr = ObjDisp(m_Device)->CreatePipelineCache(Unwrap(m_Device), &info, NULL,
+                                                 &m_ReplayPipelineCache);
+  }
+
+  if(vkr != VK_SUCCESS)
+  {
+    RDCERR("Couldn't create replay pipeline cache, VkResult: 0x%08x", vkr);
+    m_ReplayPipelineCache = VK_NULL_HANDLE;
+    return;
+  }
+
+  if(!initialData.empty())
+    RDCLOG("Loaded %llu bytes of pipeline cache data", (uint64_t)initialData.size());
+
+  GetResourceManager()->WrapResource(Unwrap(m_Device), m_ReplayPipelineCache);
+}
+
+void WrappedVulkan::DestroyReplayPipelineCache()
+{
+  if(m_ReplayPipelineCache == VK_NULL_HANDLE)
+    return;
+
+  string filename = GetReplayPipelineCacheFilename();
+
+  size_t size = 0;
+  VkResult vkr = ObjDisp(m_Device)->GetPipelineCacheData(
+      Unwrap(m_Device), Unwrap(m_ReplayPipelineCache), &size, NULL);
+
+  if(!filename.empty() && vkr == VK_SUCCESS && size > 0)
+  {
+    vector<byte> data(size);
+    vkr = ObjDisp(m_Device)->GetPipelineCacheData(Unwrap(m_Device), Unwrap(m_ReplayPipelineCache),
+                                                  &size, &data[0]);
+
+    FILE *f = vkr == VK_SUCCESS ? FileIO::fopen(filename.c_str(), "wb") : NULL;
+
+    if(f)
+    {
+      const VkPhysicalDeviceProperties &props = m_PhysicalDeviceData.props;
+
+      ReplayPipelineCacheHeader header;
+      header.magic = ReplayPipelineCacheMagic;
+      header.version = ReplayPipelineCacheVersion;
+      header.captureHash = m_CaptureHash;
+      header.vendorID = props.vendorID;
+      header.deviceID = props.deviceID;
+      header.driverVersion = props.driverVersion;
+      memcpy(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE);
+      header.dataSize = size;
+
+      FileIO::fwrite(&header, 1, sizeof(header), f);
+      FileIO::fwrite(&data[0], 1, size, f);
+
+      FileIO::fclose(f);
+
+      RDCDEBUG("Wrote %llu bytes of pipeline cache data", (uint64_t)size);
+
+      PruneReplayPipelineCaches(filename);
+    }
+    else
+    {
+      RDCERR("Error writing pipeline cache %s", filename.c_str());
+    }
+  }
+
+  ObjDisp(m_Device)->DestroyPipelineCache(Unwrap(m_Device), Unwrap(m_ReplayPipelineCache), NULL);
+  GetResourceManager()->ReleaseWrappedResource(m_ReplayPipelineCache);
+  m_ReplayPipelineCache = VK_NULL_HANDLE;
+}
+
 ReplayCreateStatus WrappedVulkan::Initialise(VkInitParams &params)
 {
   if(m_pSerialiser->HasError())
@@ -96,6 +351,11 @@ ReplayCreateStatus WrappedVulkan::Initialise(VkInitParams &params)
 
   m_InitParams = params;
 
+  // identify the capture for the persistent pipeline cache, so that two different captures never
+  // share (and overwrite) the same cache.
+  if(!m_pSerialiser->GetFilename().empty())
+    m_CaptureHash = HashCaptureFile(m_pSerialiser->GetFilename());
+
   params.AppName = string("RenderDoc @ ") + params.AppName;
   params.EngineName = string("RenderDoc @ ") + params.EngineName;
 
@@ -422,6 +682,9 @@ void WrappedVulkan::Shutdown()
   // destroy debug manager and any objects it created
   SAFE_DELETE(m_DebugManager);
 
+  // save out the pipeline cache now all our pipelines have been created
+  DestroyReplayPipelineCache();
+
   if(ObjDisp(m_Instance)->DestroyDebugReportCallbackEXT && m_DbgMsgCallback != VK_NULL_HANDLE)
     ObjDisp(m_Instance)->DestroyDebugReportCallbackEXT(Unwrap(m_Instance), m_DbgMsgCallback, NULL);
 
@@ -1063,6 +1326,8 @@ bool WrappedVulkan::Serialise_vkCreateDevice(Serialiser *localSerialiser,
       }
     }
 
+    CreateReplayPipelineCache();
+
     m_DebugManager = new VulkanDebugManager(this, device);
 
     SAFE_DELETE_ARRAY(modQueues);
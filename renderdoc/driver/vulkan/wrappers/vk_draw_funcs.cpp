@@ -151,7 +151,7 @@ void WrappedVulkan::vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCoun
     Serialise_vkCmdDraw(localSerialiser, commandBuffer, vertexCount, instanceCount, firstVertex,
                         firstInstance);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -249,7 +249,7 @@ void WrappedVulkan::vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t ind
     Serialise_vkCmdDrawIndexed(localSerialiser, commandBuffer, indexCount, instanceCount,
                                firstIndex, vertexOffset, firstInstance);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -518,7 +518,7 @@ void WrappedVulkan::vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer bu
     SCOPED_SERIALISE_CONTEXT(DRAW_INDIRECT);
     Serialise_vkCmdDrawIndirect(localSerialiser, commandBuffer, buffer, offset, count, stride);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     record->MarkResourceFrameReferenced(GetResID(buffer), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(buffer)->baseResource, eFrameRef_Read);
@@ -813,7 +813,7 @@ void WrappedVulkan::vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBu
     SCOPED_SERIALISE_CONTEXT(DRAW_INDEXED_INDIRECT);
     Serialise_vkCmdDrawIndexedIndirect(localSerialiser, commandBuffer, buffer, offset, count, stride);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     record->MarkResourceFrameReferenced(GetResID(buffer), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(buffer)->baseResource, eFrameRef_Read);
@@ -896,7 +896,7 @@ void WrappedVulkan::vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uin
     SCOPED_SERIALISE_CONTEXT(DISPATCH);
     Serialise_vkCmdDispatch(localSerialiser, commandBuffer, x, y, z);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -994,7 +994,7 @@ void WrappedVulkan::vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffe
     SCOPED_SERIALISE_CONTEXT(DISPATCH_INDIRECT);
     Serialise_vkCmdDispatchIndirect(localSerialiser, commandBuffer, buffer, offset);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     record->MarkResourceFrameReferenced(GetResID(buffer), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(buffer)->baseResource, eFrameRef_Read);
@@ -1118,7 +1118,7 @@ void WrappedVulkan::vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcIma
     Serialise_vkCmdBlitImage(localSerialiser, commandBuffer, srcImage, srcImageLayout, destImage,
                              destImageLayout, regionCount, pRegions, filter);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     record->MarkResourceFrameReferenced(GetResID(srcImage), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(srcImage)->baseResource, eFrameRef_Read);
@@ -1245,7 +1245,7 @@ void WrappedVulkan::vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage src
     Serialise_vkCmdResolveImage(localSerialiser, commandBuffer, srcImage, srcImageLayout, destImage,
                                 destImageLayout, regionCount, pRegions);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     record->MarkResourceFrameReferenced(GetResID(srcImage), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(srcImage)->baseResource, eFrameRef_Read);
@@ -1372,7 +1372,7 @@ void WrappedVulkan::vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcIma
     Serialise_vkCmdCopyImage(localSerialiser, commandBuffer, srcImage, srcImageLayout, destImage,
                              destImageLayout, regionCount, pRegions);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(srcImage), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(srcImage)->baseResource, eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetResID(destImage), eFrameRef_Write);
@@ -1490,7 +1490,7 @@ void WrappedVulkan::vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuff
     Serialise_vkCmdCopyBufferToImage(localSerialiser, commandBuffer, srcBuffer, destImage,
                                      destImageLayout, regionCount, pRegions);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     record->MarkResourceFrameReferenced(GetResID(srcBuffer), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(srcBuffer)->baseResource, eFrameRef_Read);
@@ -1608,7 +1608,7 @@ void WrappedVulkan::vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImag
     Serialise_vkCmdCopyImageToBuffer(localSerialiser, commandBuffer, srcImage, srcImageLayout,
                                      destBuffer, regionCount, pRegions);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(srcImage), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(srcImage)->baseResource, eFrameRef_Read);
 
@@ -1734,7 +1734,7 @@ void WrappedVulkan::vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcB
     Serialise_vkCmdCopyBuffer(localSerialiser, commandBuffer, srcBuffer, destBuffer, regionCount,
                               pRegions);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(srcBuffer), eFrameRef_Read);
     record->MarkResourceFrameReferenced(GetRecord(srcBuffer)->baseResource, eFrameRef_Read);
 
@@ -1850,7 +1850,7 @@ void WrappedVulkan::vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage
     Serialise_vkCmdClearColorImage(localSerialiser, commandBuffer, image, imageLayout, pColor,
                                    rangeCount, pRanges);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(image), eFrameRef_Write);
     record->MarkResourceFrameReferenced(GetRecord(image)->baseResource, eFrameRef_Read);
     if(GetRecord(image)->sparseInfo)
@@ -1956,7 +1956,7 @@ void WrappedVulkan::vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, V
     Serialise_vkCmdClearDepthStencilImage(localSerialiser, commandBuffer, image, imageLayout,
                                           pDepthStencil, rangeCount, pRanges);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(image), eFrameRef_Write);
     record->MarkResourceFrameReferenced(GetRecord(image)->baseResource, eFrameRef_Read);
     if(GetRecord(image)->sparseInfo)
@@ -2084,7 +2084,7 @@ void WrappedVulkan::vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_
     Serialise_vkCmdClearAttachments(localSerialiser, commandBuffer, attachmentCount, pAttachments,
                                     rectCount, pRects);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
 
     // image/attachments are referenced when the render pass is started and the framebuffer is
     // bound.
@@ -80,7 +80,7 @@ void WrappedVulkan::vkCmdSetViewport(VkCommandBuffer cmdBuffer, uint32_t firstVi
     SCOPED_SERIALISE_CONTEXT(SET_VP);
     Serialise_vkCmdSetViewport(localSerialiser, cmdBuffer, firstViewport, viewportCount, pViewports);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -140,7 +140,7 @@ void WrappedVulkan::vkCmdSetScissor(VkCommandBuffer cmdBuffer, uint32_t firstSci
     SCOPED_SERIALISE_CONTEXT(SET_SCISSOR);
     Serialise_vkCmdSetScissor(localSerialiser, cmdBuffer, firstScissor, scissorCount, pScissors);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -189,7 +189,7 @@ void WrappedVulkan::vkCmdSetLineWidth(VkCommandBuffer cmdBuffer, float lineWidth
     SCOPED_SERIALISE_CONTEXT(SET_LINE_WIDTH);
     Serialise_vkCmdSetLineWidth(localSerialiser, cmdBuffer, lineWidth);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -246,7 +246,7 @@ void WrappedVulkan::vkCmdSetDepthBias(VkCommandBuffer cmdBuffer, float depthBias
     Serialise_vkCmdSetDepthBias(localSerialiser, cmdBuffer, depthBias, depthBiasClamp,
                                 slopeScaledDepthBias);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -305,7 +305,7 @@ void WrappedVulkan::vkCmdSetBlendConstants(VkCommandBuffer cmdBuffer, const floa
     SCOPED_SERIALISE_CONTEXT(SET_BLEND_CONST);
     Serialise_vkCmdSetBlendConstants(localSerialiser, cmdBuffer, blendConst);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -358,7 +358,7 @@ void WrappedVulkan::vkCmdSetDepthBounds(VkCommandBuffer cmdBuffer, float minDept
     SCOPED_SERIALISE_CONTEXT(SET_DEPTH_BOUNDS);
     Serialise_vkCmdSetDepthBounds(localSerialiser, cmdBuffer, minDepthBounds, maxDepthBounds);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -415,7 +415,7 @@ void WrappedVulkan::vkCmdSetStencilCompareMask(VkCommandBuffer cmdBuffer,
     SCOPED_SERIALISE_CONTEXT(SET_STENCIL_COMP_MASK);
     Serialise_vkCmdSetStencilCompareMask(localSerialiser, cmdBuffer, faceMask, compareMask);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -472,7 +472,7 @@ void WrappedVulkan::vkCmdSetStencilWriteMask(VkCommandBuffer cmdBuffer, VkStenci
     SCOPED_SERIALISE_CONTEXT(SET_STENCIL_WRITE_MASK);
     Serialise_vkCmdSetStencilWriteMask(localSerialiser, cmdBuffer, faceMask, writeMask);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
 
@@ -529,6 +529,6 @@ void WrappedVulkan::vkCmdSetStencilReference(VkCommandBuffer cmdBuffer, VkStenci
     SCOPED_SERIALISE_CONTEXT(SET_STENCIL_REF);
     Serialise_vkCmdSetStencilReference(localSerialiser, cmdBuffer, faceMask, reference);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
   }
 }
@@ -197,7 +197,8 @@ bool WrappedVulkan::Serialise_vkQueueSubmit(Serialiser *localSerialiser, VkQueue
     for(uint32_t i = 0; i < numCmds; i++)
     {
       ResourceId cmd = GetResourceManager()->GetLiveID(cmdIds[i]);
-      GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts);
+      GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
+                                          m_ImageLayoutsLock);
     }
 
     AddEvent(desc);
@@ -305,7 +306,7 @@ bool WrappedVulkan::Serialise_vkQueueSubmit(Serialiser *localSerialiser, VkQueue
         rerecordedCmds.push_back(Unwrap(cmd));
 
         GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[rerecord].imgbarriers,
-                                            m_ImageLayouts);
+                                            m_ImageLayouts, m_ImageLayoutsLock);
       }
 
       submitInfo.commandBufferCount = (uint32_t)rerecordedCmds.size();
@@ -374,7 +375,8 @@ bool WrappedVulkan::Serialise_vkQueueSubmit(Serialiser *localSerialiser, VkQueue
       for(uint32_t i = 0; i < trimmedCmdIds.size(); i++)
       {
         ResourceId cmd = trimmedCmdIds[i];
-        GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts);
+        GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
+                                            m_ImageLayoutsLock);
       }
     }
     else
@@ -390,7 +392,8 @@ bool WrappedVulkan::Serialise_vkQueueSubmit(Serialiser *localSerialiser, VkQueue
       for(uint32_t i = 0; i < numCmds; i++)
       {
         ResourceId cmd = GetResourceManager()->GetLiveID(cmdIds[i]);
-        GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts);
+        GetResourceManager()->ApplyBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
+                                            m_ImageLayoutsLock);
       }
     }
   }
@@ -584,11 +587,8 @@ VkResult WrappedVulkan::vkQueueSubmit(VkQueue queue, uint32_t submitCount,
 
       VkResourceRecord *record = GetRecord(pSubmits[s].pCommandBuffers[i]);
 
-      {
-        SCOPED_LOCK(m_ImageLayoutsLock);
-        GetResourceManager()->ApplyBarriers(record->bakedCommands->cmdInfo->imgbarriers,
-                                            m_ImageLayouts);
-      }
+      GetResourceManager()->ApplyBarriers(record->bakedCommands->cmdInfo->imgbarriers,
+                                          m_ImageLayouts, m_ImageLayoutsLock);
 
       // need to lock the whole section of code, not just the check on
       // m_State, as we also need to make sure we don't check the state,
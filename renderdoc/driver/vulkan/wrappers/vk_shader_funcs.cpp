@@ -311,9 +311,8 @@ bool WrappedVulkan::Serialise_vkCreateGraphicsPipelines(
     VkPipeline pipe = VK_NULL_HANDLE;
 
     device = GetResourceManager()->GetLiveHandle<VkDevice>(devId);
-    // don't use pipeline caches on replay
-    pipelineCache =
-        VK_NULL_HANDLE;    // GetResourceManager()->GetLiveHandle<VkPipelineCache>(cacheId);
+    // don't use the application's pipeline caches on replay, use our own persistent cache
+    pipelineCache = GetReplayPipelineCache();
 
     VkResult ret = ObjDisp(device)->CreateGraphicsPipelines(Unwrap(device), Unwrap(pipelineCache),
                                                             1, &info, NULL, &pipe);
@@ -467,7 +466,8 @@ bool WrappedVulkan::Serialise_vkCreateComputePipelines(Serialiser *localSerialis
     VkPipeline pipe = VK_NULL_HANDLE;
 
     device = GetResourceManager()->GetLiveHandle<VkDevice>(devId);
-    pipelineCache = GetResourceManager()->GetLiveHandle<VkPipelineCache>(cacheId);
+    // don't use the application's pipeline caches on replay, use our own persistent cache
+    pipelineCache = GetReplayPipelineCache();
 
     VkResult ret = ObjDisp(device)->CreateComputePipelines(Unwrap(device), Unwrap(pipelineCache), 1,
                                                            &info, NULL, &pipe);
@@ -596,7 +596,7 @@ void WrappedVulkan::vkCmdSetEvent(VkCommandBuffer cmdBuffer, VkEvent event,
     SCOPED_SERIALISE_CONTEXT(CMD_SET_EVENT);
     Serialise_vkCmdSetEvent(localSerialiser, cmdBuffer, event, stageMask);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(event), eFrameRef_Read);
   }
 }
@@ -652,7 +652,7 @@ void WrappedVulkan::vkCmdResetEvent(VkCommandBuffer cmdBuffer, VkEvent event,
     SCOPED_SERIALISE_CONTEXT(CMD_RESET_EVENT);
     Serialise_vkCmdResetEvent(localSerialiser, cmdBuffer, event, stageMask);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     record->MarkResourceFrameReferenced(GetResID(event), eFrameRef_Read);
   }
 }
@@ -736,7 +736,8 @@ bool WrappedVulkan::Serialise_vkCmdWaitEvents(
 
       ResourceId cmd = GetResID(RerecordCmdBuf(cmdid));
       GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                           (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                           m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                           &imgBarriers[0]);
     }
   }
   else if(m_State == READING)
@@ -764,7 +765,8 @@ bool WrappedVulkan::Serialise_vkCmdWaitEvents(
 
     ResourceId cmd = GetResID(cmdBuffer);
     GetResourceManager()->RecordBarriers(m_BakedCmdBufferInfo[cmd].imgbarriers, m_ImageLayouts,
-                                         (uint32_t)imgBarriers.size(), &imgBarriers[0]);
+                                         m_ImageLayoutsLock, (uint32_t)imgBarriers.size(),
+                                         &imgBarriers[0]);
   }
 
   SAFE_DELETE_ARRAY(memBarriers);
@@ -823,13 +825,11 @@ void WrappedVulkan::vkCmdWaitEvents(VkCommandBuffer cmdBuffer, uint32_t eventCou
                               imageMemoryBarrierCount, pImageMemoryBarriers);
 
     if(imageMemoryBarrierCount > 0)
-    {
-      SCOPED_LOCK(m_ImageLayoutsLock);
-      GetResourceManager()->RecordBarriers(GetRecord(cmdBuffer)->cmdInfo->imgbarriers, m_ImageLayouts,
-                                           imageMemoryBarrierCount, pImageMemoryBarriers);
-    }
+    GetResourceManager()->RecordBarriers(GetRecord(cmdBuffer)->cmdInfo->imgbarriers, m_ImageLayouts,
+                                         m_ImageLayoutsLock, imageMemoryBarrierCount,
+                                         pImageMemoryBarriers);
 
-    record->AddChunk(scope.Get());
+    scope.Append(&record->cmdInfo->commands);
     for(uint32_t i = 0; i < eventCount; i++)
       record->MarkResourceFrameReferenced(GetResID(pEvents[i]), eFrameRef_Read);
   }
@@ -283,6 +283,7 @@ bool WrappedVulkan::Serialise_vkCreateSwapchainKHR(Serialiser *localSerialiser,
 
       m_ImageLayouts[liveId].extent = iminfo.extent;
       m_ImageLayouts[liveId].format = iminfo.format;
+      m_ImageLayouts[liveId].layerCount = (int)info.imageArrayLayers;
 
       m_ImageLayouts[liveId].subresourceStates.clear();
       m_ImageLayouts[liveId].subresourceStates.push_back(
@@ -417,6 +418,7 @@ void WrappedVulkan::WrapAndProcessCreatedSwapchain(VkDevice device,
         // fill out image info so we track resource state barriers
         {
           SCOPED_LOCK(m_ImageLayoutsLock);
+          m_ImageLayouts[imid].layerCount = (int)pCreateInfo->imageArrayLayers;
           m_ImageLayouts[imid].subresourceStates.clear();
           m_ImageLayouts[imid].subresourceStates.push_back(
               ImageRegionState(range, UNKNOWN_PREV_IMG_LAYOUT, VK_IMAGE_LAYOUT_UNDEFINED));
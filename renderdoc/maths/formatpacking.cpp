@@ -0,0 +1,700 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "formatpacking.h"
+#include <algorithm>
+#include <string.h>
+#include "api/replay/renderdoc_replay.h"
+#include "common/common.h"
+
+// the SSE paths only need SSE2, which every x86-64 CPU (and every x86 CPU we support) has. F16C is
+// checked for at runtime.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FORMAT_DECODE_SSE OPTION_ON
+#else
+#define FORMAT_DECODE_SSE OPTION_OFF
+#endif
+
+#if ENABLED(FORMAT_DECODE_SSE)
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define F16C_TARGET
+#else
+#include <cpuid.h>
+#define F16C_TARGET __attribute__((target("f16c")))
+#endif
+
+#endif
+
+float ConvertComponent(ResourceFormat fmt, byte *data)
+{
+  if(fmt.compByteWidth == 4)
+  {
+    uint32_t *u32 = (uint32_t *)data;
+    int32_t *i32 = (int32_t *)data;
+
+    if(fmt.compType == eCompType_Float)
+    {
+      return *(float *)u32;
+    }
+    else if(fmt.compType == eCompType_UInt || fmt.compType == eCompType_UScaled)
+    {
+      return float(*u32);
+    }
+    else if(fmt.compType == eCompType_SInt || fmt.compType == eCompType_SScaled)
+    {
+      return float(*i32);
+    }
+  }
+  else if(fmt.compByteWidth == 2)
+  {
+    uint16_t *u16 = (uint16_t *)data;
+    int16_t *i16 = (int16_t *)data;
+
+    if(fmt.compType == eCompType_Float)
+    {
+      return ConvertFromHalf(*u16);
+    }
+    else if(fmt.compType == eCompType_UInt || fmt.compType == eCompType_UScaled)
+    {
+      return float(*u16);
+    }
+    else if(fmt.compType == eCompType_SInt || fmt.compType == eCompType_SScaled)
+    {
+      return float(*i16);
+    }
+    else if(fmt.compType == eCompType_UNorm)
+    {
+      return float(*u16) / 65535.0f;
+    }
+    else if(fmt.compType == eCompType_SNorm)
+    {
+      float f = -1.0f;
+
+      if(*i16 == -32768)
+        f = -1.0f;
+      else
+        f = ((float)*i16) / 32767.0f;
+
+      return f;
+    }
+  }
+  else if(fmt.compByteWidth == 1)
+  {
+    uint8_t *u8 = (uint8_t *)data;
+    int8_t *i8 = (int8_t *)data;
+
+    if(fmt.compType == eCompType_UInt || fmt.compType == eCompType_UScaled)
+    {
+      return float(*u8);
+    }
+    else if(fmt.compType == eCompType_SInt || fmt.compType == eCompType_SScaled)
+    {
+      return float(*i8);
+    }
+    else if(fmt.compType == eCompType_UNorm)
+    {
+      if(fmt.srgbCorrected)
+        return SRGB8_lookuptable[*u8];
+      else
+        return float(*u8) / 255.0f;
+    }
+    else if(fmt.compType == eCompType_SNorm)
+    {
+      float f = -1.0f;
+
+      if(*i8 == -128)
+        f = -1.0f;
+      else
+        f = ((float)*i8) / 127.0f;
+
+      return f;
+    }
+  }
+
+  RDCERR("Unexpected format to convert from");
+
+  return 0.0f;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Batch decoding
+//
+// Each supported component type/count combination gets its own loop, instantiated from the
+// templates below, so the per-element work is a fixed-size load and conversion with no branching
+// on the format. Where SSE2 is available the integer and normalised types convert all components
+// of an element at once, and halves use F16C if the CPU supports it. Results are bit-identical to
+// ConvertComponent.
+
+enum DecodeType
+{
+  eDecode_Float,
+  eDecode_Half,
+  eDecode_UInt32,
+  eDecode_SInt32,
+  eDecode_UInt16,
+  eDecode_SInt16,
+  eDecode_UNorm16,
+  eDecode_SNorm16,
+  eDecode_UInt8,
+  eDecode_SInt8,
+  eDecode_UNorm8,
+  eDecode_SNorm8,
+  eDecode_SRGB8,
+};
+
+typedef void (*DecodeFunction)(const byte *src, size_t stride, size_t count, FloatVector *out);
+
+template <DecodeType type>
+struct DecodeTraits;
+
+template <>
+struct DecodeTraits<eDecode_Float>
+{
+  typedef float CompType;
+  static float Convert(float comp) { return comp; }
+};
+
+template <>
+struct DecodeTraits<eDecode_Half>
+{
+  typedef uint16_t CompType;
+  static float Convert(uint16_t comp) { return ConvertFromHalf(comp); }
+};
+
+template <>
+struct DecodeTraits<eDecode_UInt32>
+{
+  typedef uint32_t CompType;
+  static float Convert(uint32_t comp) { return float(comp); }
+};
+
+template <>
+struct DecodeTraits<eDecode_SInt32>
+{
+  typedef int32_t CompType;
+  static float Convert(int32_t comp) { return float(comp); }
+};
+
+template <>
+struct DecodeTraits<eDecode_UInt16>
+{
+  typedef uint16_t CompType;
+  static float Convert(uint16_t comp) { return float(comp); }
+};
+
+template <>
+struct DecodeTraits<eDecode_SInt16>
+{
+  typedef int16_t CompType;
+  static float Convert(int16_t comp) { return float(comp); }
+};
+
+template <>
+struct DecodeTraits<eDecode_UNorm16>
+{
+  typedef uint16_t CompType;
+  static float Convert(uint16_t comp) { return float(comp) / 65535.0f; }
+};
+
+template <>
+struct DecodeTraits<eDecode_SNorm16>
+{
+  typedef int16_t CompType;
+  // -32768 and -32767 both map to -1.0
+  static float Convert(int16_t comp) { return RDCMAX(float(comp) / 32767.0f, -1.0f); }
+};
+
+template <>
+struct DecodeTraits<eDecode_UInt8>
+{
+  typedef uint8_t CompType;
+  static float Convert(uint8_t comp) { return float(comp); }
+};
+
+template <>
+struct DecodeTraits<eDecode_SInt8>
+{
+  typedef int8_t CompType;
+  static float Convert(int8_t comp) { return float(comp); }
+};
+
+template <>
+struct DecodeTraits<eDecode_UNorm8>
+{
+  typedef uint8_t CompType;
+  static float Convert(uint8_t comp) { return float(comp) / 255.0f; }
+};
+
+template <>
+struct DecodeTraits<eDecode_SNorm8>
+{
+  typedef int8_t CompType;
+  // -128 and -127 both map to -1.0
+  static float Convert(int8_t comp) { return RDCMAX(float(comp) / 127.0f, -1.0f); }
+};
+
+template <>
+struct DecodeTraits<eDecode_SRGB8>
+{
+  typedef uint8_t CompType;
+  static float Convert(uint8_t comp) { return SRGB8_lookuptable[comp]; }
+};
+
+template <DecodeType type, uint32_t comps>
+static void DecodeScalar(const byte *src, size_t stride, size_t count, FloatVector *out)
+{
+  typedef DecodeTraits<type> Traits;
+  typedef typename Traits::CompType CompType;
+
+  for(size_t i = 0; i < count; i++, src += stride)
+  {
+    CompType in[comps];
+    memcpy(in, src, sizeof(in));
+
+    float *o = &out[i].x;
+
+    for(uint32_t c = 0; c < comps; c++)
+      o[c] = Traits::Convert(in[c]);
+
+    for(uint32_t c = comps; c < 4; c++)
+      o[c] = (c == 3) ? 1.0f : 0.0f;
+  }
+}
+
+#if ENABLED(FORMAT_DECODE_SSE)
+
+// converts all the components of an element at once, from a register with the raw components
+// packed at the bottom. Types without a specialisation here (halves, which need F16C, 32-bit uints
+// since SSE2 only has a signed conversion, and sRGB) fall back to the scalar loop.
+template <DecodeType type>
+struct SSEConvert
+{
+  enum
+  {
+    Supported = 0
+  };
+  static __m128 Convert(__m128i v) { return _mm_setzero_ps(); }
+};
+
+#define SSE_CONVERT(type)                            \
+  template <>                                        \
+  struct SSEConvert<type>                            \
+  {                                                  \
+    enum                                             \
+    {                                                \
+      Supported = 1                                  \
+    };                                               \
+    static __m128 Convert(__m128i v);                \
+  };                                                 \
+  inline __m128 SSEConvert<type>::Convert(__m128i v)
+
+SSE_CONVERT(eDecode_Float)
+{
+  return _mm_castsi128_ps(v);
+}
+
+SSE_CONVERT(eDecode_SInt32)
+{
+  return _mm_cvtepi32_ps(v);
+}
+
+SSE_CONVERT(eDecode_UInt16)
+{
+  return _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, _mm_setzero_si128()));
+}
+
+SSE_CONVERT(eDecode_SInt16)
+{
+  // sign extend by unpacking into the top half and shifting down
+  return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+}
+
+SSE_CONVERT(eDecode_UNorm16)
+{
+  return _mm_div_ps(SSEConvert<eDecode_UInt16>::Convert(v), _mm_set1_ps(65535.0f));
+}
+
+SSE_CONVERT(eDecode_SNorm16)
+{
+  __m128 f = _mm_div_ps(SSEConvert<eDecode_SInt16>::Convert(v), _mm_set1_ps(32767.0f));
+  return _mm_max_ps(f, _mm_set1_ps(-1.0f));
+}
+
+SSE_CONVERT(eDecode_UInt8)
+{
+  v = _mm_unpacklo_epi8(v, _mm_setzero_si128());
+  return _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, _mm_setzero_si128()));
+}
+
+SSE_CONVERT(eDecode_SInt8)
+{
+  v = _mm_unpacklo_epi8(v, v);
+  return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 24));
+}
+
+SSE_CONVERT(eDecode_UNorm8)
+{
+  return _mm_div_ps(SSEConvert<eDecode_UInt8>::Convert(v), _mm_set1_ps(255.0f));
+}
+
+SSE_CONVERT(eDecode_SNorm8)
+{
+  __m128 f = _mm_div_ps(SSEConvert<eDecode_SInt8>::Convert(v), _mm_set1_ps(127.0f));
+  return _mm_max_ps(f, _mm_set1_ps(-1.0f));
+}
+
+#undef SSE_CONVERT
+
+// loads one element's components into the bottom of a register, with the rest zeroed. Each size
+// is loaded exactly with plain integer loads - going through a partially written temporary would
+// stall on store forwarding.
+template <typename T>
+static T ReadUnaligned(const byte *src)
+{
+  T ret;
+  memcpy(&ret, src, sizeof(T));
+  return ret;
+}
+
+template <size_t bytes>
+static __m128i LoadElement(const byte *src);
+
+template <>
+inline __m128i LoadElement<1>(const byte *src)
+{
+  return _mm_cvtsi32_si128(src[0]);
+}
+
+template <>
+inline __m128i LoadElement<2>(const byte *src)
+{
+  return _mm_cvtsi32_si128(ReadUnaligned<uint16_t>(src));
+}
+
+template <>
+inline __m128i LoadElement<3>(const byte *src)
+{
+  return _mm_cvtsi32_si128(ReadUnaligned<uint16_t>(src) | (uint32_t(src[2]) << 16));
+}
+
+template <>
+inline __m128i LoadElement<4>(const byte *src)
+{
+  return _mm_cvtsi32_si128(ReadUnaligned<uint32_t>(src));
+}
+
+template <>
+inline __m128i LoadElement<6>(const byte *src)
+{
+  return _mm_unpacklo_epi32(_mm_cvtsi32_si128(ReadUnaligned<uint32_t>(src)),
+                            _mm_cvtsi32_si128(ReadUnaligned<uint16_t>(src + 4)));
+}
+
+template <>
+inline __m128i LoadElement<8>(const byte *src)
+{
+  return _mm_loadl_epi64((const __m128i *)src);
+}
+
+template <>
+inline __m128i LoadElement<12>(const byte *src)
+{
+  return _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)src),
+                            _mm_cvtsi32_si128(ReadUnaligned<uint32_t>(src + 8)));
+}
+
+template <>
+inline __m128i LoadElement<16>(const byte *src)
+{
+  return _mm_loadu_si128((const __m128i *)src);
+}
+
+// components the element doesn't have come out of the conversion as 0.0, which is what we want for
+// y and z. w needs to be 1.0, which we can OR in since 0.0 is all-zero bits.
+template <uint32_t comps>
+static __m128 DefaultW()
+{
+  return _mm_setr_ps(0.0f, 0.0f, 0.0f, comps < 4 ? 1.0f : 0.0f);
+}
+
+template <DecodeType type, uint32_t comps>
+static void DecodeSSE(const byte *src, size_t stride, size_t count, FloatVector *out)
+{
+  typedef typename DecodeTraits<type>::CompType CompType;
+
+  const __m128 w = DefaultW<comps>();
+
+  for(size_t i = 0; i < count; i++, src += stride)
+  {
+    __m128i v = LoadElement<sizeof(CompType) * comps>(src);
+    _mm_storeu_ps(&out[i].x, _mm_or_ps(SSEConvert<type>::Convert(v), w));
+  }
+}
+
+template <uint32_t comps>
+F16C_TARGET static void DecodeHalfF16C(const byte *src, size_t stride, size_t count,
+                                       FloatVector *out)
+{
+  const __m128 w = DefaultW<comps>();
+
+  for(size_t i = 0; i < count; i++, src += stride)
+  {
+    __m128i v = LoadElement<sizeof(uint16_t) * comps>(src);
+    _mm_storeu_ps(&out[i].x, _mm_or_ps(_mm_cvtph_ps(v), w));
+  }
+}
+
+static bool CPUHasF16C()
+{
+  // F16C needs the OS to have enabled AVX state, same as AVX itself
+  const uint32_t osxsaveBit = 1U << 27;
+  const uint32_t avxBit = 1U << 28;
+  const uint32_t f16cBit = 1U << 29;
+  const uint32_t required = osxsaveBit | avxBit | f16cBit;
+
+  uint32_t ecx = 0;
+  uint64_t xcr0 = 0;
+
+#if defined(_MSC_VER)
+  int info[4] = {};
+  __cpuid(info, 1);
+  ecx = (uint32_t)info[2];
+
+  if((ecx & required) != required)
+    return false;
+
+  xcr0 = _xgetbv(0);
+#else
+  uint32_t eax = 0, ebx = 0, edx = 0;
+  if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    return false;
+
+  if((ecx & required) != required)
+    return false;
+
+  uint32_t xcr0lo = 0, xcr0hi = 0;
+  __asm__ __volatile__("xgetbv" : "=a"(xcr0lo), "=d"(xcr0hi) : "c"(0));
+  xcr0 = (uint64_t(xcr0hi) << 32) | xcr0lo;
+#endif
+
+  // XMM and YMM state
+  return (xcr0 & 0x6) == 0x6;
+}
+
+#endif    // ENABLED(FORMAT_DECODE_SSE)
+
+template <DecodeType type, uint32_t comps>
+static DecodeFunction GetDecodeFunction()
+{
+#if ENABLED(FORMAT_DECODE_SSE)
+  if(SSEConvert<type>::Supported)
+    return &DecodeSSE<type, comps>;
+
+  if(type == eDecode_Half)
+  {
+    static const bool f16c = CPUHasF16C();
+    if(f16c)
+      return &DecodeHalfF16C<comps>;
+  }
+#endif
+
+  return &DecodeScalar<type, comps>;
+}
+
+template <DecodeType type>
+static DecodeFunction GetDecodeFunction(uint32_t compCount)
+{
+  switch(compCount)
+  {
+    case 1: return GetDecodeFunction<type, 1>();
+    case 2: return GetDecodeFunction<type, 2>();
+    case 3: return GetDecodeFunction<type, 3>();
+    case 4: return GetDecodeFunction<type, 4>();
+    default: break;
+  }
+
+  return NULL;
+}
+
+// mirrors the format handling in ConvertComponent, returns NULL for anything it doesn't support
+static DecodeFunction GetDecodeFunction(const ResourceFormat &fmt)
+{
+  const FormatComponentType compType = fmt.compType;
+  const bool isUInt = (compType == eCompType_UInt || compType == eCompType_UScaled);
+  const bool isSInt = (compType == eCompType_SInt || compType == eCompType_SScaled);
+
+  if(fmt.compByteWidth == 4)
+  {
+    if(compType == eCompType_Float)
+      return GetDecodeFunction<eDecode_Float>(fmt.compCount);
+    else if(isUInt)
+      return GetDecodeFunction<eDecode_UInt32>(fmt.compCount);
+    else if(isSInt)
+      return GetDecodeFunction<eDecode_SInt32>(fmt.compCount);
+  }
+  else if(fmt.compByteWidth == 2)
+  {
+    if(compType == eCompType_Float)
+      return GetDecodeFunction<eDecode_Half>(fmt.compCount);
+    else if(isUInt)
+      return GetDecodeFunction<eDecode_UInt16>(fmt.compCount);
+    else if(isSInt)
+      return GetDecodeFunction<eDecode_SInt16>(fmt.compCount);
+    else if(compType == eCompType_UNorm)
+      return GetDecodeFunction<eDecode_UNorm16>(fmt.compCount);
+    else if(compType == eCompType_SNorm)
+      return GetDecodeFunction<eDecode_SNorm16>(fmt.compCount);
+  }
+  else if(fmt.compByteWidth == 1)
+  {
+    if(isUInt)
+      return GetDecodeFunction<eDecode_UInt8>(fmt.compCount);
+    else if(isSInt)
+      return GetDecodeFunction<eDecode_SInt8>(fmt.compCount);
+    else if(compType == eCompType_UNorm && fmt.srgbCorrected)
+      return GetDecodeFunction<eDecode_SRGB8>(fmt.compCount);
+    else if(compType == eCompType_UNorm)
+      return GetDecodeFunction<eDecode_UNorm8>(fmt.compCount);
+    else if(compType == eCompType_SNorm)
+      return GetDecodeFunction<eDecode_SNorm8>(fmt.compCount);
+  }
+
+  return NULL;
+}
+
+size_t DecodeFormattedComponents(const ResourceFormat &fmt, const byte *data, const byte *end,
+                                 size_t stride, size_t count, FloatVector *out)
+{
+  if(count == 0)
+    return 0;
+
+  size_t elemSize = fmt.compCount * fmt.compByteWidth;
+
+  const SpecialFormat special = fmt.specialFormat;
+
+  if(special == eSpecial_R10G10B10A2 || special == eSpecial_R11G11B10)
+  {
+    elemSize = sizeof(uint32_t);
+  }
+  else if(special != eSpecial_Unknown)
+  {
+    RDCERR("Unsupported special format %u for decoding", special);
+
+    for(size_t i = 0; i < count; i++)
+      out[i] = FloatVector(0.0f, 0.0f, 0.0f, 1.0f);
+
+    return 0;
+  }
+
+  // elements are at increasing addresses, so the in-bounds ones are a prefix
+  size_t numValid = 0;
+  if(data <= end && size_t(end - data) >= elemSize)
+  {
+    if(stride == 0)
+      numValid = count;
+    else
+      numValid = RDCMIN(count, (size_t(end - data) - elemSize) / stride + 1);
+  }
+
+  const byte *src = data;
+
+  if(special == eSpecial_R10G10B10A2)
+  {
+    for(size_t i = 0; i < numValid; i++, src += stride)
+    {
+      uint32_t packed;
+      memcpy(&packed, src, sizeof(packed));
+
+      Vec4f v = ConvertFromR10G10B10A2(packed);
+      out[i] = FloatVector(v.x, v.y, v.z, v.w);
+    }
+  }
+  else if(special == eSpecial_R11G11B10)
+  {
+    for(size_t i = 0; i < numValid; i++, src += stride)
+    {
+      uint32_t packed;
+      memcpy(&packed, src, sizeof(packed));
+
+      Vec3f v = ConvertFromR11G11B10(packed);
+      out[i] = FloatVector(v.x, v.y, v.z, 1.0f);
+    }
+  }
+  else
+  {
+    DecodeFunction decode = GetDecodeFunction(fmt);
+
+    if(decode)
+    {
+      decode(data, stride, numValid, out);
+    }
+    else
+    {
+      // let ConvertComponent report the unsupported format
+      for(size_t i = 0; i < numValid; i++, src += stride)
+      {
+        float *o = &out[i].x;
+        for(uint32_t c = 0; c < 4; c++)
+        {
+          if(c < fmt.compCount)
+            o[c] = ConvertComponent(fmt, (byte *)src + c * fmt.compByteWidth);
+          else
+            o[c] = (c == 3) ? 1.0f : 0.0f;
+        }
+      }
+    }
+  }
+
+  if(fmt.bgraOrder)
+  {
+    for(size_t i = 0; i < numValid; i++)
+      std::swap(out[i].x, out[i].z);
+  }
+
+  for(size_t i = numValid; i < count; i++)
+    out[i] = FloatVector(0.0f, 0.0f, 0.0f, 1.0f);
+
+  return numValid;
+}
+
+size_t DecodeFormattedComponents(const MeshFormat &fmt, const byte *data, const byte *end,
+                                 size_t count, FloatVector *out)
+{
+  ResourceFormat resFmt;
+  resFmt.special = (fmt.specialFormat != eSpecial_Unknown);
+  resFmt.specialFormat = fmt.specialFormat;
+  resFmt.compByteWidth = fmt.compByteWidth;
+  resFmt.compCount = fmt.compCount;
+  resFmt.compType = fmt.compType;
+  resFmt.bgraOrder = fmt.bgraOrder;
+
+  return DecodeFormattedComponents(resFmt, data, end, fmt.stride, count, out);
+}
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <stdint.h>
+#include "common/common.h"
 #include "vec.h"
 
 inline Vec4f ConvertFromR10G10B10A2(uint32_t data)
@@ -137,6 +138,18 @@ inline float ConvertFromSRGB8(uint8_t comp)
 }
 
 struct ResourceFormat;
+struct MeshFormat;
+struct FloatVector;
 float ConvertComponent(ResourceFormat fmt, byte *data);
 
+// decodes count elements of fmt to float4s. Element i is read from data + i * stride, components
+// the format doesn't have are filled from (0, 0, 0, 1) and bgraOrder is applied. Elements that
+// would read past end are also set to (0, 0, 0, 1). Returns how many elements were in bounds.
+size_t DecodeFormattedComponents(const ResourceFormat &fmt, const byte *data, const byte *end,
+                                 size_t stride, size_t count, FloatVector *out);
+
+// as above, for the element described by a mesh format, using its stride.
+size_t DecodeFormattedComponents(const MeshFormat &fmt, const byte *data, const byte *end,
+                                 size_t count, FloatVector *out);
+
 #include "half_convert.h"
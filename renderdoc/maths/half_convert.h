@@ -126,7 +126,8 @@ inline float ConvertFromHalf(uint16_t comp)
       int i;
       float f;
     } nan;
-    nan.i = 0x7F800001;
+    // infinities keep their sign, anything else is a NaN
+    nan.i = mantissa == 0 ? ((sign ? 0x80000000 : 0) | 0x7F800000) : 0x7F800001;
     return nan.f;
   }
 }
@@ -95,6 +95,8 @@ uint32_t LaunchAndInjectIntoProcess(const char *app, const char *workingDir, con
 void *LoadModule(const char *module);
 void *GetFunctionAddress(void *module, const char *function);
 uint32_t GetCurrentPID();
+// returns the value of the named environment variable, or an empty string if it isn't set
+string GetEnvVariable(const char *name);
 };
 
 namespace Timing
@@ -121,6 +123,30 @@ private:
   CriticalSectionTemplate &operator=(const CriticalSectionTemplate &other);
   CriticalSectionTemplate(const CriticalSectionTemplate &other);
 
+  template <class, class>
+  friend class ConditionVariableTemplate;
+
+  data m_Data;
+};
+
+// Wait() atomically releases the lock and sleeps until woken, then re-acquires the lock before
+// returning. The lock must be held exactly once (not recursively) by the waiting thread, and
+// wakeups can be spurious so the caller should re-check its condition in a loop.
+template <class data, class lock>
+class ConditionVariableTemplate
+{
+public:
+  ConditionVariableTemplate();
+  ~ConditionVariableTemplate();
+  void Wait(lock &cs);
+  void WakeOne();
+  void WakeAll();
+
+private:
+  // no copying
+  ConditionVariableTemplate &operator=(const ConditionVariableTemplate &other);
+  ConditionVariableTemplate(const ConditionVariableTemplate &other);
+
   data m_Data;
 };
 
@@ -132,6 +158,7 @@ void *GetTLSValue(uint64_t slot);
 void SetTLSValue(uint64_t slot, void *value);
 
 // must typedef CriticalSectionTemplate<X> CriticalSection
+// must typedef ConditionVariableTemplate<X, CriticalSection> ConditionVariable
 
 typedef void (*ThreadEntry)(void *);
 typedef uint64_t ThreadHandle;
@@ -141,6 +168,9 @@ void JoinThread(ThreadHandle handle);
 void CloseThread(ThreadHandle handle);
 void Sleep(uint32_t milliseconds);
 
+// number of logical processors available to this process, at least 1
+uint32_t NumberOfCores();
+
 // kind of windows specific, to handle this case:
 // http://blogs.msdn.com/b/oldnewthing/archive/2013/11/05/10463645.aspx
 void KeepModuleAlive();
@@ -240,10 +270,28 @@ class StackResolver
 public:
   virtual ~StackResolver() {}
   virtual AddressDetails GetAddr(uint64_t addr) = 0;
+
+  // resolves a whole callstack at once, so resolvers can share work between the addresses
+  virtual void GetAddrs(const uint64_t *addrs, size_t count, AddressDetails *out)
+  {
+    for(size_t i = 0; i < count; i++)
+      out[i] = GetAddr(addrs[i]);
+  }
 };
 
 void Init();
 
+// matches the values of eRENDERDOC_Option_CallstackUnwinder
+enum Unwinder
+{
+  eUnwinder_System = 0,
+  eUnwinder_FramePointers,
+  eUnwinder_EHFrame,
+};
+
+// selects how Collect() walks the stack. Platforms with only one unwinder ignore it
+void SetUnwinder(uint32_t unwinder);
+
 Stackwalk *Collect();
 Stackwalk *Create();
 
@@ -270,8 +318,15 @@ void GetExecutableFilename(string &selfName);
 uint64_t GetModifiedTimestamp(const string &filename);
 
 void Copy(const char *from, const char *to, bool allowOverwrite);
+// renames from over to, replacing to if it exists. Atomic where the filesystem supports it
+bool Move(const char *from, const char *to);
 void Delete(const char *path);
 
+// maps a whole file read-only into memory, returning NULL on failure or if the file is empty.
+// handle is an opaque OS handle that must be passed back to UnmapFile along with the size.
+const void *MapFile(const char *filename, uint64_t &size, void *&handle);
+void UnmapFile(const void *ptr, uint64_t size, void *handle);
+
 enum
 {
   eFileProp_Directory = 0x1,
@@ -56,6 +56,10 @@ void Init()
 {
 }
 
+void SetUnwinder(uint32_t unwinder)
+{
+}
+
 Stackwalk *Collect()
 {
   return new AndroidCallstack();
@@ -25,13 +25,19 @@
 #include <execinfo.h>
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 #include <map>
 #include <vector>
+#include "common/worker_pool.h"
 #include "os/os_specific.h"
+#include "linux_symbols.h"
+#include "linux_unwind.h"
 
 void *renderdocBase = NULL;
 void *renderdocEnd = NULL;
 
+static volatile uint32_t unwinder = Callstack::eUnwinder_System;
+
 class LinuxCallstack : public Callstack::Stackwalk
 {
 public:
@@ -57,21 +63,46 @@ private:
 
   void Collect()
   {
-    void *addrs_ptr[ARRAY_COUNT(addrs)];
+    uint64_t addrs_raw[ARRAY_COUNT(addrs)];
 
-    numLevels = backtrace(addrs_ptr, ARRAY_COUNT(addrs));
+    int rawLevels = 0;
 
-    int offs = 0;
-    // if we want to trim levels of the stack, we can do that here
-    // by incrementing offs and decrementing numLevels
-    while(numLevels > 0 && addrs_ptr[offs] >= renderdocBase && addrs_ptr[offs] < renderdocEnd)
+    if(unwinder == Callstack::eUnwinder_FramePointers)
+      rawLevels = Unwind::FramePointers(addrs_raw, ARRAY_COUNT(addrs), (uint64_t)renderdocBase,
+                                        (uint64_t)renderdocEnd);
+    else if(unwinder == Callstack::eUnwinder_EHFrame)
+      rawLevels = Unwind::EHFrame(addrs_raw, ARRAY_COUNT(addrs));
+
+    int offs = TrimRenderDocFrames(addrs_raw, rawLevels);
+
+    // fall back to the system unwinder if it's selected, or the faster ones couldn't get past
+    // RenderDoc's own frames
+    if(rawLevels - offs <= 0)
     {
-      offs++;
-      numLevels--;
+      void *addrs_ptr[ARRAY_COUNT(addrs)];
+
+      rawLevels = backtrace(addrs_ptr, ARRAY_COUNT(addrs));
+
+      for(int i = 0; i < rawLevels; i++)
+        addrs_raw[i] = (uint64_t)addrs_ptr[i];
+
+      offs = TrimRenderDocFrames(addrs_raw, rawLevels);
     }
 
+    numLevels = rawLevels - offs;
+
     for(int i = 0; i < numLevels; i++)
-      addrs[i] = (uint64_t)addrs_ptr[i + offs];
+      addrs[i] = addrs_raw[i + offs];
+  }
+
+  // returns how many of the innermost frames are inside RenderDoc and should be dropped
+  static int TrimRenderDocFrames(const uint64_t *addrs_raw, int rawLevels)
+  {
+    int offs = 0;
+    while(offs < rawLevels && addrs_raw[offs] >= (uint64_t)renderdocBase &&
+          addrs_raw[offs] < (uint64_t)renderdocEnd)
+      offs++;
+    return offs;
   }
 
   uint64_t addrs[128];
@@ -104,6 +135,11 @@ void Init()
   }
 }
 
+void SetUnwinder(uint32_t unwinder)
+{
+  ::unwinder = unwinder;
+}
+
 Stackwalk *Collect()
 {
   return new LinuxCallstack();
@@ -151,82 +187,169 @@ struct LookupModule
 {
   uint64_t base;
   uint64_t end;
+  uint64_t offset;
   char path[2048];
+
+  bool operator<(const LookupModule &o) const { return base < o.base; }
 };
 
 class LinuxResolver : public Callstack::StackResolver
 {
 public:
-  LinuxResolver(vector<LookupModule> modules) { m_Modules = modules; }
-  Callstack::AddressDetails GetAddr(uint64_t addr)
+  LinuxResolver(vector<LookupModule> modules) : m_Modules(modules), m_Pool(NULL)
   {
-    EnsureCached(addr);
+    std::sort(m_Modules.begin(), m_Modules.end());
+    m_Symbols.resize(m_Modules.size(), NULL);
+    m_Loaded.resize(m_Modules.size(), false);
+  }
 
-    return m_Cache[addr];
+  ~LinuxResolver()
+  {
+    for(size_t i = 0; i < m_Symbols.size(); i++)
+      SAFE_DELETE(m_Symbols[i]);
+    SAFE_DELETE(m_Pool);
   }
 
-private:
-  void EnsureCached(uint64_t addr)
+  Callstack::AddressDetails GetAddr(uint64_t addr)
   {
-    auto it = m_Cache.insert(
-        std::pair<uint64_t, Callstack::AddressDetails>(addr, Callstack::AddressDetails()));
-    if(!it.second)
-      return;
+    Callstack::AddressDetails ret;
+    GetAddrs(&addr, 1, &ret);
+    return ret;
+  }
 
-    Callstack::AddressDetails &ret = it.first->second;
+  void GetAddrs(const uint64_t *addrs, size_t count, Callstack::AddressDetails *out)
+  {
+    std::vector<uint64_t> missing;
 
-    ret.filename = "Unknown";
-    ret.line = 0;
-    ret.function = StringFormat::Fmt("0x%08llx", addr);
+    for(size_t i = 0; i < count; i++)
+      if(m_Cache.find(addrs[i]) == m_Cache.end())
+        missing.push_back(addrs[i]);
 
-    for(size_t i = 0; i < m_Modules.size(); i++)
+    if(!missing.empty())
     {
-      if(addr >= m_Modules[i].base && addr < m_Modules[i].end)
+      std::sort(missing.begin(), missing.end());
+      missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+
+      // modules are only parsed the first time an address lands in them. That is by far the most
+      // expensive part, so all the modules needed by this batch are loaded together.
+      std::vector<size_t> load;
+      for(size_t i = 0; i < missing.size(); i++)
       {
-        uint64_t relative = addr - m_Modules[i].base;
-        string cmd =
-            StringFormat::Fmt("addr2line -j.text -fCe \"%s\" 0x%llx", m_Modules[i].path, relative);
+        size_t mod = FindModule(missing[i]);
+        if(mod < m_Modules.size() && !m_Loaded[mod])
+        {
+          m_Loaded[mod] = true;
+          load.push_back(mod);
+        }
+      }
 
-        FILE *f = ::popen(cmd.c_str(), "r");
+      LoadModulesJob loadJob(this, load);
+      RunParallel((uint32_t)load.size(), 1, loadJob);
 
-        char result[2048] = {0};
-        fread(result, 1, 2047, f);
+      std::vector<Callstack::AddressDetails> resolved(missing.size());
+      ResolveJob resolveJob(this, missing, resolved);
+      RunParallel((uint32_t)missing.size(), ParallelResolveCount, resolveJob);
 
-        fclose(f);
+      for(size_t i = 0; i < missing.size(); i++)
+        m_Cache[missing[i]] = resolved[i];
+    }
 
-        char *line2 = strchr(result, '\n');
-        if(line2)
-        {
-          *line2 = 0;
-          line2++;
-        }
+    for(size_t i = 0; i < count; i++)
+      out[i] = m_Cache[addrs[i]];
+  }
 
-        ret.function = result;
+private:
+  // below this many addresses it's quicker to look them up than to hand them to other threads
+  static const uint32_t ParallelResolveCount = 256;
 
-        if(line2)
-        {
-          char *last = line2 + strlen(line2) - 1;
-          uint32_t mul = 1;
-          ret.line = 0;
-          while(*last >= '0' && *last <= '9')
-          {
-            ret.line += mul * (uint32_t(*last) - uint32_t('0'));
-            *last = 0;
-            last--;
-            mul *= 10;
-          }
-          if(*last == ':')
-            *last = 0;
+  struct LoadModulesJob : public Threading::ParallelJob
+  {
+    LoadModulesJob(LinuxResolver *r, const std::vector<size_t> &m) : resolver(r), modules(m) {}
+    void Run(uint32_t index)
+    {
+      size_t mod = modules[index];
+      ELFSymbols *symbols = new ELFSymbols(resolver->m_Modules[mod].path);
+      if(!symbols->IsValid())
+        RDCWARN("Couldn't read symbols from '%s'", resolver->m_Modules[mod].path);
+      resolver->m_Symbols[mod] = symbols;
+    }
 
-          ret.filename = line2;
-        }
+    LinuxResolver *resolver;
+    const std::vector<size_t> &modules;
+  };
 
-        break;
-      }
+  struct ResolveJob : public Threading::ParallelJob
+  {
+    ResolveJob(LinuxResolver *r, const std::vector<uint64_t> &a,
+               std::vector<Callstack::AddressDetails> &o)
+        : resolver(r), addrs(a), out(o)
+    {
+    }
+    void Run(uint32_t index) { resolver->Resolve(addrs[index], out[index]); }
+    LinuxResolver *resolver;
+    const std::vector<uint64_t> &addrs;
+    std::vector<Callstack::AddressDetails> &out;
+  };
+
+  void RunParallel(uint32_t count, uint32_t minParallel, Threading::ParallelJob &job)
+  {
+    if(count > minParallel)
+    {
+      if(m_Pool == NULL)
+        m_Pool = new Threading::WorkerPool();
+
+      m_Pool->ParallelFor(count, job);
+    }
+    else
+    {
+      for(uint32_t i = 0; i < count; i++)
+        job.Run(i);
     }
   }
 
+  size_t FindModule(uint64_t addr) const
+  {
+    LookupModule key;
+    key.base = addr;
+
+    auto it = std::upper_bound(m_Modules.begin(), m_Modules.end(), key);
+
+    if(it == m_Modules.begin())
+      return ~0U;
+
+    --it;
+
+    if(addr >= it->end)
+      return ~0U;
+
+    return size_t(it - m_Modules.begin());
+  }
+
+  // only reads loaded modules, so it can run on any thread
+  void Resolve(uint64_t addr, Callstack::AddressDetails &ret) const
+  {
+    ret.filename = "Unknown";
+    ret.line = 0;
+    ret.function = StringFormat::Fmt("0x%08llx", addr);
+
+    size_t mod = FindModule(addr);
+
+    if(mod >= m_Modules.size() || m_Symbols[mod] == NULL)
+      return;
+
+    const LookupModule &m = m_Modules[mod];
+
+    uint64_t linkAddr = 0;
+    if(m_Symbols[mod]->FileOffsetToAddress(addr - m.base + m.offset, linkAddr))
+      m_Symbols[mod]->Resolve(linkAddr, ret);
+  }
+
   std::vector<LookupModule> m_Modules;
+  std::vector<ELFSymbols *> m_Symbols;
+  std::vector<bool> m_Loaded;
+
+  Threading::WorkerPool *m_Pool;
+
   std::map<uint64_t, Callstack::AddressDetails> m_Cache;
 };
 
@@ -256,21 +379,23 @@ StackResolver *MakeResolver(char *moduleDB, size_t DBSize, string pdbSearchPaths
 
     // find .text segments
     {
-      long unsigned int base = 0, end = 0;
+      long unsigned int base = 0, end = 0, offset = 0;
 
       int inode = 0;
       int offs = 0;
       //                        base-end   perms offset devid   inode offs
-      int num = sscanf(search, "%lx-%lx  r-xp  %*x    %*x:%*x %d    %n", &base, &end, &inode, &offs);
+      int num = sscanf(search, "%lx-%lx  r-xp  %lx    %*x:%*x %d    %n", &base, &end, &offset,
+                       &inode, &offs);
 
       // we don't care about inode actually, we ust use it to verify that
-      // we read all 3 params (and so perms == r-xp)
-      if(num == 3 && offs > 0)
+      // we read all 4 params (and so perms == r-xp)
+      if(num == 4 && offs > 0)
       {
         LookupModule mod = {0};
 
         mod.base = (uint64_t)base;
         mod.end = (uint64_t)end;
+        mod.offset = (uint64_t)offset;
 
         search += offs;
         while(size_t(search - moduleDB) < DBSize && (*search == ' ' || *search == '\t'))
@@ -295,37 +420,8 @@ StackResolver *MakeResolver(char *moduleDB, size_t DBSize, string pdbSearchPaths
             mod.path[i] = search[i];
           }
 
-          // addr2line wants offsets relative to text section, have to find offset of .text section
-          // in this
-          // mmapped section
-
-          int textoffs = 0;
-          string cmd = StringFormat::Fmt("readelf -WS \"%s\"", mod.path);
-
-          FILE *f = ::popen(cmd.c_str(), "r");
-
-          char result[4096] = {0};
-          fread(result, 1, 4095, f);
-
-          fclose(f);
-
-          // find .text line
-          char *find = strstr(result, ".text");
-
-          if(find)
-          {
-            find += 5;
-
-            while(isalpha(*find) || isspace(*find))
-              find++;
-
-            // virtual address is listed first, we want the offset
-            sscanf(find, "%*x %x", &textoffs);
-
-            mod.base += textoffs;
-
-            modules.push_back(mod);
-          }
+          // the module's symbols are only read once an address needs resolving in it
+          modules.push_back(mod);
         }
       }
     }
@@ -0,0 +1,733 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "linux_symbols.h"
+#include <cxxabi.h>
+#include <elf.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include "serialise/string_utils.h"
+
+#ifndef SHF_COMPRESSED
+#define SHF_COMPRESSED (1 << 11)
+#endif
+
+#ifndef STT_GNU_IFUNC
+#define STT_GNU_IFUNC 10
+#endif
+
+namespace
+{
+// the subset of DWARF constants needed to run .debug_line programs
+enum
+{
+  DW_LNS_copy = 0x01,
+  DW_LNS_advance_pc = 0x02,
+  DW_LNS_advance_line = 0x03,
+  DW_LNS_set_file = 0x04,
+  DW_LNS_const_add_pc = 0x08,
+  DW_LNS_fixed_advance_pc = 0x09,
+
+  DW_LNE_end_sequence = 0x01,
+  DW_LNE_set_address = 0x02,
+  DW_LNE_define_file = 0x03,
+
+  DW_LNCT_path = 0x1,
+  DW_LNCT_directory_index = 0x2,
+
+  DW_FORM_block2 = 0x03,
+  DW_FORM_block4 = 0x04,
+  DW_FORM_data2 = 0x05,
+  DW_FORM_data4 = 0x06,
+  DW_FORM_data8 = 0x07,
+  DW_FORM_string = 0x08,
+  DW_FORM_block = 0x09,
+  DW_FORM_block1 = 0x0a,
+  DW_FORM_data1 = 0x0b,
+  DW_FORM_sdata = 0x0d,
+  DW_FORM_strp = 0x0e,
+  DW_FORM_udata = 0x0f,
+  DW_FORM_data16 = 0x1e,
+  DW_FORM_line_strp = 0x1f,
+};
+
+const char *StringAt(const byte *data, uint64_t size, uint64_t offset)
+{
+  if(data == NULL || offset >= size || memchr(data + offset, 0, size_t(size - offset)) == NULL)
+    return "";
+  return (const char *)data + offset;
+}
+
+template <typename T>
+bool ReadStruct(const byte *data, uint64_t size, uint64_t offset, T &out)
+{
+  if(offset > size || size - offset < sizeof(T))
+    return false;
+  memcpy(&out, data + offset, sizeof(T));
+  return true;
+}
+
+struct LineRowOrder
+{
+  // at equal addresses the end of one sequence sorts before the start of the next, so that lookups
+  // land on the start.
+  template <typename Row>
+  bool operator()(const Row &a, const Row &b) const
+  {
+    if(a.address != b.address)
+      return a.address < b.address;
+    return a.file == ~0U && b.file != ~0U;
+  }
+};
+
+struct SymbolOrder
+{
+  // sized symbols sort first at equal addresses, so they win when duplicates are removed
+  template <typename Sym>
+  bool operator()(const Sym &a, const Sym &b) const
+  {
+    if(a.address != b.address)
+      return a.address < b.address;
+    return a.size > b.size;
+  }
+};
+
+struct SymbolAddressEqual
+{
+  template <typename Sym>
+  bool operator()(const Sym &a, const Sym &b) const
+  {
+    return a.address == b.address;
+  }
+};
+};
+
+const uint32_t ELFSymbols::EndOfSequence;
+
+struct ELFSymbols::Sections
+{
+  Sections() : is64(false), debuglink(NULL)
+  {
+    symtab = strtab = dynsym = dynstr = debugLine = debugLineStr = debugStr = buildId =
+        SectionData();
+  }
+
+  bool is64;
+
+  SectionData symtab, strtab;
+  SectionData dynsym, dynstr;
+  SectionData debugLine, debugLineStr, debugStr;
+  SectionData buildId;
+  const char *debuglink;
+
+  std::vector<Segment> segments;
+};
+
+ELFSymbols::ELFSymbols(const char *path) : m_Valid(false)
+{
+  Sections sections;
+  uint64_t size = 0;
+  const byte *data = MapFile(path, size);
+
+  if(data == NULL || !ParseELF(data, size, sections))
+    return;
+
+  m_Valid = true;
+  m_Segments = sections.segments;
+
+  // distributions strip binaries and ship the symbols and debug info in a separate file
+  Sections debug;
+  bool hasDebug = false;
+
+  if(sections.symtab.size == 0 || sections.debugLine.size == 0)
+  {
+    std::string debugPath = FindDebugFile(path, sections);
+
+    if(!debugPath.empty())
+    {
+      data = MapFile(debugPath.c_str(), size);
+      hasDebug = data && ParseELF(data, size, debug) && debug.is64 == sections.is64;
+    }
+  }
+
+  // prefer the full symbol table to the dynamic exports
+  const Sections &symbolSource = sections.symtab.size || !hasDebug ? sections : debug;
+  SectionData symbols = symbolSource.symtab, strings = symbolSource.strtab;
+
+  if(symbols.size == 0)
+  {
+    symbols = sections.dynsym;
+    strings = sections.dynstr;
+  }
+
+  if(sections.is64)
+    AddSymbols<Elf64_Sym>(symbols, strings);
+  else
+    AddSymbols<Elf32_Sym>(symbols, strings);
+
+  AddLines(sections.debugLine.size || !hasDebug ? sections : debug);
+
+  m_FilenameLookup.clear();
+}
+
+ELFSymbols::~ELFSymbols()
+{
+  for(size_t i = 0; i < m_Files.size(); i++)
+    FileIO::UnmapFile(m_Files[i].data, m_Files[i].size, m_Files[i].handle);
+}
+
+const byte *ELFSymbols::MapFile(const char *path, uint64_t &size)
+{
+  MappedFile file;
+  file.data = (const byte *)FileIO::MapFile(path, file.size, file.handle);
+
+  if(file.data == NULL)
+    return NULL;
+
+  // symbol names point into the mapping, so it is kept until destruction
+  m_Files.push_back(file);
+
+  size = file.size;
+  return file.data;
+}
+
+bool ELFSymbols::ParseELF(const byte *data, uint64_t size, Sections &sections)
+{
+  if(size < EI_NIDENT || memcmp(data, ELFMAG, SELFMAG) != 0 || data[EI_DATA] != ELFDATA2LSB)
+    return false;
+
+  sections.is64 = (data[EI_CLASS] == ELFCLASS64);
+
+  if(sections.is64)
+    return ReadSections<Elf64_Ehdr, Elf64_Shdr, Elf64_Phdr>(data, size, sections);
+  else if(data[EI_CLASS] == ELFCLASS32)
+    return ReadSections<Elf32_Ehdr, Elf32_Shdr, Elf32_Phdr>(data, size, sections);
+
+  return false;
+}
+
+template <typename Ehdr, typename Shdr, typename Phdr>
+bool ELFSymbols::ReadSections(const byte *data, uint64_t size, Sections &sections)
+{
+  Ehdr ehdr;
+  if(!ReadStruct(data, size, 0, ehdr))
+    return false;
+
+  for(uint64_t i = 0; i < ehdr.e_phnum; i++)
+  {
+    Phdr phdr;
+    if(!ReadStruct(data, size, ehdr.e_phoff + i * ehdr.e_phentsize, phdr))
+      break;
+
+    if(phdr.p_type == PT_LOAD)
+    {
+      Segment seg = {phdr.p_offset, phdr.p_filesz, phdr.p_vaddr};
+      sections.segments.push_back(seg);
+    }
+  }
+
+  if(ehdr.e_shoff == 0)
+    return true;
+
+  // large section counts are stored in the first section header
+  Shdr first;
+  if(!ReadStruct(data, size, ehdr.e_shoff, first))
+    return true;
+
+  uint64_t numSections = ehdr.e_shnum ? ehdr.e_shnum : first.sh_size;
+  uint64_t nameSection = ehdr.e_shstrndx == SHN_XINDEX ? first.sh_link : ehdr.e_shstrndx;
+
+  std::vector<Shdr> shdrs;
+  for(uint64_t i = 0; i < numSections; i++)
+  {
+    Shdr shdr;
+    if(!ReadStruct(data, size, ehdr.e_shoff + i * ehdr.e_shentsize, shdr))
+      break;
+    shdrs.push_back(shdr);
+  }
+
+  std::vector<SectionData> contents(shdrs.size());
+  for(size_t i = 0; i < shdrs.size(); i++)
+  {
+    const Shdr &shdr = shdrs[i];
+
+    contents[i].data = NULL;
+    contents[i].size = 0;
+
+    // compressed debug sections would need inflating first, treat them as missing
+    if(shdr.sh_type == SHT_NOBITS || (shdr.sh_flags & SHF_COMPRESSED) ||
+       shdr.sh_offset > size || size - shdr.sh_offset < shdr.sh_size)
+      continue;
+
+    contents[i].data = data + shdr.sh_offset;
+    contents[i].size = shdr.sh_size;
+  }
+
+  if(nameSection >= shdrs.size())
+    return true;
+
+  for(size_t i = 0; i < shdrs.size(); i++)
+  {
+    const Shdr &shdr = shdrs[i];
+    const char *name =
+        StringAt(contents[nameSection].data, contents[nameSection].size, shdr.sh_name);
+
+    if(shdr.sh_type == SHT_SYMTAB && shdr.sh_link < shdrs.size())
+    {
+      sections.symtab = contents[i];
+      sections.strtab = contents[shdr.sh_link];
+    }
+    else if(shdr.sh_type == SHT_DYNSYM && shdr.sh_link < shdrs.size())
+    {
+      sections.dynsym = contents[i];
+      sections.dynstr = contents[shdr.sh_link];
+    }
+    else if(!strcmp(name, ".debug_line"))
+    {
+      sections.debugLine = contents[i];
+    }
+    else if(!strcmp(name, ".debug_line_str"))
+    {
+      sections.debugLineStr = contents[i];
+    }
+    else if(!strcmp(name, ".debug_str"))
+    {
+      sections.debugStr = contents[i];
+    }
+    else if(!strcmp(name, ".gnu_debuglink"))
+    {
+      sections.debuglink = StringAt(contents[i].data, contents[i].size, 0);
+    }
+    else if(shdr.sh_type == SHT_NOTE && !strcmp(name, ".note.gnu.build-id"))
+    {
+      Elf64_Nhdr note;
+      if(ReadStruct(contents[i].data, contents[i].size, 0, note) && note.n_type == NT_GNU_BUILD_ID)
+      {
+        uint64_t descOffset = sizeof(note) + AlignUp4(note.n_namesz);
+        if(descOffset <= contents[i].size && contents[i].size - descOffset >= note.n_descsz)
+        {
+          sections.buildId.data = contents[i].data + descOffset;
+          sections.buildId.size = note.n_descsz;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+std::string ELFSymbols::FindDebugFile(const char *path, const Sections &sections)
+{
+  std::vector<std::string> candidates;
+
+  if(sections.buildId.size >= 2)
+  {
+    std::string hex;
+    for(uint64_t i = 0; i < sections.buildId.size; i++)
+      hex += StringFormat::Fmt("%02x", sections.buildId.data[i]);
+
+    candidates.push_back("/usr/lib/debug/.build-id/" + hex.substr(0, 2) + "/" + hex.substr(2) +
+                         ".debug");
+  }
+
+  if(sections.debuglink && sections.debuglink[0])
+  {
+    std::string dir = dirname(std::string(path));
+
+    candidates.push_back(dir + "/" + sections.debuglink);
+    candidates.push_back(dir + "/.debug/" + sections.debuglink);
+    candidates.push_back("/usr/lib/debug" + dir + "/" + sections.debuglink);
+  }
+
+  for(size_t i = 0; i < candidates.size(); i++)
+    if(candidates[i] != path && access(candidates[i].c_str(), R_OK) == 0)
+      return candidates[i];
+
+  return "";
+}
+
+template <typename Sym>
+void ELFSymbols::AddSymbols(SectionData symbols, SectionData strings)
+{
+  uint64_t count = symbols.size / sizeof(Sym);
+
+  m_Symbols.reserve((size_t)count);
+
+  for(uint64_t i = 0; i < count; i++)
+  {
+    Sym sym;
+    memcpy(&sym, symbols.data + i * sizeof(Sym), sizeof(Sym));
+
+    uint32_t type = sym.st_info & 0xf;
+
+    if((type != STT_FUNC && type != STT_GNU_IFUNC) || sym.st_shndx == SHN_UNDEF ||
+       sym.st_value == 0)
+      continue;
+
+    const char *name = StringAt(strings.data, strings.size, sym.st_name);
+
+    if(name[0] == 0)
+      continue;
+
+    Symbol s = {sym.st_value, sym.st_size, name};
+    m_Symbols.push_back(s);
+  }
+
+  std::sort(m_Symbols.begin(), m_Symbols.end(), SymbolOrder());
+  m_Symbols.erase(std::unique(m_Symbols.begin(), m_Symbols.end(), SymbolAddressEqual()),
+                  m_Symbols.end());
+}
+
+uint32_t ELFSymbols::AddFilename(const char *dir, const char *name)
+{
+  std::string path = name;
+  if(name[0] != '/' && dir[0] != 0)
+    path = std::string(dir) + "/" + name;
+
+  auto it = m_FilenameLookup.find(path);
+  if(it != m_FilenameLookup.end())
+    return it->second;
+
+  uint32_t idx = (uint32_t)m_Filenames.size();
+  m_Filenames.push_back(path);
+  m_FilenameLookup[path] = idx;
+  return idx;
+}
+
+static bool ReadForm(DWARFReader &reader, uint64_t form, bool dwarf64, const char *&str,
+                     uint64_t &val, const byte *lineStr, uint64_t lineStrSize, const byte *debugStr,
+                     uint64_t debugStrSize)
+{
+  switch(form)
+  {
+    case DW_FORM_string: str = reader.ReadString(); return true;
+    case DW_FORM_line_strp:
+      str = StringAt(lineStr, lineStrSize, reader.ReadOffset(dwarf64));
+      return true;
+    case DW_FORM_strp: str = StringAt(debugStr, debugStrSize, reader.ReadOffset(dwarf64)); return true;
+    case DW_FORM_udata: val = reader.ReadULEB(); return true;
+    case DW_FORM_sdata: val = (uint64_t)reader.ReadSLEB(); return true;
+    case DW_FORM_data1: val = reader.Read<uint8_t>(); return true;
+    case DW_FORM_data2: val = reader.Read<uint16_t>(); return true;
+    case DW_FORM_data4: val = reader.Read<uint32_t>(); return true;
+    case DW_FORM_data8: val = reader.Read<uint64_t>(); return true;
+    case DW_FORM_data16: reader.Skip(16); return true;
+    case DW_FORM_block: reader.Skip(reader.ReadULEB()); return true;
+    case DW_FORM_block1: reader.Skip(reader.Read<uint8_t>()); return true;
+    case DW_FORM_block2: reader.Skip(reader.Read<uint16_t>()); return true;
+    case DW_FORM_block4: reader.Skip(reader.Read<uint32_t>()); return true;
+    // indexed strings need .debug_str_offsets and the unit's base from .debug_info
+    default: return false;
+  }
+}
+
+void ELFSymbols::AddLines(const Sections &sections)
+{
+  DWARFReader units(sections.debugLine.data, sections.debugLine.size);
+
+  std::vector<const char *> dirs;
+  std::vector<uint32_t> files;
+  std::vector<LineRow> sequence;
+
+  while(!units.AtEnd())
+  {
+    bool dwarf64 = false;
+    uint64_t length = units.Read<uint32_t>();
+
+    if(length == 0xffffffff)
+    {
+      dwarf64 = true;
+      length = units.Read<uint64_t>();
+    }
+
+    if(length == 0 || length > units.Remaining())
+      break;
+
+    DWARFReader unit(units.cur, length);
+    units.Skip(length);
+
+    uint16_t version = unit.Read<uint16_t>();
+    if(version < 2 || version > 5)
+      continue;
+
+    uint8_t addressSize = sections.is64 ? 8 : 4;
+    if(version >= 5)
+    {
+      addressSize = unit.Read<uint8_t>();
+      unit.Read<uint8_t>();    // segment selector size
+    }
+
+    uint64_t headerLength = unit.ReadOffset(dwarf64);
+    if(headerLength > unit.Remaining())
+      continue;
+
+    DWARFReader header(unit.cur, headerLength);
+    DWARFReader program(unit.cur + headerLength, unit.Remaining() - headerLength);
+
+    uint8_t minInstLength = header.Read<uint8_t>();
+    if(version >= 4)
+      header.Read<uint8_t>();    // max ops per instruction, only for VLIW
+    header.Read<uint8_t>();      // default is_stmt, we keep every row like addr2line
+    int8_t lineBase = header.Read<int8_t>();
+    uint8_t lineRange = header.Read<uint8_t>();
+    uint8_t opcodeBase = header.Read<uint8_t>();
+
+    if(lineRange == 0 || opcodeBase == 0)
+      continue;
+
+    uint8_t opcodeLengths[256] = {};
+    for(uint32_t i = 1; i < opcodeBase; i++)
+      opcodeLengths[i] = header.Read<uint8_t>();
+
+    dirs.clear();
+    files.clear();
+
+    bool validHeader = true;
+
+    if(version >= 5)
+    {
+      // directories then files, each entry described by a list of (content type, form) pairs.
+      for(int table = 0; table < 2 && validHeader; table++)
+      {
+        uint8_t formatCount = header.Read<uint8_t>();
+        uint64_t formats[256][2];
+        for(uint32_t f = 0; f < formatCount; f++)
+        {
+          formats[f][0] = header.ReadULEB();
+          formats[f][1] = header.ReadULEB();
+        }
+
+        uint64_t count = header.ReadULEB();
+        for(uint64_t e = 0; e < count && validHeader && !header.AtEnd(); e++)
+        {
+          const char *path = "";
+          uint64_t dirIndex = 0;
+
+          for(uint32_t f = 0; f < formatCount && validHeader; f++)
+          {
+            const char *str = NULL;
+            uint64_t val = 0;
+            validHeader = ReadForm(header, formats[f][1], dwarf64, str, val,
+                                   sections.debugLineStr.data, sections.debugLineStr.size,
+                                   sections.debugStr.data, sections.debugStr.size);
+
+            if(formats[f][0] == DW_LNCT_path && str)
+              path = str;
+            else if(formats[f][0] == DW_LNCT_directory_index)
+              dirIndex = val;
+          }
+
+          if(table == 0)
+            dirs.push_back(path);
+          else
+            files.push_back(AddFilename(dirIndex < dirs.size() ? dirs[dirIndex] : "", path));
+        }
+      }
+    }
+    else
+    {
+      // directory 0 is the compilation directory, which is only recorded in .debug_info
+      dirs.push_back("");
+      while(!header.AtEnd())
+      {
+        const char *dir = header.ReadString();
+        if(dir[0] == 0)
+          break;
+        dirs.push_back(dir);
+      }
+
+      // file indices start at 1
+      files.push_back(EndOfSequence);
+      while(!header.AtEnd())
+      {
+        const char *name = header.ReadString();
+        if(name[0] == 0)
+          break;
+        uint64_t dirIndex = header.ReadULEB();
+        header.ReadULEB();    // modification time
+        header.ReadULEB();    // file length
+        files.push_back(AddFilename(dirIndex < dirs.size() ? dirs[dirIndex] : "", name));
+      }
+    }
+
+    if(!validHeader)
+      continue;
+
+    uint64_t address = 0;
+    uint64_t file = 1;
+    int64_t line = 1;
+
+    sequence.clear();
+
+    while(!program.AtEnd())
+    {
+      uint8_t op = program.Read<uint8_t>();
+      bool emit = false;
+
+      if(op >= opcodeBase)
+      {
+        uint8_t adjusted = op - opcodeBase;
+        address += (adjusted / lineRange) * minInstLength;
+        line += lineBase + (adjusted % lineRange);
+        emit = true;
+      }
+      else if(op == 0)
+      {
+        uint64_t len = program.ReadULEB();
+        if(len == 0 || len > program.Remaining())
+          break;
+
+        DWARFReader ext(program.cur, len);
+        program.Skip(len);
+
+        uint8_t extOp = ext.Read<uint8_t>();
+
+        if(extOp == DW_LNE_end_sequence)
+        {
+          LineRow row = {address, EndOfSequence, 0};
+          sequence.push_back(row);
+
+          // code discarded by the linker has its sequences relocated to 0 (or -1), and would
+          // otherwise overlap real code
+          uint64_t tombstone = addressSize == 8 ? ~0ULL : 0xffffffffULL;
+          if(sequence[0].address != 0 && sequence[0].address != tombstone)
+            m_Lines.insert(m_Lines.end(), sequence.begin(), sequence.end());
+
+          sequence.clear();
+          address = 0;
+          file = 1;
+          line = 1;
+        }
+        else if(extOp == DW_LNE_set_address)
+        {
+          address = ext.ReadSized(len - 1);
+        }
+        else if(extOp == DW_LNE_define_file)
+        {
+          const char *name = ext.ReadString();
+          uint64_t dirIndex = ext.ReadULEB();
+          files.push_back(AddFilename(dirIndex < dirs.size() ? dirs[dirIndex] : "", name));
+        }
+      }
+      else if(op == DW_LNS_copy)
+      {
+        emit = true;
+      }
+      else if(op == DW_LNS_advance_pc)
+      {
+        address += program.ReadULEB() * minInstLength;
+      }
+      else if(op == DW_LNS_advance_line)
+      {
+        line += program.ReadSLEB();
+      }
+      else if(op == DW_LNS_set_file)
+      {
+        file = program.ReadULEB();
+      }
+      else if(op == DW_LNS_const_add_pc)
+      {
+        address += ((255 - opcodeBase) / lineRange) * minInstLength;
+      }
+      else if(op == DW_LNS_fixed_advance_pc)
+      {
+        address += program.Read<uint16_t>();
+      }
+      else
+      {
+        // skip the arguments of any opcode we don't care about
+        for(uint32_t i = 0; i < opcodeLengths[op]; i++)
+          program.ReadULEB();
+      }
+
+      if(emit && file < files.size() && files[file] != EndOfSequence)
+      {
+        LineRow row = {address, files[file], (uint32_t)RDCCLAMP(line, (int64_t)0, (int64_t)0xffffffff)};
+        sequence.push_back(row);
+      }
+    }
+  }
+
+  std::stable_sort(m_Lines.begin(), m_Lines.end(), LineRowOrder());
+}
+
+bool ELFSymbols::FileOffsetToAddress(uint64_t offset, uint64_t &address) const
+{
+  for(size_t i = 0; i < m_Segments.size(); i++)
+  {
+    const Segment &seg = m_Segments[i];
+    if(offset >= seg.offset && offset - seg.offset < seg.filesize)
+    {
+      address = offset - seg.offset + seg.address;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool ELFSymbols::Resolve(uint64_t address, Callstack::AddressDetails &details) const
+{
+  bool found = false;
+
+  Symbol symKey = {address, 0, NULL};
+  auto sym = std::upper_bound(m_Symbols.begin(), m_Symbols.end(), symKey);
+
+  if(sym != m_Symbols.begin())
+  {
+    --sym;
+
+    // symbols without a size run until the next one
+    if(sym->size == 0 || address - sym->address < sym->size)
+    {
+      int status = 0;
+      char *demangled = abi::__cxa_demangle(sym->name, NULL, NULL, &status);
+
+      details.function = (status == 0 && demangled) ? demangled : sym->name;
+      free(demangled);
+
+      found = true;
+    }
+  }
+
+  LineRow lineKey = {address, 0, 0};
+  auto row = std::upper_bound(m_Lines.begin(), m_Lines.end(), lineKey);
+
+  if(row != m_Lines.begin())
+  {
+    --row;
+
+    if(row->file != EndOfSequence)
+    {
+      details.filename = m_Filenames[row->file];
+      details.line = row->line;
+      found = true;
+    }
+  }
+
+  return found;
+}
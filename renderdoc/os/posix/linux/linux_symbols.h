@@ -0,0 +1,208 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "os/os_specific.h"
+
+// bounds-checked reads from a DWARF section. Reading past the end leaves the reader at the end and
+// returns zero, so a truncated or corrupt section just stops parsing early.
+struct DWARFReader
+{
+  DWARFReader(const byte *data, uint64_t size) : cur(data), end(data + size) {}
+  bool AtEnd() const { return cur >= end; }
+  uint64_t Remaining() const { return uint64_t(end - cur); }
+  template <typename T>
+  T Read()
+  {
+    T ret = T();
+    if(Remaining() < sizeof(T))
+    {
+      cur = end;
+      return ret;
+    }
+    memcpy(&ret, cur, sizeof(T));
+    cur += sizeof(T);
+    return ret;
+  }
+
+  uint64_t ReadSized(uint64_t size)
+  {
+    switch(size)
+    {
+      case 1: return Read<uint8_t>();
+      case 2: return Read<uint16_t>();
+      case 4: return Read<uint32_t>();
+      case 8: return Read<uint64_t>();
+      default: Skip(size); return 0;
+    }
+  }
+
+  uint64_t ReadOffset(bool dwarf64) { return dwarf64 ? Read<uint64_t>() : Read<uint32_t>(); }
+  uint64_t ReadULEB()
+  {
+    uint64_t ret = 0;
+    uint32_t shift = 0;
+    while(cur < end)
+    {
+      byte b = *(cur++);
+      if(shift < 64)
+        ret |= uint64_t(b & 0x7f) << shift;
+      shift += 7;
+      if((b & 0x80) == 0)
+        break;
+    }
+    return ret;
+  }
+
+  int64_t ReadSLEB()
+  {
+    uint64_t ret = 0;
+    uint32_t shift = 0;
+    byte b = 0;
+    while(cur < end)
+    {
+      b = *(cur++);
+      if(shift < 64)
+        ret |= uint64_t(b & 0x7f) << shift;
+      shift += 7;
+      if((b & 0x80) == 0)
+        break;
+    }
+    if(shift < 64 && (b & 0x40))
+      ret |= ~0ULL << shift;
+    return (int64_t)ret;
+  }
+
+  const char *ReadString()
+  {
+    const byte *nul = (const byte *)memchr(cur, 0, (size_t)Remaining());
+    if(nul == NULL)
+    {
+      cur = end;
+      return "";
+    }
+    const char *ret = (const char *)cur;
+    cur = nul + 1;
+    return ret;
+  }
+
+  void Skip(uint64_t bytes) { cur = bytes > Remaining() ? end : cur + bytes; }
+  const byte *cur;
+  const byte *end;
+};
+
+// Function and source line lookup for a single ELF file, read in-process rather than by running
+// addr2line. On construction the file is mapped, its .symtab (or .dynsym) functions and DWARF
+// .debug_line programs are parsed once into address-sorted tables, and separate debug files are
+// found through the build-id or .gnu_debuglink. Afterwards the object is read-only, so Resolve can
+// be called from any number of threads at once.
+class ELFSymbols
+{
+public:
+  ELFSymbols(const char *path);
+  ~ELFSymbols();
+
+  // true if the file was a readable ELF, even if it had no symbols
+  bool IsValid() const { return m_Valid; }
+  // converts an offset into the file, as listed in /proc/<pid>/maps, into the virtual address it
+  // is linked at.
+  bool FileOffsetToAddress(uint64_t offset, uint64_t &address) const;
+
+  // fills in whichever of function, filename & line are known for the linked address. Returns
+  // false if neither a function nor a line was found.
+  bool Resolve(uint64_t address, Callstack::AddressDetails &details) const;
+
+private:
+  struct MappedFile
+  {
+    const byte *data;
+    uint64_t size;
+    void *handle;
+  };
+
+  struct Segment
+  {
+    uint64_t offset;
+    uint64_t filesize;
+    uint64_t address;
+  };
+
+  struct Symbol
+  {
+    uint64_t address;
+    uint64_t size;
+    const char *name;
+
+    bool operator<(const Symbol &o) const { return address < o.address; }
+  };
+
+  // one row of the line table. Rows with file == EndOfSequence mark the first address past the end
+  // of a sequence, where no line information exists.
+  struct LineRow
+  {
+    uint64_t address;
+    uint32_t file;
+    uint32_t line;
+
+    bool operator<(const LineRow &o) const { return address < o.address; }
+  };
+
+  static const uint32_t EndOfSequence = ~0U;
+
+  struct SectionData
+  {
+    const byte *data;
+    uint64_t size;
+  };
+
+  struct Sections;
+
+  const byte *MapFile(const char *path, uint64_t &size);
+  static bool ParseELF(const byte *data, uint64_t size, Sections &sections);
+  template <typename Ehdr, typename Shdr, typename Phdr>
+  static bool ReadSections(const byte *data, uint64_t size, Sections &sections);
+  static std::string FindDebugFile(const char *path, const Sections &sections);
+
+  template <typename Sym>
+  void AddSymbols(SectionData symbols, SectionData strings);
+  void AddLines(const Sections &sections);
+  uint32_t AddFilename(const char *dir, const char *name);
+
+  std::vector<MappedFile> m_Files;
+
+  std::vector<Segment> m_Segments;
+  std::vector<Symbol> m_Symbols;
+  std::vector<LineRow> m_Lines;
+  std::vector<std::string> m_Filenames;
+  // only used while parsing, to share filenames between compilation units
+  std::map<std::string, uint32_t> m_FilenameLookup;
+
+  bool m_Valid;
+};
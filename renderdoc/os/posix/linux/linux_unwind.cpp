@@ -0,0 +1,789 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "linux_unwind.h"
+
+#if defined(__x86_64__)
+
+#include <link.h>
+#include <pthread.h>
+#include <string.h>
+#include "common/common.h"
+#include "linux_symbols.h"
+
+namespace
+{
+// DWARF register numbers on x86-64
+enum
+{
+  DW_REG_RBP = 6,
+  DW_REG_RSP = 7,
+  DW_REG_RA = 16,
+};
+
+// the subset of call frame instructions and pointer encodings used by .eh_frame
+enum
+{
+  DW_CFA_advance_loc = 0x40,
+  DW_CFA_offset = 0x80,
+  DW_CFA_restore = 0xc0,
+
+  DW_CFA_nop = 0x00,
+  DW_CFA_set_loc = 0x01,
+  DW_CFA_advance_loc1 = 0x02,
+  DW_CFA_advance_loc2 = 0x03,
+  DW_CFA_advance_loc4 = 0x04,
+  DW_CFA_offset_extended = 0x05,
+  DW_CFA_restore_extended = 0x06,
+  DW_CFA_undefined = 0x07,
+  DW_CFA_same_value = 0x08,
+  DW_CFA_register = 0x09,
+  DW_CFA_remember_state = 0x0a,
+  DW_CFA_restore_state = 0x0b,
+  DW_CFA_def_cfa = 0x0c,
+  DW_CFA_def_cfa_register = 0x0d,
+  DW_CFA_def_cfa_offset = 0x0e,
+  DW_CFA_def_cfa_expression = 0x0f,
+  DW_CFA_expression = 0x10,
+  DW_CFA_offset_extended_sf = 0x11,
+  DW_CFA_def_cfa_sf = 0x12,
+  DW_CFA_def_cfa_offset_sf = 0x13,
+  DW_CFA_val_offset = 0x14,
+  DW_CFA_val_offset_sf = 0x15,
+  DW_CFA_val_expression = 0x16,
+  DW_CFA_GNU_args_size = 0x2e,
+  DW_CFA_GNU_negative_offset_extended = 0x2f,
+
+  DW_EH_PE_absptr = 0x00,
+  DW_EH_PE_uleb128 = 0x01,
+  DW_EH_PE_udata2 = 0x02,
+  DW_EH_PE_udata4 = 0x03,
+  DW_EH_PE_udata8 = 0x04,
+  DW_EH_PE_sleb128 = 0x09,
+  DW_EH_PE_sdata2 = 0x0a,
+  DW_EH_PE_sdata4 = 0x0b,
+  DW_EH_PE_sdata8 = 0x0c,
+  DW_EH_PE_pcrel = 0x10,
+  DW_EH_PE_datarel = 0x30,
+  DW_EH_PE_indirect = 0x80,
+  DW_EH_PE_omit = 0xff,
+};
+
+// .eh_frame lives in mapped memory with no size of its own, so records are read with a reader
+// bounded by their own length field.
+const uint64_t UnboundedRead = 1 << 20;
+
+bool ReadEncoded(DWARFReader &reader, uint8_t encoding, uint64_t dataBase, uint64_t &val)
+{
+  if(encoding == DW_EH_PE_omit)
+  {
+    val = 0;
+    return true;
+  }
+
+  uint64_t fieldAddress = (uint64_t)reader.cur;
+
+  switch(encoding & 0x0f)
+  {
+    case DW_EH_PE_absptr: val = reader.Read<uint64_t>(); break;
+    case DW_EH_PE_uleb128: val = reader.ReadULEB(); break;
+    case DW_EH_PE_udata2: val = reader.Read<uint16_t>(); break;
+    case DW_EH_PE_udata4: val = reader.Read<uint32_t>(); break;
+    case DW_EH_PE_udata8: val = reader.Read<uint64_t>(); break;
+    case DW_EH_PE_sleb128: val = (uint64_t)reader.ReadSLEB(); break;
+    case DW_EH_PE_sdata2: val = (uint64_t)(int64_t)reader.Read<int16_t>(); break;
+    case DW_EH_PE_sdata4: val = (uint64_t)(int64_t)reader.Read<int32_t>(); break;
+    case DW_EH_PE_sdata8: val = reader.Read<uint64_t>(); break;
+    default: return false;
+  }
+
+  switch(encoding & 0x70)
+  {
+    case DW_EH_PE_absptr: break;
+    case DW_EH_PE_pcrel: val += fieldAddress; break;
+    case DW_EH_PE_datarel: val += dataBase; break;
+    default: return false;
+  }
+
+  if(encoding & DW_EH_PE_indirect)
+    val = *(const uint64_t *)val;
+
+  return true;
+}
+
+struct CIEInfo
+{
+  CIEInfo() : instructions(NULL, 0) {}
+  uint64_t codeAlign;
+  int64_t dataAlign;
+  uint8_t fdeEncoding;
+  bool hasAugmentationData;
+  DWARFReader instructions;
+};
+
+// how the caller's value of a register is recovered. Only RBP and the return address are tracked,
+// every other register is irrelevant to stepping a frame.
+struct RegisterRule
+{
+  enum Type
+  {
+    SameValue,
+    AtCFAOffset,
+    Undefined,
+    Unsupported,
+  };
+
+  Type type;
+  int64_t offset;
+};
+
+struct FrameState
+{
+  uint64_t cfaRegister;
+  int64_t cfaOffset;
+  bool cfaExpression;
+  RegisterRule rbp;
+  RegisterRule ra;
+};
+
+void SetRegisterRule(FrameState &state, uint64_t reg, RegisterRule::Type type, int64_t offset = 0)
+{
+  RegisterRule rule = {type, offset};
+
+  if(reg == DW_REG_RBP)
+    state.rbp = rule;
+  else if(reg == DW_REG_RA)
+    state.ra = rule;
+}
+
+void RestoreRegisterRule(FrameState &state, uint64_t reg, const FrameState *initial)
+{
+  if(initial == NULL)
+    SetRegisterRule(state, reg, RegisterRule::SameValue);
+  else if(reg == DW_REG_RBP)
+    state.rbp = initial->rbp;
+  else if(reg == DW_REG_RA)
+    state.ra = initial->ra;
+}
+
+bool ParseCIE(const byte *cie, CIEInfo &info)
+{
+  DWARFReader reader(cie, UnboundedRead);
+
+  uint64_t length = reader.Read<uint32_t>();
+  bool dwarf64 = (length == 0xffffffff);
+  if(dwarf64)
+    length = reader.Read<uint64_t>();
+
+  if(length == 0)
+    return false;
+
+  reader = DWARFReader(reader.cur, length);
+
+  if(reader.ReadOffset(dwarf64) != 0)
+    return false;
+
+  uint8_t version = reader.Read<uint8_t>();
+  if(version != 1 && version != 3)
+    return false;
+
+  const char *augmentation = reader.ReadString();
+
+  if(strstr(augmentation, "eh"))
+    reader.Read<uint64_t>();
+
+  info.codeAlign = reader.ReadULEB();
+  info.dataAlign = reader.ReadSLEB();
+
+  if(version == 1)
+    reader.Read<uint8_t>();
+  else
+    reader.ReadULEB();
+
+  info.fdeEncoding = DW_EH_PE_absptr;
+  info.hasAugmentationData = (augmentation[0] == 'z');
+
+  if(info.hasAugmentationData)
+  {
+    uint64_t augLength = reader.ReadULEB();
+    DWARFReader augData(reader.cur, augLength);
+    reader.Skip(augLength);
+
+    for(const char *c = augmentation + 1; *c; c++)
+    {
+      if(*c == 'R')
+      {
+        info.fdeEncoding = augData.Read<uint8_t>();
+      }
+      else if(*c == 'P')
+      {
+        uint64_t personality = 0;
+        if(!ReadEncoded(augData, augData.Read<uint8_t>(), 0, personality))
+          return false;
+      }
+      else if(*c == 'L')
+      {
+        augData.Read<uint8_t>();
+      }
+      else if(*c != 'S' && *c != 'B')
+      {
+        return false;
+      }
+    }
+  }
+
+  info.instructions = reader;
+
+  return true;
+}
+
+// runs call frame instructions until the location passes pc. initial is NULL while running the
+// CIE's own instructions, and otherwise is the state they produced.
+bool Execute(DWARFReader reader, const CIEInfo &cie, uint64_t loc, uint64_t pc, FrameState &state,
+             const FrameState *initial)
+{
+  FrameState remembered[8];
+  int numRemembered = 0;
+
+  while(!reader.AtEnd())
+  {
+    uint8_t op = reader.Read<uint8_t>();
+    uint8_t operand = op & 0x3f;
+
+    switch(op & 0xc0)
+    {
+      case DW_CFA_advance_loc:
+        loc += operand * cie.codeAlign;
+        if(loc > pc)
+          return true;
+        continue;
+      case DW_CFA_offset:
+        SetRegisterRule(state, operand, RegisterRule::AtCFAOffset,
+                        (int64_t)reader.ReadULEB() * cie.dataAlign);
+        continue;
+      case DW_CFA_restore: RestoreRegisterRule(state, operand, initial); continue;
+      default: break;
+    }
+
+    uint64_t reg = 0;
+
+    switch(op)
+    {
+      case DW_CFA_nop: break;
+      case DW_CFA_set_loc:
+        if(!ReadEncoded(reader, cie.fdeEncoding, 0, loc))
+          return false;
+        if(loc > pc)
+          return true;
+        break;
+      case DW_CFA_advance_loc1:
+      case DW_CFA_advance_loc2:
+      case DW_CFA_advance_loc4:
+        if(op == DW_CFA_advance_loc1)
+          loc += reader.Read<uint8_t>() * cie.codeAlign;
+        else if(op == DW_CFA_advance_loc2)
+          loc += reader.Read<uint16_t>() * cie.codeAlign;
+        else
+          loc += reader.Read<uint32_t>() * cie.codeAlign;
+        if(loc > pc)
+          return true;
+        break;
+      case DW_CFA_offset_extended:
+        reg = reader.ReadULEB();
+        SetRegisterRule(state, reg, RegisterRule::AtCFAOffset,
+                        (int64_t)reader.ReadULEB() * cie.dataAlign);
+        break;
+      case DW_CFA_offset_extended_sf:
+        reg = reader.ReadULEB();
+        SetRegisterRule(state, reg, RegisterRule::AtCFAOffset, reader.ReadSLEB() * cie.dataAlign);
+        break;
+      case DW_CFA_GNU_negative_offset_extended:
+        reg = reader.ReadULEB();
+        SetRegisterRule(state, reg, RegisterRule::AtCFAOffset,
+                        -(int64_t)reader.ReadULEB() * cie.dataAlign);
+        break;
+      case DW_CFA_restore_extended: RestoreRegisterRule(state, reader.ReadULEB(), initial); break;
+      case DW_CFA_undefined:
+        SetRegisterRule(state, reader.ReadULEB(), RegisterRule::Undefined);
+        break;
+      case DW_CFA_same_value:
+        SetRegisterRule(state, reader.ReadULEB(), RegisterRule::SameValue);
+        break;
+      case DW_CFA_register:
+        reg = reader.ReadULEB();
+        reader.ReadULEB();
+        SetRegisterRule(state, reg, RegisterRule::Unsupported);
+        break;
+      case DW_CFA_remember_state:
+        if(numRemembered == ARRAY_COUNT(remembered))
+          return false;
+        remembered[numRemembered++] = state;
+        break;
+      case DW_CFA_restore_state:
+        if(numRemembered == 0)
+          return false;
+        state = remembered[--numRemembered];
+        break;
+      case DW_CFA_def_cfa:
+        state.cfaRegister = reader.ReadULEB();
+        state.cfaOffset = (int64_t)reader.ReadULEB();
+        state.cfaExpression = false;
+        break;
+      case DW_CFA_def_cfa_sf:
+        state.cfaRegister = reader.ReadULEB();
+        state.cfaOffset = reader.ReadSLEB() * cie.dataAlign;
+        state.cfaExpression = false;
+        break;
+      case DW_CFA_def_cfa_register:
+        state.cfaRegister = reader.ReadULEB();
+        state.cfaExpression = false;
+        break;
+      case DW_CFA_def_cfa_offset: state.cfaOffset = (int64_t)reader.ReadULEB(); break;
+      case DW_CFA_def_cfa_offset_sf: state.cfaOffset = reader.ReadSLEB() * cie.dataAlign; break;
+      case DW_CFA_def_cfa_expression:
+        state.cfaExpression = true;
+        reader.Skip(reader.ReadULEB());
+        break;
+      case DW_CFA_expression:
+      case DW_CFA_val_expression:
+        reg = reader.ReadULEB();
+        reader.Skip(reader.ReadULEB());
+        SetRegisterRule(state, reg, RegisterRule::Unsupported);
+        break;
+      case DW_CFA_val_offset:
+      case DW_CFA_val_offset_sf:
+        reg = reader.ReadULEB();
+        if(op == DW_CFA_val_offset)
+          reader.ReadULEB();
+        else
+          reader.ReadSLEB();
+        SetRegisterRule(state, reg, RegisterRule::Unsupported);
+        break;
+      case DW_CFA_GNU_args_size: reader.ReadULEB(); break;
+      default: return false;
+    }
+  }
+
+  return true;
+}
+
+// the rule for stepping over one frame, as cached for each return address
+struct UnwindRule
+{
+  enum
+  {
+    Cached = 0x1,
+    Valid = 0x2,
+    RestoresRBP = 0x4,
+    EndOfStack = 0x8,
+  };
+
+  uint64_t pc;
+  int32_t cfaOffset;
+  int16_t raOffset;
+  int16_t rbpOffset;
+  uint8_t cfaRegister;
+  uint8_t flags;
+};
+
+struct FindEHFrameHeader
+{
+  uint64_t pc;
+  const byte *header;
+};
+
+int FindEHFrameHeaderCallback(struct dl_phdr_info *info, size_t size, void *data)
+{
+  FindEHFrameHeader *find = (FindEHFrameHeader *)data;
+
+  const ElfW(Phdr) *ehFrameHeader = NULL;
+  bool contains = false;
+
+  for(ElfW(Half) i = 0; i < info->dlpi_phnum; i++)
+  {
+    const ElfW(Phdr) &phdr = info->dlpi_phdr[i];
+
+    if(phdr.p_type == PT_LOAD)
+    {
+      uint64_t start = info->dlpi_addr + phdr.p_vaddr;
+      if(find->pc >= start && find->pc < start + phdr.p_memsz)
+        contains = true;
+    }
+    else if(phdr.p_type == PT_GNU_EH_FRAME)
+    {
+      ehFrameHeader = &phdr;
+    }
+  }
+
+  if(!contains)
+    return 0;
+
+  if(ehFrameHeader)
+    find->header = (const byte *)(info->dlpi_addr + ehFrameHeader->p_vaddr);
+
+  return 1;
+}
+
+// looks up the FDE covering pc in the binary search table of its module's .eh_frame_hdr
+const byte *FindFDE(uint64_t pc)
+{
+  FindEHFrameHeader find = {pc, NULL};
+  dl_iterate_phdr(&FindEHFrameHeaderCallback, &find);
+
+  const byte *header = find.header;
+
+  // only the sorted table format that linkers actually emit is handled
+  if(header == NULL || header[0] != 1 || header[2] == DW_EH_PE_omit ||
+     header[3] != (DW_EH_PE_datarel | DW_EH_PE_sdata4))
+    return NULL;
+
+  DWARFReader reader(header + 4, UnboundedRead);
+
+  uint64_t ehFrame = 0, count = 0;
+  if(!ReadEncoded(reader, header[1], (uint64_t)header, ehFrame) ||
+     !ReadEncoded(reader, header[2], (uint64_t)header, count))
+    return NULL;
+
+  const int32_t *table = (const int32_t *)reader.cur;
+
+  // find the last entry starting at or before pc
+  uint64_t lo = 0, hi = count;
+  while(lo < hi)
+  {
+    uint64_t mid = (lo + hi) / 2;
+    if((uint64_t)header + table[mid * 2] <= pc)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if(lo == 0)
+    return NULL;
+
+  return header + table[(lo - 1) * 2 + 1];
+}
+
+void CalculateRule(uint64_t pc, UnwindRule &rule)
+{
+  rule.flags = UnwindRule::Cached;
+
+  const byte *fde = FindFDE(pc);
+  if(fde == NULL)
+    return;
+
+  DWARFReader reader(fde, UnboundedRead);
+
+  uint64_t length = reader.Read<uint32_t>();
+  bool dwarf64 = (length == 0xffffffff);
+  if(dwarf64)
+    length = reader.Read<uint64_t>();
+
+  if(length == 0)
+    return;
+
+  reader = DWARFReader(reader.cur, length);
+
+  const byte *ciePointer = reader.cur;
+  uint64_t cieOffset = reader.ReadOffset(dwarf64);
+
+  CIEInfo cie;
+  if(cieOffset == 0 || !ParseCIE(ciePointer - cieOffset, cie))
+    return;
+
+  uint64_t pcBegin = 0, pcRange = 0;
+  if(!ReadEncoded(reader, cie.fdeEncoding, 0, pcBegin) ||
+     !ReadEncoded(reader, cie.fdeEncoding & 0x0f, 0, pcRange))
+    return;
+
+  if(pc < pcBegin || pc >= pcBegin + pcRange)
+    return;
+
+  if(cie.hasAugmentationData)
+    reader.Skip(reader.ReadULEB());
+
+  FrameState initial;
+  initial.cfaRegister = DW_REG_RSP;
+  initial.cfaOffset = 8;
+  initial.cfaExpression = false;
+  initial.rbp.type = RegisterRule::SameValue;
+  initial.rbp.offset = 0;
+  initial.ra.type = RegisterRule::AtCFAOffset;
+  initial.ra.offset = -8;
+
+  if(!Execute(cie.instructions, cie, pcBegin, ~0ULL, initial, NULL))
+    return;
+
+  FrameState state = initial;
+  if(!Execute(reader, cie, pcBegin, pc, state, &initial))
+    return;
+
+  if(state.ra.type == RegisterRule::Undefined)
+  {
+    rule.flags |= UnwindRule::EndOfStack;
+    return;
+  }
+
+  if(state.cfaExpression || (state.cfaRegister != DW_REG_RSP && state.cfaRegister != DW_REG_RBP) ||
+     state.ra.type != RegisterRule::AtCFAOffset || state.rbp.type == RegisterRule::Unsupported ||
+     state.rbp.type == RegisterRule::Undefined)
+    return;
+
+  if(state.cfaOffset != (int32_t)state.cfaOffset || state.ra.offset != (int16_t)state.ra.offset ||
+     state.rbp.offset != (int16_t)state.rbp.offset)
+    return;
+
+  rule.cfaRegister = (uint8_t)state.cfaRegister;
+  rule.cfaOffset = (int32_t)state.cfaOffset;
+  rule.raOffset = (int16_t)state.ra.offset;
+  rule.rbpOffset = (int16_t)state.rbp.offset;
+  rule.flags |= UnwindRule::Valid;
+
+  if(state.rbp.type == RegisterRule::AtCFAOffset)
+    rule.flags |= UnwindRule::RestoresRBP;
+}
+
+// 1024 rules covers the distinct return addresses of a typical application's API calls many times
+// over, and a collision only costs recalculating one rule.
+const uint32_t RuleCacheBits = 10;
+
+struct ThreadState
+{
+  uint64_t stackLow;
+  uint64_t stackHigh;
+  UnwindRule *rules;
+
+  bool InStack(uint64_t address, uint64_t size) const
+  {
+    return address >= stackLow && address < stackHigh && stackHigh - address >= size;
+  }
+
+  const UnwindRule &GetRule(uint64_t pc)
+  {
+    if(rules == NULL)
+    {
+      rules = new UnwindRule[1 << RuleCacheBits];
+      memset(rules, 0, sizeof(UnwindRule) << RuleCacheBits);
+    }
+
+    UnwindRule &rule = rules[(pc * 0x9E3779B97F4A7C15ULL) >> (64 - RuleCacheBits)];
+
+    if(rule.pc != pc || (rule.flags & UnwindRule::Cached) == 0)
+    {
+      rule.pc = pc;
+      CalculateRule(pc, rule);
+    }
+
+    return rule;
+  }
+
+  // true if the function returned to at ra keeps its frame in rbp, so the saved chain is sound
+  bool UsesFramePointer(uint64_t ra)
+  {
+    const UnwindRule &rule = GetRule(ra - 1);
+    return (rule.flags & UnwindRule::Valid) && rule.cfaRegister == DW_REG_RBP;
+  }
+};
+
+pthread_key_t threadStateKey;
+pthread_once_t threadStateOnce = PTHREAD_ONCE_INIT;
+
+void DeleteThreadState(void *data)
+{
+  ThreadState *state = (ThreadState *)data;
+  delete[] state->rules;
+  delete state;
+}
+
+void CreateThreadStateKey()
+{
+  pthread_key_create(&threadStateKey, &DeleteThreadState);
+}
+
+ThreadState *GetThreadState()
+{
+  pthread_once(&threadStateOnce, &CreateThreadStateKey);
+
+  ThreadState *state = (ThreadState *)pthread_getspecific(threadStateKey);
+
+  if(state == NULL)
+  {
+    state = new ThreadState();
+    state->stackLow = state->stackHigh = 0;
+    state->rules = NULL;
+
+    pthread_attr_t attr;
+    if(pthread_getattr_np(pthread_self(), &attr) == 0)
+    {
+      void *base = NULL;
+      size_t size = 0;
+      if(pthread_attr_getstack(&attr, &base, &size) == 0)
+      {
+        state->stackLow = (uint64_t)base;
+        state->stackHigh = (uint64_t)base + size;
+      }
+      pthread_attr_destroy(&attr);
+    }
+
+    pthread_setspecific(threadStateKey, state);
+  }
+
+  return state;
+}
+
+// steps one frame out from ip, using the function's .eh_frame rule if it has one we can follow or
+// otherwise assuming a standard frame pointer. first is set for the innermost frame, where ip is
+// exact rather than a return address. Returns false at the end of the stack or on a bad frame.
+bool StepFrame(ThreadState *state, bool first, uint64_t &ip, uint64_t &sp, uint64_t &fp)
+{
+  // after the first frame ip is a return address, which may be the first byte after the end of
+  // the calling function, so look up the call instruction instead.
+  const UnwindRule &rule = state->GetRule(first ? ip : ip - 1);
+
+  uint64_t cfa = 0, ra = 0;
+
+  if(rule.flags & UnwindRule::Valid)
+  {
+    cfa = (rule.cfaRegister == DW_REG_RBP ? fp : sp) + rule.cfaOffset;
+
+    if(!state->InStack(cfa + rule.raOffset, 8))
+      return false;
+
+    ra = *(const uint64_t *)(cfa + rule.raOffset);
+
+    if(rule.flags & UnwindRule::RestoresRBP)
+    {
+      if(!state->InStack(cfa + rule.rbpOffset, 8))
+        return false;
+
+      fp = *(const uint64_t *)(cfa + rule.rbpOffset);
+    }
+  }
+  else if(rule.flags & UnwindRule::EndOfStack)
+  {
+    return false;
+  }
+  else
+  {
+    // no rule we can follow, assume the function set up a standard frame pointer
+    if((fp & 7) != 0 || fp < sp || !state->InStack(fp, 16))
+      return false;
+
+    const uint64_t *frame = (const uint64_t *)fp;
+    cfa = fp + 16;
+    ra = frame[1];
+    fp = frame[0];
+  }
+
+  if(ra == 0 || cfa <= sp)
+    return false;
+
+  sp = cfa;
+  ip = ra;
+
+  return true;
+}
+};
+
+#define GET_REGISTERS(ip, sp, fp)    \
+  __asm__ volatile(                  \
+      "lea 0(%%rip), %0\n\t"         \
+      "mov %%rsp, %1\n\t"            \
+      "mov %%rbp, %2"                \
+      : "=r"(ip), "=r"(sp), "=r"(fp))
+
+namespace Unwind
+{
+__attribute__((noinline)) int FramePointers(uint64_t *addrs, int maxLevels, uint64_t skipBase,
+                                            uint64_t skipEnd)
+{
+  ThreadState *state = GetThreadState();
+
+  uint64_t ip = 0, sp = 0, fp = 0;
+  GET_REGISTERS(ip, sp, fp);
+
+  int numLevels = 0;
+
+  // the skipped module isn't built with frame pointers, so rbp holds whatever it was last used
+  // for. Step out of it with the unwind tables, until we reach a function that addresses its frame
+  // through rbp, before trusting the chain.
+  do
+  {
+    if(numLevels >= maxLevels || !StepFrame(state, numLevels == 0, ip, sp, fp))
+      return numLevels;
+
+    addrs[numLevels++] = ip;
+  } while((ip >= skipBase && ip < skipEnd) || !state->UsesFramePointer(ip));
+
+  while(numLevels < maxLevels && (fp & 7) == 0 && fp >= sp && state->InStack(fp, 16))
+  {
+    const uint64_t *frame = (const uint64_t *)fp;
+
+    if(frame[1] == 0)
+      break;
+
+    addrs[numLevels++] = frame[1];
+
+    // frames must move strictly up the stack, otherwise the chain is corrupt
+    if(frame[0] <= fp)
+      break;
+
+    fp = frame[0];
+  }
+
+  return numLevels;
+}
+
+__attribute__((noinline)) int EHFrame(uint64_t *addrs, int maxLevels)
+{
+  ThreadState *state = GetThreadState();
+
+  uint64_t ip = 0, sp = 0, fp = 0;
+  GET_REGISTERS(ip, sp, fp);
+
+  int numLevels = 0;
+
+  while(numLevels < maxLevels && StepFrame(state, numLevels == 0, ip, sp, fp))
+    addrs[numLevels++] = ip;
+
+  return numLevels;
+}
+};
+
+#else
+
+namespace Unwind
+{
+int FramePointers(uint64_t *addrs, int maxLevels, uint64_t skipBase, uint64_t skipEnd)
+{
+  return 0;
+}
+
+int EHFrame(uint64_t *addrs, int maxLevels)
+{
+  return 0;
+}
+};
+
+#endif
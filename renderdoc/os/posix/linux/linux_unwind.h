@@ -0,0 +1,49 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <stdint.h>
+
+// Cheaper alternatives to backtrace() for collecting callstacks at capture time. Both write the
+// return addresses of the calling thread's stack, innermost first starting with the caller of the
+// function, and return how many were written. They only ever read memory inside the current
+// thread's stack, so a corrupt or missing frame ends the walk early rather than crashing.
+//
+// Only x86-64 is supported, on other architectures both return 0 and the caller should fall back
+// to backtrace().
+namespace Unwind
+{
+// follows the saved frame pointer chain. This costs a couple of loads per frame, but the walk stops
+// at the first function that was compiled without frame pointers. Frames in [skipBase, skipEnd),
+// i.e. RenderDoc's own module which is built without them, are first stepped out of as EHFrame
+// does, and so is every frame after them until one that keeps its frame pointer.
+int FramePointers(uint64_t *addrs, int maxLevels, uint64_t skipBase, uint64_t skipEnd);
+
+// steps frames using the rules in each module's .eh_frame, like the C++ exception unwinder. The
+// rule for each return address is looked up once and cached per thread, so a repeated stack only
+// costs a cache lookup per frame. Frames with rules it can't follow fall back to the frame pointer.
+int EHFrame(uint64_t *addrs, int maxLevels);
+};
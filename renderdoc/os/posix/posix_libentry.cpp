@@ -44,7 +44,8 @@ void library_loaded()
 
   if(curfile.find("/renderdoccmd") != string::npos ||
      curfile.find("/renderdocui") != string::npos || curfile.find("/qrenderdoc") != string::npos ||
-     curfile.find("org.renderdoc.renderdoccmd") != string::npos)
+     curfile.find("org.renderdoc.renderdoccmd") != string::npos ||
+     curfile.find("/renderdoc-bench") != string::npos)
   {
     RDCDEBUG("Not creating hooks - in replay app");
 
@@ -573,3 +573,9 @@ uint32_t Process::GetCurrentPID()
 {
   return (uint32_t)getpid();
 }
+
+string Process::GetEnvVariable(const char *name)
+{
+  const char *val = getenv(name);
+  return val ? string(val) : string();
+}
@@ -58,6 +58,7 @@ struct pthreadLockData
   pthread_mutexattr_t attr;
 };
 typedef CriticalSectionTemplate<pthreadLockData> CriticalSection;
+typedef ConditionVariableTemplate<pthread_cond_t, CriticalSection> ConditionVariable;
 };
 
 namespace Bits
@@ -31,6 +31,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <time.h>
@@ -246,11 +247,53 @@ void Copy(const char *from, const char *to, bool allowOverwrite)
   ::fclose(tf);
 }
 
+bool Move(const char *from, const char *to)
+{
+  return ::rename(from, to) == 0;
+}
+
 void Delete(const char *path)
 {
   unlink(path);
 }
 
+const void *MapFile(const char *filename, uint64_t &size, void *&handle)
+{
+  size = 0;
+  handle = NULL;
+
+  int fd = open(filename, O_RDONLY);
+
+  if(fd < 0)
+    return NULL;
+
+  struct stat st;
+
+  if(fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    close(fd);
+    return NULL;
+  }
+
+  void *ptr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  // the mapping holds its own reference to the file
+  close(fd);
+
+  if(ptr == MAP_FAILED)
+    return NULL;
+
+  size = (uint64_t)st.st_size;
+
+  return ptr;
+}
+
+void UnmapFile(const void *ptr, uint64_t size, void *handle)
+{
+  if(ptr)
+    munmap((void *)ptr, (size_t)size);
+}
+
 vector<FoundFile> GetFilesInDirectory(const char *path)
 {
   vector<FoundFile> ret;
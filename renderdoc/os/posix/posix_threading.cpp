@@ -101,6 +101,36 @@ void CriticalSection::Unlock()
   pthread_mutex_unlock(&m_Data.lock);
 }
 
+template <>
+ConditionVariable::ConditionVariableTemplate()
+{
+  pthread_cond_init(&m_Data, NULL);
+}
+
+template <>
+ConditionVariable::~ConditionVariableTemplate()
+{
+  pthread_cond_destroy(&m_Data);
+}
+
+template <>
+void ConditionVariable::Wait(CriticalSection &cs)
+{
+  pthread_cond_wait(&m_Data, &cs.m_Data.lock);
+}
+
+template <>
+void ConditionVariable::WakeOne()
+{
+  pthread_cond_signal(&m_Data);
+}
+
+template <>
+void ConditionVariable::WakeAll()
+{
+  pthread_cond_broadcast(&m_Data);
+}
+
 struct ThreadInitData
 {
   ThreadEntry entryFunc;
@@ -245,4 +275,10 @@ void Sleep(uint32_t milliseconds)
 {
   usleep(milliseconds * 1000);
 }
+
+uint32_t NumberOfCores()
+{
+  long ret = sysconf(_SC_NPROCESSORS_ONLN);
+  return ret > 1 ? (uint32_t)ret : 1;
+}
 };
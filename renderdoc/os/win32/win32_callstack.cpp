@@ -780,6 +780,10 @@ void Init()
   ::InitDbgHelp();
 }
 
+void SetUnwinder(uint32_t unwinder)
+{
+}
+
 Stackwalk *Collect()
 {
   return new Win32Callstack();
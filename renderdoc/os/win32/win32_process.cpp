@@ -1092,3 +1092,19 @@ uint32_t Process::GetCurrentPID()
 {
   return (uint32_t)GetCurrentProcessId();
 }
+
+string Process::GetEnvVariable(const char *name)
+{
+  wstring wname = StringFormat::UTF82Wide(string(name));
+
+  DWORD len = GetEnvironmentVariableW(wname.c_str(), NULL, 0);
+  if(len == 0)
+    return string();
+
+  wstring value;
+  value.resize(len);
+  len = GetEnvironmentVariableW(wname.c_str(), &value[0], len);
+  value.resize(len);
+
+  return StringFormat::Wide2UTF8(value);
+}
@@ -62,6 +62,7 @@ void WriteOutput(int channel, const char *str);
 namespace Threading
 {
 typedef CriticalSectionTemplate<CRITICAL_SECTION> CriticalSection;
+typedef ConditionVariableTemplate<CONDITION_VARIABLE, CriticalSection> ConditionVariable;
 };
 
 namespace Bits
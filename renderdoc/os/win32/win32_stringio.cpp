@@ -341,12 +341,72 @@ void Copy(const char *from, const char *to, bool allowOverwrite)
   ::CopyFileW(wfrom.c_str(), wto.c_str(), allowOverwrite == false);
 }
 
+bool Move(const char *from, const char *to)
+{
+  wstring wfrom = StringFormat::UTF82Wide(string(from));
+  wstring wto = StringFormat::UTF82Wide(string(to));
+
+  return ::MoveFileExW(wfrom.c_str(), wto.c_str(), MOVEFILE_REPLACE_EXISTING) == TRUE;
+}
+
 void Delete(const char *path)
 {
   wstring wpath = StringFormat::UTF82Wide(string(path));
   ::DeleteFileW(wpath.c_str());
 }
 
+const void *MapFile(const char *filename, uint64_t &size, void *&handle)
+{
+  size = 0;
+  handle = NULL;
+
+  wstring wfn = StringFormat::UTF82Wide(string(filename));
+
+  HANDLE file = ::CreateFileW(wfn.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+  if(file == INVALID_HANDLE_VALUE)
+    return NULL;
+
+  LARGE_INTEGER len;
+
+  if(!::GetFileSizeEx(file, &len) || len.QuadPart == 0)
+  {
+    ::CloseHandle(file);
+    return NULL;
+  }
+
+  HANDLE mapping = ::CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+  // the mapping holds its own reference to the file
+  ::CloseHandle(file);
+
+  if(mapping == NULL)
+    return NULL;
+
+  const void *ptr = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+  if(ptr == NULL)
+  {
+    ::CloseHandle(mapping);
+    return NULL;
+  }
+
+  size = (uint64_t)len.QuadPart;
+  handle = mapping;
+
+  return ptr;
+}
+
+void UnmapFile(const void *ptr, uint64_t size, void *handle)
+{
+  if(ptr)
+    ::UnmapViewOfFile(ptr);
+  if(handle)
+    ::CloseHandle((HANDLE)handle);
+}
+
 vector<FoundFile> GetFilesInDirectory(const char *path)
 {
   vector<FoundFile> ret;
@@ -106,6 +106,30 @@ void CriticalSection::Unlock()
   LeaveCriticalSection(&m_Data);
 }
 
+ConditionVariable::ConditionVariableTemplate()
+{
+  InitializeConditionVariable(&m_Data);
+}
+
+ConditionVariable::~ConditionVariableTemplate()
+{
+}
+
+void ConditionVariable::Wait(CriticalSection &cs)
+{
+  SleepConditionVariableCS(&m_Data, &cs.m_Data, INFINITE);
+}
+
+void ConditionVariable::WakeOne()
+{
+  WakeConditionVariable(&m_Data);
+}
+
+void ConditionVariable::WakeAll()
+{
+  WakeAllConditionVariable(&m_Data);
+}
+
 struct ThreadInitData
 {
   ThreadEntry entryFunc;
@@ -253,4 +277,11 @@ void Sleep(uint32_t milliseconds)
 {
   ::Sleep((DWORD)milliseconds);
 }
+
+uint32_t NumberOfCores()
+{
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return RDCMAX(1U, (uint32_t)info.dwNumberOfProcessors);
+}
 };
@@ -48,6 +48,7 @@ int RENDERDOC_CC SetCaptureOptionU32(RENDERDOC_CaptureOption opt, uint32_t val)
     case eRENDERDOC_Option_SaveAllInitials: opts.SaveAllInitials = (val != 0); break;
     case eRENDERDOC_Option_CaptureAllCmdLists: opts.CaptureAllCmdLists = (val != 0); break;
     case eRENDERDOC_Option_DebugOutputMute: opts.DebugOutputMute = (val != 0); break;
+    case eRENDERDOC_Option_CallstackUnwinder: opts.CallstackUnwinder = val; break;
     default: RDCLOG("Unrecognised capture option '%d'", opt); return 0;
   }
 
@@ -75,6 +76,7 @@ int RENDERDOC_CC SetCaptureOptionF32(RENDERDOC_CaptureOption opt, float val)
     case eRENDERDOC_Option_SaveAllInitials: opts.SaveAllInitials = (val != 0.0f); break;
     case eRENDERDOC_Option_CaptureAllCmdLists: opts.CaptureAllCmdLists = (val != 0.0f); break;
     case eRENDERDOC_Option_DebugOutputMute: opts.DebugOutputMute = (val != 0.0f); break;
+    case eRENDERDOC_Option_CallstackUnwinder: opts.CallstackUnwinder = (uint32_t)val; break;
     default: RDCLOG("Unrecognised capture option '%d'", opt); return 0;
   }
 
@@ -110,6 +112,8 @@ uint32_t RENDERDOC_CC GetCaptureOptionU32(RENDERDOC_CaptureOption opt)
       return (RenderDoc::Inst().GetCaptureOptions().CaptureAllCmdLists ? 1 : 0);
     case eRENDERDOC_Option_DebugOutputMute:
       return (RenderDoc::Inst().GetCaptureOptions().DebugOutputMute ? 1 : 0);
+    case eRENDERDOC_Option_CallstackUnwinder:
+      return (RenderDoc::Inst().GetCaptureOptions().CallstackUnwinder);
     default: break;
   }
 
@@ -145,6 +149,8 @@ float RENDERDOC_CC GetCaptureOptionF32(RENDERDOC_CaptureOption opt)
       return (RenderDoc::Inst().GetCaptureOptions().CaptureAllCmdLists ? 1.0f : 0.0f);
     case eRENDERDOC_Option_DebugOutputMute:
       return (RenderDoc::Inst().GetCaptureOptions().DebugOutputMute ? 1.0f : 0.0f);
+    case eRENDERDOC_Option_CallstackUnwinder:
+      return (RenderDoc::Inst().GetCaptureOptions().CallstackUnwinder * 1.0f);
     default: break;
   }
 
@@ -166,4 +172,5 @@ CaptureOptions::CaptureOptions()
   SaveAllInitials = false;
   CaptureAllCmdLists = false;
   DebugOutputMute = true;
+  CallstackUnwinder = 0;
 }
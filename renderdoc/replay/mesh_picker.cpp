@@ -0,0 +1,734 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "mesh_picker.h"
+#include <float.h>
+#include <algorithm>
+#include <cmath>
+#include "common/common.h"
+#include "maths/camera.h"
+#include "maths/formatpacking.h"
+#include "replay_driver.h"
+
+// leaves are allowed to hold at most this many triangles before they're split, and nodes this
+// small or smaller are only split if the surface area heuristic says it's worth it.
+static const uint32_t MaxLeafTriangles = 4;
+static const uint32_t MaxSAHLeafTriangles = 16;
+
+// the depth of the tree is capped so that traversal can use a fixed-size stack. Any node this
+// deep just becomes a leaf, which only happens for very degenerate meshes.
+static const uint32_t MaxBVHDepth = 48;
+
+static const uint32_t NumSAHBins = 16;
+
+// points further than this in pixels from the cursor are never picked
+static const float MaxPointPickDistance = 35.0f;
+
+static bool IsTriangleTopology(PrimitiveTopology topo)
+{
+  return topo == eTopology_TriangleList || topo == eTopology_TriangleStrip ||
+         topo == eTopology_TriangleFan || topo == eTopology_TriangleList_Adj ||
+         topo == eTopology_TriangleStrip_Adj;
+}
+
+static uint32_t NumTriangles(PrimitiveTopology topo, uint32_t numVerts)
+{
+  switch(topo)
+  {
+    case eTopology_TriangleList: return numVerts / 3;
+    case eTopology_TriangleStrip:
+    case eTopology_TriangleFan: return numVerts >= 3 ? numVerts - 2 : 0;
+    case eTopology_TriangleList_Adj: return numVerts / 6;
+    case eTopology_TriangleStrip_Adj: return numVerts >= 5 ? (numVerts - 3) / 2 : 0;
+    default: break;
+  }
+
+  return 0;
+}
+
+// the vertices in the mesh that make up triangle prim, the same as the mesh picking shaders
+static void TriangleVerts(PrimitiveTopology topo, uint32_t prim, uint32_t *verts)
+{
+  switch(topo)
+  {
+    case eTopology_TriangleList:
+      verts[0] = prim * 3;
+      verts[1] = prim * 3 + 1;
+      verts[2] = prim * 3 + 2;
+      break;
+    case eTopology_TriangleStrip:
+      verts[0] = prim;
+      verts[1] = prim + 1;
+      verts[2] = prim + 2;
+      break;
+    case eTopology_TriangleFan:
+      verts[0] = 0;
+      verts[1] = prim + 1;
+      verts[2] = prim + 2;
+      break;
+    case eTopology_TriangleList_Adj:
+      verts[0] = prim * 6;
+      verts[1] = prim * 6 + 2;
+      verts[2] = prim * 6 + 4;
+      break;
+    case eTopology_TriangleStrip_Adj:
+      verts[0] = prim * 2;
+      verts[1] = prim * 2 + 2;
+      verts[2] = prim * 2 + 4;
+      break;
+    default: verts[0] = verts[1] = verts[2] = 0; break;
+  }
+}
+
+static FloatVector FetchPosition(const FloatVector *positions, uint32_t numPositions,
+                                 const uint32_t *indices, uint32_t vert, bool flipY)
+{
+  uint32_t idx = indices ? indices[vert] : vert;
+
+  // indices past the end of the vertex data read the same default as a missing component
+  FloatVector ret = idx < numPositions ? positions[idx] : FloatVector(0.0f, 0.0f, 0.0f, 1.0f);
+
+  if(flipY)
+    ret.y = -ret.y;
+
+  return ret;
+}
+
+static bool IsFinite(const Vec3f &v)
+{
+  return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+}
+
+static float Axis(const Vec3f &v, int axis)
+{
+  return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+static uint32_t SAHBin(float centroid, float axisMin, float binScale)
+{
+  return RDCMIN(uint32_t((centroid - axisMin) * binScale), NumSAHBins - 1);
+}
+
+static Vec3f Min(const Vec3f &a, const Vec3f &b)
+{
+  return Vec3f(RDCMIN(a.x, b.x), RDCMIN(a.y, b.y), RDCMIN(a.z, b.z));
+}
+
+static Vec3f Max(const Vec3f &a, const Vec3f &b)
+{
+  return Vec3f(RDCMAX(a.x, b.x), RDCMAX(a.y, b.y), RDCMAX(a.z, b.z));
+}
+
+// Moller-Trumbore, accepting backfaces and only hits in front of the ray, like the shaders do.
+static bool RayTriangleIntersect(const Vec3f &a, const Vec3f &b, const Vec3f &c,
+                                 const Vec3f &rayPos, const Vec3f &rayDir, float &t)
+{
+  Vec3f v0v1 = b - a;
+  Vec3f v0v2 = c - a;
+  Vec3f pvec = rayDir.Cross(v0v2);
+  float det = v0v1.Dot(pvec);
+
+  if(det == 0.0f)
+    return false;
+
+  float invDet = 1.0f / det;
+
+  Vec3f tvec = rayPos - a;
+  float u = tvec.Dot(pvec) * invDet;
+  if(u < 0.0f || u > 1.0f)
+    return false;
+
+  Vec3f qvec = tvec.Cross(v0v1);
+  float v = rayDir.Dot(qvec) * invDet;
+  if(v < 0.0f || u + v > 1.0f)
+    return false;
+
+  t = v0v2.Dot(qvec) * invDet;
+  return t > 0.0f;
+}
+
+void CalcMeshPickRay(const MeshDisplay &cfg, uint32_t x, uint32_t y, float width, float height,
+                     Vec3f &rayPos, Vec3f &rayDir, Matrix4f &pickMVP)
+{
+  Matrix4f projMat = Matrix4f::Perspective(90.0f, 0.1f, 100000.0f, width / height);
+
+  Matrix4f camMat = cfg.cam ? cfg.cam->GetMatrix() : Matrix4f::Identity();
+  Matrix4f camMVP = projMat.Mul(camMat);
+
+  Matrix4f pickMVPProj;
+  if(cfg.position.unproject)
+  {
+    // the derivation of the projection matrix might not be right (hell, it could be an
+    // orthographic projection). But it'll be close enough likely.
+    Matrix4f guessProj =
+        cfg.position.farPlane != FLT_MAX
+            ? Matrix4f::Perspective(cfg.fov, cfg.position.nearPlane, cfg.position.farPlane,
+                                    cfg.aspect)
+            : Matrix4f::ReversePerspective(cfg.fov, cfg.position.nearPlane, cfg.aspect);
+
+    if(cfg.ortho)
+      guessProj = Matrix4f::Orthographic(cfg.position.nearPlane, cfg.position.farPlane);
+
+    pickMVPProj = projMat.Mul(camMat.Mul(guessProj.Inverse()));
+  }
+
+  Matrix4f inversePickMVP = camMVP.Inverse();
+
+  float pickXCanonical = RDCLERP(-1.0f, 1.0f, float(x) / width);
+  // flip the Y axis
+  float pickYCanonical = RDCLERP(1.0f, -1.0f, float(y) / height);
+
+  Vec3f cameraToWorldNearPosition =
+      inversePickMVP.Transform(Vec3f(pickXCanonical, pickYCanonical, -1), 1);
+
+  Vec3f cameraToWorldFarPosition =
+      inversePickMVP.Transform(Vec3f(pickXCanonical, pickYCanonical, 1), 1);
+
+  Vec3f testDir = (cameraToWorldFarPosition - cameraToWorldNearPosition);
+  testDir.Normalise();
+
+  // Calculate the ray direction first in the regular way (above), so we can use the
+  // the output for testing if the ray we are picking is negative or not. This is similar
+  // to checking against the forward direction of the camera, but more robust
+  if(cfg.position.unproject)
+  {
+    Matrix4f inversePickMVPGuess = pickMVPProj.Inverse();
+
+    Vec3f nearPosProj = inversePickMVPGuess.Transform(Vec3f(pickXCanonical, pickYCanonical, -1), 1);
+
+    Vec3f farPosProj = inversePickMVPGuess.Transform(Vec3f(pickXCanonical, pickYCanonical, 1), 1);
+
+    rayDir = (farPosProj - nearPosProj);
+    rayDir.Normalise();
+
+    if(testDir.z < 0)
+      rayDir = -rayDir;
+
+    rayPos = nearPosProj;
+    pickMVP = pickMVPProj;
+  }
+  else
+  {
+    rayDir = testDir;
+    rayPos = cameraToWorldNearPosition;
+    pickMVP = camMVP;
+  }
+}
+
+MeshPicker::MeshPicker(uint32_t eventID, uint32_t instance, const MeshFormat &fmt)
+{
+  m_EventID = eventID;
+  m_Instance = instance;
+  m_Format = fmt;
+}
+
+bool MeshPicker::Matches(uint32_t eventID, uint32_t instance, const MeshFormat &fmt) const
+{
+  return m_EventID == eventID && m_Instance == instance && m_Format.buf == fmt.buf &&
+         m_Format.offset == fmt.offset && m_Format.stride == fmt.stride &&
+         m_Format.compCount == fmt.compCount && m_Format.compByteWidth == fmt.compByteWidth &&
+         m_Format.compType == fmt.compType && m_Format.bgraOrder == fmt.bgraOrder &&
+         m_Format.specialFormat == fmt.specialFormat && m_Format.idxbuf == fmt.idxbuf &&
+         m_Format.idxoffs == fmt.idxoffs && m_Format.idxByteWidth == fmt.idxByteWidth &&
+         m_Format.baseVertex == fmt.baseVertex && m_Format.topo == fmt.topo &&
+         m_Format.numVerts == fmt.numVerts && m_Format.unproject == fmt.unproject;
+}
+
+MeshPicker *MeshPicker::Create(IReplayDriver *driver, uint32_t eventID, uint32_t instance,
+                               const MeshFormat &fmt, bool flipY)
+{
+  if(fmt.buf == ResourceId() || fmt.numVerts == 0)
+    return NULL;
+
+  vector<byte> vbData;
+  driver->GetBufferData(fmt.buf, fmt.offset, 0, vbData);
+
+  if(vbData.empty())
+    return NULL;
+
+  std::vector<uint32_t> indices;
+  uint32_t numPositions = fmt.numVerts;
+
+  if(fmt.idxByteWidth && fmt.idxbuf != ResourceId())
+  {
+    vector<byte> ibData;
+    driver->GetBufferData(fmt.idxbuf, fmt.idxoffs, uint64_t(fmt.numVerts) * fmt.idxByteWidth,
+                          ibData);
+
+    // any indices past the end of the buffer read as 0
+    indices.resize(fmt.numVerts, 0);
+
+    uint32_t numRead = RDCMIN(fmt.numVerts, uint32_t(ibData.size() / fmt.idxByteWidth));
+
+    if(fmt.idxByteWidth == 1)
+    {
+      for(uint32_t i = 0; i < numRead; i++)
+        indices[i] = ibData[i];
+    }
+    else if(fmt.idxByteWidth == 2)
+    {
+      const uint16_t *idx16 = (const uint16_t *)&ibData[0];
+      for(uint32_t i = 0; i < numRead; i++)
+        indices[i] = idx16[i];
+    }
+    else if(numRead > 0)
+    {
+      memcpy(&indices[0], &ibData[0], numRead * sizeof(uint32_t));
+    }
+
+    numPositions = 0;
+    for(uint32_t i = 0; i < fmt.numVerts; i++)
+      numPositions = RDCMAX(numPositions, indices[i]);
+    if(numPositions < ~0U)
+      numPositions++;
+  }
+
+  const byte *data = &vbData[0];
+  const byte *dataEnd = data + vbData.size();
+
+  // apply baseVertex but clamp to 0 (don't allow index to become negative). The first idxclamp
+  // vertices all read vertex 0, and the rest are one contiguous run we can decode in one go.
+  uint32_t idxclamp = 0;
+  if(fmt.baseVertex < 0)
+    idxclamp = RDCMIN(uint32_t(-fmt.baseVertex), numPositions);
+
+  const byte *runStart = data;
+  if(fmt.baseVertex > 0)
+    runStart += uint64_t(fmt.baseVertex) * fmt.stride;
+
+  // don't decode vertices that start past the end of the buffer - stray indices (like strip
+  // restarts) would otherwise have us decode billions of defaults. FetchPosition gives the same
+  // default for anything past the end.
+  uint64_t available = 1;
+  if(fmt.stride > 0)
+    available = runStart < dataEnd ? uint64_t(dataEnd - runStart) / fmt.stride + 1 : 0;
+  numPositions = (uint32_t)RDCMIN(uint64_t(numPositions), idxclamp + available);
+
+  std::vector<FloatVector> positions(numPositions);
+
+  if(idxclamp > 0)
+  {
+    DecodeFormattedComponents(fmt, data, dataEnd, 1, &positions[0]);
+    for(uint32_t i = 1; i < idxclamp; i++)
+      positions[i] = positions[0];
+  }
+
+  if(numPositions > idxclamp)
+    DecodeFormattedComponents(fmt, runStart, dataEnd, numPositions - idxclamp,
+                              &positions[idxclamp]);
+
+  MeshPicker *picker = new MeshPicker(eventID, instance, fmt);
+  picker->Build(positions.empty() ? NULL : &positions[0], numPositions,
+                indices.empty() ? NULL : &indices[0], flipY);
+  return picker;
+}
+
+void MeshPicker::Build(const FloatVector *positions, uint32_t numPositions,
+                       const uint32_t *indices, bool flipY)
+{
+  m_Triangles.clear();
+  m_Nodes.clear();
+  m_Points.clear();
+
+  const uint32_t numVerts = m_Format.numVerts;
+
+  if(!IsTriangleTopology(m_Format.topo))
+  {
+    m_Points.resize(numVerts);
+    for(uint32_t i = 0; i < numVerts; i++)
+      m_Points[i] = FetchPosition(positions, numPositions, indices, i, flipY);
+    return;
+  }
+
+  const uint32_t numTris = NumTriangles(m_Format.topo, numVerts);
+
+  m_Triangles.reserve(numTris);
+
+  std::vector<Vec3f> centroids;
+  centroids.reserve(numTris);
+
+  for(uint32_t p = 0; p < numTris; p++)
+  {
+    uint32_t verts[3];
+    TriangleVerts(m_Format.topo, p, verts);
+
+    Triangle tri;
+    tri.prim = p;
+
+    for(int i = 0; i < 3; i++)
+    {
+      FloatVector pos = FetchPosition(positions, numPositions, indices, verts[i], flipY);
+
+      if(m_Format.unproject)
+        tri.pos[i] = Vec3f(pos.x / pos.w, pos.y / pos.w, pos.z / pos.w);
+      else
+        tri.pos[i] = Vec3f(pos.x, pos.y, pos.z);
+    }
+
+    // a triangle with a vertex at infinity (e.g. w = 0) can't be hit sensibly, and would poison
+    // the bounds of every node above it.
+    if(!IsFinite(tri.pos[0]) || !IsFinite(tri.pos[1]) || !IsFinite(tri.pos[2]))
+      continue;
+
+    m_Triangles.push_back(tri);
+    centroids.push_back((tri.pos[0] + tri.pos[1] + tri.pos[2]) * (1.0f / 3.0f));
+  }
+
+  if(m_Triangles.empty())
+    return;
+
+  // a binary tree with at least one triangle per leaf never needs more than 2N - 1 nodes
+  m_Nodes.reserve(m_Triangles.size() * 2);
+  m_Nodes.push_back(BVHNode());
+  BuildNode(0, 0, (uint32_t)m_Triangles.size(), centroids, 0);
+}
+
+void MeshPicker::BuildNode(uint32_t node, uint32_t first, uint32_t count,
+                           std::vector<Vec3f> &centroids, uint32_t depth)
+{
+  Bounds bounds = {Vec3f(FLT_MAX, FLT_MAX, FLT_MAX), Vec3f(-FLT_MAX, -FLT_MAX, -FLT_MAX)};
+  Bounds centroidBounds = bounds;
+
+  for(uint32_t i = first; i < first + count; i++)
+  {
+    const Triangle &tri = m_Triangles[i];
+    for(int v = 0; v < 3; v++)
+    {
+      bounds.minimum = Min(bounds.minimum, tri.pos[v]);
+      bounds.maximum = Max(bounds.maximum, tri.pos[v]);
+    }
+    centroidBounds.minimum = Min(centroidBounds.minimum, centroids[i]);
+    centroidBounds.maximum = Max(centroidBounds.maximum, centroids[i]);
+  }
+
+  // start off as a leaf, and only turn into an interior node if we decide to split
+  m_Nodes[node].bounds = bounds;
+  m_Nodes[node].first = first;
+  m_Nodes[node].count = count;
+
+  if(count <= MaxLeafTriangles || depth >= MaxBVHDepth)
+    return;
+
+  // split along the axis the centroids are most spread out on
+  Vec3f extent = centroidBounds.maximum - centroidBounds.minimum;
+  int axis = 0;
+  if(extent.y > Axis(extent, axis))
+    axis = 1;
+  if(extent.z > Axis(extent, axis))
+    axis = 2;
+
+  const float axisMin = Axis(centroidBounds.minimum, axis);
+  const float axisExtent = Axis(extent, axis);
+
+  uint32_t mid = first + count / 2;
+
+  if(axisExtent > 0.0f)
+  {
+    // bin the triangles by centroid and choose the bin boundary with the lowest surface area
+    // heuristic cost, estimated as the area of each side times the triangles in it.
+    struct Bin
+    {
+      Bounds bounds;
+      uint32_t count;
+    } bins[NumSAHBins];
+
+    for(uint32_t b = 0; b < NumSAHBins; b++)
+    {
+      bins[b].bounds.minimum = Vec3f(FLT_MAX, FLT_MAX, FLT_MAX);
+      bins[b].bounds.maximum = Vec3f(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+      bins[b].count = 0;
+    }
+
+    const float binScale = float(NumSAHBins) / axisExtent;
+
+    for(uint32_t i = first; i < first + count; i++)
+    {
+      uint32_t b = SAHBin(Axis(centroids[i], axis), axisMin, binScale);
+
+      const Triangle &tri = m_Triangles[i];
+      for(int v = 0; v < 3; v++)
+      {
+        bins[b].bounds.minimum = Min(bins[b].bounds.minimum, tri.pos[v]);
+        bins[b].bounds.maximum = Max(bins[b].bounds.maximum, tri.pos[v]);
+      }
+      bins[b].count++;
+    }
+
+    float aboveArea[NumSAHBins] = {};
+    uint32_t aboveCount[NumSAHBins] = {};
+
+    Bounds acc = bins[NumSAHBins - 1].bounds;
+    uint32_t n = 0;
+    for(uint32_t b = NumSAHBins - 1; b > 0; b--)
+    {
+      acc.minimum = Min(acc.minimum, bins[b].bounds.minimum);
+      acc.maximum = Max(acc.maximum, bins[b].bounds.maximum);
+      n += bins[b].count;
+
+      Vec3f e = acc.maximum - acc.minimum;
+      aboveArea[b] = n ? e.x * e.y + e.y * e.z + e.z * e.x : 0.0f;
+      aboveCount[b] = n;
+    }
+
+    acc = bins[0].bounds;
+    n = 0;
+
+    float bestCost = FLT_MAX;
+    uint32_t bestSplit = 0;
+
+    for(uint32_t b = 0; b < NumSAHBins - 1; b++)
+    {
+      acc.minimum = Min(acc.minimum, bins[b].bounds.minimum);
+      acc.maximum = Max(acc.maximum, bins[b].bounds.maximum);
+      n += bins[b].count;
+
+      if(n == 0 || aboveCount[b + 1] == 0)
+        continue;
+
+      Vec3f e = acc.maximum - acc.minimum;
+      float cost = (e.x * e.y + e.y * e.z + e.z * e.x) * n + aboveArea[b + 1] * aboveCount[b + 1];
+
+      if(cost < bestCost)
+      {
+        bestCost = cost;
+        bestSplit = b + 1;
+      }
+    }
+
+    // small nodes stay as leaves if testing all their triangles is cheaper than splitting
+    Vec3f e = bounds.maximum - bounds.minimum;
+    float leafCost = (e.x * e.y + e.y * e.z + e.z * e.x) * count;
+    if(count <= MaxSAHLeafTriangles && bestCost >= leafCost)
+      return;
+
+    if(bestSplit > 0)
+    {
+      // partition so that the triangles below the split come first
+      uint32_t i = first;
+      uint32_t j = first + count;
+      while(i < j)
+      {
+        if(SAHBin(Axis(centroids[i], axis), axisMin, binScale) < bestSplit)
+        {
+          i++;
+        }
+        else
+        {
+          j--;
+          std::swap(m_Triangles[i], m_Triangles[j]);
+          std::swap(centroids[i], centroids[j]);
+        }
+      }
+
+      mid = i;
+    }
+  }
+
+  // if everything landed on one side (or the centroids are all identical), split evenly by count
+  if(mid == first || mid == first + count)
+    mid = first + count / 2;
+
+  uint32_t children = (uint32_t)m_Nodes.size();
+  m_Nodes.resize(children + 2);
+
+  m_Nodes[node].first = children;
+  m_Nodes[node].count = 0;
+
+  BuildNode(children, first, mid - first, centroids, depth + 1);
+  BuildNode(children + 1, mid, first + count - mid, centroids, depth + 1);
+}
+
+uint32_t MeshPicker::Pick(const Vec3f &rayPos, const Vec3f &rayDir, const Matrix4f &pickMVP,
+                          uint32_t x, uint32_t y, float width, float height) const
+{
+  if(IsTriangleTopology(m_Format.topo))
+    return PickTriangle(rayPos, rayDir);
+
+  return PickPoint(pickMVP, x, y, width, height);
+}
+
+// returns the distance along the ray where it enters the bounds, or FLT_MAX if it misses them or
+// only enters further than maxT.
+static float RayBoundsEntry(const Vec3f &minimum, const Vec3f &maximum, const Vec3f &rayPos,
+                            const Vec3f &invDir, float maxT)
+{
+  float t0 = (minimum.x - rayPos.x) * invDir.x;
+  float t1 = (maximum.x - rayPos.x) * invDir.x;
+  float tmin = RDCMIN(t0, t1);
+  float tmax = RDCMAX(t0, t1);
+
+  t0 = (minimum.y - rayPos.y) * invDir.y;
+  t1 = (maximum.y - rayPos.y) * invDir.y;
+  tmin = RDCMAX(tmin, RDCMIN(t0, t1));
+  tmax = RDCMIN(tmax, RDCMAX(t0, t1));
+
+  t0 = (minimum.z - rayPos.z) * invDir.z;
+  t1 = (maximum.z - rayPos.z) * invDir.z;
+  tmin = RDCMAX(tmin, RDCMIN(t0, t1));
+  tmax = RDCMIN(tmax, RDCMAX(t0, t1));
+
+  if(tmax < RDCMAX(tmin, 0.0f) || tmin >= maxT)
+    return FLT_MAX;
+
+  return tmin;
+}
+
+uint32_t MeshPicker::PickTriangle(const Vec3f &rayPos, const Vec3f &rayDir) const
+{
+  if(m_Nodes.empty())
+    return ~0U;
+
+  const Vec3f invDir(1.0f / rayDir.x, 1.0f / rayDir.y, 1.0f / rayDir.z);
+
+  // the shaders keep the hit nearest the ray origin, and the ray direction is normalised so
+  // that's the one with the smallest t.
+  float closestT = FLT_MAX;
+  const Triangle *closest = NULL;
+
+  struct StackEntry
+  {
+    uint32_t node;
+    float t;
+  } stack[MaxBVHDepth + 2];
+  uint32_t stackSize = 0;
+
+  const BVHNode *nodes = &m_Nodes[0];
+
+  if(RayBoundsEntry(nodes[0].bounds.minimum, nodes[0].bounds.maximum, rayPos, invDir, closestT) <
+     FLT_MAX)
+  {
+    stack[stackSize].node = 0;
+    stack[stackSize].t = 0.0f;
+    stackSize++;
+  }
+
+  while(stackSize > 0)
+  {
+    stackSize--;
+
+    // skip nodes that are further away than a hit we found since they were pushed
+    if(stack[stackSize].t >= closestT)
+      continue;
+
+    const BVHNode *node = nodes + stack[stackSize].node;
+
+    // walk down towards the nearer child, pushing the other to come back to
+    while(node->count == 0)
+    {
+      const BVHNode *a = nodes + node->first;
+      const BVHNode *b = a + 1;
+
+      float ta = RayBoundsEntry(a->bounds.minimum, a->bounds.maximum, rayPos, invDir, closestT);
+      float tb = RayBoundsEntry(b->bounds.minimum, b->bounds.maximum, rayPos, invDir, closestT);
+
+      if(tb < ta)
+      {
+        std::swap(a, b);
+        std::swap(ta, tb);
+      }
+
+      if(ta == FLT_MAX)
+      {
+        node = NULL;
+        break;
+      }
+
+      if(tb < FLT_MAX)
+      {
+        stack[stackSize].node = uint32_t(b - nodes);
+        stack[stackSize].t = tb;
+        stackSize++;
+      }
+
+      node = a;
+    }
+
+    if(node == NULL)
+      continue;
+
+    for(uint32_t i = node->first; i < node->first + node->count; i++)
+    {
+      const Triangle &tri = m_Triangles[i];
+
+      float t = 0.0f;
+      if(RayTriangleIntersect(tri.pos[0], tri.pos[1], tri.pos[2], rayPos, rayDir, t) &&
+         t < closestT)
+      {
+        closestT = t;
+        closest = &tri;
+      }
+    }
+  }
+
+  if(closest == NULL)
+    return ~0U;
+
+  // return the vertex that was closest to the triangle/ray intersection point
+  Vec3f hitPosition = rayPos + rayDir * closestT;
+
+  float dist0 = (closest->pos[0] - hitPosition).Length();
+  float dist1 = (closest->pos[1] - hitPosition).Length();
+  float dist2 = (closest->pos[2] - hitPosition).Length();
+
+  uint32_t verts[3];
+  TriangleVerts(m_Format.topo, closest->prim, verts);
+
+  if(dist1 < dist0 && dist1 < dist2)
+    return verts[1];
+  else if(dist2 < dist0 && dist2 < dist1)
+    return verts[2];
+
+  return verts[0];
+}
+
+uint32_t MeshPicker::PickPoint(const Matrix4f &pickMVP, uint32_t x, uint32_t y, float width,
+                               float height) const
+{
+  uint32_t closest = ~0U;
+  float closestLen = MaxPointPickDistance;
+  float closestDepth = FLT_MAX;
+
+  for(uint32_t i = 0; i < (uint32_t)m_Points.size(); i++)
+  {
+    const FloatVector &pos = m_Points[i];
+
+    Vec3f ndc = pickMVP.Transform(Vec3f(pos.x, pos.y, pos.z), pos.w);
+
+    float dx = (ndc.x + 1.0f) * 0.5f * width - float(x);
+    float dy = (1.0f - ndc.y) * 0.5f * height - float(y);
+    float len = sqrtf(dx * dx + dy * dy);
+
+    // keep the picking order consistent when several vertices share a position (e.g. if only
+    // their UVs or normals differ) by preferring the nearest, then the shallowest, then the first.
+    if(len < closestLen || (closest != ~0U && len == closestLen && ndc.z < closestDepth))
+    {
+      closest = i;
+      closestLen = len;
+      closestDepth = ndc.z;
+    }
+  }
+
+  return closest;
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+#include "api/replay/renderdoc_replay.h"
+#include "maths/matrix.h"
+#include "maths/vec.h"
+
+class IReplayDriver;
+
+// computes the pick ray through pixel (x, y) of a width x height mesh output, and the matrix that
+// takes a mesh position to the output's clip space. This matches what the drivers' GPU picking
+// does, including the guessed projection used to unproject post-projection data.
+void CalcMeshPickRay(const MeshDisplay &cfg, uint32_t x, uint32_t y, float width, float height,
+                     Vec3f &rayPos, Vec3f &rayDir, Matrix4f &pickMVP);
+
+// Picks mesh vertices on the CPU. The positions are decoded once when the picker is built, and
+// for triangle topologies a bounding volume hierarchy is built over the triangles so a pick only
+// tests the handful of triangles near the ray. Other topologies pick the vertex nearest the
+// cursor in screen space, like the GPU path.
+class MeshPicker
+{
+public:
+  MeshPicker(uint32_t eventID, uint32_t instance, const MeshFormat &fmt);
+
+  // reads back the mesh data through the driver and builds a picker from it. Returns NULL if the
+  // position data couldn't be fetched.
+  static MeshPicker *Create(IReplayDriver *driver, uint32_t eventID, uint32_t instance,
+                            const MeshFormat &fmt, bool flipY);
+
+  bool Matches(uint32_t eventID, uint32_t instance, const MeshFormat &fmt) const;
+
+  // positions holds numPositions decoded vertices, with any base vertex already applied. indices
+  // is NULL for non-indexed meshes, otherwise it has fmt.numVerts entries. If flipY is set the Y
+  // of each position is negated, as for Vulkan's clip space.
+  void Build(const FloatVector *positions, uint32_t numPositions, const uint32_t *indices,
+             bool flipY);
+
+  // returns the index in the mesh of the picked vertex, or ~0U if nothing was picked. rayPos,
+  // rayDir and pickMVP come from CalcMeshPickRay.
+  uint32_t Pick(const Vec3f &rayPos, const Vec3f &rayDir, const Matrix4f &pickMVP, uint32_t x,
+                uint32_t y, float width, float height) const;
+
+  size_t GetTriangleCount() const { return m_Triangles.size(); }
+
+private:
+  struct Triangle
+  {
+    Vec3f pos[3];
+    uint32_t prim;
+  };
+
+  struct Bounds
+  {
+    Vec3f minimum, maximum;
+  };
+
+  // interior nodes have count == 0 and their children at first and first + 1. Leaves own
+  // triangles [first, first + count).
+  struct BVHNode
+  {
+    Bounds bounds;
+    uint32_t first;
+    uint32_t count;
+  };
+
+  void BuildNode(uint32_t node, uint32_t first, uint32_t count, std::vector<Vec3f> &centroids,
+                 uint32_t depth);
+
+  uint32_t PickTriangle(const Vec3f &rayPos, const Vec3f &rayDir) const;
+  uint32_t PickPoint(const Matrix4f &pickMVP, uint32_t x, uint32_t y, float width,
+                     float height) const;
+
+  uint32_t m_EventID;
+  uint32_t m_Instance;
+  MeshFormat m_Format;
+
+  std::vector<Triangle> m_Triangles;
+  std::vector<BVHNode> m_Nodes;
+
+  // for non-triangle topologies, the position of each vertex in the mesh
+  std::vector<FloatVector> m_Points;
+};
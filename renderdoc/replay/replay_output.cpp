@@ -25,6 +25,7 @@
 
 #include "common/common.h"
 #include "maths/matrix.h"
+#include "replay/mesh_picker.h"
 #include "serialise/string_utils.h"
 #include "replay_renderer.h"
 
@@ -115,6 +116,7 @@ ReplayOutput::~ReplayOutput()
   m_CustomShaderResourceId = ResourceId();
 
   ClearThumbnails();
+  ClearMeshPickers();
 }
 
 bool ReplayOutput::SetOutputConfig(const OutputConfig &o)
@@ -157,6 +159,9 @@ void ReplayOutput::SetFrameEvent(int eventID)
 {
   m_EventID = eventID;
 
+  // the mesh data could be different even if we're at the same event (e.g. after shader edits)
+  ClearMeshPickers();
+
   m_OverlayDirty = true;
   m_MainOutput.dirty = true;
 
@@ -461,7 +466,7 @@ uint32_t ReplayOutput::PickVertex(uint32_t eventID, uint32_t x, uint32_t y, uint
 
       cfg.position = fmt;
 
-      uint32_t ret = m_pDevice->PickVertex(m_EventID, cfg, x, y);
+      uint32_t ret = PickMeshVertex(inst, cfg, x, y);
       if(ret != ~0U)
       {
         *pickedInstance = inst;
@@ -473,8 +478,63 @@ uint32_t ReplayOutput::PickVertex(uint32_t eventID, uint32_t x, uint32_t y, uint
   }
   else
   {
-    return m_pDevice->PickVertex(m_EventID, cfg, x, y);
+    return PickMeshVertex(0, cfg, x, y);
+  }
+}
+
+uint32_t ReplayOutput::PickMeshVertex(uint32_t instance, const MeshDisplay &cfg, uint32_t x,
+                                      uint32_t y)
+{
+  if(cfg.position.numVerts == 0 || m_Width <= 0 || m_Height <= 0)
+    return ~0U;
+
+  MeshPicker *picker = NULL;
+
+  for(size_t i = 0; i < m_MeshPickers.size(); i++)
+  {
+    if(m_MeshPickers[i]->Matches(m_EventID, instance, cfg.position))
+    {
+      picker = m_MeshPickers[i];
+      m_MeshPickers.erase(m_MeshPickers.begin() + i);
+      break;
+    }
+  }
+
+  if(picker == NULL)
+  {
+    // Vulkan's clip space has Y pointing down, so flip post-projection data to match the output
+    bool flipY = cfg.position.unproject &&
+                 m_pRenderer->GetAPIProperties().pipelineType == eGraphicsAPI_Vulkan;
+
+    picker = MeshPicker::Create(m_pDevice, m_EventID, instance, cfg.position, flipY);
+
+    // if we couldn't read back the mesh data, let the driver pick on the GPU
+    if(picker == NULL)
+      return m_pDevice->PickVertex(m_EventID, cfg, x, y);
+
+    // only keep a few meshes around, they can be large
+    const size_t maxMeshPickers = 8;
+    if(m_MeshPickers.size() >= maxMeshPickers)
+    {
+      SAFE_DELETE(m_MeshPickers.back());
+      m_MeshPickers.pop_back();
+    }
   }
+
+  m_MeshPickers.insert(m_MeshPickers.begin(), picker);
+
+  Vec3f rayPos, rayDir;
+  Matrix4f pickMVP;
+  CalcMeshPickRay(cfg, x, y, float(m_Width), float(m_Height), rayPos, rayDir, pickMVP);
+
+  return picker->Pick(rayPos, rayDir, pickMVP, x, y, float(m_Width), float(m_Height));
+}
+
+void ReplayOutput::ClearMeshPickers()
+{
+  for(size_t i = 0; i < m_MeshPickers.size(); i++)
+    SAFE_DELETE(m_MeshPickers[i]);
+  m_MeshPickers.clear();
 }
 
 bool ReplayOutput::SetPixelContextLocation(uint32_t x, uint32_t y)
@@ -24,9 +24,13 @@
  ******************************************************************************/
 
 #include "replay_renderer.h"
+#include <algorithm>
 #include <string.h>
 #include <time.h>
 #include "common/dds_readwrite.h"
+#include "common/exr_write.h"
+#include "common/png_write.h"
+#include "common/worker_pool.h"
 #include "jpeg-compressor/jpgd.h"
 #include "jpeg-compressor/jpge.h"
 #include "maths/formatpacking.h"
@@ -35,109 +39,249 @@
 #include "serialise/string_utils.h"
 #include "stb/stb_image.h"
 #include "stb/stb_image_write.h"
-#include "tinyexr/tinyexr.h"
 
-float ConvertComponent(ResourceFormat fmt, byte *data)
+static void fileWriteFunc(void *context, void *data, int size)
 {
-  if(fmt.compByteWidth == 4)
+  FileIO::fwrite(data, 1, size, (FILE *)context);
+}
+
+// rows per band for SaveTexture's parallel conversion passes. Bands are converted independently so
+// only a band's worth of intermediate data is live per thread.
+static const uint32_t SaveBandRows = 64;
+
+// writes one subresource into a DDS file that's being streamed out, then frees it
+struct DDSWriteJob : public Threading::WorkerJob
+{
+  FILE *f;
+  const dds_data *dds;
+  int mip;
+  byte *data;
+
+  void Run()
   {
-    uint32_t *u32 = (uint32_t *)data;
-    int32_t *i32 = (int32_t *)data;
+    write_dds_subresource(f, *dds, mip, data);
+    delete[] data;
+  }
+};
 
-    if(fmt.compType == eCompType_Float)
-    {
-      return *(float *)u32;
-    }
-    else if(fmt.compType == eCompType_UInt || fmt.compType == eCompType_UScaled)
-    {
-      return float(*u32);
-    }
-    else if(fmt.compType == eCompType_SInt || fmt.compType == eCompType_SScaled)
-    {
-      return float(*i32);
-    }
+// copies one RGBA8 slice into its cell in a combined image (slices-as-grid or cube cruciform),
+// then frees it
+struct CompositeSliceJob : public Threading::WorkerJob
+{
+  byte *src;
+  byte *dst;
+  uint32_t sliceWidth, sliceHeight;
+  uint32_t dstWidth;
+  uint32_t xoffs, yoffs;
+
+  void Run()
+  {
+    for(uint32_t y = 0; y < sliceHeight; y++)
+      memcpy(&dst[((y + yoffs) * dstWidth + xoffs) * 4], &src[y * sliceWidth * 4], sliceWidth * 4);
+
+    delete[] src;
   }
-  else if(fmt.compByteWidth == 2)
+};
+
+// converts bands of RGBA8-style byte data for the LDR file formats, in one pass per pixel:
+// optionally extracting a single channel to greyscale, then either dropping alpha (blending
+// against a background), expanding RG to RG0, or forcing alpha to opaque.
+struct ByteConvertJob : public Threading::ParallelJob
+{
+  byte *src;
+  byte *dst;
+  uint32_t width, height;
+  uint32_t srcComps, dstComps;
+
+  int channelExtract;
+  bool removeAlpha;
+  bool expandRG;
+  bool discardAlpha;
+
+  AlphaMapping alpha;
+  FloatVector alphaCol, alphaColSecondary;
+
+  void Run(uint32_t band)
   {
-    uint16_t *u16 = (uint16_t *)data;
-    int16_t *i16 = (int16_t *)data;
+    uint32_t cc = srcComps;
 
-    if(fmt.compType == eCompType_Float)
-    {
-      return ConvertFromHalf(*u16);
-    }
-    else if(fmt.compType == eCompType_UInt || fmt.compType == eCompType_UScaled)
+    uint32_t yend = RDCMIN(height, (band + 1) * SaveBandRows);
+    for(uint32_t y = band * SaveBandRows; y < yend; y++)
     {
-      return float(*u16);
-    }
-    else if(fmt.compType == eCompType_SInt || fmt.compType == eCompType_SScaled)
-    {
-      return float(*i16);
-    }
-    else if(fmt.compType == eCompType_UNorm)
-    {
-      return float(*u16) / 65535.0f;
-    }
-    else if(fmt.compType == eCompType_SNorm)
-    {
-      float f = -1.0f;
+      for(uint32_t x = 0; x < width; x++)
+      {
+        byte *s = &src[(size_t(y) * width + x) * cc];
+        byte *d = &dst[(size_t(y) * width + x) * dstComps];
 
-      if(*i16 == -32768)
-        f = -1.0f;
-      else
-        f = ((float)*i16) / 32767.0f;
+        // if we want a grayscale image of one channel, splat it across all channels
+        // and set alpha to full
+        if(channelExtract >= 0)
+        {
+          s[0] = s[channelExtract];
+          if(cc >= 2)
+            s[1] = s[channelExtract];
+          if(cc >= 3)
+            s[2] = s[channelExtract];
+          if(cc >= 4)
+            s[3] = 255;
+        }
+
+        if(removeAlpha)
+        {
+          byte r = s[0];
+          byte g = s[1];
+          byte b = s[2];
+          byte a = s[3];
 
-      return f;
+          if(alpha != eAlphaMap_Discard)
+          {
+            FloatVector col = alphaCol;
+            if(alpha == eAlphaMap_BlendToCheckerboard)
+            {
+              bool lightSquare = ((x / 64) % 2) == ((y / 64) % 2);
+              col = lightSquare ? alphaCol : alphaColSecondary;
+            }
+
+            col.x = powf(col.x, 1.0f / 2.2f);
+            col.y = powf(col.y, 1.0f / 2.2f);
+            col.z = powf(col.z, 1.0f / 2.2f);
+
+            FloatVector pixel = FloatVector(float(r) / 255.0f, float(g) / 255.0f,
+                                            float(b) / 255.0f, float(a) / 255.0f);
+
+            pixel.x = pixel.x * pixel.w + col.x * (1.0f - pixel.w);
+            pixel.y = pixel.y * pixel.w + col.y * (1.0f - pixel.w);
+            pixel.z = pixel.z * pixel.w + col.z * (1.0f - pixel.w);
+
+            r = byte(pixel.x * 255.0f);
+            g = byte(pixel.y * 255.0f);
+            b = byte(pixel.z * 255.0f);
+          }
+
+          d[0] = r;
+          d[1] = g;
+          d[2] = b;
+        }
+        else if(expandRG)
+        {
+          byte r = s[0];
+          byte g = s[1];
+
+          d[0] = r;
+          d[1] = g;
+          d[2] = 0;
+
+          // if we're greyscaling the image, then keep the greyscale here.
+          if(channelExtract >= 0)
+            d[2] = r;
+        }
+        else if(discardAlpha)
+        {
+          d[3] = 255;
+        }
+      }
     }
   }
-  else if(fmt.compByteWidth == 1)
+};
+
+// decodes rows of the source texture to float RGBA for the HDR formats, applying channel
+// extraction and clamping as needed.
+struct FloatDecodeContext
+{
+  const byte *src;
+  ResourceFormat format;
+  uint32_t width;
+  size_t pixelSize;
+  int channelExtract;
+  bool clampNegative;
+
+  void Decode(uint32_t y, FloatVector *row) const
   {
-    uint8_t *u8 = (uint8_t *)data;
-    int8_t *i8 = (int8_t *)data;
+    size_t rowSize = pixelSize * width;
+    const byte *srcData = src + rowSize * y;
 
-    if(fmt.compType == eCompType_UInt || fmt.compType == eCompType_UScaled)
-    {
-      return float(*u8);
-    }
-    else if(fmt.compType == eCompType_SInt || fmt.compType == eCompType_SScaled)
-    {
-      return float(*i8);
-    }
-    else if(fmt.compType == eCompType_UNorm)
-    {
-      if(fmt.srgbCorrected)
-        return SRGB8_lookuptable[*u8];
-      else
-        return float(*u8) / 255.0f;
-    }
-    else if(fmt.compType == eCompType_SNorm)
+    DecodeFormattedComponents(format, srcData, srcData + rowSize, pixelSize, width, row);
+
+    for(uint32_t x = 0; x < width; x++)
     {
-      float f = -1.0f;
+      float r = row[x].x;
+      float g = row[x].y;
+      float b = row[x].z;
+      float a = row[x].w;
 
-      if(*i8 == -128)
-        f = -1.0f;
-      else
-        f = ((float)*i8) / 127.0f;
+      // HDR can't represent negative values
+      if(clampNegative)
+      {
+        r = RDCMAX(r, 0.0f);
+        g = RDCMAX(g, 0.0f);
+        b = RDCMAX(b, 0.0f);
+        a = RDCMAX(a, 0.0f);
+      }
+
+      if(channelExtract == 0)
+      {
+        g = b = r;
+        a = 1.0f;
+      }
+      if(channelExtract == 1)
+      {
+        r = b = g;
+        a = 1.0f;
+      }
+      if(channelExtract == 2)
+      {
+        r = g = b;
+        a = 1.0f;
+      }
+      if(channelExtract == 3)
+      {
+        r = g = b = a;
+        a = 1.0f;
+      }
 
-      return f;
+      row[x] = FloatVector(r, g, b, a);
     }
   }
+};
 
-  RDCERR("Unexpected format to convert from");
+// fills bands of an interleaved RGBA float image for stb's HDR writer
+struct HDRConvertJob : public Threading::ParallelJob
+{
+  const FloatDecodeContext *ctx;
+  uint32_t height;
+  float *dst;
 
-  return 0.0f;
-}
+  void Run(uint32_t band)
+  {
+    FloatVector *row = new FloatVector[ctx->width];
 
-static void fileWriteFunc(void *context, void *data, int size)
+    uint32_t yend = RDCMIN(height, (band + 1) * SaveBandRows);
+    for(uint32_t y = band * SaveBandRows; y < yend; y++)
+    {
+      ctx->Decode(y, row);
+      memcpy(&dst[size_t(y) * ctx->width * 4], row, ctx->width * sizeof(FloatVector));
+    }
+
+    delete[] row;
+  }
+};
+
+// the EXR writer pulls scanlines for each block it compresses, so the source is decoded straight
+// into the blocks instead of a full-size float image.
+static void DecodeEXRRow(uint32_t y, float *rgba, const void *userdata)
 {
-  FileIO::fwrite(data, 1, size, (FILE *)context);
+  ((const FloatDecodeContext *)userdata)->Decode(y, (FloatVector *)rgba);
 }
 
 ReplayRenderer::ReplayRenderer()
 {
   m_pDevice = NULL;
 
+  m_SavePool = NULL;
+
   m_EventID = 100000;
+
+  RDCEraseEl(m_APIProps);
 }
 
 ReplayRenderer::~ReplayRenderer()
@@ -159,11 +303,21 @@ ReplayRenderer::~ReplayRenderer()
 
   m_TargetResources.clear();
 
+  SAFE_DELETE(m_SavePool);
+
   if(m_pDevice)
     m_pDevice->Shutdown();
   m_pDevice = NULL;
 }
 
+Threading::WorkerPool &ReplayRenderer::GetSavePool()
+{
+  if(m_SavePool == NULL)
+    m_SavePool = new Threading::WorkerPool();
+
+  return *m_SavePool;
+}
+
 bool ReplayRenderer::SetFrameEvent(uint32_t eventID, bool force)
 {
   if(eventID != m_EventID || force)
@@ -347,13 +501,27 @@ bool ReplayRenderer::GetResolve(uint64_t *callstack, uint32_t callstackLen,
     return true;
   }
 
-  create_array_uninit(*arr, callstackLen);
-  for(size_t i = 0; i < callstackLen; i++)
+  std::vector<uint64_t> missing;
+  for(uint32_t i = 0; i < callstackLen; i++)
+    if(m_ResolvedFrames.find(callstack[i]) == m_ResolvedFrames.end())
+      missing.push_back(callstack[i]);
+
+  if(!missing.empty())
   {
-    Callstack::AddressDetails info = resolv->GetAddr(callstack[i]);
-    arr->elems[i] = info.formattedString();
+    std::sort(missing.begin(), missing.end());
+    missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+
+    std::vector<Callstack::AddressDetails> details(missing.size());
+    resolv->GetAddrs(&missing[0], missing.size(), &details[0]);
+
+    for(size_t i = 0; i < missing.size(); i++)
+      m_ResolvedFrames[missing[i]] = details[i].formattedString();
   }
 
+  create_array_uninit(*arr, callstackLen);
+  for(size_t i = 0; i < callstackLen; i++)
+    arr->elems[i] = m_ResolvedFrames[callstack[i]];
+
   return true;
 }
 
@@ -602,8 +770,6 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
     // otherwise take all mips, as by default
   }
 
-  vector<byte *> subdata;
-
   bool downcast = false;
 
   // don't support slice mappings for DDS - it supports slices natively
@@ -687,149 +853,50 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
     slicePitch = rowPitch * td.height;
   }
 
-  // loop over fetching subresources
-  for(uint32_t s = 0; s < numSlices; s++)
-  {
-    uint32_t slice = s * sliceStride + sliceOffset;
-
-    for(uint32_t m = 0; m < numMips; m++)
-    {
-      uint32_t mip = m + mipOffset;
-
-      GetTextureDataParams params;
-      params.forDiskSave = true;
-      params.typeHint = sd.typeHint;
-      params.resolve = resolveSamples;
-      params.remap = downcast ? eRemap_RGBA8 : eRemap_None;
-      params.blackPoint = sd.comp.blackPoint;
-      params.whitePoint = sd.comp.whitePoint;
-
-      size_t datasize = 0;
-      byte *bytes = m_pDevice->GetTextureData(liveid, slice, mip, params, datasize);
-
-      if(bytes == NULL)
-      {
-        RDCERR("Couldn't get bytes for mip %u, slice %u", mip, slice);
-
-        for(size_t i = 0; i < subdata.size(); i++)
-          delete[] subdata[i];
-
-        return false;
-      }
-
-      if(td.depth == 1)
-      {
-        subdata.push_back(bytes);
-        continue;
-      }
-
-      uint32_t mipSlicePitch = slicePitch;
-
-      uint32_t w = RDCMAX(1U, td.width >> m);
-      uint32_t h = RDCMAX(1U, td.height >> m);
-      uint32_t d = RDCMAX(1U, td.depth >> m);
-
-      if(blockformat)
-      {
-        mipSlicePitch = RDCMAX(1U, ((w + 3) / 4)) * blockSize * RDCMAX(1U, h / 4);
-      }
-      else
-      {
-        mipSlicePitch = w * bytesPerPixel * h;
-      }
-
-      // we don't support slice ranges, only all-or-nothing
-      // we're also not dealing with multisampled slices if
-      // depth > 1. So if we only want one slice out of a 3D texture
-      // then make sure we get it
-      if(numSlices == 1)
-      {
-        byte *depthslice = new byte[mipSlicePitch];
-        byte *b = bytes + mipSlicePitch * sliceOffset;
-        memcpy(depthslice, b, slicePitch);
-        subdata.push_back(depthslice);
-
-        delete[] bytes;
-        continue;
-      }
-
-      s += (d - 1);
-
-      byte *b = bytes;
-
-      // add each depth slice as a separate subdata
-      for(uint32_t di = 0; di < d; di++)
-      {
-        byte *depthslice = new byte[mipSlicePitch];
-
-        memcpy(depthslice, b, mipSlicePitch);
+  // fetching has to stay on this thread as the replay device isn't thread-safe, but everything
+  // downstream of it - compositing, converting, compressing and writing - is spread across a pool
+  // of workers and overlapped with fetching where possible.
+  Threading::WorkerPool &pool = GetSavePool();
 
-        subdata.push_back(depthslice);
+  // work out up-front if the subresources are going to be composited into a single image, so each
+  // one can be copied into place and freed while the next is fetched. Should have been handled
+  // above, but verify incoming data is RGBA8
+  bool rgba8 = (td.format.compByteWidth == 1 && td.format.compCount == 4);
 
-        b += mipSlicePitch;
-      }
+  bool compositeGrid = sd.slice.slicesAsGrid && rgba8;
+  // cruciform needs exactly the 6 faces
+  bool compositeCruciform =
+      !compositeGrid && sd.slice.cubeCruciform && rgba8 && numSlices * numMips == 6;
 
-      delete[] bytes;
-    }
-  }
+  uint32_t compositeWidth = td.width;
+  uint32_t compositeHeight = td.height;
+  byte *compositeData = NULL;
+  std::vector<CompositeSliceJob> compositeJobs;
 
-  // should have been handled above, but verify incoming data is RGBA8
-  if(sd.slice.slicesAsGrid && td.format.compByteWidth == 1 && td.format.compCount == 4)
+  if(compositeGrid)
   {
-    uint32_t sliceWidth = td.width;
-    uint32_t sliceHeight = td.height;
-
     uint32_t sliceGridHeight = (td.arraysize * td.depth) / sd.slice.sliceGridWidth;
     if((td.arraysize * td.depth) % sd.slice.sliceGridWidth != 0)
       sliceGridHeight++;
 
-    td.width *= sd.slice.sliceGridWidth;
-    td.height *= sliceGridHeight;
-
-    byte *combinedData = new byte[td.width * td.height * td.format.compCount];
+    compositeWidth *= sd.slice.sliceGridWidth;
+    compositeHeight *= sliceGridHeight;
 
-    memset(combinedData, 0, td.width * td.height * td.format.compCount);
+    compositeJobs.resize(sd.slice.sliceGridWidth * sliceGridHeight);
 
-    for(size_t i = 0; i < subdata.size(); i++)
+    for(size_t i = 0; i < compositeJobs.size(); i++)
     {
       uint32_t gridx = (uint32_t)i % sd.slice.sliceGridWidth;
       uint32_t gridy = (uint32_t)i / sd.slice.sliceGridWidth;
 
-      uint32_t yoffs = gridy * sliceHeight;
-      uint32_t xoffs = gridx * sliceWidth;
-
-      for(uint32_t y = 0; y < sliceHeight; y++)
-      {
-        for(uint32_t x = 0; x < sliceWidth; x++)
-        {
-          uint32_t *srcpix = (uint32_t *)&subdata[i][(y * sliceWidth + x) * 4 + 0];
-          uint32_t *dstpix = (uint32_t *)&combinedData[((y + yoffs) * td.width + x + xoffs) * 4 + 0];
-
-          *dstpix = *srcpix;
-        }
-      }
-
-      delete[] subdata[i];
+      compositeJobs[i].xoffs = gridx * td.width;
+      compositeJobs[i].yoffs = gridy * td.height;
     }
-
-    subdata.resize(1);
-    subdata[0] = combinedData;
-    rowPitch = td.width * 4;
   }
-
-  // should have been handled above, but verify incoming data is RGBA8 and 6 slices
-  if(sd.slice.cubeCruciform && td.format.compByteWidth == 1 && td.format.compCount == 4 &&
-     subdata.size() == 6)
+  else if(compositeCruciform)
   {
-    uint32_t sliceWidth = td.width;
-    uint32_t sliceHeight = td.height;
-
-    td.width *= 4;
-    td.height *= 3;
-
-    byte *combinedData = new byte[td.width * td.height * td.format.compCount];
-
-    memset(combinedData, 0, td.width * td.height * td.format.compCount);
+    compositeWidth *= 4;
+    compositeHeight *= 3;
 
     /*
      Y X=0   1   2   3
@@ -849,142 +916,276 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
     uint32_t gridx[6] = {2, 0, 1, 1, 1, 3};
     uint32_t gridy[6] = {1, 1, 0, 2, 1, 1};
 
-    for(size_t i = 0; i < subdata.size(); i++)
+    compositeJobs.resize(6);
+
+    for(size_t i = 0; i < compositeJobs.size(); i++)
     {
-      uint32_t yoffs = gridy[i] * sliceHeight;
-      uint32_t xoffs = gridx[i] * sliceWidth;
+      compositeJobs[i].xoffs = gridx[i] * td.width;
+      compositeJobs[i].yoffs = gridy[i] * td.height;
+    }
+  }
 
-      for(uint32_t y = 0; y < sliceHeight; y++)
-      {
-        for(uint32_t x = 0; x < sliceWidth; x++)
-        {
-          uint32_t *srcpix = (uint32_t *)&subdata[i][(y * sliceWidth + x) * 4 + 0];
-          uint32_t *dstpix = (uint32_t *)&combinedData[((y + yoffs) * td.width + x + xoffs) * 4 + 0];
+  if(!compositeJobs.empty())
+  {
+    compositeData = new byte[compositeWidth * compositeHeight * 4];
 
-          *dstpix = *srcpix;
-        }
-      }
+    memset(compositeData, 0, compositeWidth * compositeHeight * 4);
 
-      delete[] subdata[i];
+    for(size_t i = 0; i < compositeJobs.size(); i++)
+    {
+      compositeJobs[i].src = NULL;
+      compositeJobs[i].dst = compositeData;
+      compositeJobs[i].sliceWidth = td.width;
+      compositeJobs[i].sliceHeight = td.height;
+      compositeJobs[i].dstWidth = compositeWidth;
     }
-
-    subdata.resize(1);
-    subdata[0] = combinedData;
-    rowPitch = td.width * 4;
   }
 
-  int numComps = td.format.compCount;
+  // if we want a grayscale image of one channel of 8-bit data, it's splatted in place before any
+  // other conversion.
+  bool extractBytes = (sd.channelExtract >= 0 && td.format.compByteWidth == 1 &&
+                       (uint32_t)sd.channelExtract < td.format.compCount);
+
+  ByteConvertJob convert = {};
+  convert.width = td.width;
+  convert.height = td.height;
+  convert.srcComps = convert.dstComps = td.format.compCount;
+  convert.channelExtract = extractBytes ? sd.channelExtract : -1;
+  convert.alpha = sd.alpha;
+  convert.alphaCol = sd.alphaCol;
+  convert.alphaColSecondary = sd.alphaColSecondary;
 
-  // if we want a grayscale image of one channel, splat it across all channels
-  // and set alpha to full
-  if(sd.channelExtract >= 0 && td.format.compByteWidth == 1 &&
-     (uint32_t)sd.channelExtract < td.format.compCount)
+  // DDS is streamed straight out to disk, each subresource written as soon as it has been fetched
+  FILE *f = NULL;
+
+  dds_data ddsData = {};
+  DDSWriteJob ddsWrite;
+
+  if(sd.destType == eFileType_DDS)
   {
-    uint32_t cc = td.format.compCount;
+    ddsData.width = td.width;
+    ddsData.height = td.height;
+    ddsData.depth = td.depth;
+    ddsData.format = td.format;
+    ddsData.mips = numMips;
+    ddsData.slices = numSlices / td.depth;
+    ddsData.subdata = NULL;
+    ddsData.cubemap = td.cubemap && numSlices == 6;
 
-    for(uint32_t y = 0; y < td.height; y++)
+    f = FileIO::fopen(path, "wb");
+
+    if(!f)
+      return false;
+
+    if(!write_dds_header(f, ddsData))
     {
-      for(uint32_t x = 0; x < td.width; x++)
-      {
-        subdata[0][(y * td.width + x) * cc + 0] =
-            subdata[0][(y * td.width + x) * cc + sd.channelExtract];
-        if(cc >= 2)
-          subdata[0][(y * td.width + x) * cc + 1] =
-              subdata[0][(y * td.width + x) * cc + sd.channelExtract];
-        if(cc >= 3)
-          subdata[0][(y * td.width + x) * cc + 2] =
-              subdata[0][(y * td.width + x) * cc + sd.channelExtract];
-        if(cc >= 4)
-          subdata[0][(y * td.width + x) * cc + 3] = 255;
-      }
+      FileIO::fclose(f);
+      return false;
     }
+
+    ddsWrite.f = f;
+    ddsWrite.dds = &ddsData;
   }
 
-  // handle formats that don't support alpha
-  if(numComps == 4 && (sd.destType == eFileType_BMP || sd.destType == eFileType_JPG))
+  vector<byte *> subdata;
+  vector<byte *> fetched;
+  size_t subresourceIndex = 0;
+
+  // loop over fetching subresources
+  for(uint32_t s = 0; s < numSlices; s++)
   {
-    byte *nonalpha = new byte[td.width * td.height * 3];
+    uint32_t slice = s * sliceStride + sliceOffset;
 
-    for(uint32_t y = 0; y < td.height; y++)
+    for(uint32_t m = 0; m < numMips; m++)
     {
-      for(uint32_t x = 0; x < td.width; x++)
+      uint32_t mip = m + mipOffset;
+
+      GetTextureDataParams params;
+      params.forDiskSave = true;
+      params.typeHint = sd.typeHint;
+      params.resolve = resolveSamples;
+      params.remap = downcast ? eRemap_RGBA8 : eRemap_None;
+      params.blackPoint = sd.comp.blackPoint;
+      params.whitePoint = sd.comp.whitePoint;
+
+      size_t datasize = 0;
+      byte *bytes = m_pDevice->GetTextureData(liveid, slice, mip, params, datasize);
+
+      if(bytes == NULL)
+      {
+        RDCERR("Couldn't get bytes for mip %u, slice %u", mip, slice);
+
+        pool.WaitAll();
+
+        for(size_t i = 0; i < subdata.size(); i++)
+          delete[] subdata[i];
+
+        delete[] compositeData;
+
+        if(f)
+        {
+          FileIO::fclose(f);
+          FileIO::Delete(path);
+        }
+
+        return false;
+      }
+
+      fetched.clear();
+
+      if(td.depth == 1)
       {
-        byte r = subdata[0][(y * td.width + x) * 4 + 0];
-        byte g = subdata[0][(y * td.width + x) * 4 + 1];
-        byte b = subdata[0][(y * td.width + x) * 4 + 2];
-        byte a = subdata[0][(y * td.width + x) * 4 + 3];
+        fetched.push_back(bytes);
+      }
+      else
+      {
+        uint32_t mipSlicePitch = slicePitch;
+
+        uint32_t w = RDCMAX(1U, td.width >> m);
+        uint32_t h = RDCMAX(1U, td.height >> m);
+        uint32_t d = RDCMAX(1U, td.depth >> m);
+
+        if(blockformat)
+        {
+          mipSlicePitch = RDCMAX(1U, ((w + 3) / 4)) * blockSize * RDCMAX(1U, h / 4);
+        }
+        else
+        {
+          mipSlicePitch = w * bytesPerPixel * h;
+        }
 
-        if(sd.alpha != eAlphaMap_Discard)
+        // we don't support slice ranges, only all-or-nothing
+        // we're also not dealing with multisampled slices if
+        // depth > 1. So if we only want one slice out of a 3D texture
+        // then make sure we get it
+        if(numSlices == 1)
+        {
+          byte *depthslice = new byte[mipSlicePitch];
+          byte *b = bytes + mipSlicePitch * sliceOffset;
+          memcpy(depthslice, b, slicePitch);
+          fetched.push_back(depthslice);
+        }
+        else
         {
-          FloatVector col = sd.alphaCol;
-          if(sd.alpha == eAlphaMap_BlendToCheckerboard)
+          s += (d - 1);
+
+          byte *b = bytes;
+
+          // add each depth slice as a separate subdata
+          for(uint32_t di = 0; di < d; di++)
           {
-            bool lightSquare = ((x / 64) % 2) == ((y / 64) % 2);
-            col = lightSquare ? sd.alphaCol : sd.alphaColSecondary;
+            byte *depthslice = new byte[mipSlicePitch];
+
+            memcpy(depthslice, b, mipSlicePitch);
+
+            fetched.push_back(depthslice);
+
+            b += mipSlicePitch;
           }
+        }
+
+        delete[] bytes;
+      }
 
-          col.x = powf(col.x, 1.0f / 2.2f);
-          col.y = powf(col.y, 1.0f / 2.2f);
-          col.z = powf(col.z, 1.0f / 2.2f);
+      for(size_t i = 0; i < fetched.size(); i++, subresourceIndex++)
+      {
+        byte *sub = fetched[i];
 
-          FloatVector pixel = FloatVector(float(r) / 255.0f, float(g) / 255.0f, float(b) / 255.0f,
-                                          float(a) / 255.0f);
+        if(f)
+        {
+          if(subresourceIndex == 0 && extractBytes)
+          {
+            convert.src = convert.dst = sub;
+            pool.ParallelFor((td.height + SaveBandRows - 1) / SaveBandRows, convert);
+          }
 
-          pixel.x = pixel.x * pixel.w + col.x * (1.0f - pixel.w);
-          pixel.y = pixel.y * pixel.w + col.y * (1.0f - pixel.w);
-          pixel.z = pixel.z * pixel.w + col.z * (1.0f - pixel.w);
+          // only one write is in flight at once, to keep the file in order while still overlapping
+          // writing with fetching the next subresource.
+          pool.Wait(&ddsWrite);
 
-          r = byte(pixel.x * 255.0f);
-          g = byte(pixel.y * 255.0f);
-          b = byte(pixel.z * 255.0f);
+          ddsWrite.mip = (int)m;
+          ddsWrite.data = sub;
+          pool.Submit(&ddsWrite);
         }
+        else if(compositeData)
+        {
+          if(subresourceIndex >= compositeJobs.size())
+          {
+            delete[] sub;
+            continue;
+          }
 
-        nonalpha[(y * td.width + x) * 3 + 0] = r;
-        nonalpha[(y * td.width + x) * 3 + 1] = g;
-        nonalpha[(y * td.width + x) * 3 + 2] = b;
+          compositeJobs[subresourceIndex].src = sub;
+          pool.Submit(&compositeJobs[subresourceIndex]);
+        }
+        else
+        {
+          subdata.push_back(sub);
+        }
       }
     }
+  }
+
+  pool.WaitAll();
+
+  if(sd.destType == eFileType_DDS)
+  {
+    FileIO::fclose(f);
+    return true;
+  }
 
-    delete[] subdata[0];
+  if(compositeData)
+  {
+    td.width = compositeWidth;
+    td.height = compositeHeight;
 
-    subdata[0] = nonalpha;
+    subdata.resize(1);
+    subdata[0] = compositeData;
+    rowPitch = td.width * 4;
 
-    numComps = 3;
-    rowPitch = td.width * 3;
+    convert.width = td.width;
+    convert.height = td.height;
   }
 
+  int numComps = td.format.compCount;
+
+  // handle formats that don't support alpha
+  convert.removeAlpha =
+      (numComps == 4 && (sd.destType == eFileType_BMP || sd.destType == eFileType_JPG));
+
   // assume that (R,G,0) is better mapping than (Y,A) for 2 component data
-  if(numComps == 2 && (sd.destType == eFileType_BMP || sd.destType == eFileType_JPG ||
-                       sd.destType == eFileType_PNG || sd.destType == eFileType_TGA))
-  {
-    byte *rg0 = new byte[td.width * td.height * 3];
+  convert.expandRG =
+      (numComps == 2 && (sd.destType == eFileType_BMP || sd.destType == eFileType_JPG ||
+                         sd.destType == eFileType_PNG || sd.destType == eFileType_TGA));
 
-    for(uint32_t y = 0; y < td.height; y++)
-    {
-      for(uint32_t x = 0; x < td.width; x++)
-      {
-        byte r = subdata[0][(y * td.width + x) * 2 + 0];
-        byte g = subdata[0][(y * td.width + x) * 2 + 1];
+  // discard alpha if requested
+  convert.discardAlpha = (numComps == 4 && sd.alpha == eAlphaMap_Discard &&
+                          (sd.destType == eFileType_PNG || sd.destType == eFileType_TGA));
 
-        rg0[(y * td.width + x) * 3 + 0] = r;
-        rg0[(y * td.width + x) * 3 + 1] = g;
-        rg0[(y * td.width + x) * 3 + 2] = 0;
+  if(extractBytes || convert.removeAlpha || convert.expandRG || convert.discardAlpha)
+  {
+    convert.src = convert.dst = subdata[0];
 
-        // if we're greyscaling the image, then keep the greyscale here.
-        if(sd.channelExtract >= 0)
-          rg0[(y * td.width + x) * 3 + 2] = r;
-      }
+    if(convert.removeAlpha || convert.expandRG)
+    {
+      convert.dstComps = 3;
+      convert.dst = new byte[td.width * td.height * 3];
     }
 
-    delete[] subdata[0];
+    pool.ParallelFor((td.height + SaveBandRows - 1) / SaveBandRows, convert);
 
-    subdata[0] = rg0;
+    if(convert.dst != convert.src)
+    {
+      delete[] subdata[0];
+
+      subdata[0] = convert.dst;
 
-    numComps = 3;
-    rowPitch = td.width * 3;
+      numComps = 3;
+      rowPitch = td.width * 3;
+    }
   }
 
-  FILE *f = FileIO::fopen(path, "wb");
+  f = FileIO::fopen(path, "wb");
 
   if(!f)
   {
@@ -992,22 +1193,7 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
   }
   else
   {
-    if(sd.destType == eFileType_DDS)
-    {
-      dds_data ddsData;
-
-      ddsData.width = td.width;
-      ddsData.height = td.height;
-      ddsData.depth = td.depth;
-      ddsData.format = td.format;
-      ddsData.mips = numMips;
-      ddsData.slices = numSlices / td.depth;
-      ddsData.subdata = &subdata[0];
-      ddsData.cubemap = td.cubemap && numSlices == 6;
-
-      success = write_dds_to_file(f, ddsData);
-    }
-    else if(sd.destType == eFileType_BMP)
+    if(sd.destType == eFileType_BMP)
     {
       int ret = stbi_write_bmp_to_func(fileWriteFunc, (void *)f, td.width, td.height, numComps,
                                        subdata[0]);
@@ -1015,20 +1201,10 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
     }
     else if(sd.destType == eFileType_PNG)
     {
-      // discard alpha if requested
-      for(uint32_t p = 0; sd.alpha == eAlphaMap_Discard && p < td.width * td.height; p++)
-        subdata[0][p * 4 + 3] = 255;
-
-      int ret = stbi_write_png_to_func(fileWriteFunc, (void *)f, td.width, td.height, numComps,
-                                       subdata[0], rowPitch);
-      success = (ret != 0);
+      success = write_png_to_file(f, subdata[0], td.width, td.height, numComps, rowPitch, pool);
     }
     else if(sd.destType == eFileType_TGA)
     {
-      // discard alpha if requested
-      for(uint32_t p = 0; sd.alpha == eAlphaMap_Discard && p < td.width * td.height; p++)
-        subdata[0][p * 4 + 3] = 255;
-
       int ret = stbi_write_tga_to_func(fileWriteFunc, (void *)f, td.width, td.height, numComps,
                                        subdata[0]);
       success = (ret != 0);
@@ -1055,174 +1231,40 @@ bool ReplayRenderer::SaveTexture(const TextureSave &saveData, const char *path)
     }
     else if(sd.destType == eFileType_HDR || sd.destType == eFileType_EXR)
     {
-      float *fldata = NULL;
-      float *abgr[4] = {NULL, NULL, NULL, NULL};
+      FloatDecodeContext decode;
+      decode.src = subdata[0];
+      decode.format = td.format;
+      decode.width = td.width;
+      decode.channelExtract = sd.channelExtract;
+      decode.clampNegative = (sd.destType == eFileType_HDR);
+
+      decode.pixelSize = td.format.compCount * td.format.compByteWidth;
+      if(td.format.special && (td.format.specialFormat == eSpecial_R10G10B10A2 ||
+                               td.format.specialFormat == eSpecial_R11G11B10))
+        decode.pixelSize = sizeof(uint32_t);
 
       if(sd.destType == eFileType_HDR)
       {
-        fldata = new float[td.width * td.height * 4];
-      }
-      else
-      {
-        abgr[0] = new float[td.width * td.height];
-        abgr[1] = new float[td.width * td.height];
-        abgr[2] = new float[td.width * td.height];
-        abgr[3] = new float[td.width * td.height];
-      }
-
-      byte *srcData = subdata[0];
-
-      for(uint32_t y = 0; y < td.height; y++)
-      {
-        for(uint32_t x = 0; x < td.width; x++)
-        {
-          float r = 0.0f;
-          float g = 0.0f;
-          float b = 0.0f;
-          float a = 1.0f;
-
-          if(td.format.special && td.format.specialFormat == eSpecial_R10G10B10A2)
-          {
-            uint32_t *u32 = (uint32_t *)srcData;
-
-            Vec4f vec = ConvertFromR10G10B10A2(*u32);
-
-            r = vec.x;
-            g = vec.y;
-            b = vec.z;
-            a = vec.w;
-
-            srcData += 4;
-          }
-          else if(td.format.special && td.format.specialFormat == eSpecial_R11G11B10)
-          {
-            uint32_t *u32 = (uint32_t *)srcData;
-
-            Vec3f vec = ConvertFromR11G11B10(*u32);
-
-            r = vec.x;
-            g = vec.y;
-            b = vec.z;
-            a = 1.0f;
-
-            srcData += 4;
-          }
-          else
-          {
-            if(td.format.compCount >= 1)
-              r = ConvertComponent(td.format, srcData + td.format.compByteWidth * 0);
-            if(td.format.compCount >= 2)
-              g = ConvertComponent(td.format, srcData + td.format.compByteWidth * 1);
-            if(td.format.compCount >= 3)
-              b = ConvertComponent(td.format, srcData + td.format.compByteWidth * 2);
-            if(td.format.compCount >= 4)
-              a = ConvertComponent(td.format, srcData + td.format.compByteWidth * 3);
-
-            srcData += td.format.compCount * td.format.compByteWidth;
-          }
-
-          if(td.format.bgraOrder)
-            std::swap(r, b);
+        float *fldata = new float[td.width * td.height * 4];
 
-          // HDR can't represent negative values
-          if(sd.destType == eFileType_HDR)
-          {
-            r = RDCMAX(r, 0.0f);
-            g = RDCMAX(g, 0.0f);
-            b = RDCMAX(b, 0.0f);
-            a = RDCMAX(a, 0.0f);
-          }
-
-          if(sd.channelExtract == 0)
-          {
-            g = b = r;
-            a = 1.0f;
-          }
-          if(sd.channelExtract == 1)
-          {
-            r = b = g;
-            a = 1.0f;
-          }
-          if(sd.channelExtract == 2)
-          {
-            r = g = b;
-            a = 1.0f;
-          }
-          if(sd.channelExtract == 3)
-          {
-            r = g = b = a;
-            a = 1.0f;
-          }
+        HDRConvertJob convertHDR;
+        convertHDR.ctx = &decode;
+        convertHDR.height = td.height;
+        convertHDR.dst = fldata;
 
-          if(fldata)
-          {
-            fldata[(y * td.width + x) * 4 + 0] = r;
-            fldata[(y * td.width + x) * 4 + 1] = g;
-            fldata[(y * td.width + x) * 4 + 2] = b;
-            fldata[(y * td.width + x) * 4 + 3] = a;
-          }
-          else
-          {
-            abgr[0][(y * td.width + x)] = a;
-            abgr[1][(y * td.width + x)] = b;
-            abgr[2][(y * td.width + x)] = g;
-            abgr[3][(y * td.width + x)] = r;
-          }
-        }
-      }
+        pool.ParallelFor((td.height + SaveBandRows - 1) / SaveBandRows, convertHDR);
 
-      if(sd.destType == eFileType_HDR)
-      {
         int ret = stbi_write_hdr_to_func(fileWriteFunc, (void *)f, td.width, td.height, 4, fldata);
         success = (ret != 0);
-      }
-      else if(sd.destType == eFileType_EXR)
-      {
-        const char *err = NULL;
-
-        EXRImage exrImage;
-        InitEXRImage(&exrImage);
-
-        int pixTypes[4] = {TINYEXR_PIXELTYPE_FLOAT, TINYEXR_PIXELTYPE_FLOAT,
-                           TINYEXR_PIXELTYPE_FLOAT, TINYEXR_PIXELTYPE_FLOAT};
-        int reqTypes[4] = {TINYEXR_PIXELTYPE_HALF, TINYEXR_PIXELTYPE_HALF, TINYEXR_PIXELTYPE_HALF,
-                           TINYEXR_PIXELTYPE_HALF};
 
-        // must be in this order as many viewers don't pay attention to channels and just assume
-        // they are in this order
-        const char *bgraNames[4] = {"A", "B", "G", "R"};
-
-        exrImage.num_channels = 4;
-        exrImage.channel_names = bgraNames;
-        exrImage.images = (unsigned char **)abgr;
-        exrImage.width = td.width;
-        exrImage.height = td.height;
-        exrImage.pixel_types = pixTypes;
-        exrImage.requested_pixel_types = reqTypes;
-
-        unsigned char *mem = NULL;
-
-        size_t ret = SaveMultiChannelEXRToMemory(&exrImage, &mem, &err);
-
-        success = (ret > 0);
-        if(success)
-          FileIO::fwrite(mem, 1, ret, f);
-        else
-          RDCERR("Error saving EXR file %d: '%s'", ret, err);
-
-        free(mem);
-      }
-
-      if(fldata)
-      {
         delete[] fldata;
       }
-      else
+      else if(sd.destType == eFileType_EXR)
       {
-        delete[] abgr[0];
-        delete[] abgr[1];
-        delete[] abgr[2];
-        delete[] abgr[3];
+        success = write_exr_to_file(f, td.width, td.height, &DecodeEXRRow, &decode, pool);
+
+        if(!success)
+          RDCERR("Error saving EXR file");
       }
     }
 
@@ -1504,6 +1546,9 @@ bool ReplayRenderer::ReplaceResource(ResourceId from, ResourceId to)
 {
   m_pDevice->ReplaceResource(from, to);
 
+  // the replaced shader's reflection may have changed
+  m_ShaderReflections.clear();
+
   SetFrameEvent(m_EventID, true);
 
   for(size_t i = 0; i < m_Outputs.size(); i++)
@@ -1517,6 +1562,9 @@ bool ReplayRenderer::RemoveReplacement(ResourceId id)
 {
   m_pDevice->RemoveReplacement(id);
 
+  // the replaced shader's reflection may have changed
+  m_ShaderReflections.clear();
+
   SetFrameEvent(m_EventID, true);
 
   for(size_t i = 0; i < m_Outputs.size(); i++)
@@ -1573,6 +1621,8 @@ ReplayCreateStatus ReplayRenderer::PostCreateInit(IReplayDriver *device)
 
   m_pDevice->ReadLogInitialisation();
 
+  m_APIProps = m_pDevice->GetAPIProperties();
+
   FetchPipelineState();
 
   FetchFrameRecord fr = m_pDevice->GetFrameRecord();
@@ -1605,58 +1655,86 @@ bool ReplayRenderer::InitResolver()
   return m_pDevice->GetCallstackResolver() != NULL;
 }
 
+ShaderReflection *ReplayRenderer::GetShaderDetails(ResourceId shader, const char *entryPoint)
+{
+  if(shader == ResourceId())
+    return NULL;
+
+  std::pair<ResourceId, std::string> key(shader, entryPoint);
+
+  auto it = m_ShaderReflections.find(key);
+  if(it != m_ShaderReflections.end())
+    return it->second;
+
+  ShaderReflection *refl = m_pDevice->GetShader(m_pDevice->GetLiveID(shader), entryPoint);
+
+  // a failed lookup isn't necessarily permanent, so only cache successful ones
+  if(refl)
+    m_ShaderReflections[key] = refl;
+
+  return refl;
+}
+
 void ReplayRenderer::FetchPipelineState()
 {
   m_pDevice->SavePipelineState();
 
-  m_D3D11PipelineState = m_pDevice->GetD3D11PipelineState();
-  m_D3D12PipelineState = m_pDevice->GetD3D12PipelineState();
-  m_GLPipelineState = m_pDevice->GetGLPipelineState();
-  m_VulkanPipelineState = m_pDevice->GetVulkanPipelineState();
-
+  // copying the state structs is deep, so skip the three that the driver leaves empty.
+  switch(m_APIProps.pipelineType)
   {
-    D3D11PipelineState::ShaderStage *stages[] = {
-        &m_D3D11PipelineState.m_VS, &m_D3D11PipelineState.m_HS, &m_D3D11PipelineState.m_DS,
-        &m_D3D11PipelineState.m_GS, &m_D3D11PipelineState.m_PS, &m_D3D11PipelineState.m_CS,
-    };
-
-    for(int i = 0; i < 6; i++)
-      if(stages[i]->Shader != ResourceId())
-        stages[i]->ShaderDetails = m_pDevice->GetShader(m_pDevice->GetLiveID(stages[i]->Shader), "");
-  }
+    case eGraphicsAPI_D3D11:
+    {
+      m_D3D11PipelineState = m_pDevice->GetD3D11PipelineState();
 
-  {
-    D3D12PipelineState::ShaderStage *stages[] = {
-        &m_D3D12PipelineState.m_VS, &m_D3D12PipelineState.m_HS, &m_D3D12PipelineState.m_DS,
-        &m_D3D12PipelineState.m_GS, &m_D3D12PipelineState.m_PS, &m_D3D12PipelineState.m_CS,
-    };
-
-    for(int i = 0; i < 6; i++)
-      if(stages[i]->Shader != ResourceId())
-        stages[i]->ShaderDetails = m_pDevice->GetShader(m_pDevice->GetLiveID(stages[i]->Shader), "");
-  }
+      D3D11PipelineState::ShaderStage *stages[] = {
+          &m_D3D11PipelineState.m_VS, &m_D3D11PipelineState.m_HS, &m_D3D11PipelineState.m_DS,
+          &m_D3D11PipelineState.m_GS, &m_D3D11PipelineState.m_PS, &m_D3D11PipelineState.m_CS,
+      };
 
-  {
-    GLPipelineState::ShaderStage *stages[] = {
-        &m_GLPipelineState.m_VS, &m_GLPipelineState.m_TCS, &m_GLPipelineState.m_TES,
-        &m_GLPipelineState.m_GS, &m_GLPipelineState.m_FS,  &m_GLPipelineState.m_CS,
-    };
-
-    for(int i = 0; i < 6; i++)
-      if(stages[i]->Shader != ResourceId())
-        stages[i]->ShaderDetails = m_pDevice->GetShader(m_pDevice->GetLiveID(stages[i]->Shader), "");
-  }
+      for(int i = 0; i < 6; i++)
+        stages[i]->ShaderDetails = GetShaderDetails(stages[i]->Shader, "");
+      break;
+    }
+    case eGraphicsAPI_D3D12:
+    {
+      m_D3D12PipelineState = m_pDevice->GetD3D12PipelineState();
 
-  {
-    VulkanPipelineState::ShaderStage *stages[] = {
-        &m_VulkanPipelineState.m_VS, &m_VulkanPipelineState.m_TCS, &m_VulkanPipelineState.m_TES,
-        &m_VulkanPipelineState.m_GS, &m_VulkanPipelineState.m_FS,  &m_VulkanPipelineState.m_CS,
-    };
-
-    for(int i = 0; i < 6; i++)
-      if(stages[i]->Shader != ResourceId())
-        stages[i]->ShaderDetails = m_pDevice->GetShader(m_pDevice->GetLiveID(stages[i]->Shader),
-                                                        stages[i]->entryPoint.elems);
+      D3D12PipelineState::ShaderStage *stages[] = {
+          &m_D3D12PipelineState.m_VS, &m_D3D12PipelineState.m_HS, &m_D3D12PipelineState.m_DS,
+          &m_D3D12PipelineState.m_GS, &m_D3D12PipelineState.m_PS, &m_D3D12PipelineState.m_CS,
+      };
+
+      for(int i = 0; i < 6; i++)
+        stages[i]->ShaderDetails = GetShaderDetails(stages[i]->Shader, "");
+      break;
+    }
+    case eGraphicsAPI_OpenGL:
+    {
+      m_GLPipelineState = m_pDevice->GetGLPipelineState();
+
+      GLPipelineState::ShaderStage *stages[] = {
+          &m_GLPipelineState.m_VS, &m_GLPipelineState.m_TCS, &m_GLPipelineState.m_TES,
+          &m_GLPipelineState.m_GS, &m_GLPipelineState.m_FS,  &m_GLPipelineState.m_CS,
+      };
+
+      for(int i = 0; i < 6; i++)
+        stages[i]->ShaderDetails = GetShaderDetails(stages[i]->Shader, "");
+      break;
+    }
+    case eGraphicsAPI_Vulkan:
+    {
+      m_VulkanPipelineState = m_pDevice->GetVulkanPipelineState();
+
+      VulkanPipelineState::ShaderStage *stages[] = {
+          &m_VulkanPipelineState.m_VS, &m_VulkanPipelineState.m_TCS, &m_VulkanPipelineState.m_TES,
+          &m_VulkanPipelineState.m_GS, &m_VulkanPipelineState.m_FS,  &m_VulkanPipelineState.m_CS,
+      };
+
+      for(int i = 0; i < 6; i++)
+        stages[i]->ShaderDetails =
+            GetShaderDetails(stages[i]->Shader, stages[i]->entryPoint.elems);
+      break;
+    }
   }
 }
 
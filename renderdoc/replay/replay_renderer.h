@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <map>
 #include <set>
 #include <vector>
 #include "api/replay/renderdoc_replay.h"
@@ -34,6 +35,12 @@
 #include "type_helpers.h"
 
 struct ReplayRenderer;
+class MeshPicker;
+
+namespace Threading
+{
+class WorkerPool;
+};
 
 struct ReplayOutput : public IReplayOutput
 {
@@ -75,6 +82,9 @@ private:
 
   void DisplayMesh();
 
+  uint32_t PickMeshVertex(uint32_t instance, const MeshDisplay &cfg, uint32_t x, uint32_t y);
+  void ClearMeshPickers();
+
   ReplayRenderer *m_pRenderer;
 
   bool m_OverlayDirty;
@@ -107,6 +117,9 @@ private:
 
   vector<uint32_t> passEvents;
 
+  // pickers for the meshes picked at the current event, most recently used first
+  std::vector<MeshPicker *> m_MeshPickers;
+
   int32_t m_Width;
   int32_t m_Height;
 
@@ -199,7 +212,11 @@ private:
 
   FetchDrawcall *GetDrawcallByEID(uint32_t eventID);
 
+  ShaderReflection *GetShaderDetails(ResourceId shader, const char *entryPoint);
+
   IReplayDriver *GetDevice() { return m_pDevice; }
+  Threading::WorkerPool &GetSavePool();
+
   struct FrameRecord
   {
     FetchFrameInfo frameInfo;
@@ -211,6 +228,9 @@ private:
 
   uint32_t m_EventID;
 
+  APIProperties m_APIProps;
+
+  // only the state for m_APIProps.pipelineType is ever fetched, the others stay default
   D3D11PipelineState m_D3D11PipelineState;
   D3D12PipelineState m_D3D12PipelineState;
   GLPipelineState m_GLPipelineState;
@@ -226,5 +246,17 @@ private:
   std::set<ResourceId> m_TargetResources;
   std::set<ResourceId> m_CustomShaders;
 
+  // reflection data is owned by the driver and lives as long as the capture, so it only needs to
+  // be looked up once for each (original shader ID, entry point). Only successful lookups are
+  // cached.
+  std::map<std::pair<ResourceId, std::string>, ShaderReflection *> m_ShaderReflections;
+
+  // callstacks from a draw loop share most of their frames, so each address is only resolved once
+  std::map<uint64_t, std::string> m_ResolvedFrames;
+
+  // workers for SaveTexture, created on first use and kept so that saving many textures in a row
+  // doesn't start and stop threads for each one
+  Threading::WorkerPool *m_SavePool;
+
   friend struct ReplayOutput;
 };
@@ -0,0 +1,447 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "callstack_table.h"
+#include <string.h>
+#include "common/common.h"
+#include "common/threading.h"
+
+// each thread keeps a small cache of the stacks it interned most recently, which is checked without
+// taking the table's lock. Only the capture's table interns stacks so one cache per thread is
+// enough, it's reset if it's used with a different table or the table has reclaimed stacks since it
+// was filled. The caches are small and are never freed.
+struct InternCache
+{
+  static const size_t Size = 64;
+
+  const CallstackTable *table;
+  int32_t generation;
+  uint64_t hashes[Size];
+  uint32_t ids[Size];
+};
+
+static InternCache *GetInternCache(const CallstackTable *table)
+{
+  static uint64_t slot = Threading::AllocateTLSSlot();
+
+  InternCache *cache = (InternCache *)Threading::GetTLSValue(slot);
+
+  if(cache == NULL)
+  {
+    cache = new InternCache();
+    Threading::SetTLSValue(slot, (void *)cache);
+  }
+
+  if(cache->table != table)
+  {
+    cache->table = table;
+    memset(cache->ids, 0, sizeof(cache->ids));
+  }
+
+  return cache;
+}
+
+CallstackTable::CallstackTable()
+{
+  m_Blocks = new Node *[MaxBlocks];
+  memset(m_Blocks, 0, sizeof(Node *) * MaxBlocks);
+  m_NumNodes = 0;
+  m_Generation = 0;
+
+  // node 0 is the root, the empty stack
+  AddNode(0, 0);
+}
+
+CallstackTable::~CallstackTable()
+{
+  for(uint32_t i = 0; i < MaxBlocks; i++)
+    SAFE_DELETE_ARRAY(m_Blocks[i]);
+
+  SAFE_DELETE_ARRAY(m_Blocks);
+}
+
+void CallstackTable::Clear()
+{
+  // blocks are kept for re-use
+  m_NumNodes = 0;
+  m_FreeNodes.clear();
+  m_Children.clear();
+  m_Stacks.clear();
+  m_DecodedIDs.clear();
+}
+
+uint64_t CallstackTable::Hash(const uint64_t *addrs, size_t numLevels)
+{
+  // FNV-1a over the addresses, finishing with the depth
+  uint64_t hash = 14695981039346656037ULL;
+
+  for(size_t i = 0; i < numLevels; i++)
+  {
+    hash ^= addrs[i];
+    hash *= 1099511628211ULL;
+  }
+
+  hash ^= numLevels;
+  hash *= 1099511628211ULL;
+
+  return hash;
+}
+
+uint32_t CallstackTable::AddNode(uint32_t parent, uint64_t addr)
+{
+  uint32_t id = 0;
+
+  if(!m_FreeNodes.empty())
+  {
+    // a freed node's reference count is left alone, a thread that read a stale ID from its cache
+    // may still be about to undo the reference it took
+    id = m_FreeNodes.back();
+    m_FreeNodes.pop_back();
+  }
+  else
+  {
+    id = m_NumNodes++;
+
+    Node *&block = m_Blocks[id / NodesPerBlock];
+    if(block == NULL)
+      block = new Node[NodesPerBlock];
+
+    block[id % NodesPerBlock].refs = 0;
+  }
+
+  Node &node = GetNode(id);
+  node.addr = addr;
+  node.parent = parent;
+
+  // children hold a reference on their parent, so a caller can't be freed before its callees
+  if(id != 0)
+    Atomic::Inc32(&GetNode(parent).refs);
+
+  return id;
+}
+
+uint32_t CallstackTable::AddFrame(uint32_t parent, uint64_t addr)
+{
+  std::pair<uint32_t, uint64_t> key(parent, addr);
+
+  std::map<std::pair<uint32_t, uint64_t>, uint32_t>::iterator it = m_Children.find(key);
+  if(it != m_Children.end())
+    return it->second;
+
+  uint32_t id = AddNode(parent, addr);
+  m_Children[key] = id;
+
+  return id;
+}
+
+bool CallstackTable::Matches(uint32_t id, const uint64_t *addrs, size_t numLevels)
+{
+  for(size_t i = 0; i < numLevels; i++)
+  {
+    if(id == 0)
+      return false;
+
+    Node &node = GetNode(id);
+
+    if(node.addr != addrs[i])
+      return false;
+
+    id = node.parent;
+  }
+
+  return id == 0;
+}
+
+uint32_t CallstackTable::Intern(const uint64_t *addrs, size_t numLevels)
+{
+  if(addrs == NULL || numLevels == 0)
+    return 0;
+
+  uint64_t hash = Hash(addrs, numLevels);
+
+  InternCache *cache = GetInternCache(this);
+  size_t slot = size_t(hash % InternCache::Size);
+  uint32_t cached = cache->ids[slot];
+
+  // a stack this thread interned before was fully added before we got its ID. Taking the reference
+  // before checking the generation means that if it still matches, Reclaim will see the reference
+  // and can't free the stack, so it's safe to check it without the lock.
+  if(cached != 0 && cache->hashes[slot] == hash)
+  {
+    Atomic::Inc32(&GetNode(cached).refs);
+
+    if(cache->generation == Atomic::CmpExch32(&m_Generation, 0, 0) &&
+       Matches(cached, addrs, numLevels))
+      return cached;
+
+    Atomic::Dec32(&GetNode(cached).refs);
+  }
+
+  uint32_t id = 0;
+
+  {
+    SCOPED_LOCK(m_Lock);
+
+    if(cache->generation != m_Generation)
+    {
+      cache->generation = m_Generation;
+      memset(cache->ids, 0, sizeof(cache->ids));
+    }
+
+    std::unordered_map<uint64_t, uint32_t>::iterator it = m_Stacks.find(hash);
+    if(it != m_Stacks.end() && Matches(it->second, addrs, numLevels))
+    {
+      id = it->second;
+    }
+    else
+    {
+      if(uint64_t(m_NumNodes) - m_FreeNodes.size() + numLevels >
+         uint64_t(MaxBlocks) * NodesPerBlock)
+      {
+        RDCERR("Callstack table is full, dropping callstack");
+        return 0;
+      }
+
+      // walk down from the outermost frame, adding any frames we don't have yet
+      for(size_t i = numLevels; i > 0; i--)
+        id = AddFrame(id, addrs[i - 1]);
+
+      // on a hash collision the first stack keeps the fast path, this one always walks the trie
+      if(it == m_Stacks.end())
+        m_Stacks[hash] = id;
+    }
+
+    Atomic::Inc32(&GetNode(id).refs);
+
+    cache->hashes[slot] = hash;
+    cache->ids[slot] = id;
+  }
+
+  return id;
+}
+
+void CallstackTable::AddRefs(const std::vector<uint32_t> &ids)
+{
+  // the empty stack is never freed so isn't counted
+  for(size_t i = 0; i < ids.size(); i++)
+    if(ids[i] != 0)
+      Atomic::Inc32(&GetNode(ids[i]).refs);
+}
+
+void CallstackTable::Release(const std::vector<uint32_t> &ids)
+{
+  // stacks are only freed in Reclaim, so this doesn't need the lock
+  for(size_t i = 0; i < ids.size(); i++)
+    if(ids[i] != 0)
+      Atomic::Dec32(&GetNode(ids[i]).refs);
+}
+
+void CallstackTable::Reclaim()
+{
+  SCOPED_LOCK(m_Lock);
+
+  // bump the generation before looking at any reference counts. A thread that takes a reference
+  // through its cache after this sees the new generation and drops it again to take the lock, and
+  // one that took a reference before this is seen below and keeps its stack alive.
+  Atomic::Inc32(&m_Generation);
+
+  uint32_t numFreed = 0;
+
+  for(uint32_t i = 1; i < m_NumNodes; i++)
+  {
+    // freeing a frame drops its reference on its parent, which may then be freed too
+    uint32_t id = i;
+
+    while(id != 0)
+    {
+      Node &node = GetNode(id);
+
+      if(node.parent == FreeParent || Atomic::CmpExch32(&node.refs, 0, 0) != 0)
+        break;
+
+      uint32_t parent = node.parent;
+
+      m_Children.erase(std::make_pair(parent, node.addr));
+      node.parent = FreeParent;
+      m_FreeNodes.push_back(id);
+      numFreed++;
+
+      Atomic::Dec32(&GetNode(parent).refs);
+      id = parent;
+    }
+  }
+
+  if(numFreed == 0)
+    return;
+
+  for(std::unordered_map<uint64_t, uint32_t>::iterator it = m_Stacks.begin(); it != m_Stacks.end();)
+  {
+    if(GetNode(it->second).parent == FreeParent)
+      it = m_Stacks.erase(it);
+    else
+      ++it;
+  }
+
+  RDCDEBUG("Reclaimed %u of %u callstack frames", numFreed, m_NumNodes);
+}
+
+bool CallstackTable::Lookup(uint32_t id, std::vector<uint64_t> &addrs)
+{
+  addrs.clear();
+
+  SCOPED_LOCK(m_Lock);
+
+  if(!m_DecodedIDs.empty())
+  {
+    std::unordered_map<uint32_t, uint32_t>::iterator it = m_DecodedIDs.find(id);
+    if(it == m_DecodedIDs.end())
+      return false;
+
+    id = it->second;
+  }
+
+  if(id >= m_NumNodes)
+    return false;
+
+  while(id != 0)
+  {
+    Node &node = GetNode(id);
+    addrs.push_back(node.addr);
+    id = node.parent;
+  }
+
+  return true;
+}
+
+uint32_t CallstackTable::Encode(const std::vector<uint32_t> &stackIDs, std::vector<byte> &data)
+{
+  SCOPED_LOCK(m_Lock);
+
+  // only the referenced stacks are visited, so this costs the same however big the table is. The
+  // root is always written first as every stack ends there.
+  std::unordered_map<uint32_t, uint32_t> index;
+  std::vector<uint32_t> ids(1, 0);
+  std::vector<uint32_t> parents(1, 0);
+  std::vector<uint64_t> addrs(1, GetNode(0).addr);
+  std::vector<uint32_t> walk;
+
+  index[0] = 0;
+
+  for(size_t i = 0; i < stackIDs.size(); i++)
+  {
+    // gather the frames of this stack we haven't written yet, stopping at the first one we have
+    walk.clear();
+
+    uint32_t id = stackIDs[i];
+    while(id < m_NumNodes && GetNode(id).parent != FreeParent && index.find(id) == index.end())
+    {
+      walk.push_back(id);
+      id = GetNode(id).parent;
+    }
+
+    if(index.find(id) == index.end())
+    {
+      RDCERR("Callstack %u isn't in the table", stackIDs[i]);
+      continue;
+    }
+
+    // add them outermost first, so parents always come before their children
+    for(size_t w = walk.size(); w > 0; w--)
+    {
+      Node &node = GetNode(walk[w - 1]);
+
+      index[walk[w - 1]] = (uint32_t)ids.size();
+      ids.push_back(walk[w - 1]);
+      parents.push_back(index[node.parent]);
+      addrs.push_back(node.addr);
+    }
+  }
+
+  uint32_t count = (uint32_t)ids.size();
+
+  data.resize(sizeof(uint32_t) + count * (sizeof(uint32_t) * 2 + sizeof(uint64_t)));
+
+  byte *dst = &data[0];
+  memcpy(dst, &count, sizeof(count));
+  dst += sizeof(count);
+  memcpy(dst, &ids[0], count * sizeof(uint32_t));
+  dst += count * sizeof(uint32_t);
+  memcpy(dst, &parents[0], count * sizeof(uint32_t));
+  dst += count * sizeof(uint32_t);
+  memcpy(dst, &addrs[0], count * sizeof(uint64_t));
+
+  return count - 1;
+}
+
+bool CallstackTable::Decode(const byte *data, size_t size)
+{
+  uint32_t count = 0;
+
+  if(size < sizeof(count))
+    return false;
+
+  memcpy(&count, data, sizeof(count));
+  data += sizeof(count);
+
+  if(count == 0 ||
+     (size - sizeof(count)) / (sizeof(uint32_t) * 2 + sizeof(uint64_t)) < count ||
+     count > MaxBlocks * NodesPerBlock)
+  {
+    RDCERR("Truncated callstack table, %u frames in %llu bytes", count, (uint64_t)size);
+    return false;
+  }
+
+  std::vector<uint32_t> ids(count);
+  std::vector<uint32_t> parents(count);
+  std::vector<uint64_t> addrs(count);
+
+  memcpy(&ids[0], data, count * sizeof(uint32_t));
+  data += count * sizeof(uint32_t);
+  memcpy(&parents[0], data, count * sizeof(uint32_t));
+  data += count * sizeof(uint32_t);
+  memcpy(&addrs[0], data, count * sizeof(uint64_t));
+
+  // parents always come before their children, which also guarantees every walk ends at the root
+  for(uint32_t i = 1; i < count; i++)
+  {
+    if(parents[i] >= i)
+    {
+      RDCERR("Corrupt callstack table, frame %u has parent %u", i, parents[i]);
+      return false;
+    }
+  }
+
+  SCOPED_LOCK(m_Lock);
+
+  Clear();
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    AddNode(i == 0 ? 0 : parents[i], addrs[i]);
+    m_DecodedIDs[ids[i]] = i;
+  }
+
+  return true;
+}
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <stdint.h>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "api/replay/basic_types.h"
+#include "os/os_specific.h"
+
+// Interns callstacks so that each chunk only has to store a 32-bit ID, and the unique stacks are
+// written once into their own section of the capture.
+//
+// Stacks are stored as a prefix trie keyed from the outermost frame, so stacks with a common caller
+// share those frames. Each node is one frame - the ID of a stack is the node of its innermost frame
+// and ID 0 is the empty stack at the root.
+//
+// Every ID handed out by Intern holds a reference on its stack, and each holder releases it when it
+// drops the ID. Stacks that nothing refers to any more are only freed by Reclaim, which is called
+// between captures, so the table stays bounded by what live chunks use rather than growing for the
+// life of the process. IDs stay stable while referenced and nodes never move, so a thread can check
+// a stack it has already interned without taking the lock. Only adding a new stack is serialised.
+class CallstackTable
+{
+public:
+  CallstackTable();
+  ~CallstackTable();
+
+  // returns the ID for a stack, adding it if it hasn't been seen before. Addresses are innermost
+  // frame first, as returned by Callstack::Stackwalk. The caller owns one reference on the ID.
+  uint32_t Intern(const uint64_t *addrs, size_t numLevels);
+
+  // take or drop one reference on each ID, for holders that copy or discard interned IDs
+  void AddRefs(const std::vector<uint32_t> &ids);
+  void Release(const std::vector<uint32_t> &ids);
+
+  // frees every stack that's no longer referenced, so its nodes can be re-used
+  void Reclaim();
+
+  // fetches the frames for a stack ID, innermost first. Returns false if the ID isn't in the table.
+  bool Lookup(uint32_t id, std::vector<uint64_t> &addrs);
+
+  // only the given stacks and their callers are written, so a table that lives across captures
+  // only writes what each capture uses. The serialised form is the node count followed by every
+  // node's ID, then every node's parent as an index into the list, then every node's address,
+  // with parents always before their children. Returns the number of frames written.
+  uint32_t Encode(const std::vector<uint32_t> &stackIDs, std::vector<byte> &data);
+  bool Decode(const byte *data, size_t size);
+
+private:
+  struct Node
+  {
+    uint64_t addr;
+    uint32_t parent;
+    // references from holders of this ID, plus one for each child node
+    volatile int32_t refs;
+  };
+
+  // parent of a node that's been freed and is waiting on the free list
+  static const uint32_t FreeParent = ~0U;
+
+  static const uint32_t NodesPerBlock = 4096;
+  static const uint32_t MaxBlocks = 16384;
+
+  Node &GetNode(uint32_t id) { return m_Blocks[id / NodesPerBlock][id % NodesPerBlock]; }
+  uint32_t AddNode(uint32_t parent, uint64_t addr);
+  uint32_t AddFrame(uint32_t parent, uint64_t addr);
+  bool Matches(uint32_t id, const uint64_t *addrs, size_t numLevels);
+  void Clear();
+
+  static uint64_t Hash(const uint64_t *addrs, size_t numLevels);
+
+  Threading::CriticalSection m_Lock;
+
+  // nodes are allocated in fixed blocks that are never reallocated or freed. m_NumNodes is how many
+  // have ever been used, those freed by Reclaim are re-used before any new ones
+  Node **m_Blocks;
+  uint32_t m_NumNodes;
+  std::vector<uint32_t> m_FreeNodes;
+
+  // bumped by Reclaim before it frees anything, so threads know their cached IDs may be stale
+  volatile int32_t m_Generation;
+
+  // {parent, address} -> child node, to walk down the trie when interning a new stack
+  std::map<std::pair<uint32_t, uint64_t>, uint32_t> m_Children;
+
+  // hash of a whole stack -> ID. Draw loops submit the same handful of stacks over and over, so
+  // this lets a repeated stack be found with one lookup instead of walking the trie.
+  std::unordered_map<uint64_t, uint32_t> m_Stacks;
+
+  // for a decoded table, the IDs the capture used -> nodes in this table
+  std::unordered_map<uint32_t, uint32_t> m_DecodedIDs;
+};
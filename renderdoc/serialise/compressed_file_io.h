@@ -0,0 +1,221 @@
+/******************************************************************************
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2017 Baldur Karlsson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <string.h>
+#include "3rdparty/lz4/lz4.h"
+#include "common/common.h"
+#include "os/os_specific.h"
+
+// based on blockStreaming_doubleBuffer.c in lz4 examples
+struct CompressedFileIO
+{
+  // large block size
+  static const size_t BlockSize = 64 * 1024;
+
+  CompressedFileIO(FILE *f)
+  {
+    m_F = f;
+    LZ4_resetStream(&m_LZ4Comp);
+    LZ4_setStreamDecode(&m_LZ4Decomp, NULL, 0);
+    m_CompressedSize = m_UncompressedSize = 0;
+    m_PageIdx = m_PageOffset = 0;
+    m_PageData = 0;
+
+    m_CompressSize = LZ4_COMPRESSBOUND(BlockSize);
+    m_CompressBuf = new byte[m_CompressSize];
+  }
+
+  ~CompressedFileIO() { SAFE_DELETE_ARRAY(m_CompressBuf); }
+  uint32_t GetCompressedSize() { return m_CompressedSize; }
+  uint32_t GetUncompressedSize() { return m_UncompressedSize; }
+  // write out some data - accumulate into the input pages, then
+  // when a page is full call Flush() to flush it out to disk
+  void Write(const void *data, size_t len)
+  {
+    if(data == NULL || len == 0)
+      return;
+
+    m_UncompressedSize += (uint32_t)len;
+
+    const byte *src = (const byte *)data;
+
+    size_t remainder = 0;
+
+    // loop continually, writing up to BlockSize out of what remains of data
+    do
+    {
+      remainder = 0;
+
+      // if we're about to copy more than the page, copy only
+      // what will fit, then copy the remainder after flushing
+      if(m_PageOffset + len > BlockSize)
+      {
+        remainder = len - (BlockSize - m_PageOffset);
+        len = BlockSize - m_PageOffset;
+      }
+
+      memcpy(m_InPages[m_PageIdx] + m_PageOffset, src, len);
+      m_PageOffset += len;
+
+      if(remainder > 0)
+      {
+        Flush();    // this will swap the input pages and reset the page offset
+
+        src += len;
+        len = remainder;
+      }
+    } while(remainder > 0);
+  }
+
+  // flush out the current page to disk
+  void Flush()
+  {
+    // m_PageOffset is the amount written, usually equal to BlockSize except the last block.
+    int32_t compSize = LZ4_compress_fast_continue(&m_LZ4Comp, (const char *)m_InPages[m_PageIdx],
+                                                  (char *)m_CompressBuf, (int)m_PageOffset,
+                                                  (int)m_CompressSize, 1);
+
+    if(compSize < 0)
+    {
+      RDCERR("Error compressing: %i", compSize);
+      return;
+    }
+
+    FileIO::fwrite(&compSize, sizeof(compSize), 1, m_F);
+    FileIO::fwrite(m_CompressBuf, 1, compSize, m_F);
+
+    m_CompressedSize += compSize + sizeof(int32_t);
+
+    m_PageOffset = 0;
+    m_PageIdx = 1 - m_PageIdx;
+  }
+
+  // Reset back to 0, only makes sense when reading as writing can't be undone
+  void Reset()
+  {
+    LZ4_setStreamDecode(&m_LZ4Decomp, NULL, 0);
+    m_CompressedSize = m_UncompressedSize = 0;
+    m_PageIdx = 0;
+    m_PageOffset = 0;
+  }
+
+  // read out some data - if the input page is empty we fill
+  // the next page with data from disk
+  void Read(byte *data, size_t len)
+  {
+    if(data == NULL || len == 0)
+      return;
+
+    m_UncompressedSize += (uint32_t)len;
+
+    // loop continually, writing up to BlockSize out of what remains of data
+    do
+    {
+      size_t readamount = len;
+
+      // if we're about to copy more than the page, copy only
+      // what will fit, then copy the remainder after refilling
+      if(readamount > m_PageData)
+        readamount = m_PageData;
+
+      if(readamount > 0)
+      {
+        memcpy(data, m_InPages[m_PageIdx] + m_PageOffset, readamount);
+
+        m_PageOffset += readamount;
+        m_PageData -= readamount;
+
+        data += readamount;
+        len -= readamount;
+      }
+
+      if(len > 0)
+        FillBuffer();    // this will swap the input pages and reset the page offset
+    } while(len > 0);
+  }
+
+  void FillBuffer()
+  {
+    int32_t compSize = 0;
+
+    FileIO::fread(&compSize, sizeof(compSize), 1, m_F);
+    size_t numRead = FileIO::fread(m_CompressBuf, 1, compSize, m_F);
+
+    m_CompressedSize += compSize;
+
+    m_PageIdx = 1 - m_PageIdx;
+
+    int32_t decompSize = LZ4_decompress_safe_continue(
+        &m_LZ4Decomp, (const char *)m_CompressBuf, (char *)m_InPages[m_PageIdx], compSize, BlockSize);
+
+    if(decompSize < 0)
+    {
+      RDCERR("Error decompressing: %i (%i / %i)", decompSize, int(numRead), compSize);
+      return;
+    }
+
+    m_PageOffset = 0;
+    m_PageData = decompSize;
+  }
+
+  static void Decompress(byte *destBuf, const byte *srcBuf, size_t len)
+  {
+    LZ4_streamDecode_t lz4;
+    LZ4_setStreamDecode(&lz4, NULL, 0);
+
+    const byte *srcBufEnd = srcBuf + len;
+
+    while(srcBuf + 4 < srcBufEnd)
+    {
+      const int32_t *compSize = (const int32_t *)srcBuf;
+      srcBuf = (const byte *)(compSize + 1);
+
+      if(srcBuf + *compSize > srcBufEnd)
+        break;
+
+      int32_t decompSize = LZ4_decompress_safe_continue(&lz4, (const char *)srcBuf, (char *)destBuf,
+                                                        *compSize, BlockSize);
+
+      if(decompSize < 0)
+        return;
+
+      srcBuf += *compSize;
+      destBuf += decompSize;
+    }
+  }
+
+  LZ4_stream_t m_LZ4Comp;
+  LZ4_streamDecode_t m_LZ4Decomp;
+  FILE *m_F;
+  uint32_t m_CompressedSize, m_UncompressedSize;
+
+  byte m_InPages[2][BlockSize];
+  size_t m_PageIdx, m_PageOffset, m_PageData;
+
+  byte *m_CompressBuf;
+  size_t m_CompressSize;
+};
@@ -25,9 +25,11 @@
 
 #include "serialiser.h"
 #include <errno.h>
-#include "3rdparty/lz4/lz4.h"
+#include <algorithm>
 #include "common/timing.h"
+#include "common/tracing.h"
 #include "core/core.h"
+#include "serialise/compressed_file_io.h"
 #include "serialise/string_utils.h"
 
 #if ENABLED(RDOC_MSVS)
@@ -47,207 +49,50 @@ int64_t Chunk::m_MaxChunks = 0;
 const uint32_t Serialiser::MAGIC_HEADER = MAKE_FOURCC('R', 'D', 'O', 'C');
 const uint64_t Serialiser::BufferAlignment = 64;
 
-// based on blockStreaming_doubleBuffer.c in lz4 examples
-struct CompressedFileIO
+Chunk::Chunk(Serialiser *ser, uint32_t chunkType, bool temporary)
 {
-  // large block size
-  static const size_t BlockSize = 64 * 1024;
-
-  CompressedFileIO(FILE *f)
-  {
-    m_F = f;
-    LZ4_resetStream(&m_LZ4Comp);
-    LZ4_setStreamDecode(&m_LZ4Decomp, NULL, 0);
-    m_CompressedSize = m_UncompressedSize = 0;
-    m_PageIdx = m_PageOffset = 0;
-    m_PageData = 0;
-
-    m_CompressSize = LZ4_COMPRESSBOUND(BlockSize);
-    m_CompressBuf = new byte[m_CompressSize];
-  }
-
-  ~CompressedFileIO() { SAFE_DELETE_ARRAY(m_CompressBuf); }
-  uint32_t GetCompressedSize() { return m_CompressedSize; }
-  uint32_t GetUncompressedSize() { return m_UncompressedSize; }
-  // write out some data - accumulate into the input pages, then
-  // when a page is full call Flush() to flush it out to disk
-  void Write(const void *data, size_t len)
-  {
-    if(data == NULL || len == 0)
-      return;
-
-    m_UncompressedSize += (uint32_t)len;
-
-    const byte *src = (const byte *)data;
-
-    size_t remainder = 0;
-
-    // loop continually, writing up to BlockSize out of what remains of data
-    do
-    {
-      remainder = 0;
-
-      // if we're about to copy more than the page, copy only
-      // what will fit, then copy the remainder after flushing
-      if(m_PageOffset + len > BlockSize)
-      {
-        remainder = len - (BlockSize - m_PageOffset);
-        len = BlockSize - m_PageOffset;
-      }
-
-      memcpy(m_InPages[m_PageIdx] + m_PageOffset, src, len);
-      m_PageOffset += len;
-
-      if(remainder > 0)
-      {
-        Flush();    // this will swap the input pages and reset the page offset
-
-        src += len;
-        len = remainder;
-      }
-    } while(remainder > 0);
-  }
-
-  // flush out the current page to disk
-  void Flush()
-  {
-    // m_PageOffset is the amount written, usually equal to BlockSize except the last block.
-    int32_t compSize = LZ4_compress_fast_continue(&m_LZ4Comp, (const char *)m_InPages[m_PageIdx],
-                                                  (char *)m_CompressBuf, (int)m_PageOffset,
-                                                  (int)m_CompressSize, 1);
-
-    if(compSize < 0)
-    {
-      RDCERR("Error compressing: %i", compSize);
-      return;
-    }
-
-    FileIO::fwrite(&compSize, sizeof(compSize), 1, m_F);
-    FileIO::fwrite(m_CompressBuf, 1, compSize, m_F);
+  m_Length = (uint32_t)ser->GetOffset();
 
-    m_CompressedSize += compSize + sizeof(int32_t);
+  RDCASSERT(ser->GetOffset() < 0xffffffff);
 
-    m_PageOffset = 0;
-    m_PageIdx = 1 - m_PageIdx;
-  }
+  m_ChunkType = chunkType;
 
-  // Reset back to 0, only makes sense when reading as writing can't be undone
-  void Reset()
-  {
-    LZ4_setStreamDecode(&m_LZ4Decomp, NULL, 0);
-    m_CompressedSize = m_UncompressedSize = 0;
-    m_PageIdx = 0;
-    m_PageOffset = 0;
-  }
+  m_Temporary = temporary;
 
-  // read out some data - if the input page is empty we fill
-  // the next page with data from disk
-  void Read(byte *data, size_t len)
+  if(ser->HasAlignedData())
   {
-    if(data == NULL || len == 0)
-      return;
-
-    m_UncompressedSize += (uint32_t)len;
-
-    // loop continually, writing up to BlockSize out of what remains of data
-    do
-    {
-      size_t readamount = len;
-
-      // if we're about to copy more than the page, copy only
-      // what will fit, then copy the remainder after refilling
-      if(readamount > m_PageData)
-        readamount = m_PageData;
-
-      if(readamount > 0)
-      {
-        memcpy(data, m_InPages[m_PageIdx] + m_PageOffset, readamount);
-
-        m_PageOffset += readamount;
-        m_PageData -= readamount;
-
-        data += readamount;
-        len -= readamount;
-      }
-
-      if(len > 0)
-        FillBuffer();    // this will swap the input pages and reset the page offset
-    } while(len > 0);
+    m_Data = Serialiser::AllocAlignedBuffer(m_Length);
+    m_AlignedData = true;
   }
-
-  void FillBuffer()
+  else
   {
-    int32_t compSize = 0;
-
-    FileIO::fread(&compSize, sizeof(compSize), 1, m_F);
-    size_t numRead = FileIO::fread(m_CompressBuf, 1, compSize, m_F);
-
-    m_CompressedSize += compSize;
-
-    m_PageIdx = 1 - m_PageIdx;
-
-    int32_t decompSize = LZ4_decompress_safe_continue(
-        &m_LZ4Decomp, (const char *)m_CompressBuf, (char *)m_InPages[m_PageIdx], compSize, BlockSize);
-
-    if(decompSize < 0)
-    {
-      RDCERR("Error decompressing: %i (%i / %i)", decompSize, int(numRead), compSize);
-      return;
-    }
-
-    m_PageOffset = 0;
-    m_PageData = decompSize;
+    m_Data = new byte[m_Length];
+    m_AlignedData = false;
   }
 
-  static void Decompress(byte *destBuf, const byte *srcBuf, size_t len)
-  {
-    LZ4_streamDecode_t lz4;
-    LZ4_setStreamDecode(&lz4, NULL, 0);
-
-    const byte *srcBufEnd = srcBuf + len;
-
-    while(srcBuf + 4 < srcBufEnd)
-    {
-      const int32_t *compSize = (const int32_t *)srcBuf;
-      srcBuf = (const byte *)(compSize + 1);
-
-      if(srcBuf + *compSize > srcBufEnd)
-        break;
-
-      int32_t decompSize = LZ4_decompress_safe_continue(&lz4, (const char *)srcBuf, (char *)destBuf,
-                                                        *compSize, BlockSize);
-
-      if(decompSize < 0)
-        return;
+  memcpy(m_Data, ser->GetRawPtr(0), m_Length);
 
-      srcBuf += *compSize;
-      destBuf += decompSize;
-    }
-  }
+  if(ser->GetDebugText())
+    m_DebugStr = ser->GetDebugStr();
 
-  LZ4_stream_t m_LZ4Comp;
-  LZ4_streamDecode_t m_LZ4Decomp;
-  FILE *m_F;
-  uint32_t m_CompressedSize, m_UncompressedSize;
+  ser->TakeCallstackIDs(m_CallstackIDs);
 
-  byte m_InPages[2][BlockSize];
-  size_t m_PageIdx, m_PageOffset, m_PageData;
+  ser->Rewind();
 
-  byte *m_CompressBuf;
-  size_t m_CompressSize;
-};
+  TrackLiveChunk();
+}
 
-Chunk::Chunk(Serialiser *ser, uint32_t chunkType, bool temporary)
+Chunk::Chunk(ChunkStream *stream, uint32_t chunkType, bool temporary)
 {
-  m_Length = (uint32_t)ser->GetOffset();
+  m_Length = (uint32_t)stream->GetLength();
 
-  RDCASSERT(ser->GetOffset() < 0xffffffff);
+  RDCASSERT(stream->GetLength() < 0xffffffff);
 
   m_ChunkType = chunkType;
 
   m_Temporary = temporary;
 
-  if(ser->HasAlignedData())
+  if(stream->HasAlignedData())
   {
     m_Data = Serialiser::AllocAlignedBuffer(m_Length);
     m_AlignedData = true;
@@ -258,25 +103,13 @@ Chunk::Chunk(Serialiser *ser, uint32_t chunkType, bool temporary)
     m_AlignedData = false;
   }
 
-  memcpy(m_Data, ser->GetRawPtr(0), m_Length);
+  memcpy(m_Data, stream->GetData(), m_Length);
 
-  if(ser->GetDebugText())
-    m_DebugStr = ser->GetDebugStr();
-
-  ser->Rewind();
+  m_DebugStr = stream->GetDebugStr();
+  m_CallstackIDs = stream->GetCallstackIDs();
+  Serialiser::GetCaptureCallstacks().AddRefs(m_CallstackIDs);
 
-#if ENABLED(RDOC_DEVEL)
-  int64_t newval = Atomic::Inc64(&m_LiveChunks);
-  Atomic::ExchAdd64(&m_TotalMem, m_Length);
-
-  if(newval > m_MaxChunks)
-  {
-    int breakpointme = 0;
-    (void)breakpointme;
-  }
-
-  m_MaxChunks = RDCMAX(newval, m_MaxChunks);
-#endif
+  TrackLiveChunk();
 }
 
 Chunk *Chunk::Duplicate()
@@ -287,6 +120,8 @@ Chunk *Chunk::Duplicate()
   ret->m_ChunkType = m_ChunkType;
   ret->m_Temporary = m_Temporary;
   ret->m_AlignedData = m_AlignedData;
+  ret->m_CallstackIDs = m_CallstackIDs;
+  Serialiser::GetCaptureCallstacks().AddRefs(m_CallstackIDs);
 
   if(m_AlignedData)
     ret->m_Data = Serialiser::AllocAlignedBuffer(m_Length);
@@ -295,6 +130,13 @@ Chunk *Chunk::Duplicate()
 
   memcpy(ret->m_Data, m_Data, m_Length);
 
+  ret->TrackLiveChunk();
+
+  return ret;
+}
+
+void Chunk::TrackLiveChunk()
+{
 #if ENABLED(RDOC_DEVEL)
   int64_t newval = Atomic::Inc64(&m_LiveChunks);
   Atomic::ExchAdd64(&m_TotalMem, m_Length);
@@ -307,8 +149,6 @@ Chunk *Chunk::Duplicate()
 
   m_MaxChunks = RDCMAX(newval, m_MaxChunks);
 #endif
-
-  return ret;
 }
 
 Chunk::~Chunk()
@@ -329,6 +169,102 @@ Chunk::~Chunk()
   {
     SAFE_DELETE_ARRAY(m_Data);
   }
+
+  Serialiser::ReleaseCallstackIDs(m_CallstackIDs);
+}
+
+// most command buffers only record a handful of commands, so streams start small and grow
+// geometrically. Resetting keeps the memory for the re-recording, up to a limit, so that one huge
+// recording doesn't pin that much memory for as long as the command buffer lives.
+static const size_t ChunkStreamInitialCapacity = 4 * 1024;
+static const size_t ChunkStreamRetainedCapacity = 256 * 1024;
+
+ChunkStream::ChunkStream()
+{
+  m_Data = NULL;
+  m_Length = m_Capacity = 0;
+  m_AlignedData = false;
+}
+
+ChunkStream::~ChunkStream()
+{
+  Free();
+}
+
+void ChunkStream::Append(Serialiser *ser)
+{
+  size_t length = (size_t)ser->GetOffset();
+  bool aligned = ser->HasAlignedData();
+
+  // buffers in the chunk are aligned relative to its start, so it must start aligned within the
+  // stream. The stream as a whole is then aligned like any other chunk when written out
+  byte padding[Serialiser::BufferAlignment + 4];
+  size_t padLength = aligned ? Serialiser::MakePaddingChunk(m_Length, padding) : 0;
+
+  Reserve(m_Length + padLength + length);
+
+  memcpy(m_Data + m_Length, padding, padLength);
+  m_Length += padLength;
+
+  memcpy(m_Data + m_Length, ser->GetRawPtr(0), length);
+  m_Length += length;
+
+  m_AlignedData |= aligned;
+
+  if(ser->GetDebugText())
+    m_DebugStr += ser->GetDebugStr();
+
+  vector<uint32_t> ids;
+  ser->TakeCallstackIDs(ids);
+  m_CallstackIDs.insert(m_CallstackIDs.end(), ids.begin(), ids.end());
+
+  ser->Rewind();
+}
+
+void ChunkStream::Reset()
+{
+  m_Length = 0;
+  m_AlignedData = false;
+  m_DebugStr.clear();
+  Serialiser::ReleaseCallstackIDs(m_CallstackIDs);
+
+  if(m_Capacity > ChunkStreamRetainedCapacity)
+  {
+    Serialiser::FreeAlignedBuffer(m_Data);
+    m_Data = NULL;
+    m_Capacity = 0;
+  }
+}
+
+void ChunkStream::Free()
+{
+  Reset();
+
+  Serialiser::FreeAlignedBuffer(m_Data);
+  m_Data = NULL;
+  m_Capacity = 0;
+}
+
+void ChunkStream::Reserve(size_t length)
+{
+  if(length <= m_Capacity)
+    return;
+
+  // grow geometrically so appending stays amortised constant time
+  size_t capacity = RDCMAX(m_Capacity * 2, ChunkStreamInitialCapacity);
+  while(capacity < length)
+    capacity *= 2;
+
+  byte *data = Serialiser::AllocAlignedBuffer(capacity);
+
+  if(m_Data)
+  {
+    memcpy(data, m_Data, m_Length);
+    Serialiser::FreeAlignedBuffer(m_Data);
+  }
+
+  m_Data = data;
+  m_Capacity = capacity;
 }
 
 /*
@@ -437,7 +373,7 @@ struct BinarySectionHeader
   }
 
 Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
-    : m_pCallstack(NULL), m_pResolver(NULL), m_Buffer(NULL)
+    : m_pCallstack(NULL), m_pResolver(NULL), m_pCallstackTable(NULL), m_Buffer(NULL)
 {
   m_ResolverThread = 0;
 
@@ -533,7 +469,7 @@ Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
     m_Sections.push_back(frameCap);
     m_KnownSections[eSectionType_FrameCapture] = frameCap;
   }
-  else if(header->version == SERIALISE_VERSION)
+  else if(header->version == 0x00000032 || header->version == SERIALISE_VERSION)
   {
     memoryBuf += sizeof(FileHeader);
 
@@ -635,7 +571,7 @@ Serialiser::Serialiser(size_t length, const byte *memoryBuf, bool fileheader)
 }
 
 Serialiser::Serialiser(const char *path, Mode mode, bool debugMode, uint64_t sizeHint)
-    : m_pCallstack(NULL), m_pResolver(NULL), m_Buffer(NULL)
+    : m_pCallstack(NULL), m_pResolver(NULL), m_pCallstackTable(NULL), m_Buffer(NULL)
 {
   m_ResolverThread = 0;
 
@@ -742,7 +678,7 @@ Serialiser::Serialiser(const char *path, Mode mode, bool debugMode, uint64_t siz
       m_Sections.push_back(frameCap);
       m_KnownSections[eSectionType_FrameCapture] = frameCap;
     }
-    else if(header.version == SERIALISE_VERSION)
+    else if(header.version == 0x00000032 || header.version == SERIALISE_VERSION)
     {
       while(!FileIO::feof(m_ReadFileHandle))
       {
@@ -871,8 +807,11 @@ Serialiser::Serialiser(const char *path, Mode mode, bool debugMode, uint64_t siz
           m_Sections.push_back(sect);
 
           // if section isn't frame capture data and is small enough, read it all into memory now,
-          // otherwise skip
-          if(sect->type != eSectionType_FrameCapture && sectionHeader.sectionLength < 4 * 1024 * 1024)
+          // otherwise skip. The callstack table is always needed to decode chunks that have stacks
+          bool loadSection = sectionHeader.sectionLength < 4 * 1024 * 1024 ||
+                             sect->type == eSectionType_Callstacks;
+
+          if(sect->type != eSectionType_FrameCapture && loadSection)
           {
             sect->data.resize(sectionHeader.sectionLength);
             FileIO::fread(&sect->data[0], 1, sectionHeader.sectionLength, m_ReadFileHandle);
@@ -968,12 +907,15 @@ void Serialiser::Reset()
 
   SAFE_DELETE(m_pCallstack);
   SAFE_DELETE(m_pResolver);
+  SAFE_DELETE(m_pCallstackTable);
   if(m_Buffer)
   {
     FreeAlignedBuffer(m_Buffer);
     m_Buffer = NULL;
   }
 
+  m_SerVer = SERIALISE_VERSION;
+
   m_ChunkLookup = NULL;
 
   m_AlignedData = false;
@@ -1017,8 +959,11 @@ Serialiser::~Serialiser()
 
   m_Chunks.clear();
 
+  ReleaseCallstackIDs(m_CallstackIDs);
+
   SAFE_DELETE(m_pResolver);
   SAFE_DELETE(m_pCallstack);
+  SAFE_DELETE(m_pCallstackTable);
   if(m_Buffer)
   {
     FreeAlignedBuffer(m_Buffer);
@@ -1297,6 +1242,73 @@ void Serialiser::SetCallstack(uint64_t *levels, size_t numLevels)
   m_pCallstack->Set(levels, numLevels);
 }
 
+void Serialiser::SetCallstackID(uint32_t stackID)
+{
+  if(m_pCallstackTable == NULL)
+  {
+    m_pCallstackTable = new CallstackTable();
+
+    Section *s = m_KnownSections[eSectionType_Callstacks];
+    if(s && !s->data.empty())
+      m_pCallstackTable->Decode(&s->data[0], s->data.size());
+  }
+
+  // unknown IDs (e.g. from a stripped capture) just leave the event without a callstack
+  m_pCallstackTable->Lookup(stackID, m_CallstackAddrs);
+
+  SetCallstack(m_CallstackAddrs.empty() ? NULL : &m_CallstackAddrs[0], m_CallstackAddrs.size());
+}
+
+void Serialiser::SerialiseCallstack(const char *name)
+{
+  if(m_Mode >= WRITING)
+  {
+    Callstack::Stackwalk *call = Callstack::Collect();
+
+    uint32_t stackID = GetCaptureCallstacks().Intern(call->GetAddrs(), call->NumLevels());
+    Serialise(name, stackID);
+
+    m_CallstackIDs.push_back(stackID);
+
+    delete call;
+  }
+  else if(m_SerVer < 0x00000033)
+  {
+    // older captures stored the addresses inline
+    uint32_t numLevels = 0;
+    uint64_t *stack = NULL;
+
+    SerialisePODArray(name, stack, numLevels);
+
+    SetCallstack(stack, numLevels);
+
+    SAFE_DELETE_ARRAY(stack);
+  }
+  else
+  {
+    uint32_t stackID = 0;
+    Serialise(name, stackID);
+
+    SetCallstackID(stackID);
+  }
+}
+
+CallstackTable &Serialiser::GetCaptureCallstacks()
+{
+  // never destroyed, chunks can still be releasing their references during static destruction
+  static CallstackTable *table = new CallstackTable();
+  return *table;
+}
+
+void Serialiser::ReleaseCallstackIDs(vector<uint32_t> &ids)
+{
+  // only writing serialisers have any IDs, so replay never touches the capture's table
+  if(!ids.empty())
+    GetCaptureCallstacks().Release(ids);
+
+  ids.clear();
+}
+
 void Serialiser::CreateResolver(void *ths)
 {
   Serialiser *ser = (Serialiser *)ths;
@@ -1310,9 +1322,41 @@ void Serialiser::CreateResolver(void *ths)
                                              &ser->m_ResolverThreadKillSignal);
 }
 
+size_t Serialiser::MakePaddingChunk(uint64_t offs, byte *padding)
+{
+  if(offs == AlignUp(offs, BufferAlignment))
+    return 0;
+
+  // write a '0' chunk that indicates special behaviour
+  uint16_t chunkIdx = 0;
+  memcpy(padding, &chunkIdx, sizeof(chunkIdx));
+
+  // control byte 0 indicates padding
+  padding[2] = 0;
+
+  // then a byte indicating how much padding follows, so the padding starts after these 4 bytes
+  uint64_t start = offs + 4;
+  uint64_t alignedoffs = AlignUp(start, BufferAlignment);
+
+  RDCCOMPILE_ASSERT(BufferAlignment < 0x100,
+                    "Buffer alignment must be less than 256");    // with a byte at most
+                                                                  // indicating how many bytes
+                                                                  // to pad,
+  // this is our maximal representable alignment
+
+  uint8_t padLength = (alignedoffs - start) & 0xff;
+  padding[3] = padLength;
+
+  // we might have padded with the control bytes, so this can be empty
+  memset(padding + 4, 0, padLength);
+
+  return 4 + (size_t)padLength;
+}
+
 void Serialiser::FlushToDisk()
 {
   SCOPED_TIMER("File writing");
+  RDCTRACE_SCOPE("Serialiser::FlushToDisk");
 
   if(m_Filename != "" && !m_HasError && m_Mode == WRITING)
   {
@@ -1363,8 +1407,6 @@ void Serialiser::FlushToDisk()
     // write header
     FileIO::fwrite(&header, 1, sizeof(FileHeader), binFile);
 
-    static const byte padding[BufferAlignment] = {0};
-
     uint64_t compressedSizeOffset = 0;
     uint64_t uncompressedSizeOffset = 0;
 
@@ -1395,43 +1437,19 @@ void Serialiser::FlushToDisk()
     // track offset so we can add padding. The padding is relative
     // to the start of the decompressed buffer, so we start it from 0
     uint64_t offs = 0;
-    uint64_t alignedoffs = 0;
 
     // write frame capture contents
     for(size_t i = 0; i < m_Chunks.size(); i++)
     {
       Chunk *chunk = m_Chunks[i];
 
-      alignedoffs = AlignUp(offs, BufferAlignment);
-
-      if(offs != alignedoffs && chunk->IsAligned())
+      if(chunk->IsAligned())
       {
-        uint16_t chunkIdx = 0;    // write a '0' chunk that indicates special behaviour
-        fwriter.Write(&chunkIdx, sizeof(chunkIdx));
-        offs += sizeof(chunkIdx);
-
-        uint8_t controlByte = 0;    // control byte 0 indicates padding
-        fwriter.Write(&controlByte, sizeof(controlByte));
-        offs += sizeof(controlByte);
-
-        offs++;    // we will have to write out a byte indicating how much padding exists, so add 1
-        alignedoffs = AlignUp(offs, BufferAlignment);
+        byte padChunk[BufferAlignment + 4];
+        size_t padLength = MakePaddingChunk(offs, padChunk);
 
-        RDCCOMPILE_ASSERT(BufferAlignment < 0x100,
-                          "Buffer alignment must be less than 256");    // with a byte at most
-                                                                        // indicating how many bytes
-                                                                        // to pad,
-        // this is our maximal representable alignment
-
-        uint8_t padLength = (alignedoffs - offs) & 0xff;
-        fwriter.Write(&padLength, sizeof(padLength));
-
-        // we might have padded with the control bytes, so only write some bytes if we need to
-        if(padLength > 0)
-        {
-          fwriter.Write(padding, size_t(alignedoffs - offs));
-          offs += alignedoffs - offs;
-        }
+        fwriter.Write(padChunk, padLength);
+        offs += padLength;
       }
 
       fwriter.Write(chunk->GetData(), chunk->GetLength());
@@ -1467,6 +1485,9 @@ void Serialiser::FlushToDisk()
 
       RDCLOG("Compressed frame capture data from %u to %u", fwriter.GetUncompressedSize(),
              fwriter.GetCompressedSize());
+
+      RDCTRACE_COUNTER("Capture uncompressed bytes", fwriter.GetUncompressedSize());
+      RDCTRACE_COUNTER("Capture compressed bytes", fwriter.GetCompressedSize());
     }
 
     char *symbolDB = NULL;
@@ -1504,6 +1525,36 @@ void Serialiser::FlushToDisk()
       SAFE_DELETE_ARRAY(symbolDB);
     }
 
+    // write the unique callstacks that chunks refer to by ID
+    if(RenderDoc::Inst().GetCaptureOptions().CaptureCallstacks ||
+       RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws)
+    {
+      const char sectionName[] = "renderdoc/internal/callstacks";
+
+      // many chunks share the same stacks. The references stay with m_CallstackIDs
+      vector<uint32_t> stackIDs = m_CallstackIDs;
+      std::sort(stackIDs.begin(), stackIDs.end());
+      stackIDs.erase(std::unique(stackIDs.begin(), stackIDs.end()), stackIDs.end());
+
+      vector<byte> stacks;
+      uint32_t numFrames = GetCaptureCallstacks().Encode(stackIDs, stacks);
+
+      BinarySectionHeader section = {0};
+      section.isASCII = 0;                                // redundant but explicit
+      section.sectionNameLength = sizeof(sectionName);    // includes null terminator
+      section.sectionType = eSectionType_Callstacks;
+      section.sectionLength = (uint32_t)stacks.size();
+
+      FileIO::fwrite(&section, 1, offsetof(BinarySectionHeader, name), binFile);
+      FileIO::fwrite(sectionName, 1, sizeof(sectionName), binFile);
+      FileIO::fwrite(&stacks[0], 1, stacks.size(), binFile);
+
+      RDCLOG("Wrote %u unique callstack frames", numFrames);
+
+      // between captures is the natural point to free stacks that are no longer used
+      GetCaptureCallstacks().Reclaim();
+    }
+
     // write the machine identifier as an ASCII section
     {
       const char sectionName[] = "renderdoc/internal/machineid";
@@ -1574,8 +1625,6 @@ uint32_t Serialiser::PushContext(const char *name, const char *typeName, uint32_
            !RenderDoc::Inst().GetCaptureOptions().CaptureCallstacksOnlyDraws)
         {
           call = Callstack::Collect();
-
-          RDCASSERT(call->NumLevels() < 0xff);
         }
       }
 
@@ -1588,13 +1637,10 @@ uint32_t Serialiser::PushContext(const char *name, const char *typeName, uint32_
 
       if(call)
       {
-        uint8_t numLevels = call->NumLevels() & 0xff;
-        WriteFrom(numLevels);
+        uint32_t stackID = GetCaptureCallstacks().Intern(call->GetAddrs(), call->NumLevels());
+        WriteFrom(stackID);
 
-        if(call->NumLevels())
-        {
-          WriteBytes((byte *)call->GetAddrs(), sizeof(uint64_t) * numLevels);
-        }
+        m_CallstackIDs.push_back(stackID);
 
         SAFE_DELETE(call);
       }
@@ -1670,14 +1716,22 @@ uint32_t Serialiser::PushContext(const char *name, const char *typeName, uint32_
 
       if(m_Indent == 0)
       {
-        if(callstack)
+        if(callstack && m_SerVer < 0x00000033)
         {
+          // older captures stored the addresses inline
           uint8_t callLen = 0;
           ReadInto(callLen);
 
           uint64_t *calls = (uint64_t *)ReadBytes(callLen * sizeof(uint64_t));
           SetCallstack(calls, callLen);
         }
+        else if(callstack)
+        {
+          uint32_t stackID = 0;
+          ReadInto(stackID);
+
+          SetCallstackID(stackID);
+        }
         else
         {
           SetCallstack(NULL, 0);
@@ -1818,6 +1872,8 @@ void Serialiser::Insert(Chunk *chunk)
 {
   m_Chunks.push_back(chunk);
 
+  AddCallstackIDs(chunk->GetCallstackIDs());
+
   m_DebugText += chunk->GetDebugString();
 }
 
@@ -36,6 +36,7 @@
 #include "common/common.h"
 #include "os/os_specific.h"
 #include "replay/type_helpers.h"
+#include "serialise/callstack_table.h"
 
 using std::set;
 using std::string;
@@ -87,6 +88,7 @@ typedef const char *(*ChunkLookup)(uint32_t chunkType);
 
 class Serialiser;
 class ScopedContext;
+class ChunkStream;
 struct CompressedFileIO;
 
 // holds the memory, length and type for a given chunk, so that it can be
@@ -102,6 +104,7 @@ public:
   uint32_t GetChunkType() { return m_ChunkType; }
   bool IsAligned() { return m_AlignedData; }
   bool IsTemporary() { return m_Temporary; }
+  const vector<uint32_t> &GetCallstackIDs() { return m_CallstackIDs; }
 #if ENABLED(RDOC_DEVEL)
   static uint64_t NumLiveChunks() { return m_LiveChunks; }
   static uint64_t TotalMem() { return m_TotalMem; }
@@ -113,6 +116,9 @@ public:
   // grab current contents of the serialiser into this chunk
   Chunk(Serialiser *ser, uint32_t chunkType, bool temp);
 
+  // copy all the chunks appended to the stream into this chunk, to be written out together
+  Chunk(ChunkStream *stream, uint32_t chunkType, bool temp);
+
   Chunk *Duplicate();
 
 private:
@@ -123,6 +129,8 @@ private:
 
   friend class ScopedContext;
 
+  void TrackLiveChunk();
+
   bool m_AlignedData;
   bool m_Temporary;
 
@@ -132,11 +140,53 @@ private:
   byte *m_Data;
   string m_DebugStr;
 
+  // the callstacks this chunk refers to, see Serialiser::TakeCallstackIDs
+  vector<uint32_t> m_CallstackIDs;
+
 #if ENABLED(RDOC_DEVEL)
   static int64_t m_LiveChunks, m_MaxChunks, m_TotalMem;
 #endif
 };
 
+// accumulates any number of chunks back to back in one growable buffer, for records that produce
+// many small chunks that are only ever written out together and in order, like command buffers.
+// Appending copies the serialised data with no allocation per chunk, and the memory is kept when
+// the stream is reset so that a re-recording can reuse it, unless it grew unusually large.
+class ChunkStream
+{
+public:
+  ChunkStream();
+  ~ChunkStream();
+
+  // move the current contents of the serialiser onto the end of the stream, rewinding it
+  void Append(Serialiser *ser);
+
+  // empty the stream, keeping the memory for re-use if it's not too large
+  void Reset();
+  // empty the stream and release the memory
+  void Free();
+
+  bool IsEmpty() const { return m_Length == 0; }
+  size_t GetLength() const { return m_Length; }
+  const byte *GetData() const { return m_Data; }
+  bool HasAlignedData() const { return m_AlignedData; }
+  const string &GetDebugStr() const { return m_DebugStr; }
+  const vector<uint32_t> &GetCallstackIDs() const { return m_CallstackIDs; }
+private:
+  // no copy semantics
+  ChunkStream(const ChunkStream &);
+  ChunkStream &operator=(const ChunkStream &);
+
+  void Reserve(size_t length);
+
+  byte *m_Data;
+  size_t m_Length;
+  size_t m_Capacity;
+  bool m_AlignedData;
+  string m_DebugStr;
+  vector<uint32_t> m_CallstackIDs;
+};
+
 // this class has a few functions. It can be used to serialise chunks - on writing it enforces
 // that we only ever write a single chunk, then pull out the data into a Chunk class and erase
 // the contents of the serialiser ready to serialise the next (see the RDCASSERT at the start
@@ -186,13 +236,14 @@ public:
     eSectionType_MachineID,          // renderdoc/internal/machineid
     eSectionType_FrameBookmarks,     // renderdoc/ui/bookmarks
     eSectionType_Notes,              // renderdoc/ui/notes
+    eSectionType_Callstacks,         // renderdoc/internal/callstacks
     eSectionType_Num,
   };
 
   // version number of overall file format or chunk organisation. If the contents/meaning/order of
   // chunks have changed this does not need to be bumped, there are version numbers within each
   // API that interprets the stream that can be bumped.
-  static const uint64_t SERIALISE_VERSION = 0x00000032;
+  static const uint64_t SERIALISE_VERSION = 0x00000033;
   static const uint32_t MAGIC_HEADER;
 
   //////////////////////////////////////////
@@ -211,6 +262,7 @@ public:
   void SetUserData(void *userData) { m_pUserData = userData; }
   bool AtEnd() { return GetOffset() >= m_BufferSize; }
   bool HasAlignedData() { return m_AlignedData; }
+  const string &GetFilename() const { return m_Filename; }
   bool IsReading() const { return m_Mode == READING; }
   bool IsWriting() const { return !IsReading(); }
   uint64_t GetOffset() const
@@ -252,6 +304,7 @@ public:
   void Rewind()
   {
     m_DebugText = "";
+    ReleaseCallstackIDs(m_CallstackIDs);
     m_Indent = 0;
     m_AlignedData = false;
     SetOffset(0);
@@ -293,6 +346,32 @@ public:
   Callstack::StackResolver *GetCallstackResolver() { return m_pResolver; }
   void SetCallstack(uint64_t *levels, size_t numLevels);
 
+  // serialise the callstack for the current event. When writing this collects the current
+  // callstack and stores its ID in the capture's callstack table, when reading the stack becomes
+  // the last callstack.
+  void SerialiseCallstack(const char *name);
+
+  // the table that callstacks are interned into while capturing. It lives as long as the process,
+  // since chunks recorded before a capture starts can be written into it and refer to its IDs, and
+  // stacks that nothing refers to any more are reclaimed after each capture is written.
+  static CallstackTable &GetCaptureCallstacks();
+
+  // when writing, the IDs of the callstacks referenced by what's been serialised. They follow the
+  // data into chunks and then into the file serialiser, so only the stacks a capture uses are
+  // written out with it. Each holder owns a reference on its IDs: taking them moves the references,
+  // adding them takes new ones, and ReleaseCallstackIDs drops them.
+  void TakeCallstackIDs(vector<uint32_t> &ids)
+  {
+    ids.swap(m_CallstackIDs);
+    m_CallstackIDs.clear();
+  }
+  void AddCallstackIDs(const vector<uint32_t> &ids)
+  {
+    GetCaptureCallstacks().AddRefs(ids);
+    m_CallstackIDs.insert(m_CallstackIDs.end(), ids.begin(), ids.end());
+  }
+  static void ReleaseCallstackIDs(vector<uint32_t> &ids);
+
   uint64_t GetSavedMachineIdent()
   {
     Section *id = m_KnownSections[eSectionType_MachineID];
@@ -616,6 +695,8 @@ private:
 
   static void CreateResolver(void *ths);
 
+  void SetCallstackID(uint32_t stackID);
+
   // clean out for before constructor and after destructor (and other times probably)
   void Reset();
 
@@ -631,6 +712,12 @@ private:
 
   static const uint64_t BufferAlignment;
 
+  // fills out the special chunk that pads a stream of chunks at offs, so that the next chunk starts
+  // aligned. Returns the size of the padding chunk, which is 0 if no padding is needed
+  static size_t MakePaddingChunk(uint64_t offs, byte *padding);
+
+  friend class ChunkStream;
+
   //////////////////////////////////////////
 
   uint64_t m_SerVer;
@@ -647,6 +734,9 @@ private:
 
   Callstack::Stackwalk *m_pCallstack;
   Callstack::StackResolver *m_pResolver;
+  CallstackTable *m_pCallstackTable;
+  std::vector<uint64_t> m_CallstackAddrs;
+  vector<uint32_t> m_CallstackIDs;
   Threading::ThreadHandle m_ResolverThread;
   volatile bool m_ResolverThreadKillSignal;
 
@@ -741,6 +831,13 @@ public:
     return new Chunk(m_Ser, m_Idx, temporary);
   }
 
+  // append to the stream rather than allocating a chunk
+  void Append(ChunkStream *stream)
+  {
+    End();
+    stream->Append(m_Ser);
+  }
+
 private:
   uint32_t m_Idx;
   Serialiser *m_Ser;
@@ -47,6 +47,24 @@ uint32_t strhash(const char *str, uint32_t seed)
   return hash;
 }
 
+uint64_t hash64(const void *data, size_t len, uint64_t seed)
+{
+  if(data == NULL)
+    return seed;
+
+  const uint8_t *bytes = (const uint8_t *)data;
+
+  uint64_t hash = seed;
+
+  for(size_t i = 0; i < len; i++)
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
 string strlower(const string &str)
 {
   string newstr(str);
@@ -41,6 +41,9 @@ std::string trim(const std::string &str);
 
 uint32_t strhash(const char *str, uint32_t existingHash = 5381);
 
+// 64-bit FNV-1a over arbitrary bytes, for keys where a 32-bit collision isn't acceptable
+uint64_t hash64(const void *data, size_t len, uint64_t existingHash = 14695981039346656037ULL);
+
 template <class strType>
 strType basename(const strType &path)
 {
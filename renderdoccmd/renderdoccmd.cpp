@@ -26,7 +26,12 @@
 #include "renderdoccmd.h"
 #include <app/renderdoc_app.h>
 #include <replay/renderdoc_replay.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 
 using std::string;
 using std::wstring;
@@ -542,6 +547,507 @@ struct ReplayCommand : public Command
   }
 };
 
+// Writes buffers out to disk on a set of background threads, so the replay thread only has to
+// fetch the data before moving on to the next event.
+class ExportFileWriter
+{
+public:
+  ExportFileWriter(uint32_t numThreads)
+  {
+    for(uint32_t i = 0; i < numThreads; i++)
+      m_Threads.push_back(std::thread(&ExportFileWriter::ThreadEntry, this));
+  }
+
+  ~ExportFileWriter() { Finish(); }
+  void Write(const std::string &path, const rdctype::array<byte> &data)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_Lock);
+      m_Queue.push_back(Job());
+      m_Queue.back().path = path;
+      m_Queue.back().data.assign(data.elems, data.elems + data.count);
+    }
+    m_Cond.notify_one();
+  }
+
+  // waits for all queued writes to complete, and stops the threads
+  void Finish()
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_Lock);
+      m_Shutdown = true;
+    }
+    m_Cond.notify_all();
+
+    for(size_t i = 0; i < m_Threads.size(); i++)
+      m_Threads[i].join();
+    m_Threads.clear();
+  }
+
+  uint32_t GetFailures() { return m_Failures; }
+  uint64_t GetBytesWritten() { return m_BytesWritten; }
+  // summed across all threads, so can be longer than the wall-clock time spent
+  double GetWriteMS() { return m_WriteMS; }
+private:
+  struct Job
+  {
+    std::string path;
+    std::vector<byte> data;
+  };
+
+  void ThreadEntry()
+  {
+    for(;;)
+    {
+      Job job;
+
+      {
+        std::unique_lock<std::mutex> lock(m_Lock);
+
+        while(m_Queue.empty() && !m_Shutdown)
+          m_Cond.wait(lock);
+
+        if(m_Queue.empty())
+          return;
+
+        job.path.swap(m_Queue.front().path);
+        job.data.swap(m_Queue.front().data);
+        m_Queue.pop_front();
+      }
+
+      auto start = std::chrono::high_resolution_clock::now();
+
+      bool success = false;
+
+      FILE *f = fopen(job.path.c_str(), "wb");
+      if(f)
+      {
+        size_t size = job.data.size();
+        success = size == 0 || fwrite(&job.data[0], 1, size, f) == size;
+        success = (fclose(f) == 0) && success;
+      }
+
+      std::chrono::duration<double, std::milli> duration =
+          std::chrono::high_resolution_clock::now() - start;
+
+      std::unique_lock<std::mutex> lock(m_Lock);
+
+      m_WriteMS += duration.count();
+
+      if(success)
+      {
+        m_BytesWritten += job.data.size();
+      }
+      else
+      {
+        std::cerr << "Couldn't write '" << job.path << "'" << std::endl;
+        m_Failures++;
+      }
+    }
+  }
+
+  std::vector<std::thread> m_Threads;
+  std::mutex m_Lock;
+  std::condition_variable m_Cond;
+  std::deque<Job> m_Queue;
+  bool m_Shutdown = false;
+
+  uint32_t m_Failures = 0;
+  uint64_t m_BytesWritten = 0;
+  double m_WriteMS = 0.0;
+};
+
+struct ExportCommand : public Command
+{
+  virtual void AddOptions(cmdline::parser &parser)
+  {
+    parser.set_footer("<capture.rdc>");
+    parser.add<string>("out", 'o', "The directory to save the outputs to. It must already exist.",
+                       true);
+    parser.add<string>("events", 'e',
+                       "The events to export at: 'last' for the final drawcall, 'all' for every "
+                       "drawcall, dispatch and clear, or a comma-separated list of event IDs and "
+                       "ranges e.g. '10,20-30'.",
+                       false, "last");
+    parser.add<string>("outputs", 0,
+                       "Comma-separated list of what to export at each event, from 'color', "
+                       "'depth' and 'buffers' (the bound vertex and index buffers).",
+                       false, "color,depth");
+    parser.add<string>("format", 'f', "The file format to save textures as.", false, "png",
+                       cmdline::oneof<string>("png", "dds", "exr", "hdr", "jpg", "bmp", "tga"));
+    parser.add<uint32_t>("threads", 'j',
+                         "The number of threads writing files. Default is 0, one per core.", false,
+                         0);
+  }
+  virtual const char *Description()
+  {
+    return "Replays a capture and saves render targets and buffers at chosen events.";
+  }
+  virtual bool IsInternalOnly() { return false; }
+  virtual bool IsCaptureCommand() { return false; }
+  virtual int Execute(cmdline::parser &parser, const CaptureOptions &)
+  {
+    if(parser.rest().empty())
+    {
+      std::cerr << "Error: export command requires a capture filename." << std::endl
+                << std::endl
+                << parser.usage();
+      return 0;
+    }
+
+    string filename = parser.rest()[0];
+    string outdir = parser.get<string>("out");
+    string format = parser.get<string>("format");
+
+    if(!outdir.empty() && outdir.back() != '/' && outdir.back() != '\\')
+      outdir += '/';
+
+    bool exportColor = false, exportDepth = false, exportBuffers = false;
+
+    std::vector<string> outputs = split(parser.get<string>("outputs"));
+    for(size_t i = 0; i < outputs.size(); i++)
+    {
+      if(outputs[i] == "color" || outputs[i] == "colour")
+      {
+        exportColor = true;
+      }
+      else if(outputs[i] == "depth")
+      {
+        exportDepth = true;
+      }
+      else if(outputs[i] == "buffers")
+      {
+        exportBuffers = true;
+      }
+      else
+      {
+        std::cerr << "Error: unknown output '" << outputs[i] << "'." << std::endl;
+        return 1;
+      }
+    }
+
+    TextureSave save = TextureSave();
+    save.destType = FileTypeFromString(format);
+    save.mip = 0;
+    save.comp.blackPoint = 0.0f;
+    save.comp.whitePoint = 1.0f;
+    save.sample.mapToArray = false;
+    save.sample.sampleIndex = ~0U;
+    save.slice.sliceIndex = 0;
+    save.channelExtract = -1;
+    save.alpha = eAlphaMap_Preserve;
+    save.jpegQuality = 90;
+
+    uint32_t numThreads = parser.get<uint32_t>("threads");
+    if(numThreads == 0)
+      numThreads = std::max(1U, std::thread::hardware_concurrency());
+
+    Timer total;
+    Timer stage;
+
+    std::cout << "Replaying '" << filename << "' locally.." << std::endl;
+
+    float progress = 0.0f;
+    ReplayRenderer *renderer = NULL;
+    ReplayCreateStatus status =
+        RENDERDOC_CreateReplayRenderer(filename.c_str(), &progress, &renderer);
+
+    if(status != eReplayCreate_Success)
+    {
+      std::cerr << "Couldn't load and replay '" << filename << "'." << std::endl;
+      return 1;
+    }
+
+    double openMS = stage.Restart();
+
+    rdctype::array<FetchDrawcall> draws;
+    renderer->GetDrawcalls(&draws);
+
+    std::vector<const FetchDrawcall *> events;
+    if(!SelectEvents(parser.get<string>("events"), draws, events))
+    {
+      renderer->Shutdown();
+      return 1;
+    }
+
+    double selectMS = stage.Restart();
+
+    GraphicsAPI api = renderer->GetAPIProperties().pipelineType;
+
+    ExportFileWriter writer(numThreads);
+
+    double replayMS = 0.0, textureMS = 0.0, bufferMS = 0.0;
+    uint32_t numTextures = 0, numBuffers = 0, textureFailures = 0;
+
+    const char *ext = format.c_str();
+
+    for(size_t e = 0; e < events.size(); e++)
+    {
+      const FetchDrawcall &draw = *events[e];
+
+      string prefix = outdir + ToStr(draw.eventID) + "_";
+
+      stage.Restart();
+
+      renderer->SetFrameEvent(draw.eventID, true);
+
+      replayMS += stage.Restart();
+
+      // SaveTexture needs the replay thread for the readback, but spreads its own encoding work
+      // across cores.
+      for(int i = 0; exportColor && i < 8; i++)
+      {
+        if(draw.outputs[i] == ResourceId())
+          continue;
+
+        save.id = draw.outputs[i];
+        save.typeHint = eCompType_None;
+
+        string path = prefix + "color" + ToStr((uint32_t)i) + "." + ext;
+        if(renderer->SaveTexture(save, path.c_str()))
+          numTextures++;
+        else
+          textureFailures++;
+      }
+
+      if(exportDepth && draw.depthOut != ResourceId())
+      {
+        save.id = draw.depthOut;
+        save.typeHint = eCompType_Depth;
+
+        string path = prefix + "depth." + ext;
+        if(renderer->SaveTexture(save, path.c_str()))
+          numTextures++;
+        else
+          textureFailures++;
+      }
+
+      textureMS += stage.Restart();
+
+      if(exportBuffers && (draw.flags & eDraw_Drawcall))
+      {
+        std::vector<ResourceId> vbs;
+        ResourceId ib;
+        GetBoundBuffers(renderer, api, vbs, ib);
+
+        rdctype::array<byte> data;
+
+        for(size_t i = 0; i < vbs.size(); i++)
+        {
+          if(vbs[i] == ResourceId())
+            continue;
+
+          renderer->GetBufferData(vbs[i], 0, 0, &data);
+          writer.Write(prefix + "vb" + ToStr((uint32_t)i) + ".bin", data);
+          numBuffers++;
+        }
+
+        if(ib != ResourceId())
+        {
+          renderer->GetBufferData(ib, 0, 0, &data);
+          writer.Write(prefix + "ib.bin", data);
+          numBuffers++;
+        }
+      }
+
+      bufferMS += stage.Restart();
+    }
+
+    renderer->Shutdown();
+
+    double shutdownMS = stage.Restart();
+
+    writer.Finish();
+
+    double drainMS = stage.Restart();
+
+    if(textureFailures > 0)
+      std::cerr << "Failed to save " << textureFailures << " texture(s)." << std::endl;
+
+    std::cout << "Exported " << numTextures << " textures and " << numBuffers
+              << " buffers at " << events.size() << " events in " << total.Restart() << " ms"
+              << std::endl;
+    std::cout << "  open capture:     " << openMS << " ms" << std::endl;
+    std::cout << "  select events:    " << selectMS << " ms" << std::endl;
+    std::cout << "  replay events:    " << replayMS << " ms" << std::endl;
+    std::cout << "  save textures:    " << textureMS << " ms" << std::endl;
+    std::cout << "  fetch buffers:    " << bufferMS << " ms" << std::endl;
+    std::cout << "  shutdown:         " << shutdownMS << " ms" << std::endl;
+    std::cout << "  finish writes:    " << drainMS << " ms (" << writer.GetBytesWritten()
+              << " bytes, " << writer.GetWriteMS() << " ms across " << numThreads << " threads)"
+              << std::endl;
+
+    return (textureFailures > 0 || writer.GetFailures() > 0) ? 1 : 0;
+  }
+
+  struct Timer
+  {
+    typedef std::chrono::high_resolution_clock clock;
+
+    Timer() : start(clock::now()) {}
+    // returns the milliseconds since the timer was last started, and starts it again
+    double Restart()
+    {
+      clock::time_point now = clock::now();
+      std::chrono::duration<double, std::milli> duration = now - start;
+      start = now;
+      return duration.count();
+    }
+    clock::time_point start;
+  };
+
+  static string ToStr(uint32_t val)
+  {
+    char str[16];
+    snprintf(str, sizeof(str), "%u", val);
+    return str;
+  }
+
+  static std::vector<string> split(const string &in)
+  {
+    std::vector<string> ret;
+
+    size_t begin = 0;
+    while(begin <= in.size())
+    {
+      size_t end = in.find(',', begin);
+      if(end == string::npos)
+        end = in.size();
+
+      if(end > begin)
+        ret.push_back(in.substr(begin, end - begin));
+
+      begin = end + 1;
+    }
+
+    return ret;
+  }
+
+  static FileType FileTypeFromString(const string &format)
+  {
+    if(format == "dds")
+      return eFileType_DDS;
+    if(format == "exr")
+      return eFileType_EXR;
+    if(format == "hdr")
+      return eFileType_HDR;
+    if(format == "jpg")
+      return eFileType_JPG;
+    if(format == "bmp")
+      return eFileType_BMP;
+    if(format == "tga")
+      return eFileType_TGA;
+    return eFileType_PNG;
+  }
+
+  static void FlattenDrawcalls(const rdctype::array<FetchDrawcall> &draws,
+                               std::vector<const FetchDrawcall *> &flat)
+  {
+    for(int32_t i = 0; i < draws.count; i++)
+    {
+      const FetchDrawcall &d = draws[i];
+
+      if(d.flags & (eDraw_Drawcall | eDraw_Dispatch | eDraw_Clear))
+        flat.push_back(&d);
+
+      FlattenDrawcalls(d.children, flat);
+    }
+  }
+
+  static bool SelectEvents(const string &spec, const rdctype::array<FetchDrawcall> &draws,
+                           std::vector<const FetchDrawcall *> &events)
+  {
+    std::vector<const FetchDrawcall *> flat;
+    FlattenDrawcalls(draws, flat);
+
+    if(spec == "all")
+    {
+      events.swap(flat);
+      return true;
+    }
+
+    if(spec == "last")
+    {
+      for(size_t i = flat.size(); i > 0; i--)
+      {
+        if(flat[i - 1]->flags & eDraw_Drawcall)
+        {
+          events.push_back(flat[i - 1]);
+          return true;
+        }
+      }
+
+      std::cerr << "Error: capture contains no drawcalls." << std::endl;
+      return false;
+    }
+
+    std::vector<string> ranges = split(spec);
+    for(size_t r = 0; r < ranges.size(); r++)
+    {
+      uint32_t first = 0, last = 0;
+      char dash = 0;
+      int parsed = sscanf(ranges[r].c_str(), "%u%c%u", &first, &dash, &last);
+
+      if(parsed == 1)
+        last = first;
+
+      if((parsed != 1 && parsed != 3) || (parsed == 3 && dash != '-') || last < first)
+      {
+        std::cerr << "Error: invalid event range '" << ranges[r] << "'." << std::endl;
+        return false;
+      }
+
+      size_t count = events.size();
+
+      for(size_t i = 0; i < flat.size(); i++)
+        if(flat[i]->eventID >= first && flat[i]->eventID <= last)
+          events.push_back(flat[i]);
+
+      if(events.size() == count)
+        std::cerr << "Warning: no drawcalls in event range '" << ranges[r] << "'." << std::endl;
+    }
+
+    return true;
+  }
+
+  static void GetBoundBuffers(ReplayRenderer *renderer, GraphicsAPI api,
+                              std::vector<ResourceId> &vbs, ResourceId &ib)
+  {
+    if(api == eGraphicsAPI_D3D11)
+    {
+      D3D11PipelineState state;
+      renderer->GetD3D11PipelineState(&state);
+      for(int32_t i = 0; i < state.m_IA.vbuffers.count; i++)
+        vbs.push_back(state.m_IA.vbuffers[i].Buffer);
+      ib = state.m_IA.ibuffer.Buffer;
+    }
+    else if(api == eGraphicsAPI_D3D12)
+    {
+      D3D12PipelineState state;
+      renderer->GetD3D12PipelineState(&state);
+      for(int32_t i = 0; i < state.m_IA.vbuffers.count; i++)
+        vbs.push_back(state.m_IA.vbuffers[i].Buffer);
+      ib = state.m_IA.ibuffer.Buffer;
+    }
+    else if(api == eGraphicsAPI_OpenGL)
+    {
+      GLPipelineState state;
+      renderer->GetGLPipelineState(&state);
+      for(int32_t i = 0; i < state.m_VtxIn.vbuffers.count; i++)
+        vbs.push_back(state.m_VtxIn.vbuffers[i].Buffer);
+      ib = state.m_VtxIn.ibuffer;
+    }
+    else if(api == eGraphicsAPI_Vulkan)
+    {
+      VulkanPipelineState state;
+      renderer->GetVulkanPipelineState(&state);
+      for(int32_t i = 0; i < state.VI.vbuffers.count; i++)
+        vbs.push_back(state.VI.vbuffers[i].buffer);
+      ib = state.IA.ibuffer.buf;
+    }
+  }
+};
+
 struct CapAltBitCommand : public Command
 {
   virtual void AddOptions(cmdline::parser &parser)
@@ -678,6 +1184,7 @@ int renderdoccmd(std::vector<std::string> &argv)
     add_command("inject", new InjectCommand());
     add_command("remoteserver", new RemoteServerCommand());
     add_command("replay", new ReplayCommand());
+    add_command("export", new ExportCommand());
     add_command("capaltbit", new CapAltBitCommand());
 
     if(argv.size() <= 1)
@@ -754,6 +1261,9 @@ int renderdoccmd(std::vector<std::string> &argv)
               "Capturing Option: Save all initial resource contents at frame start.");
       cmd.add("opt-capture-all-cmd-lists", 0,
               "Capturing Option: In D3D11, record all command lists from application start.");
+      cmd.add<string>("opt-callstack-unwinder", 0,
+                      "Capturing Option: How CPU callstacks are collected on Linux.", false,
+                      "system", cmdline::oneof<string>("system", "framepointers", "ehframe"));
     }
 
     cmd.parse_check(argv, true);
@@ -787,6 +1297,12 @@ int renderdoccmd(std::vector<std::string> &argv)
         opts.CaptureAllCmdLists = true;
 
       opts.DelayForDebugger = (uint32_t)cmd.get<int>("opt-delay-for-debugger");
+
+      string unwinder = cmd.get<string>("opt-callstack-unwinder");
+      if(unwinder == "framepointers")
+        opts.CallstackUnwinder = 1;
+      else if(unwinder == "ehframe")
+        opts.CallstackUnwinder = 2;
     }
 
     if(cmd.exist("help"))